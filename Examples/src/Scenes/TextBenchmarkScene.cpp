@@ -0,0 +1,94 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include "Scenes/TextBenchmarkScene.hpp"
+
+#include <Mountain/Graphics/Draw.hpp>
+#include <Mountain/Resource/ResourceManager.hpp>
+#include <Mountain/Utils/ImGuiUtils.hpp>
+#include <Mountain/Utils/Stopwatch.hpp>
+
+TextBenchmarkScene::TextBenchmarkScene()
+    : Base{"Text Benchmark"}
+{
+}
+
+void TextBenchmarkScene::LoadPersistentResources()
+{
+    TestScene::LoadPersistentResources();
+
+    m_Font = ResourceManager::GetFont(Utils::GetBuiltinAssetsPath() + "font.ttf", 12);
+}
+
+void TextBenchmarkScene::Begin()
+{
+    TestScene::Begin();
+
+    GenerateLines();
+    ResetSamples();
+}
+
+void TextBenchmarkScene::Render()
+{
+    TestScene::Render();
+
+    // Flush everything drawn before so that only the text is measured
+    Draw::Flush();
+
+    const f32 lineHeight = m_Font->CalcTextSize("A").y * m_Scale;
+
+    const Stopwatch stopwatch = Stopwatch::StartNew();
+
+    for (usize i = 0; i < m_Lines.GetSize(); i++)
+        Draw::Text(*m_Font, m_Lines[i], Vector2{0.f, static_cast<f32>(i) * lineHeight}, m_Scale);
+
+    Draw::Flush();
+
+    m_LastFrameTime = stopwatch.GetElapsedMilliseconds();
+    m_TotalFrameTime += m_LastFrameTime;
+    m_SampleCount++;
+}
+
+void TextBenchmarkScene::RenderImGui()
+{
+    TestScene::RenderImGui();
+
+    bool changed = false;
+    changed |= ImGui::DragInt("Line count", &m_LineCount, 1.f, 1, 1000);
+    changed |= ImGui::DragInt("Line length", &m_LineLength, 1.f, 1, 1000);
+    ImGui::DragFloat("Scale", &m_Scale, 0.01f, 0.1f, 10.f);
+
+    if (changed)
+    {
+        GenerateLines();
+        ResetSamples();
+    }
+
+    ImGui::Text("Glyphs per frame: %d", m_LineCount * m_LineLength);
+    ImGui::Text("Last frame: %.3fms", m_LastFrameTime);
+    ImGui::Text("Average: %.3fms over %zu frames", m_SampleCount == 0 ? 0.0 : m_TotalFrameTime / static_cast<f64>(m_SampleCount), m_SampleCount);
+
+    if (ImGui::Button("Reset"))
+        ResetSamples();
+}
+
+void TextBenchmarkScene::GenerateLines()
+{
+    m_Lines.Clear();
+
+    for (s32 i = 0; i < m_LineCount; i++)
+    {
+        std::string& line = m_Lines.Emplace();
+        line.reserve(static_cast<usize>(m_LineLength));
+
+        // Cycle through the printable ASCII characters
+        for (s32 j = 0; j < m_LineLength; j++)
+            line += static_cast<char>(' ' + (i + j) % ('~' - ' ' + 1));
+    }
+}
+
+void TextBenchmarkScene::ResetSamples()
+{
+    m_LastFrameTime = 0.0;
+    m_TotalFrameTime = 0.0;
+    m_SampleCount = 0;
+}
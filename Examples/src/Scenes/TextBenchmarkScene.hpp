@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#include "Scenes/TestScene.hpp"
+
+/// @brief Draws a large amount of text each frame and measures the CPU time spent submitting and flushing it
+class TextBenchmarkScene : public TestScene
+{
+public:
+    using Base = TestScene;
+
+    TextBenchmarkScene();
+
+    void LoadPersistentResources() override;
+
+    void Begin() override;
+
+    void Render() override;
+
+    void RenderImGui() override;
+
+private:
+    Pointer<Font> m_Font;
+
+    s32 m_LineCount = 100;
+    s32 m_LineLength = 100;
+    f32 m_Scale = 1.f;
+
+    List<std::string> m_Lines;
+
+    f64 m_LastFrameTime = 0.0;
+    f64 m_TotalFrameTime = 0.0;
+    usize m_SampleCount = 0;
+
+    void GenerateLines();
+    void ResetSamples();
+};
@@ -20,6 +20,7 @@
 #include "Scenes/PostProcessingEffectsScene.hpp"
 #include "Scenes/ShapesScene.hpp"
 #include "Scenes/SpriteAnimationsScene.hpp"
+#include "Scenes/TextBenchmarkScene.hpp"
 
 using namespace Mountain;
 
@@ -39,7 +40,8 @@ TestGame::TestGame(const c8* const windowTitle)
         new PostProcessingEffectsScene,
         new SpriteAnimationsScene,
         new AudioScene,
-        new ShapesScene
+        new ShapesScene,
+        new TextBenchmarkScene
     );
 
     // Sort the scenes alphabetically
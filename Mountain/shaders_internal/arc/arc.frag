@@ -1,8 +1,9 @@
-#version 460
+#version 450
 
 layout(origin_upper_left) in vec4 gl_FragCoord;
 
 #include "../utils.glsl"
+#include "../frame.glsl"
 
 in flat vec2 center;
 in flat vec2 size;
@@ -12,8 +13,6 @@ in flat float thickness;
 in flat vec4 color;
 in flat int filled;
 
-uniform vec2 cameraScale;
-
 out vec4 fragmentColor;
 
 void main()
@@ -1,8 +1,9 @@
-#version 460
+#version 450
 
 layout(origin_upper_left) in vec4 gl_FragCoord;
 
 #include "../utils.glsl"
+#include "../frame.glsl"
 
 in vec2 center;
 in vec2 size;
@@ -11,8 +12,6 @@ in vec2 scale;
 in vec4 color;
 in flat int filled;
 
-uniform vec2 cameraScale;
-
 out vec4 fragmentColor;
 
 void main()
@@ -1,4 +1,6 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout (location = 0) in vec2 vertexPosition;
 layout (location = 1) in mat4 transformation;
@@ -9,11 +11,6 @@ layout (location = 8) in vec2 instanceScale;
 layout (location = 9) in vec4 instanceColor;
 layout (location = 10) in int instanceFilled;
 
-uniform mat4 projection;
-uniform mat4 camera;
-
-uniform vec2 cameraScale;
-
 out vec2 center;
 out vec2 size;
 out float thickness;
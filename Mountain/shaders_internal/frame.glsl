@@ -0,0 +1,8 @@
+// Per-frame data shared by all the internal shaders, updated by the Draw class when the camera changes
+layout (std140, binding = 0) uniform Frame
+{
+    mat4 projection; // Projection matrix multiplied by the camera matrix
+    mat4 camera;
+    vec2 cameraScale;
+    float time; // Total time in seconds
+};
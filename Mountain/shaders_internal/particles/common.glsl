@@ -10,9 +10,9 @@ struct Particle
     vec4 color;
 };
 
-layout(std430, binding = 0) coherent buffer AliveParticles
+layout(std430, binding = 0) buffer AliveParticles
 {
-    bool liveParticles[]; // true if the particle is alive and should be updated and drawn
+    uint aliveParticles[]; // Indices in particles of the living particles, in no particular order
 };
 
 layout(std430, binding = 1) buffer Particles
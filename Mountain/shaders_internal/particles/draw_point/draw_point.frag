@@ -1,8 +1,7 @@
-#version 460
+#version 450
 
 in VertexOut
 {
-    flat int particleAlive;
     flat vec4 particleColor;
 } shaderIn;
 
@@ -10,8 +9,5 @@ out vec4 outFragmentColor;
 
 void main()
 {
-    if (shaderIn.particleAlive == 0)
-        discard;
-
     outFragmentColor = shaderIn.particleColor;
 }
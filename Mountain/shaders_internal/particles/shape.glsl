@@ -53,7 +53,7 @@ uniform struct Shape
 
 void ShapeInitialize(inout Particle particle)
 {
-    float id = float(gl_GlobalInvocationID.x) / float(gl_NumWorkGroups.x);
+    float id = float(gl_GlobalInvocationID.x) / float(particleCount);
     vec2 randomSeed = vec2(id, fract(time * 0.1f));
 
     switch (shape.type)
@@ -0,0 +1,101 @@
+#include "../utils.glsl"
+#include "common.glsl"
+#include "module_types.glsl"
+
+// The particle lists work like this each frame:
+// - update.comp goes through aliveParticles, moves the particles that died to deadParticles and the others to nextAliveParticles
+// - emit.comp computes how many particles to spawn and takes their indices from the end of deadParticles
+// - spawn.comp initializes these particles and adds them to nextAliveParticles
+// - finish.comp makes nextAliveParticles the new list of living particles and writes the indirect commands of the next frame
+// The CPU swaps the buffers bound to aliveParticles and nextAliveParticles after each frame, so it never reads anything back
+
+layout(std430, binding = 2) buffer NextAliveParticles
+{
+    uint nextAliveParticles[];
+};
+
+layout(std430, binding = 3) buffer DeadParticles
+{
+    uint deadParticles[]; // Indices in particles of the free slots
+};
+
+layout(std430, binding = 4) buffer Counters
+{
+    uint aliveCount; // Size of aliveParticles
+    uint nextAliveCount; // Size of nextAliveParticles
+    uint deadCount; // Size of deadParticles
+    uint spawnCount; // Number of particles to spawn this frame, taken from the end of deadParticles
+    float spawnTimer; // Time left before spawning the next particle emitted over time
+};
+
+layout(std430, binding = 5) buffer IndirectCommands
+{
+    uint updateDispatch[3]; // Work group counts of update.comp
+    uint spawnDispatch[3]; // Work group counts of spawn.comp
+    uint drawVertexCount;
+    uint drawInstanceCount; // Number of particles drawn
+    uint drawFirst;
+    uint drawBaseInstance;
+};
+
+const uint WorkGroupSize = 64;
+
+uniform float time;
+
+#include "shape.glsl"
+#include "velocity_over_lifetime.glsl"
+#include "force_over_lifetime.glsl"
+#include "color_over_lifetime.glsl"
+#include "color_by_speed.glsl"
+
+uniform uint enabledModules;
+
+const vec2 particleDefaultStartVelocity = vec2(0.f, -1.f);
+const vec2 particleDefaultOffset = vec2(0.f);
+const vec2 particleDefaultVelocity = vec2(0.f);
+
+uint WorkGroupCount(in uint invocations)
+{
+    return (invocations + WorkGroupSize - 1) / WorkGroupSize;
+}
+
+Particle NewParticle()
+{
+    Particle result = Particle(
+        particleLifetime,
+        particleStartSize,
+        particleDefaultStartVelocity,
+        particleDefaultOffset,
+        particleDefaultVelocity,
+        particleStartColor
+    );
+
+    if ((enabledModules & ModuleTypesShape) != 0)
+        ShapeInitialize(result);
+
+    result.startVelocity *= particleSpeed;
+
+    return result;
+}
+
+void UpdateParticle(inout Particle particle)
+{
+    particle.lifetime -= deltaTime;
+
+    particle.color = particleStartColor;
+    particle.size = particleStartSize;
+    vec2 velocity = particle.startVelocity;
+
+    // Modules updates
+    if ((enabledModules & ModuleTypesVelocityOverLifetime) != 0)
+        VelocityOverLifetimeUpdate(particle, velocity);
+    if ((enabledModules & ModuleTypesForceOverLifetime) != 0)
+        ForceOverLifetimeUpdate(particle, particle.accumulatedVelocity);
+    if ((enabledModules & ModuleTypesColorOverLifetime) != 0)
+        ColorOverLifetimeUpdate(particle);
+    if ((enabledModules & ModuleTypesColorBySpeed) != 0)
+        ColorBySpeedUpdate(particle, SquaredLength(velocity));
+
+    velocity += particle.accumulatedVelocity;
+    particle.offset += velocity * deltaTime;
+}
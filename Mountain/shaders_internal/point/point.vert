@@ -1,10 +1,10 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout(location = 0) in vec2 position;
 layout(location = 1) in vec4 instanceColor;
 
-uniform mat4 projection;
-
 out vec4 color;
 
 void main()
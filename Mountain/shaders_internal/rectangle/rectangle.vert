@@ -1,11 +1,11 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout (location = 0) in vec2 basePosition;
 layout (location = 1) in mat4 transformation;
 layout (location = 5) in vec4 instanceColor;
 
-uniform mat4 projection;
-
 out vec4 color;
 
 void main()
@@ -1,4 +1,6 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 struct LightSource
 {
@@ -13,7 +15,6 @@ struct LightSource
 in vec2 textureCoordinates;
 in vec2 fragmentPosition;
 
-uniform mat4 camera;
 uniform vec2 scale; // RenderTarget scale
 uniform vec2 actualScale; // RenderTarget scale * Camera scale
 
@@ -1,8 +1,8 @@
-#version 460
+#version 450
 
-layout (location = 0) in vec2 vertexPosition;
+#include "../frame.glsl"
 
-uniform mat4 projection;
+layout (location = 0) in vec2 vertexPosition;
 
 uniform mat4 transformation;
 uniform mat4 uvProjection;
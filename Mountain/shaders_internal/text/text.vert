@@ -1,14 +1,20 @@
-#version 460
+#version 450
 
-layout (location = 0) in vec4 vertex; // vec2 position, vec2 textureCoordinates
+#include "../frame.glsl"
 
-uniform mat4 projection;
+layout (location = 0) in vec2 vertexPosition;
+layout (location = 1) in vec4 glyphRectangle; // vec2 position, vec2 size
+layout (location = 2) in vec4 glyphUv; // vec2 uv0, vec2 uv1
+layout (location = 3) in vec4 glyphColor;
 
 out vec2 textureCoordinates;
+out vec4 color;
 
 void main()
 {
-    textureCoordinates = vertex.zw;
-    
-    gl_Position = vec4((projection * vec4(vertex.xy, 0.f, 1.f)).xy, 0.f, 1.f);
+    textureCoordinates = mix(glyphUv.xy, glyphUv.zw, vertexPosition);
+    color = glyphColor;
+
+    vec2 position = glyphRectangle.xy + vertexPosition * glyphRectangle.zw;
+    gl_Position = vec4((projection * vec4(position, 0.f, 1.f)).xy, 0.f, 1.f);
 }
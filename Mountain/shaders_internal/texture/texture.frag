@@ -1,13 +1,19 @@
-#version 460
+#version 450
 
 in vec2 textureCoordinates;
 in vec4 color;
+flat in int layer;
 
-uniform sampler2D image;
+layout (binding = 0) uniform sampler2D image;
+// Sampled instead of image when drawing a texture packed into a TextureAtlas, layer being its page
+layout (binding = 1) uniform sampler2DArray atlas;
 
 out vec4 fragmentColor;
 
 void main()
 {
-    fragmentColor = color * texture(image, textureCoordinates);
-} 
+    if (layer < 0)
+        fragmentColor = color * texture(image, textureCoordinates);
+    else
+        fragmentColor = color * texture(atlas, vec3(textureCoordinates, layer));
+}
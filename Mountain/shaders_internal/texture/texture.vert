@@ -1,14 +1,16 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout (location = 0) in vec2 vertexPosition;
 layout (location = 1) in mat4 transformation;
 layout (location = 5) in mat4 uvProjection;
 layout (location = 9) in vec4 instanceColor;
-
-uniform mat4 projection;
+layout (location = 10) in int instanceLayer;
 
 out vec2 textureCoordinates;
 out vec4 color;
+flat out int layer;
 
 void main()
 {
@@ -16,6 +18,7 @@ void main()
     
     textureCoordinates = (uvProjection * position).xy;
     color = instanceColor;
+    layer = instanceLayer;
 
     gl_Position = projection * (transformation * position);
 }
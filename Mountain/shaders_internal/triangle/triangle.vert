@@ -1,12 +1,12 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout (location = 0) in vec2 p1;
 layout (location = 1) in vec2 p2;
 layout (location = 2) in vec2 p3;
 layout (location = 3) in vec4 instanceColor;
 
-uniform mat4 projection;
-
 out vec4 color;
 
 void main()
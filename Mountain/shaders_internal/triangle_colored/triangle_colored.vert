@@ -1,4 +1,6 @@
-#version 460
+#version 450
+
+#include "../frame.glsl"
 
 layout (location = 0) in vec2 p1;
 layout (location = 1) in vec2 p2;
@@ -7,8 +9,6 @@ layout (location = 3) in vec4 c1;
 layout (location = 4) in vec4 c2;
 layout (location = 5) in vec4 c3;
 
-uniform mat4 projection;
-
 out vec4 color;
 
 void main()
@@ -8,8 +8,13 @@
 #include <imgui.h>
 
 #include "Mountain/Globals.hpp"
+#include "Mountain/Profiler.hpp"
 #include "Mountain/Audio/AudioContext.hpp"
+#include "Mountain/Audio/AudioMixer.hpp"
+#include "Mountain/Audio/AudioStream.hpp"
+#include "Mountain/Audio/VoiceManager.hpp"
 #include "Mountain/Utils/Logger.hpp"
+#include "Mountain/Utils/Utils.hpp"
 
 using namespace Mountain;
 
@@ -25,7 +30,16 @@ bool Audio::Initialize()
 
     Logger::LogVerbose("Initializing audio");
 
-    m_CurrentDevice = new AudioDevice(alcGetString(nullptr, ALC_DEFAULT_ALL_DEVICES_SPECIFIER));
+    if (LoopbackAudio)
+    {
+        m_CurrentDevice = AudioDevice::OpenLoopback(LoopbackSampleRate);
+        if (!m_CurrentDevice)
+            return false;
+    }
+    else
+    {
+        m_CurrentDevice = new AudioDevice(alcGetString(nullptr, ALC_DEFAULT_ALL_DEVICES_SPECIFIER));
+    }
 
     alcEventCallbackSoft = reinterpret_cast<LPALCEVENTCALLBACKSOFT>(m_CurrentDevice->GetProcAddress("alcEventCallbackSOFT"));
     alcEventControlSoft = reinterpret_cast<LPALCEVENTCONTROLSOFT>(m_CurrentDevice->GetProcAddress("alcEventControlSOFT"));
@@ -36,6 +50,15 @@ bool Audio::Initialize()
 
     m_CurrentContext = new AudioContext(*m_CurrentDevice);
 
+    VoiceManager::Initialize();
+
+    AudioMixer::Initialize();
+    AudioMixer::CreateOutput();
+
+    m_Streaming = true;
+    m_StreamingThread = std::thread{RunStreamingThread};
+    Utils::SetThreadName(m_StreamingThread, "Audio Streaming");
+
     return true;
 }
 
@@ -48,6 +71,19 @@ void Audio::Shutdown()
 
     Logger::LogVerbose("Shutting down audio");
 
+    VoiceManager::Shutdown();
+
+    {
+        std::scoped_lock lock(m_StreamsMutex);
+        m_Streaming = false;
+    }
+    m_StreamsCondVar.notify_one();
+    if (m_StreamingThread.joinable())
+        m_StreamingThread.join();
+
+    AudioMixer::DestroyOutput();
+    AudioMixer::Shutdown();
+
     for (auto&& buffer : m_Buffers)
         delete buffer;
 
@@ -63,7 +99,9 @@ void Audio::Update()
 
     ZoneScoped;
 
-    if (!m_DefaultDeviceChanged)
+    VoiceManager::Update();
+
+    if (!m_DefaultDeviceChanged || m_CurrentDevice->IsLoopback())
         return;
 
     const std::string defaultDevice = alcGetString(nullptr, ALC_DEFAULT_ALL_DEVICES_SPECIFIER);
@@ -81,10 +119,36 @@ void Audio::RegisterBuffer(AudioBuffer* buffer) { m_Buffers.Add(buffer); }
 
 void Audio::UnregisterBuffer(AudioBuffer* buffer) { m_Buffers.Remove(buffer); }
 
+void Audio::RegisterStream(AudioStream* stream)
+{
+    std::scoped_lock lock(m_StreamsMutex);
+    m_Streams.Add(stream);
+}
+
+void Audio::UnregisterStream(AudioStream* stream)
+{
+    std::scoped_lock lock(m_StreamsMutex);
+    m_Streams.Remove(stream);
+}
+
 void Audio::UpdateContext()
 {
-    delete m_CurrentContext;
-    m_CurrentContext = new AudioContext(*m_CurrentDevice);
+    // The sources belong to the context, so the voices become virtual until they get one in the new context
+    VoiceManager::Shutdown();
+
+    {
+        // Don't let the streaming thread use the context while it is recreated
+        std::scoped_lock lock(m_StreamsMutex);
+
+        AudioMixer::DestroyOutput();
+
+        delete m_CurrentContext;
+        m_CurrentContext = new AudioContext(*m_CurrentDevice);
+
+        AudioMixer::CreateOutput();
+    }
+
+    VoiceManager::Initialize();
 }
 
 const AudioDevice* Audio::GetCurrentDevice() { return m_CurrentDevice; }
@@ -95,6 +159,37 @@ void Audio::SetCurrentDevice(AudioDevice* newCurrentDevice)
     UpdateContext();
 }
 
+void Audio::RenderLoopback(f32* output, u32 frameCount)
+{
+    ZoneScoped;
+
+    if (!m_CurrentDevice->IsLoopback())
+    {
+        Logger::LogError("Cannot render the audio of device {}, which isn't a loopback device", m_CurrentDevice->GetName());
+        return;
+    }
+
+    std::scoped_lock lock(m_StreamsMutex);
+
+    m_CurrentContext->MakeCurrent();
+
+    while (frameCount > 0)
+    {
+        // Render at most one mixer buffer at a time, and refill the sources before each of them since the streaming thread
+        // can't keep up with a device rendering faster than real time
+        const u32 renderedFrameCount = std::min(frameCount, AudioMixer::BufferFrameCount);
+
+        for (AudioStream* stream : m_Streams)
+            stream->Update();
+        AudioMixer::Update();
+
+        m_CurrentDevice->RenderSamples(output, renderedFrameCount);
+
+        output += static_cast<usize>(renderedFrameCount) * 2;
+        frameCount -= renderedFrameCount;
+    }
+}
+
 f32 Audio::GetDistanceFactor() { return m_DistanceFactor; }
 
 void Audio::SetDistanceFactor(const f32 newDistanceFactor) { m_DistanceFactor = newDistanceFactor; }
@@ -121,3 +216,22 @@ void Audio::IterateAlStringList(const c8* list, const std::function<void(const c
             lambda(list + i);
     }
 }
+
+void Audio::RunStreamingThread()
+{
+#ifdef PROFILING
+    tracy::SetThreadName("Audio Streaming");
+#endif
+
+    std::unique_lock lock(m_StreamsMutex);
+
+    while (m_Streaming)
+    {
+        for (AudioStream* stream : m_Streams)
+            stream->Update();
+
+        AudioMixer::Update();
+
+        m_StreamsCondVar.wait_for(lock, StreamingInterval, [] { return !m_Streaming; });
+    }
+}
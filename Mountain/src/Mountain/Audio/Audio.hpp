@@ -1,6 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <thread>
 
 #include "Mountain/Core.hpp"
 #include "Mountain/Audio/AudioBuffer.hpp"
@@ -23,11 +28,16 @@ typedef int ALCenum;
 
 namespace Mountain
 {
+    class AudioStream;
+
     class Audio
     {
         STATIC_CLASS(Audio)
 
     public:
+        /// @brief The sample rate of the loopback device opened when @c LoopbackAudio is @c true.
+        static constexpr s32 LoopbackSampleRate = 48000;
+
         MOUNTAIN_API static bool Initialize();
 
         MOUNTAIN_API static void Shutdown();
@@ -42,8 +52,21 @@ namespace Mountain
 
         MOUNTAIN_API static void UnregisterBuffer(AudioBuffer* buffer);
 
+        /// @brief Adds @p stream to the ones refilled by the audio streaming thread.
+        MOUNTAIN_API static void RegisterStream(AudioStream* stream);
+
+        /// @brief Removes @p stream from the ones refilled by the audio streaming thread.
+        /// @details Once this returns, the streaming thread doesn't use @p stream anymore.
+        MOUNTAIN_API static void UnregisterStream(AudioStream* stream);
+
         MOUNTAIN_API static void UpdateContext();
 
+        /// @brief Renders the next @p frameCount frames of the current loopback device in @p output, as interleaved stereo samples.
+        /// @details The streams and the @c AudioMixer are refilled as needed while rendering, so this can render faster than
+        /// real time. The current device must have been opened with @c AudioDevice::OpenLoopback().
+        /// @see LoopbackAudio
+        MOUNTAIN_API static void RenderLoopback(f32* output, u32 frameCount);
+
         MOUNTAIN_API static const AudioDevice* GetCurrentDevice();
 
         MOUNTAIN_API static void SetCurrentDevice(AudioDevice* newCurrentDevice);
@@ -58,6 +81,17 @@ namespace Mountain
 
         MOUNTAIN_API static inline List<AudioBuffer*> m_Buffers;
 
+        /// @brief The time the streaming thread waits between two refills of the streams, which is much shorter than the
+        /// duration of an AudioStream buffer.
+        static constexpr std::chrono::milliseconds StreamingInterval{10};
+
+        MOUNTAIN_API static inline List<AudioStream*> m_Streams;
+        /// @brief Held while the streams and the AudioMixer output are updated, and while the context is recreated.
+        MOUNTAIN_API static inline std::mutex m_StreamsMutex;
+        MOUNTAIN_API static inline std::condition_variable m_StreamsCondVar;
+        MOUNTAIN_API static inline std::thread m_StreamingThread;
+        MOUNTAIN_API static inline std::atomic_bool m_Streaming = false;
+
         MOUNTAIN_API static inline f32 m_DistanceFactor = 0.2f;
 
         MOUNTAIN_API static inline bool m_DefaultDeviceChanged = false;
@@ -68,5 +102,7 @@ namespace Mountain
         ///
         /// OpenAL string lists are strings separated by null characters, and ending with two consecutive null characters.
         static void IterateAlStringList(const c8* list, const std::function<void(const c8*)>& lambda);
+
+        static void RunStreamingThread();
     };
 }
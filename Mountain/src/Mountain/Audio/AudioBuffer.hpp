@@ -27,14 +27,15 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         u32 GetHandle() const;
 
+        /// @brief Returns the OpenAL format of the samples with the given number of @p channels and @p bitDepth.
+        ATTRIBUTE_NODISCARD
+        static s32 AlFormatFromData(u16 channels, u16 bitDepth);
+
     private:
         u32 m_Handle = 0;
 
         s32 m_Format = 0;
 
         AudioContext* m_Context = nullptr;
-
-        ATTRIBUTE_NODISCARD
-        static s32 AlFormatFromData(u16 channels, u16 bitDepth);
     };
 }
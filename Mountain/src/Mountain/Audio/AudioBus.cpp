@@ -0,0 +1,37 @@
+#include "Mountain/Audio/AudioBus.hpp"
+
+#include "Mountain/Audio/AudioMixer.hpp"
+
+using namespace Mountain;
+
+AudioBus::AudioBus(std::string name, AudioBus* parent)
+    : m_Name(std::move(name))
+    , m_Parent(parent ? parent : AudioMixer::GetMasterBus())
+{
+    AudioMixer::RegisterBus(this);
+}
+
+AudioBus::~AudioBus() { AudioMixer::UnregisterBus(this); }
+
+f32 AudioBus::GetVolume() const { return m_Volume.load(std::memory_order_relaxed); }
+
+void AudioBus::SetVolume(const f32 newVolume) { m_Volume.store(std::max(0.f, newVolume), std::memory_order_relaxed); }
+
+bool AudioBus::GetMuted() const { return m_Muted.load(std::memory_order_relaxed); }
+
+void AudioBus::SetMuted(const bool newMuted) { m_Muted.store(newMuted, std::memory_order_relaxed); }
+
+f32 AudioBus::GetLowPassCutoff() const { return m_LowPassCutoff.load(std::memory_order_relaxed); }
+
+void AudioBus::SetLowPassCutoff(const f32 newLowPassCutoff) { m_LowPassCutoff.store(std::max(0.f, newLowPassCutoff), std::memory_order_relaxed); }
+
+void AudioBus::SetDucking(AudioBus* sidechain, const f32 amount)
+{
+    if (sidechain == this)
+        THROW(ArgumentException{"An AudioBus cannot duck itself", "sidechain"});
+
+    AudioMixer::SetDucking(this, sidechain);
+    m_DuckingAmount.store(std::clamp(amount, 0.f, 1.f), std::memory_order_relaxed);
+}
+
+f32 AudioBus::GetPeak() const { return m_Peak.load(std::memory_order_relaxed); }
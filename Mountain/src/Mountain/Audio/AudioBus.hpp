@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+#include "Mountain/Containers/List.hpp"
+
+/// @file AudioBus.hpp
+/// @brief Defines the Mountain::AudioBus class.
+
+namespace Mountain
+{
+    /// @brief A submix of the @c AudioMixer, which the sounds played on it and its child buses are mixed into.
+    /// @details Each block, the samples of a bus are filtered, multiplied by its gain and added to its parent, up to the
+    /// master bus which is sent to the output. A bus can be ducked by another one, which lowers its gain while the other bus
+    /// is playing something, e.g. to lower the music during dialogues.
+    ///
+    /// The properties of a bus can be changed from any thread, and are applied by the mixer on the next block it renders.
+    class AudioBus
+    {
+        friend class AudioMixer;
+
+    public:
+        /// @brief Creates a bus named @p name, mixed into @p parent, or into the master bus of the @c AudioMixer if it is @c nullptr.
+        /// @details The @c AudioMixer must be initialized.
+        MOUNTAIN_API explicit AudioBus(std::string name, AudioBus* parent = nullptr);
+
+        /// @brief Stops the sounds played on this bus, and moves its children to its parent.
+        MOUNTAIN_API ~AudioBus();
+
+        DELETE_COPY_MOVE_OPERATIONS(AudioBus)
+
+        GETTER(const std::string&, Name, m_Name)
+
+        /// @brief Returns the bus this one is mixed into, or @c nullptr for the master bus.
+        GETTER(AudioBus*, Parent, m_Parent)
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetVolume() const;
+
+        /// @brief Sets the volume in the range [0, inf]. Default value is 1.
+        MOUNTAIN_API void SetVolume(f32 newVolume);
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool GetMuted() const;
+
+        MOUNTAIN_API void SetMuted(bool newMuted);
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetLowPassCutoff() const;
+
+        /// @brief Sets the cutoff frequency in Hz of the low-pass filter of this bus, or 0 to disable it. Default value is 0.
+        MOUNTAIN_API void SetLowPassCutoff(f32 newLowPassCutoff);
+
+        /// @brief Lowers the gain of this bus by @p amount while @p sidechain is playing something.
+        /// @param sidechain The bus to follow, or @c nullptr to disable ducking.
+        /// @param amount How much to lower the gain, in the range [0, 1]. 1 completely silences this bus.
+        MOUNTAIN_API void SetDucking(AudioBus* sidechain, f32 amount);
+
+        /// @brief Returns the highest absolute value of the samples this bus sent to its parent during the last block.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetPeak() const;
+
+    private:
+        std::string m_Name;
+        AudioBus* m_Parent = nullptr;
+        /// @brief The number of buses between this one and the master bus, used to mix the children before their parents.
+        u32 m_Depth = 0;
+
+        std::atomic<f32> m_Volume = 1.f;
+        std::atomic_bool m_Muted = false;
+        std::atomic<f32> m_LowPassCutoff = 0.f;
+        std::atomic<f32> m_Peak = 0.f;
+
+        /// @brief The bus ducking this one, which is only changed with the mixer lock held.
+        AudioBus* m_DuckingSidechain = nullptr;
+        std::atomic<f32> m_DuckingAmount = 0.f;
+
+        // The following are only used by the mixer while it renders
+
+        /// @brief The interleaved stereo samples of the block being rendered.
+        List<f32> m_Samples;
+        Array<f32, 2> m_LowPassState{};
+        /// @brief The current gain multiplier of the ducking, which moves towards its target over time to avoid clicks.
+        f32 m_DuckingGain = 1.f;
+    };
+}
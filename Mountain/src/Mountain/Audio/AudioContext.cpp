@@ -14,7 +14,7 @@
 using namespace Mountain;
 
 AudioContext::AudioContext(AudioDevice& device)
-    : m_Handle(alcCreateContext(device.m_Handle, nullptr))
+    : m_Handle(alcCreateContext(device.m_Handle, device.m_ContextAttributes.IsEmpty() ? nullptr : device.m_ContextAttributes.GetData()))
     , m_Device(&device)
 {
     if (!m_Handle || AudioDevice::CheckError(m_Device))
@@ -8,6 +8,9 @@
 using namespace Mountain;
 
 LPALCREOPENDEVICESOFT alcReopenDeviceSoft = nullptr;
+LPALCLOOPBACKOPENDEVICESOFT alcLoopbackOpenDeviceSoft = nullptr;
+LPALCISRENDERFORMATSUPPORTEDSOFT alcIsRenderFormatSupportedSoft = nullptr;
+LPALCRENDERSAMPLESSOFT alcRenderSamplesSoft = nullptr;
 
 bool AudioDevice::CheckError(const AudioDevice* device)
 {
@@ -24,6 +27,46 @@ bool AudioDevice::CheckError(const AudioDevice* device)
     return false;
 }
 
+AudioDevice* AudioDevice::OpenLoopback(const s32 sampleRate)
+{
+    if (!alcIsExtensionPresent(nullptr, "ALC_SOFT_loopback"))
+    {
+        Logger::LogError("Unable to open a loopback audio device, ALC_SOFT_loopback isn't supported");
+        return nullptr;
+    }
+
+    alcLoopbackOpenDeviceSoft = reinterpret_cast<LPALCLOOPBACKOPENDEVICESOFT>(alcGetProcAddress(nullptr, "alcLoopbackOpenDeviceSOFT"));
+    alcIsRenderFormatSupportedSoft = reinterpret_cast<LPALCISRENDERFORMATSUPPORTEDSOFT>(alcGetProcAddress(nullptr, "alcIsRenderFormatSupportedSOFT"));
+    alcRenderSamplesSoft = reinterpret_cast<LPALCRENDERSAMPLESSOFT>(alcGetProcAddress(nullptr, "alcRenderSamplesSOFT"));
+
+    ALCdevice* const handle = alcLoopbackOpenDeviceSoft(nullptr);
+    if (!handle)
+    {
+        Logger::LogError("Unable to open a loopback audio device");
+        return nullptr;
+    }
+
+    if (!alcIsRenderFormatSupportedSoft(handle, sampleRate, ALC_STEREO_SOFT, ALC_FLOAT_SOFT))
+    {
+        Logger::LogError("Loopback audio device doesn't support rendering stereo floats at {} Hz", sampleRate);
+        alcCloseDevice(handle);
+        return nullptr;
+    }
+
+    AudioDevice* const device = new AudioDevice;
+    device->m_Handle = handle;
+    device->m_Name = "Loopback";
+    device->m_Loopback = true;
+    device->m_ContextAttributes.AddRange({
+        ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT,
+        ALC_FORMAT_TYPE_SOFT, ALC_FLOAT_SOFT,
+        ALC_FREQUENCY, sampleRate,
+        0
+    });
+
+    return device;
+}
+
 AudioDevice::AudioDevice(std::string&& name)
     : m_Handle(alcOpenDevice(name.c_str()))
     , m_Name(std::move(name))
@@ -39,6 +82,10 @@ AudioDevice::~AudioDevice() { alcCloseDevice(m_Handle); }
 
 void AudioDevice::Reopen(const std::string& newName)
 {
+    // A loopback device doesn't output to anything, so there is nothing to reopen
+    if (m_Loopback)
+        return;
+
     alcReopenDeviceSoft(m_Handle, newName.c_str(), nullptr);
     m_Name = newName;
 }
@@ -49,3 +96,23 @@ void* AudioDevice::GetProcAddress(const c8* functionName) const
 }
 
 std::string AudioDevice::GetName() const { return m_Name; }
+
+s32 AudioDevice::GetSampleRate() const
+{
+    s32 sampleRate = 0;
+    alcGetIntegerv(m_Handle, ALC_FREQUENCY, 1, &sampleRate);
+    return sampleRate;
+}
+
+bool AudioDevice::IsLoopback() const { return m_Loopback; }
+
+void AudioDevice::RenderSamples(f32* output, const u32 frameCount) const
+{
+    if (!m_Loopback)
+    {
+        Logger::LogError("Cannot render the samples of audio device {}, which isn't a loopback device", m_Name);
+        return;
+    }
+
+    alcRenderSamplesSoft(m_Handle, output, static_cast<ALCsizei>(frameCount));
+}
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
 
 // ReSharper disable once CppInconsistentNaming
 struct ALCdevice;
@@ -14,6 +15,12 @@ namespace Mountain
     public:
         MOUNTAIN_API static bool CheckError(const AudioDevice* device = nullptr);
 
+        /// @brief Opens a loopback device, which renders its output in memory with @c RenderSamples() instead of playing it.
+        /// @details This requires the ALC_SOFT_loopback extension. The device renders interleaved stereo floats at @p sampleRate.
+        /// @return The new device, or @c nullptr if it couldn't be opened.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static AudioDevice* OpenLoopback(s32 sampleRate);
+
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API explicit AudioDevice(std::string&& name);
 
@@ -28,10 +35,26 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API std::string GetName() const;
 
+        /// @brief Returns the output sample rate of the device in Hz.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API s32 GetSampleRate() const;
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsLoopback() const;
+
+        /// @brief Renders the next @p frameCount frames of a loopback device in @p output, as interleaved stereo samples.
+        MOUNTAIN_API void RenderSamples(f32* output, u32 frameCount) const;
+
     private:
         ALCdevice* m_Handle = nullptr;
         std::string m_Name;
 
+        bool m_Loopback = false;
+        /// @brief The attributes the contexts of this device are created with, which describe the output format of loopback devices.
+        List<s32> m_ContextAttributes;
+
+        AudioDevice() = default;
+
         // AudioContext needs to access the handle of this class
         friend class AudioContext;
     };
@@ -0,0 +1,423 @@
+#include "Mountain/Audio/AudioKernels.hpp"
+
+#ifdef ARCHITECTURE_X64
+#include <immintrin.h>
+#endif
+
+#include "Mountain/Utils/Simd.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    constexpr u64 FractionMask = AudioKernels::FractionOne - 1;
+    /// @brief The fractions are converted to floats from their 24 most significant bits, which is the precision of a float,
+    /// so that they fit in a signed 32-bit integer in the SIMD versions.
+    constexpr u32 FractionShift = AudioKernels::FractionBits - 24;
+    constexpr f32 FractionScale = 1.f / static_cast<f32>(1 << 24);
+    constexpr f32 SampleScale = 1.f / 32768.f;
+
+    f32 Fraction(const u64 position) { return static_cast<f32>(static_cast<s32>((position & FractionMask) >> FractionShift)) * FractionScale; }
+
+    f32 Interpolate(const s16 a, const s16 b, const f32 fraction)
+    {
+        const f32 first = static_cast<f32>(a);
+        return (first + (static_cast<f32>(b) - first) * fraction) * SampleScale;
+    }
+
+    /// @brief Returns how many output frames can be computed from @p position before needing the last frame of the samples,
+    /// which is where the scalar version takes over to avoid reading past the end.
+    u32 InterpolatedFrameCount(const u64 frameCount, const u64 position, const u64 step, const u32 outputFrameCount)
+    {
+        if (frameCount < 2)
+            return 0;
+
+        const u64 end = (frameCount - 1) << AudioKernels::FractionBits;
+        if (position >= end)
+            return 0;
+
+        if (step == 0)
+            return outputFrameCount;
+
+        return static_cast<u32>(std::min<u64>(outputFrameCount, (end - position + step - 1) / step));
+    }
+
+    u32 ResampleMixScalar(
+        const s16* samples,
+        const u64 frameCount,
+        const u16 channels,
+        u64& position,
+        const u64 step,
+        const f32 gainLeft,
+        const f32 gainRight,
+        f32* output,
+        const u32 outputFrameCount
+    )
+    {
+        const u64 end = frameCount << AudioKernels::FractionBits;
+
+        u32 i = 0;
+        for (; i < outputFrameCount && position < end; i++, position += step)
+        {
+            const u64 index = position >> AudioKernels::FractionBits;
+            const u64 next = std::min(index + 1, frameCount - 1);
+            const f32 fraction = Fraction(position);
+
+            if (channels == 1)
+            {
+                const f32 value = Interpolate(samples[index], samples[next], fraction);
+                output[i * 2] += value * gainLeft;
+                output[i * 2 + 1] += value * gainRight;
+            }
+            else
+            {
+                output[i * 2] += Interpolate(samples[index * 2], samples[next * 2], fraction) * gainLeft;
+                output[i * 2 + 1] += Interpolate(samples[index * 2 + 1], samples[next * 2 + 1], fraction) * gainRight;
+            }
+        }
+
+        return i;
+    }
+
+#ifdef ARCHITECTURE_X64
+    /// @brief Interpolates the four frames between @p first and @p second and adds them to four stereo output frames.
+    TARGET_ISA("sse2")
+    void InterpolateMix4(
+        const __m128 firstLeft,
+        const __m128 secondLeft,
+        const __m128 firstRight,
+        const __m128 secondRight,
+        const __m128 fraction,
+        const __m128 gainLeft,
+        const __m128 gainRight,
+        f32* output
+    )
+    {
+        const __m128 scale = _mm_set1_ps(SampleScale);
+
+        const __m128 left = _mm_mul_ps(_mm_mul_ps(_mm_add_ps(firstLeft, _mm_mul_ps(_mm_sub_ps(secondLeft, firstLeft), fraction)), scale), gainLeft);
+        const __m128 right = _mm_mul_ps(_mm_mul_ps(_mm_add_ps(firstRight, _mm_mul_ps(_mm_sub_ps(secondRight, firstRight), fraction)), scale), gainRight);
+
+        _mm_storeu_ps(output, _mm_add_ps(_mm_loadu_ps(output), _mm_unpacklo_ps(left, right)));
+        _mm_storeu_ps(output + 4, _mm_add_ps(_mm_loadu_ps(output + 4), _mm_unpackhi_ps(left, right)));
+    }
+
+    /// @brief Splits 32-bit integers made of two 16-bit samples into their sign-extended low and high halves.
+    TARGET_ISA("sse2")
+    void Unpack(const __m128i pairs, __m128& low, __m128& high)
+    {
+        low = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(pairs, 16), 16));
+        high = _mm_cvtepi32_ps(_mm_srai_epi32(pairs, 16));
+    }
+
+    // SSE2 can't gather the samples, so they are read one by one and only the positions and the interpolation are
+    // computed with SIMD instructions
+    TARGET_ISA("sse2")
+    void ResampleMixSse2(
+        const s16* samples,
+        const u16 channels,
+        u64& position,
+        const u64 step,
+        const f32 gainLeft,
+        const f32 gainRight,
+        f32* output,
+        const u32 outputFrameCount
+    )
+    {
+        const __m128 left = _mm_set1_ps(gainLeft);
+        const __m128 right = _mm_set1_ps(gainRight);
+        const __m128 fractionScale = _mm_set1_ps(FractionScale);
+
+        // The positions are kept in two vectors of 2 lanes, with the low 32 bits of the frame indices to load the samples
+        // and the fractions in the other 32 bits
+        __m128i positionsLow = _mm_set_epi64x(static_cast<s64>(position + step), static_cast<s64>(position));
+        __m128i positionsHigh = _mm_set_epi64x(static_cast<s64>(position + step * 3), static_cast<s64>(position + step * 2));
+        const __m128i advance = _mm_set1_epi64x(static_cast<s64>(step * 4));
+
+        u32 i = 0;
+        for (; i + 4 <= outputFrameCount; i += 4)
+        {
+            // Move the low halves of the lanes to the first 64 bits and the high halves to the last 64 bits
+            const __m128i low = _mm_shuffle_epi32(positionsLow, _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i high = _mm_shuffle_epi32(positionsHigh, _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i fractionBits = _mm_unpacklo_epi64(low, high);
+            const __m128i indices = _mm_unpackhi_epi64(low, high);
+
+            const __m128 fraction = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(fractionBits, FractionShift)), fractionScale);
+
+            alignas(16) Array<s32, 4> index;
+            _mm_store_si128(reinterpret_cast<__m128i*>(index.GetData()), indices);
+
+            f32* out = output + static_cast<usize>(i) * 2;
+
+            const s16* f0 = samples + static_cast<usize>(static_cast<u32>(index[0])) * channels;
+            const s16* f1 = samples + static_cast<usize>(static_cast<u32>(index[1])) * channels;
+            const s16* f2 = samples + static_cast<usize>(static_cast<u32>(index[2])) * channels;
+            const s16* f3 = samples + static_cast<usize>(static_cast<u32>(index[3])) * channels;
+
+            if (channels == 1)
+            {
+                const __m128 a = _mm_setr_ps(f0[0], f1[0], f2[0], f3[0]);
+                const __m128 b = _mm_setr_ps(f0[1], f1[1], f2[1], f3[1]);
+                InterpolateMix4(a, b, a, b, fraction, left, right, out);
+            }
+            else
+            {
+                const __m128 a = _mm_setr_ps(f0[0], f1[0], f2[0], f3[0]);
+                const __m128 b = _mm_setr_ps(f0[2], f1[2], f2[2], f3[2]);
+                const __m128 c = _mm_setr_ps(f0[1], f1[1], f2[1], f3[1]);
+                const __m128 d = _mm_setr_ps(f0[3], f1[3], f2[3], f3[3]);
+                InterpolateMix4(a, b, c, d, fraction, left, right, out);
+            }
+
+            positionsLow = _mm_add_epi64(positionsLow, advance);
+            positionsHigh = _mm_add_epi64(positionsHigh, advance);
+        }
+
+        position += step * i;
+    }
+
+    TARGET_ISA("avx2")
+    void ResampleMixAvx2(
+        const s16* samples,
+        const u16 channels,
+        u64& position,
+        const u64 step,
+        const f32 gainLeft,
+        const f32 gainRight,
+        f32* output,
+        const u32 outputFrameCount
+    )
+    {
+        const __m128 left = _mm_set1_ps(gainLeft);
+        const __m128 right = _mm_set1_ps(gainRight);
+        const __m128 fractionScale = _mm_set1_ps(FractionScale);
+
+        const __m256i fractionMask = _mm256_set1_epi64x(static_cast<s64>(FractionMask));
+        // Moves the low 32 bits of each 64-bit lane to the first 128 bits
+        const __m256i packLow = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+
+        __m256i positions = _mm256_setr_epi64x(
+            static_cast<s64>(position),
+            static_cast<s64>(position + step),
+            static_cast<s64>(position + step * 2),
+            static_cast<s64>(position + step * 3)
+        );
+        const __m256i advance = _mm256_set1_epi64x(static_cast<s64>(step * 4));
+
+        const s32* frames = reinterpret_cast<const s32*>(samples);
+
+        u32 i = 0;
+        for (; i + 4 <= outputFrameCount; i += 4)
+        {
+            const __m256i indices = _mm256_srli_epi64(positions, AudioKernels::FractionBits);
+            const __m256i fractions64 = _mm256_srli_epi64(_mm256_and_si256(positions, fractionMask), FractionShift);
+            const __m128 fraction = _mm_mul_ps(
+                _mm_cvtepi32_ps(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(fractions64, packLow))),
+                fractionScale
+            );
+
+            f32* out = output + static_cast<usize>(i) * 2;
+
+            if (channels == 1)
+            {
+                // Each 32-bit load reads a sample and the next one
+                __m128 a, b;
+                Unpack(_mm256_i64gather_epi32(reinterpret_cast<const int*>(samples), indices, 2), a, b);
+                InterpolateMix4(a, b, a, b, fraction, left, right, out);
+            }
+            else
+            {
+                // Each 32-bit load reads the left and right samples of a frame
+                __m128 a, b, c, d;
+                Unpack(_mm256_i64gather_epi32(reinterpret_cast<const int*>(frames), indices, 4), a, c);
+                Unpack(_mm256_i64gather_epi32(reinterpret_cast<const int*>(frames + 1), indices, 4), b, d);
+                InterpolateMix4(a, b, c, d, fraction, left, right, out);
+            }
+
+            positions = _mm256_add_epi64(positions, advance);
+        }
+
+        position += step * i;
+    }
+
+    TARGET_ISA("sse2")
+    usize MixSse2(const f32* input, f32* output, const usize sampleCount, const f32 gain)
+    {
+        const __m128 g = _mm_set1_ps(gain);
+
+        usize i = 0;
+        for (; i + 4 <= sampleCount; i += 4)
+            _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(_mm_loadu_ps(input + i), g)));
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize MixAvx2(const f32* input, f32* output, const usize sampleCount, const f32 gain)
+    {
+        const __m256 g = _mm256_set1_ps(gain);
+
+        usize i = 0;
+        for (; i + 8 <= sampleCount; i += 8)
+            _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_loadu_ps(output + i), _mm256_mul_ps(_mm256_loadu_ps(input + i), g)));
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize ConvertToS16Sse2(const f32* input, s16* output, const usize sampleCount)
+    {
+        const __m128 min = _mm_set1_ps(-1.f);
+        const __m128 max = _mm_set1_ps(1.f);
+        const __m128 scale = _mm_set1_ps(32767.f);
+
+        usize i = 0;
+        for (; i + 8 <= sampleCount; i += 8)
+        {
+            const __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i), min), max), scale);
+            const __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i + 4), min), max), scale);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize ConvertToS16Avx2(const f32* input, s16* output, const usize sampleCount)
+    {
+        const __m256 min = _mm256_set1_ps(-1.f);
+        const __m256 max = _mm256_set1_ps(1.f);
+        const __m256 scale = _mm256_set1_ps(32767.f);
+
+        usize i = 0;
+        for (; i + 16 <= sampleCount; i += 16)
+        {
+            const __m256i a = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(input + i), min), max), scale));
+            const __m256i b = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(input + i + 8), min), max), scale));
+            // The pack works on each 128-bit half separately, so the 64-bit blocks need to be put back in order
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0b11011000);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+        }
+
+        return i;
+    }
+#endif
+}
+
+u32 AudioKernels::ResampleMix(
+    const s16* samples,
+    const u64 frameCount,
+    const u16 channels,
+    u64& position,
+    const u64 step,
+    const f32 gainLeft,
+    const f32 gainRight,
+    f32* output,
+    const u32 outputFrameCount
+)
+{
+    u32 mixed = 0;
+
+#ifdef ARCHITECTURE_X64
+    // The SIMD versions only compute whole groups of 4 frames, which can't include the last frame of the samples since
+    // interpolating it would read past the end
+    const u32 simdFrameCount = InterpolatedFrameCount(frameCount, position, step, outputFrameCount) & ~3u;
+
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2:
+            ResampleMixAvx2(samples, channels, position, step, gainLeft, gainRight, output, simdFrameCount);
+            mixed = simdFrameCount;
+            break;
+
+        case SimdLevel::Sse2:
+            ResampleMixSse2(samples, channels, position, step, gainLeft, gainRight, output, simdFrameCount);
+            mixed = simdFrameCount;
+            break;
+
+        case SimdLevel::None:
+            break;
+    }
+#endif
+
+    return mixed + ResampleMixScalar(
+        samples,
+        frameCount,
+        channels,
+        position,
+        step,
+        gainLeft,
+        gainRight,
+        output + static_cast<usize>(mixed) * 2,
+        outputFrameCount - mixed
+    );
+}
+
+void AudioKernels::Mix(const f32* input, f32* output, const usize sampleCount, const f32 gain)
+{
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = MixAvx2(input, output, sampleCount, gain); break;
+        case SimdLevel::Sse2: i = MixSse2(input, output, sampleCount, gain); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < sampleCount; i++)
+        output[i] += input[i] * gain;
+}
+
+void AudioKernels::ConvertToS16(const f32* input, s16* output, const usize sampleCount)
+{
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = ConvertToS16Avx2(input, output, sampleCount); break;
+        case SimdLevel::Sse2: i = ConvertToS16Sse2(input, output, sampleCount); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    // std::nearbyint rounds to the nearest even integer like the SIMD conversions
+    for (; i < sampleCount; i++)
+        output[i] = static_cast<s16>(std::nearbyint(std::clamp(input[i], -1.f, 1.f) * 32767.f));
+}
+
+f32 AudioKernels::Peak(const f32* samples, const usize sampleCount)
+{
+    f32 peak = 0.f;
+    for (usize i = 0; i < sampleCount; i++)
+        peak = std::max(peak, std::abs(samples[i]));
+    return peak;
+}
+
+void AudioKernels::LowPass(f32* samples, const u32 frameCount, const f32 coefficient, Array<f32, 2>& state)
+{
+    // Each output depends on the previous one, so this can't be vectorized over time
+    f32 left = state[0];
+    f32 right = state[1];
+
+    for (u32 i = 0; i < frameCount; i++)
+    {
+        left += (samples[i * 2] - left) * coefficient;
+        right += (samples[i * 2 + 1] - right) * coefficient;
+        samples[i * 2] = left;
+        samples[i * 2 + 1] = right;
+    }
+
+    // Once the input is silent, the state decays towards 0 forever, so stop it before it reaches the very slow denormal range
+    constexpr f32 SilenceThreshold = 1e-15f;
+    state[0] = std::abs(left) < SilenceThreshold ? 0.f : left;
+    state[1] = std::abs(right) < SilenceThreshold ? 0.f : right;
+}
+
+f32 AudioKernels::LowPassCoefficient(const f32 cutoff, const s32 sampleRate)
+{
+    return 1.f - std::exp(-2.f * Calc::Pi * cutoff / static_cast<f32>(sampleRate));
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+
+/// @file AudioKernels.hpp
+/// @brief Defines the Mountain::AudioKernels class.
+
+namespace Mountain
+{
+    /// @brief Static class containing the sample processing functions of the @c AudioMixer.
+    /// @details The functions that process whole blocks of samples have SSE2 and AVX2 versions, chosen depending on
+    /// @c Simd::GetLevel(). All of them work on interleaved stereo samples in the range [-1, 1].
+    class AudioKernels
+    {
+        STATIC_CLASS(AudioKernels)
+
+    public:
+        /// @brief The number of fractional bits of the fixed-point playback positions used by @c ResampleMix().
+        static constexpr u32 FractionBits = 32;
+        /// @brief The fixed-point value of a whole frame.
+        static constexpr u64 FractionOne = 1ull << FractionBits;
+
+        /// @brief Resamples 16-bit samples with a linear interpolation and adds them to a stereo output.
+        /// @param samples The interleaved mono or stereo samples to read.
+        /// @param frameCount The number of frames of @p samples.
+        /// @param channels The number of channels of @p samples, which must be 1 or 2.
+        /// @param position The fixed-point position of the first frame to read, which is advanced by the number of frames read.
+        /// @param step The fixed-point number of frames to advance for each output frame, e.g. @c FractionOne to keep the same sample rate.
+        /// @param gainLeft The gain of the left output channel.
+        /// @param gainRight The gain of the right output channel.
+        /// @param output The interleaved stereo samples to add the result to.
+        /// @param outputFrameCount The maximum number of frames to add to @p output.
+        /// @return The number of frames added to @p output, which is less than @p outputFrameCount if the end of @p samples was reached.
+        MOUNTAIN_API static u32 ResampleMix(
+            const s16* samples,
+            u64 frameCount,
+            u16 channels,
+            u64& position,
+            u64 step,
+            f32 gainLeft,
+            f32 gainRight,
+            f32* output,
+            u32 outputFrameCount
+        );
+
+        /// @brief Adds each of the @p sampleCount samples of @p input multiplied by @p gain to @p output.
+        MOUNTAIN_API static void Mix(const f32* input, f32* output, usize sampleCount, f32 gain);
+
+        /// @brief Clamps the samples of @p input to [-1, 1] and converts them to 16-bit samples in @p output.
+        MOUNTAIN_API static void ConvertToS16(const f32* input, s16* output, usize sampleCount);
+
+        /// @brief Returns the highest absolute value of the samples.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static f32 Peak(const f32* samples, usize sampleCount);
+
+        /// @brief Applies a one-pole low-pass filter to interleaved stereo samples.
+        /// @param samples The samples to filter in place.
+        /// @param frameCount The number of frames of @p samples.
+        /// @param coefficient The coefficient of the filter, as returned by @c LowPassCoefficient().
+        /// @param state The last output of the filter for each channel, which is updated to continue filtering in the next call.
+        MOUNTAIN_API static void LowPass(f32* samples, u32 frameCount, f32 coefficient, Array<f32, 2>& state);
+
+        /// @brief Returns the coefficient of a one-pole low-pass filter with the given @p cutoff frequency.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static f32 LowPassCoefficient(f32 cutoff, s32 sampleRate);
+    };
+}
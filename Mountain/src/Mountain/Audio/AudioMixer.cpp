@@ -0,0 +1,376 @@
+#include "Mountain/Audio/AudioMixer.hpp"
+
+#include <AL/al.h>
+
+#include "Mountain/Audio/Audio.hpp"
+#include "Mountain/Audio/AudioBus.hpp"
+#include "Mountain/Audio/AudioContext.hpp"
+#include "Mountain/Audio/AudioDevice.hpp"
+#include "Mountain/Audio/AudioKernels.hpp"
+#include "Mountain/Resource/AudioTrack.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    /// @brief The lowest pitch of a sound, below which it would practically never end.
+    constexpr f32 MinPitch = 0.01f;
+
+    /// @brief The peak of a sidechain bus above which it ducks the buses following it.
+    constexpr f32 DuckingThreshold = 0.01f;
+    /// @brief The time in seconds the ducking takes to lower the gain, which is short to avoid hiding the start of a sound.
+    constexpr f32 DuckingAttack = 0.01f;
+    /// @brief The time in seconds the ducking takes to restore the gain.
+    constexpr f32 DuckingRelease = 0.3f;
+}
+
+void AudioMixer::Initialize()
+{
+    ZoneScoped;
+
+    // This is the only bus created without a parent, since there is no master bus to default to yet
+    m_MasterBus = new AudioBus("Master");
+}
+
+void AudioMixer::Shutdown()
+{
+    ZoneScoped;
+
+    StopAll();
+
+    delete m_MasterBus;
+    m_MasterBus = nullptr;
+}
+
+bool AudioMixer::Play(const AudioTrack& track, AudioBus* bus, const f32 volume, const f32 pitch, const f32 pan)
+{
+    if (!m_MasterBus)
+    {
+        Logger::LogError("Cannot play AudioTrack {} before the AudioMixer is initialized", track.GetName());
+        return false;
+    }
+
+    if (track.IsStreamed() || !track.GetData() || track.GetBitDepth() != 16 || track.GetChannels() == 0 || track.GetChannels() > 2)
+    {
+        Logger::LogWarning("Cannot mix AudioTrack {}, only 16-bit mono and stereo tracks that aren't streamed can be", track.GetName());
+        return false;
+    }
+
+    const f32 clampedVolume = std::max(0.f, volume);
+    const f32 clampedPan = std::clamp(pan, -1.f, 1.f);
+
+    const Sound sound
+    {
+        .track = &track,
+        .bus = bus ? bus : m_MasterBus,
+        .gainLeft = clampedVolume * std::min(1.f, 1.f - clampedPan),
+        .gainRight = clampedVolume * std::min(1.f, 1.f + clampedPan),
+        .pitch = std::max(MinPitch, pitch)
+    };
+
+    std::scoped_lock lock(m_PendingSoundsMutex);
+
+    if (m_SoundCount + m_PendingSounds.GetSize() >= maxSoundCount)
+        return false;
+
+    m_PendingSounds.Add(sound);
+    return true;
+}
+
+void AudioMixer::Stop(const AudioBus& bus)
+{
+    std::scoped_lock lock(m_Mutex, m_PendingSoundsMutex);
+
+    m_Sounds.RemoveAll([&](const Sound& sound) { return sound.bus == &bus; });
+    m_PendingSounds.RemoveAll([&](const Sound& sound) { return sound.bus == &bus; });
+    m_SoundCount = m_Sounds.GetSize();
+}
+
+void AudioMixer::Stop(const AudioTrack& track)
+{
+    std::scoped_lock lock(m_Mutex, m_PendingSoundsMutex);
+
+    m_Sounds.RemoveAll([&](const Sound& sound) { return sound.track == &track; });
+    m_PendingSounds.RemoveAll([&](const Sound& sound) { return sound.track == &track; });
+    m_SoundCount = m_Sounds.GetSize();
+}
+
+void AudioMixer::StopAll()
+{
+    std::scoped_lock lock(m_Mutex, m_PendingSoundsMutex);
+
+    m_Sounds.Clear();
+    m_PendingSounds.Clear();
+    m_SoundCount = 0;
+}
+
+void AudioMixer::Render(f32* output, u32 frameCount)
+{
+    ZoneScoped;
+
+    std::scoped_lock lock(m_Mutex);
+
+    if (!m_MasterBus)
+    {
+        std::fill_n(output, static_cast<usize>(frameCount) * 2, 0.f);
+        return;
+    }
+
+    {
+        std::scoped_lock pendingLock(m_PendingSoundsMutex);
+        m_Sounds.AddRange(m_PendingSounds.GetData(), m_PendingSounds.GetSize());
+        m_PendingSounds.Clear();
+    }
+
+    while (frameCount > 0)
+    {
+        const u32 blockFrameCount = std::min(frameCount, BufferFrameCount);
+        RenderBlock(output, blockFrameCount);
+
+        output += static_cast<usize>(blockFrameCount) * 2;
+        frameCount -= blockFrameCount;
+    }
+
+    m_SoundCount = m_Sounds.GetSize();
+}
+
+AudioBus* AudioMixer::GetMasterBus() { return m_MasterBus; }
+
+s32 AudioMixer::GetSampleRate() { return m_SampleRate; }
+
+usize AudioMixer::GetSoundCount() { return m_SoundCount; }
+
+void AudioMixer::RegisterBus(AudioBus* bus)
+{
+    bus->m_Samples.Resize(static_cast<usize>(BufferFrameCount) * 2);
+
+    std::scoped_lock lock(m_Mutex);
+
+    m_Buses.Add(bus);
+    SortBuses();
+}
+
+void AudioMixer::UnregisterBus(AudioBus* bus)
+{
+    std::scoped_lock lock(m_Mutex, m_PendingSoundsMutex);
+
+    for (AudioBus* other : m_Buses)
+    {
+        if (other->m_Parent == bus)
+            other->m_Parent = bus->m_Parent;
+
+        if (other->m_DuckingSidechain == bus)
+            other->m_DuckingSidechain = nullptr;
+    }
+
+    m_Sounds.RemoveAll([&](const Sound& sound) { return sound.bus == bus; });
+    m_PendingSounds.RemoveAll([&](const Sound& sound) { return sound.bus == bus; });
+    m_SoundCount = m_Sounds.GetSize();
+
+    m_Buses.Remove(bus);
+    SortBuses();
+}
+
+void AudioMixer::SetDucking(AudioBus* bus, AudioBus* sidechain)
+{
+    std::scoped_lock lock(m_Mutex);
+    bus->m_DuckingSidechain = sidechain;
+}
+
+void AudioMixer::SortBuses()
+{
+    for (AudioBus* bus : m_Buses)
+    {
+        bus->m_Depth = 0;
+        for (const AudioBus* parent = bus->m_Parent; parent; parent = parent->m_Parent)
+            bus->m_Depth++;
+    }
+
+    std::stable_sort(
+        m_Buses.GetData(),
+        m_Buses.GetData() + m_Buses.GetSize(),
+        [](const AudioBus* lhs, const AudioBus* rhs) { return lhs->m_Depth > rhs->m_Depth; }
+    );
+}
+
+void AudioMixer::RenderBlock(f32* output, const u32 frameCount)
+{
+    ZoneScoped;
+
+    const usize sampleCount = static_cast<usize>(frameCount) * 2;
+
+    std::fill_n(output, sampleCount, 0.f);
+    for (AudioBus* bus : m_Buses)
+        std::fill_n(bus->m_Samples.GetData(), sampleCount, 0.f);
+
+    const f64 outputSampleRate = static_cast<f64>(m_SampleRate);
+
+    for (usize i = 0; i < m_Sounds.GetSize();)
+    {
+        Sound& sound = m_Sounds[i];
+        const AudioTrack& track = *sound.track;
+
+        // The step is computed each time since the output sample rate changes with the audio device
+        const u64 step = static_cast<u64>(
+            static_cast<f64>(track.GetSampleRate()) * sound.pitch / outputSampleRate * static_cast<f64>(AudioKernels::FractionOne)
+        );
+
+        const u32 mixed = AudioKernels::ResampleMix(
+            track.GetData<s16>(),
+            track.GetFrameCount(),
+            track.GetChannels(),
+            sound.position,
+            step,
+            sound.gainLeft,
+            sound.gainRight,
+            sound.bus->m_Samples.GetData(),
+            frameCount
+        );
+
+        if (mixed < frameCount)
+        {
+            // The sound ended, and the order of the sounds doesn't matter, so replace it with the last one
+            sound = m_Sounds.Last();
+            m_Sounds.RemoveLast();
+            continue;
+        }
+
+        i++;
+    }
+
+    // The buses are sorted so that the children are always mixed into their parent before it is processed
+    for (AudioBus* bus : m_Buses)
+    {
+        const f32 gain = ProcessBus(*bus, frameCount);
+        if (gain == 0.f)
+            continue;
+
+        f32* destination = bus->m_Parent ? bus->m_Parent->m_Samples.GetData() : output;
+        AudioKernels::Mix(bus->m_Samples.GetData(), destination, sampleCount, gain);
+    }
+}
+
+f32 AudioMixer::ProcessBus(AudioBus& bus, const u32 frameCount)
+{
+    f32* const samples = bus.m_Samples.GetData();
+    const f32 sampleRate = static_cast<f32>(m_SampleRate);
+
+    const f32 cutoff = bus.GetLowPassCutoff();
+    if (cutoff > 0.f && cutoff < sampleRate * 0.5f)
+        AudioKernels::LowPass(samples, frameCount, AudioKernels::LowPassCoefficient(cutoff, m_SampleRate), bus.m_LowPassState);
+
+    f32 duckingTarget = 1.f;
+    if (bus.m_DuckingSidechain && bus.m_DuckingSidechain->GetPeak() > DuckingThreshold)
+        duckingTarget = 1.f - bus.m_DuckingAmount.load(std::memory_order_relaxed);
+
+    // Move the ducking gain towards its target exponentially, the sidechain peak being the one of its last block
+    const f32 duration = static_cast<f32>(frameCount) / sampleRate;
+    const f32 time = duckingTarget < bus.m_DuckingGain ? DuckingAttack : DuckingRelease;
+    bus.m_DuckingGain += (duckingTarget - bus.m_DuckingGain) * (1.f - std::exp(-duration / time));
+
+    const f32 gain = bus.GetMuted() ? 0.f : bus.GetVolume() * bus.m_DuckingGain;
+    bus.m_Peak.store(AudioKernels::Peak(samples, static_cast<usize>(frameCount) * 2) * gain, std::memory_order_relaxed);
+
+    return gain;
+}
+
+void AudioMixer::CreateOutput()
+{
+    ZoneScoped;
+
+    Audio::GetContext()->MakeCurrent();
+
+    const s32 deviceSampleRate = Audio::GetCurrentDevice()->GetSampleRate();
+    if (deviceSampleRate > 0)
+        m_SampleRate = deviceSampleRate;
+
+    m_OutputSamples.Resize(static_cast<usize>(BufferFrameCount) * 2);
+    m_OutputBuffer.Resize(static_cast<usize>(BufferFrameCount) * 2);
+
+    // Reset the error state here to avoid stopping because of a different OpenAL error
+    AudioContext::CheckError();
+
+    alGenSources(1, &m_Source);
+    if (AudioContext::CheckError())
+    {
+        Logger::LogError("Unable to create the audio mixer output source");
+        m_Source = 0;
+        return;
+    }
+
+    alGenBuffers(BufferCount, m_Buffers.GetData());
+
+    // The output is already mixed in stereo, so it isn't spatialized
+    alSourcei(m_Source, AL_SOURCE_RELATIVE, AL_TRUE);
+
+    for (const u32 buffer : m_Buffers)
+        Fill(buffer);
+
+    alSourceQueueBuffers(m_Source, BufferCount, m_Buffers.GetData());
+    alSourcePlay(m_Source);
+
+    AudioContext::CheckError();
+
+    Logger::LogVerbose("Created the audio mixer output at {} Hz", m_SampleRate);
+}
+
+void AudioMixer::DestroyOutput()
+{
+    if (!m_Source)
+        return;
+
+    ZoneScoped;
+
+    Audio::GetContext()->MakeCurrent();
+
+    alSourceStop(m_Source);
+    alSourcei(m_Source, AL_BUFFER, 0);
+    alDeleteSources(1, &m_Source);
+    alDeleteBuffers(BufferCount, m_Buffers.GetData());
+    AudioContext::CheckError();
+
+    m_Source = 0;
+}
+
+void AudioMixer::Update()
+{
+    if (!m_Source)
+        return;
+
+    ZoneScoped;
+
+    s32 processed = 0;
+    alGetSourcei(m_Source, AL_BUFFERS_PROCESSED, &processed);
+
+    for (s32 i = 0; i < processed; i++)
+    {
+        u32 buffer = 0;
+        alSourceUnqueueBuffers(m_Source, 1, &buffer);
+        Fill(buffer);
+        alSourceQueueBuffers(m_Source, 1, &buffer);
+    }
+
+    s32 state = 0;
+    alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+
+    // The source stops if all of its buffers were played before they could be refilled
+    if (state != AL_PLAYING)
+        alSourcePlay(m_Source);
+
+    AudioContext::CheckError();
+}
+
+void AudioMixer::Fill(const u32 buffer)
+{
+    Render(m_OutputSamples.GetData(), BufferFrameCount);
+    AudioKernels::ConvertToS16(m_OutputSamples.GetData(), m_OutputBuffer.GetData(), m_OutputSamples.GetSize());
+
+    alBufferData(
+        buffer,
+        AL_FORMAT_STEREO16,
+        m_OutputBuffer.GetData(),
+        static_cast<s32>(m_OutputBuffer.GetSize() * sizeof(s16)),
+        m_SampleRate
+    );
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+#include "Mountain/Containers/List.hpp"
+
+/// @file AudioMixer.hpp
+/// @brief Defines the Mountain::AudioMixer class.
+
+namespace Mountain
+{
+    class AudioBus;
+    class AudioTrack;
+
+    /// @brief Static class mixing short sounds in software and playing the result on a single OpenAL source.
+    /// @details This is meant for the many short sound effects a game can play at once, which would otherwise each need an
+    /// OpenAL source and be mixed by the driver. The sounds are resampled and mixed into their @c AudioBus with the
+    /// vectorized @c AudioKernels, then the buses are mixed into their parents up to the master bus.
+    ///
+    /// The output is rendered @c BufferFrameCount frames at a time on the audio streaming thread, so sounds start playing
+    /// after at most @c BufferCount buffers. Positional sounds and music should still be played with an @c AudioVoice.
+    ///
+    /// @c Render() doesn't use OpenAL, so the mixer can also be used without an audio device, e.g. in tests.
+    class AudioMixer
+    {
+        STATIC_CLASS(AudioMixer)
+
+        friend class Audio;
+        friend class AudioBus;
+
+    public:
+        /// @brief The number of buffers queued on the output source.
+        static constexpr u32 BufferCount = 4;
+        /// @brief The number of frames rendered at once, i.e. the number of samples for each channel of an output buffer.
+        static constexpr u32 BufferFrameCount = 1024;
+
+        /// @brief The maximum number of sounds playing at once. @c Play() fails when it is reached.
+        MOUNTAIN_API static inline u32 maxSoundCount = 512;
+
+        /// @brief Creates the master bus.
+        MOUNTAIN_API static void Initialize();
+
+        /// @brief Stops all the sounds and deletes the master bus. The other buses must have been deleted.
+        MOUNTAIN_API static void Shutdown();
+
+        /// @brief Starts playing @p track on @p bus, or on the master bus if it is @c nullptr.
+        /// @details The track must be a 16-bit mono or stereo track that isn't streamed. Unloading it stops the sound.
+        /// @param track The track to play.
+        /// @param bus The bus to mix the sound into.
+        /// @param volume The volume in the range [0, inf].
+        /// @param pitch The playback speed multiplier in the range ]0, inf].
+        /// @param pan The stereo panning in the range [-1, 1], from full left to full right.
+        /// @return Whether the sound will be played.
+        MOUNTAIN_API static bool Play(const AudioTrack& track, AudioBus* bus = nullptr, f32 volume = 1.f, f32 pitch = 1.f, f32 pan = 0.f);
+
+        /// @brief Stops all the sounds played on @p bus.
+        MOUNTAIN_API static void Stop(const AudioBus& bus);
+
+        /// @brief Stops all the sounds playing @p track.
+        /// @details This waits for the render in progress, so the track data can be freed once this returns.
+        MOUNTAIN_API static void Stop(const AudioTrack& track);
+
+        /// @brief Stops all the sounds.
+        MOUNTAIN_API static void StopAll();
+
+        /// @brief Mixes the next @p frameCount frames of all the sounds into @p output, as interleaved stereo samples.
+        /// @details This is called by the audio streaming thread to fill the output source, and can be called directly when
+        /// the mixer isn't playing on an audio device.
+        MOUNTAIN_API static void Render(f32* output, u32 frameCount);
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static AudioBus* GetMasterBus();
+
+        /// @brief Returns the sample rate of the output, which is the one of the current audio device.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static s32 GetSampleRate();
+
+        /// @brief Returns the number of sounds currently playing.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetSoundCount();
+
+    private:
+        struct Sound
+        {
+            /// @brief The track being played, which stops the sound before freeing its data.
+            const AudioTrack* track = nullptr;
+            AudioBus* bus = nullptr;
+            f32 gainLeft = 1.f;
+            f32 gainRight = 1.f;
+            f32 pitch = 1.f;
+            /// @brief The fixed-point playback position in frames.
+            u64 position = 0;
+        };
+
+        MOUNTAIN_API static inline AudioBus* m_MasterBus = nullptr;
+        /// @brief All the buses, sorted from the deepest to the master bus so that children are mixed before their parent.
+        MOUNTAIN_API static inline List<AudioBus*> m_Buses;
+
+        MOUNTAIN_API static inline List<Sound> m_Sounds;
+        /// @brief Held while rendering and while changing the buses or the sounds.
+        MOUNTAIN_API static inline std::mutex m_Mutex;
+
+        /// @brief The sounds played since the last render, which are kept apart to avoid waiting for the render in @c Play().
+        MOUNTAIN_API static inline List<Sound> m_PendingSounds;
+        MOUNTAIN_API static inline std::mutex m_PendingSoundsMutex;
+
+        /// @brief The number of sounds playing after the last render.
+        MOUNTAIN_API static inline std::atomic<usize> m_SoundCount = 0;
+
+        MOUNTAIN_API static inline s32 m_SampleRate = 48000;
+
+        // Output source, only used by the audio streaming thread or with the audio streaming lock held
+
+        MOUNTAIN_API static inline u32 m_Source = 0;
+        MOUNTAIN_API static inline Array<u32, BufferCount> m_Buffers{};
+        MOUNTAIN_API static inline List<f32> m_OutputSamples;
+        MOUNTAIN_API static inline List<s16> m_OutputBuffer;
+
+        static void RegisterBus(AudioBus* bus);
+
+        static void UnregisterBus(AudioBus* bus);
+
+        static void SetDucking(AudioBus* bus, AudioBus* sidechain);
+
+        /// @brief Computes the depth of each bus and sorts them by depth.
+        static void SortBuses();
+
+        /// @brief Renders at most @c BufferFrameCount frames.
+        static void RenderBlock(f32* output, u32 frameCount);
+
+        /// @brief Applies the processing of @p bus to its samples and returns the gain to mix them with.
+        static f32 ProcessBus(AudioBus& bus, u32 frameCount);
+
+        /// @brief Creates the output source and starts playing it in the current audio context.
+        static void CreateOutput();
+
+        /// @brief Deletes the output source, which must be done before its audio context is destroyed.
+        static void DestroyOutput();
+
+        /// @brief Renders in the output buffers that finished playing and queues them back.
+        /// @details This is called on the audio streaming thread.
+        static void Update();
+
+        /// @brief Renders the next block in @p buffer.
+        static void Fill(u32 buffer);
+    };
+}
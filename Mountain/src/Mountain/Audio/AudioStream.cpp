@@ -0,0 +1,272 @@
+#include "Mountain/Audio/AudioStream.hpp"
+
+#include <AL/al.h>
+
+#include <stb_vorbis.h>
+#include <minimp3/minimp3.h>
+#include <minimp3/minimp3_ex.h>
+
+#include "Mountain/Audio/Audio.hpp"
+#include "Mountain/Audio/AudioBuffer.hpp"
+#include "Mountain/Audio/AudioContext.hpp"
+#include "Mountain/Resource/AudioTrack.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+struct AudioStream::Decoder
+{
+    stb_vorbis* vorbis = nullptr;
+
+    mp3dec_ex_t mp3{};
+    bool mp3Opened = false;
+};
+
+AudioStream::AudioStream(const AudioTrack& track, const u32 source)
+    : m_Track(&track)
+    , m_Source(source)
+    , m_Decoder(new Decoder)
+{
+    if (!track.IsStreamed())
+        THROW(ArgumentException{"Cannot create an AudioStream for an AudioTrack that isn't streamed", "track"});
+
+    m_Format = AudioBuffer::AlFormatFromData(track.GetChannels(), track.GetBitDepth());
+    m_Samples.Resize(static_cast<usize>(BufferFrameCount) * track.GetChannels());
+
+    switch (track.GetFormat())
+    {
+        case AudioTrackFormat::OggVorbis:
+            m_Decoder->vorbis = stb_vorbis_open_memory(track.m_EncodedData, static_cast<int>(track.m_EncodedDataSize), nullptr, nullptr);
+            break;
+
+        case AudioTrackFormat::Mp3:
+            m_Decoder->mp3Opened = mp3dec_ex_open_buf(&m_Decoder->mp3, track.m_EncodedData, static_cast<size_t>(track.m_EncodedDataSize), MP3D_SEEK_TO_SAMPLE) == 0;
+            break;
+
+        case AudioTrackFormat::Wavefront:
+            break;
+    }
+
+    if (!m_Decoder->vorbis && !m_Decoder->mp3Opened)
+        Logger::LogError("Unable to open the decoder for streaming AudioTrack {}", track.GetName());
+
+    Audio::GetContext()->MakeCurrent();
+    alGenBuffers(BufferCount, m_Buffers.GetData());
+    AudioContext::CheckError();
+
+    Audio::RegisterStream(this);
+}
+
+AudioStream::~AudioStream()
+{
+    // Once unregistered, the streaming thread can't be updating this stream anymore
+    Audio::UnregisterStream(this);
+
+    Stop();
+
+    Audio::GetContext()->MakeCurrent();
+    alDeleteBuffers(BufferCount, m_Buffers.GetData());
+    AudioContext::CheckError();
+
+    if (m_Decoder->vorbis)
+        stb_vorbis_close(m_Decoder->vorbis);
+    if (m_Decoder->mp3Opened)
+        mp3dec_ex_close(&m_Decoder->mp3);
+
+    delete m_Decoder;
+}
+
+void AudioStream::Play(const f32 seconds)
+{
+    std::scoped_lock lock(m_Mutex);
+
+    SeekTime(seconds);
+    Restart(true);
+}
+
+void AudioStream::Stop()
+{
+    std::scoped_lock lock(m_Mutex);
+
+    Audio::GetContext()->MakeCurrent();
+    alSourceStop(m_Source);
+    // Setting the buffer of a stopped source to 0 removes all of its queued buffers
+    alSourcei(m_Source, AL_BUFFER, 0);
+    AudioContext::CheckError();
+
+    m_QueuedBuffers = 0;
+    m_Playing = false;
+}
+
+void AudioStream::Seek(const f32 seconds)
+{
+    std::scoped_lock lock(m_Mutex);
+
+    SeekTime(seconds);
+    Restart(m_Playing);
+}
+
+bool AudioStream::GetLooping() const
+{
+    std::scoped_lock lock(m_Mutex);
+    return m_Looping;
+}
+
+void AudioStream::SetLooping(const bool newLooping)
+{
+    std::scoped_lock lock(m_Mutex);
+    m_Looping = newLooping;
+}
+
+bool AudioStream::IsPlaying() const
+{
+    std::scoped_lock lock(m_Mutex);
+    return m_Playing;
+}
+
+void AudioStream::Update()
+{
+    std::scoped_lock lock(m_Mutex);
+
+    if (!m_Playing)
+        return;
+
+    s32 processed = 0;
+    alGetSourcei(m_Source, AL_BUFFERS_PROCESSED, &processed);
+
+    for (s32 i = 0; i < processed; i++)
+    {
+        u32 buffer = 0;
+        alSourceUnqueueBuffers(m_Source, 1, &buffer);
+        m_QueuedBuffers--;
+
+        if (!Fill(buffer))
+            continue;
+
+        alSourceQueueBuffers(m_Source, 1, &buffer);
+        m_QueuedBuffers++;
+    }
+
+    AudioContext::CheckError();
+
+    s32 state = 0;
+    alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+
+    if (state == AL_PLAYING)
+        return;
+
+    if (m_QueuedBuffers == 0)
+    {
+        // The end of the track was reached and everything was played
+        m_Playing = false;
+        return;
+    }
+
+    if (state == AL_STOPPED)
+    {
+        // The source ran out of buffers before they could be refilled, so resume it now that some were queued again
+        Logger::LogWarning("AudioTrack {} was played faster than it could be streamed", m_Track->GetName());
+        alSourcePlay(m_Source);
+    }
+}
+
+void AudioStream::Restart(const bool play)
+{
+    Audio::GetContext()->MakeCurrent();
+
+    alSourceStop(m_Source);
+    alSourcei(m_Source, AL_BUFFER, 0);
+    m_QueuedBuffers = 0;
+
+    for (const u32 buffer : m_Buffers)
+    {
+        if (!Fill(buffer))
+            break;
+
+        alSourceQueueBuffers(m_Source, 1, &buffer);
+        m_QueuedBuffers++;
+    }
+
+    m_Playing = play && m_QueuedBuffers > 0;
+    if (m_Playing)
+        alSourcePlay(m_Source);
+
+    AudioContext::CheckError();
+}
+
+bool AudioStream::Fill(const u32 buffer)
+{
+    ZoneScoped;
+
+    const u32 frameCount = Decode(BufferFrameCount);
+    if (frameCount == 0)
+        return false;
+
+    const s32 size = static_cast<s32>(frameCount * m_Track->GetChannels() * sizeof(s16));
+    alBufferData(buffer, m_Format, m_Samples.GetData(), size, m_Track->GetSampleRate());
+
+    return true;
+}
+
+u32 AudioStream::Decode(const u32 frameCount)
+{
+    const u16 channels = m_Track->GetChannels();
+
+    u32 decoded = 0;
+    bool restarted = false;
+
+    while (decoded < frameCount)
+    {
+        const u32 read = Read(m_Samples.GetData() + static_cast<usize>(decoded) * channels, frameCount - decoded);
+        decoded += read;
+
+        if (read > 0)
+        {
+            restarted = false;
+            continue;
+        }
+
+        // Stop if the track doesn't loop, or if it is empty and starting over didn't decode anything
+        if (!m_Looping || restarted)
+            break;
+
+        SeekFrame(0);
+        restarted = true;
+    }
+
+    return decoded;
+}
+
+u32 AudioStream::Read(s16* samples, const u32 frameCount)
+{
+    const u16 channels = m_Track->GetChannels();
+
+    if (m_Decoder->vorbis)
+        return static_cast<u32>(stb_vorbis_get_samples_short_interleaved(m_Decoder->vorbis, channels, samples, static_cast<int>(frameCount * channels)));
+
+    if (m_Decoder->mp3Opened)
+        return static_cast<u32>(mp3dec_ex_read(&m_Decoder->mp3, samples, static_cast<size_t>(frameCount) * channels) / channels);
+
+    return 0;
+}
+
+void AudioStream::SeekFrame(const u64 frame)
+{
+    if (m_Decoder->vorbis)
+    {
+        if (frame == 0)
+            stb_vorbis_seek_start(m_Decoder->vorbis);
+        else
+            stb_vorbis_seek(m_Decoder->vorbis, static_cast<unsigned int>(frame));
+    }
+    else if (m_Decoder->mp3Opened)
+    {
+        mp3dec_ex_seek(&m_Decoder->mp3, frame * m_Track->GetChannels());
+    }
+}
+
+void AudioStream::SeekTime(const f32 seconds)
+{
+    const u64 frame = static_cast<u64>(std::max(0.f, seconds) * static_cast<f32>(m_Track->GetSampleRate()));
+    SeekFrame(std::min(frame, m_Track->GetFrameCount()));
+}
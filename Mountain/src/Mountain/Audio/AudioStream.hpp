@@ -0,0 +1,102 @@
+#pragma once
+
+#include <mutex>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+#include "Mountain/Containers/List.hpp"
+
+/// @file AudioStream.hpp
+/// @brief Defines the Mountain::AudioStream class.
+
+namespace Mountain
+{
+    class AudioTrack;
+
+    /// @brief Plays a streamed @c AudioTrack on an OpenAL source by decoding it a few buffers at a time.
+    /// @details The stream keeps @c BufferCount OpenAL buffers queued on its source. The audio streaming thread started by
+    /// @c Audio::Initialize() refills each buffer once it has been played, so only a fraction of a second of the track is
+    /// decoded at any time.
+    /// When looping, the end and the start of the track are decoded in the same buffer, so there is no gap between them.
+    ///
+    /// Streams are owned by the @c AudioVoice playing the track, which is stopped, deleting its stream, before the track is
+    /// unloaded.
+    class AudioStream
+    {
+        friend class Audio;
+
+    public:
+        /// @brief The number of buffers queued on the source.
+        static constexpr u32 BufferCount = 4;
+        /// @brief The number of frames, i.e. samples for each channel, in a buffer.
+        static constexpr u32 BufferFrameCount = 8192;
+
+        /// @brief Creates a stream of @p track, played on the OpenAL @p source.
+        MOUNTAIN_API AudioStream(const AudioTrack& track, u32 source);
+
+        MOUNTAIN_API ~AudioStream();
+
+        DELETE_COPY_MOVE_OPERATIONS(AudioStream)
+
+        /// @brief Plays the track from @p seconds from its start.
+        MOUNTAIN_API void Play(f32 seconds = 0.f);
+
+        /// @brief Stops playing and removes all the buffers from the source.
+        MOUNTAIN_API void Stop();
+
+        /// @brief Moves the playback position to @p seconds from the start of the track, playing from there if it was playing.
+        MOUNTAIN_API void Seek(f32 seconds);
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool GetLooping() const;
+
+        MOUNTAIN_API void SetLooping(bool newLooping);
+
+        /// @brief Returns whether the stream is playing, including while it is waiting for buffers to be decoded.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsPlaying() const;
+
+    private:
+        struct Decoder;
+
+        const AudioTrack* m_Track = nullptr;
+        u32 m_Source = 0;
+        s32 m_Format = 0;
+
+        Array<u32, BufferCount> m_Buffers{};
+        /// @brief The number of buffers currently queued on the source.
+        u32 m_QueuedBuffers = 0;
+
+        Decoder* m_Decoder = nullptr;
+        /// @brief The interleaved 16-bit samples of the buffer being decoded.
+        List<s16> m_Samples;
+
+        bool m_Playing = false;
+        bool m_Looping = false;
+
+        /// @brief Held while using the decoder or the source, which are used by both the streaming thread and the owner of the stream.
+        mutable std::mutex m_Mutex;
+
+        /// @brief Rewinds the source, then fills and queues all the buffers from the current decoder position.
+        void Restart(bool play);
+
+        /// @brief Decodes the next frames of the track in @p buffer.
+        /// @return Whether any frame was decoded, which is only @c false at the end of a track that isn't looping.
+        bool Fill(u32 buffer);
+
+        /// @brief Decodes up to @p frameCount frames in @c m_Samples, starting over at the end of the track if looping.
+        /// @return The number of decoded frames.
+        u32 Decode(u32 frameCount);
+
+        /// @brief Decodes up to @p frameCount frames in @p samples without looping.
+        u32 Read(s16* samples, u32 frameCount);
+
+        void SeekFrame(u64 frame);
+
+        void SeekTime(f32 seconds);
+
+        /// @brief Refills the buffers that finished playing and queues them back on the source.
+        /// @details This is called on the audio streaming thread.
+        void Update();
+    };
+}
@@ -0,0 +1,386 @@
+#include "Mountain/Audio/VoiceManager.hpp"
+
+#include <AL/al.h>
+
+#include "Mountain/Audio/Audio.hpp"
+#include "Mountain/Audio/AudioContext.hpp"
+#include "Mountain/Audio/AudioStream.hpp"
+#include "Mountain/Input/Time.hpp"
+#include "Mountain/Resource/AudioTrack.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    /// @brief How much more audible a voice with a source is considered when sorting, so that voices with a similar
+    /// audibility don't keep exchanging their sources.
+    constexpr f32 RealVoiceBias = 1.25f;
+}
+
+AudioVoice::AudioVoice() { VoiceManager::Register(this); }
+
+AudioVoice::~AudioVoice()
+{
+    Stop();
+    VoiceManager::Unregister(this);
+}
+
+void AudioVoice::Play(AudioTrack& track)
+{
+    Stop();
+
+    m_Track = &track;
+    m_Playing = true;
+    m_Dirty = 0;
+
+    // Start right away if a source is free, the next VoiceManager::Update() takes it back if the voice isn't important enough
+    if (!VoiceManager::m_FreeSources.IsEmpty())
+    {
+        Audio::GetContext()->MakeCurrent();
+        VoiceManager::Realize(*this);
+    }
+}
+
+void AudioVoice::Stop()
+{
+    if (m_Source)
+    {
+        Audio::GetContext()->MakeCurrent();
+        VoiceManager::Virtualize(*this);
+    }
+
+    m_Playing = false;
+    m_Time = 0.f;
+}
+
+void AudioVoice::Seek(const f32 seconds)
+{
+    m_Time = std::max(0.f, seconds);
+    SetDirty(DirtyTime);
+}
+
+bool AudioVoice::IsPlaying() const { return m_Playing; }
+
+bool AudioVoice::IsVirtual() const { return m_Playing && m_Source == 0; }
+
+void AudioVoice::SetVolume(const f32 newVolume)
+{
+    const f32 volume = std::max(0.f, newVolume);
+    if (volume == m_Volume)
+        return;
+
+    m_Volume = volume;
+    SetDirty(DirtyGain);
+}
+
+void AudioVoice::SetPitch(const f32 newPitch)
+{
+    const f32 pitch = std::max(0.f, newPitch);
+    if (pitch == m_Pitch)
+        return;
+
+    m_Pitch = pitch;
+    SetDirty(DirtyPitch);
+}
+
+void AudioVoice::SetLooping(const bool newLooping)
+{
+    if (newLooping == m_Looping)
+        return;
+
+    m_Looping = newLooping;
+    SetDirty(DirtyLooping);
+}
+
+void AudioVoice::SetPosition(const Vector3& newPosition)
+{
+    if (newPosition == m_Position)
+        return;
+
+    m_Position = newPosition;
+    SetDirty(DirtyPosition);
+}
+
+void AudioVoice::SetVelocity(const Vector3& newVelocity)
+{
+    if (newVelocity == m_Velocity)
+        return;
+
+    m_Velocity = newVelocity;
+    SetDirty(DirtyVelocity);
+}
+
+void AudioVoice::SetDirty(const u8 flags) { m_Dirty |= flags; }
+
+void VoiceManager::Initialize()
+{
+    ZoneScoped;
+
+    AudioContext* const context = Audio::GetContext();
+    context->MakeCurrent();
+
+    u32 count = sourceCount;
+    const s32 maxSourceCount = context->GetMaxSourceCount(AudioSourceType::Mono);
+    if (maxSourceCount > 0)
+        count = std::min(count, static_cast<u32>(maxSourceCount));
+
+    // Reset the error state here to avoid stopping because of a different OpenAL error
+    AudioContext::CheckError();
+
+    for (u32 i = 0; i < count; i++)
+    {
+        u32 source = 0;
+        alGenSources(1, &source);
+
+        if (AudioContext::CheckError())
+            break;
+
+        m_Sources.Add(source);
+        m_FreeSources.Add(source);
+    }
+
+    Logger::LogVerbose("Created {} audio sources for the voice pool", m_Sources.GetSize());
+}
+
+void VoiceManager::Shutdown()
+{
+    ZoneScoped;
+
+    Audio::GetContext()->MakeCurrent();
+
+    for (AudioVoice* voice : m_Voices)
+    {
+        if (voice->m_Source)
+            Virtualize(*voice);
+    }
+
+    alDeleteSources(static_cast<s32>(m_Sources.GetSize()), m_Sources.GetData());
+    AudioContext::CheckError();
+
+    m_Sources.Clear();
+    m_FreeSources.Clear();
+}
+
+void VoiceManager::Update()
+{
+    ZoneScoped;
+
+    if (m_Voices.IsEmpty())
+        return;
+
+    Audio::GetContext()->MakeCurrent();
+
+    Vector3 listenerPosition;
+    alGetListenerfv(AL_POSITION, listenerPosition.Data());
+
+    const f32 deltaTime = Time::GetDeltaTimeUnscaled();
+
+    m_SortedVoices.Clear();
+    for (AudioVoice* voice : m_Voices)
+    {
+        if (!voice->m_Playing)
+            continue;
+
+        if (!Advance(*voice, deltaTime))
+        {
+            voice->Stop();
+            continue;
+        }
+
+        voice->m_Audibility = ComputeAudibility(*voice, listenerPosition);
+        m_SortedVoices.Add(voice);
+    }
+
+    std::sort(
+        m_SortedVoices.GetData(),
+        m_SortedVoices.GetData() + m_SortedVoices.GetSize(),
+        [](const AudioVoice* lhs, const AudioVoice* rhs)
+        {
+            if (lhs->priority != rhs->priority)
+                return lhs->priority > rhs->priority;
+
+            return lhs->m_Audibility * (lhs->m_Source ? RealVoiceBias : 1.f) > rhs->m_Audibility * (rhs->m_Source ? RealVoiceBias : 1.f);
+        }
+    );
+
+    const usize realCount = std::min(m_SortedVoices.GetSize(), m_Sources.GetSize());
+
+    // Take the sources of the voices that lost them first, so that they can be given to the more important ones
+    for (usize i = 0; i < m_SortedVoices.GetSize(); i++)
+    {
+        AudioVoice& voice = *m_SortedVoices[i];
+        if (voice.m_Source && (i >= realCount || voice.m_Audibility < audibilityThreshold))
+            Virtualize(voice);
+    }
+
+    for (usize i = 0; i < realCount; i++)
+    {
+        AudioVoice& voice = *m_SortedVoices[i];
+        if (voice.m_Audibility < audibilityThreshold)
+            continue;
+
+        if (voice.m_Source)
+            PushState(voice);
+        else
+            Realize(voice);
+    }
+}
+
+void VoiceManager::StopTrack(const AudioTrack& track)
+{
+    for (AudioVoice* voice : m_Voices)
+    {
+        if (voice->m_Track == &track && voice->m_Playing)
+            voice->Stop();
+    }
+}
+
+usize VoiceManager::GetVoiceCount() { return m_Voices.GetSize(); }
+
+usize VoiceManager::GetRealVoiceCount() { return m_Sources.GetSize() - m_FreeSources.GetSize(); }
+
+usize VoiceManager::GetSourceCount() { return m_Sources.GetSize(); }
+
+void VoiceManager::Register(AudioVoice* voice) { m_Voices.Add(voice); }
+
+void VoiceManager::Unregister(AudioVoice* voice) { m_Voices.Remove(voice); }
+
+void VoiceManager::Realize(AudioVoice& voice)
+{
+    const u32 source = m_FreeSources.Last();
+    m_FreeSources.RemoveLast();
+    voice.m_Source = source;
+
+    alSourcef(source, AL_GAIN, voice.m_Volume);
+    alSourcef(source, AL_PITCH, voice.m_Pitch);
+    alSourcefv(source, AL_POSITION, voice.m_Position.Data());
+    alSourcefv(source, AL_VELOCITY, voice.m_Velocity.Data());
+
+    if (voice.m_Track->IsStreamed())
+    {
+        // The stream loops by itself, OpenAL would only loop over the buffers currently queued
+        alSourcei(source, AL_LOOPING, AL_FALSE);
+
+        voice.m_Stream = new AudioStream(*voice.m_Track, source);
+        voice.m_Stream->SetLooping(voice.m_Looping);
+        voice.m_Stream->Play(voice.m_Time);
+    }
+    else
+    {
+        alSourcei(source, AL_LOOPING, voice.m_Looping);
+        alSourcei(source, AL_BUFFER, static_cast<s32>(voice.m_Track->GetBuffer()->GetHandle()));
+        alSourcef(source, AL_SEC_OFFSET, voice.m_Time);
+        alSourcePlay(source);
+    }
+
+    AudioContext::CheckError();
+
+    voice.m_Dirty = 0;
+}
+
+void VoiceManager::Virtualize(AudioVoice& voice)
+{
+    const u32 source = voice.m_Source;
+
+    if (voice.m_Stream)
+    {
+        // The stream doesn't know where the source is in the track, so keep the time estimated by Advance()
+        delete voice.m_Stream;
+        voice.m_Stream = nullptr;
+    }
+    else
+    {
+        alGetSourcef(source, AL_SEC_OFFSET, &voice.m_Time);
+        alSourceStop(source);
+        alSourcei(source, AL_BUFFER, 0);
+        AudioContext::CheckError();
+    }
+
+    m_FreeSources.Add(source);
+    voice.m_Source = 0;
+}
+
+bool VoiceManager::Advance(AudioVoice& voice, const f32 deltaTime)
+{
+    // Voices with a source end when OpenAL is done playing them
+    if (voice.m_Stream)
+    {
+        if (!voice.m_Stream->IsPlaying())
+            return false;
+    }
+    else if (voice.m_Source)
+    {
+        s32 state = 0;
+        alGetSourcei(voice.m_Source, AL_SOURCE_STATE, &state);
+        if (state == AL_STOPPED)
+            return false;
+    }
+
+    voice.m_Time += deltaTime * voice.m_Pitch;
+
+    const f32 duration = voice.m_Track->GetDuration();
+    if (voice.m_Time < duration)
+        return true;
+
+    // Virtual voices end when their time reaches the end of the track
+    if (!voice.m_Looping || duration <= 0.f)
+        return voice.m_Source != 0;
+
+    voice.m_Time = std::fmod(voice.m_Time, duration);
+    return true;
+}
+
+f32 VoiceManager::ComputeAudibility(const AudioVoice& voice, const Vector3& listenerPosition)
+{
+    // OpenAL doesn't spatialize tracks with more than one channel
+    if (voice.m_Track->GetChannels() > 1)
+        return voice.m_Volume;
+
+    // This is the attenuation of the default AL_INVERSE_DISTANCE_CLAMPED model, with a reference distance and rolloff
+    // factor of 1
+    const f32 distance = std::max(1.f, (voice.m_Position - listenerPosition).Length());
+    return voice.m_Volume / distance;
+}
+
+void VoiceManager::PushState(AudioVoice& voice)
+{
+    const u8 dirty = voice.m_Dirty;
+    if (dirty == 0)
+        return;
+
+    voice.m_Dirty = 0;
+
+    const u32 source = voice.m_Source;
+
+    if (dirty & AudioVoice::DirtyGain)
+        alSourcef(source, AL_GAIN, voice.m_Volume);
+
+    if (dirty & AudioVoice::DirtyPitch)
+        alSourcef(source, AL_PITCH, voice.m_Pitch);
+
+    if (dirty & AudioVoice::DirtyPosition)
+        alSourcefv(source, AL_POSITION, voice.m_Position.Data());
+
+    if (dirty & AudioVoice::DirtyVelocity)
+        alSourcefv(source, AL_VELOCITY, voice.m_Velocity.Data());
+
+    if (voice.m_Stream)
+    {
+        if (dirty & AudioVoice::DirtyLooping)
+            voice.m_Stream->SetLooping(voice.m_Looping);
+
+        if (dirty & AudioVoice::DirtyTime)
+            voice.m_Stream->Seek(voice.m_Time);
+    }
+    else
+    {
+        if (dirty & AudioVoice::DirtyLooping)
+            alSourcei(source, AL_LOOPING, voice.m_Looping);
+
+        if (dirty & AudioVoice::DirtyTime)
+            alSourcef(source, AL_SEC_OFFSET, voice.m_Time);
+    }
+
+    AudioContext::CheckError();
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Math/Vector3.hpp"
+
+/// @file VoiceManager.hpp
+/// @brief Defines the Mountain::AudioVoice and Mountain::VoiceManager classes.
+
+namespace Mountain
+{
+    class AudioStream;
+    class AudioTrack;
+
+    /// @brief A sound played using one of the OpenAL sources of the @c VoiceManager.
+    /// @details A voice only has a source while it is among the most important voices playing. Otherwise it is virtual: its
+    /// playback position keeps advancing without anything being heard, and it starts again from there once it gets a source
+    /// back.
+    ///
+    /// Changing the properties of a voice doesn't call OpenAL. They are marked as dirty and only sent once per frame by
+    /// @c VoiceManager::Update(), and only if the voice has a source.
+    class AudioVoice
+    {
+        friend class VoiceManager;
+
+    public:
+        /// @brief Voices with a higher priority get a source before the ones with a lower priority, whatever their audibility.
+        s32 priority = 0;
+
+        MOUNTAIN_API AudioVoice();
+
+        MOUNTAIN_API ~AudioVoice();
+
+        DELETE_COPY_MOVE_OPERATIONS(AudioVoice)
+
+        /// @brief Plays @p track from the start. The voice is stopped if the track is unloaded while it is playing.
+        MOUNTAIN_API void Play(AudioTrack& track);
+
+        MOUNTAIN_API void Stop();
+
+        /// @brief Moves the playback position to @p seconds from the start of the track.
+        MOUNTAIN_API void Seek(f32 seconds);
+
+        /// @brief Returns whether the voice is playing, whether it is virtual or not.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsPlaying() const;
+
+        /// @brief Returns whether the voice is playing without an OpenAL source.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsVirtual() const;
+
+        /// @brief Returns the playback position in seconds.
+        GETTER(f32, Time, m_Time)
+
+        /// @brief Returns the estimated gain of the voice at the listener position, computed by the last @c VoiceManager::Update().
+        GETTER(f32, Audibility, m_Audibility)
+
+        GETTER(f32, Volume, m_Volume)
+
+        /// @brief Sets the volume in the range [0, inf]. Default value is 1.
+        MOUNTAIN_API void SetVolume(f32 newVolume);
+
+        GETTER(f32, Pitch, m_Pitch)
+
+        /// @brief Sets the pitch in the range [0, inf]. Default value is 1.
+        MOUNTAIN_API void SetPitch(f32 newPitch);
+
+        GETTER(bool, Looping, m_Looping)
+
+        MOUNTAIN_API void SetLooping(bool newLooping);
+
+        GETTER(const Vector3&, Position, m_Position)
+
+        /// @brief Sets the position of the voice in OpenAL units. This is ignored for tracks with more than one channel.
+        MOUNTAIN_API void SetPosition(const Vector3& newPosition);
+
+        GETTER(const Vector3&, Velocity, m_Velocity)
+
+        /// @brief Sets the velocity of the voice in OpenAL units. This is ignored for tracks with more than one channel.
+        MOUNTAIN_API void SetVelocity(const Vector3& newVelocity);
+
+    private:
+        static constexpr u8 DirtyGain = 1 << 0;
+        static constexpr u8 DirtyPitch = 1 << 1;
+        static constexpr u8 DirtyLooping = 1 << 2;
+        static constexpr u8 DirtyPosition = 1 << 3;
+        static constexpr u8 DirtyVelocity = 1 << 4;
+        static constexpr u8 DirtyTime = 1 << 5;
+
+        AudioTrack* m_Track = nullptr;
+
+        f32 m_Volume = 1.f;
+        f32 m_Pitch = 1.f;
+        bool m_Looping = false;
+        Vector3 m_Position;
+        Vector3 m_Velocity;
+
+        bool m_Playing = false;
+        f32 m_Time = 0.f;
+        f32 m_Audibility = 0.f;
+
+        /// @brief The properties that changed since they were last sent to OpenAL.
+        u8 m_Dirty = 0;
+
+        /// @brief The OpenAL source of the voice, or 0 if it is virtual.
+        u32 m_Source = 0;
+        /// @brief The stream playing the track on @c m_Source if it is streamed.
+        AudioStream* m_Stream = nullptr;
+
+        void SetDirty(u8 flags);
+    };
+
+    /// @brief Static class sharing a fixed pool of OpenAL sources between all the @c AudioVoice instances.
+    /// @details Each frame, the playing voices are sorted by priority and then by audibility, which is their volume
+    /// attenuated by their distance to the listener. The first ones get a source and the others become virtual, so any
+    /// number of voices can play with a bounded number of OpenAL sources and calls.
+    ///
+    /// The sources are created in @c Audio::Initialize() and @c Update() is called by @c Audio::Update().
+    class VoiceManager
+    {
+        STATIC_CLASS(VoiceManager)
+
+        friend class AudioVoice;
+
+    public:
+        /// @brief The number of OpenAL sources to create in @c Initialize(), which is limited by the number of mono sources of
+        /// the audio context.
+        MOUNTAIN_API static inline u32 sourceCount = 32;
+
+        /// @brief Voices with a lower audibility don't get a source even if some are available.
+        MOUNTAIN_API static inline f32 audibilityThreshold = 0.001f;
+
+        /// @brief Creates the sources in the current audio context.
+        MOUNTAIN_API static void Initialize();
+
+        /// @brief Makes all the voices virtual and deletes the sources.
+        MOUNTAIN_API static void Shutdown();
+
+        /// @brief Advances the voices, gives the sources to the most important ones and sends their dirty properties to OpenAL.
+        MOUNTAIN_API static void Update();
+
+        /// @brief Stops all the voices playing @p track, which is called when it is unloaded.
+        MOUNTAIN_API static void StopTrack(const AudioTrack& track);
+
+        /// @brief Returns the number of voices, playing or not.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetVoiceCount();
+
+        /// @brief Returns the number of voices currently using a source.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetRealVoiceCount();
+
+        /// @brief Returns the number of sources in the pool.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetSourceCount();
+
+    private:
+        MOUNTAIN_API static inline List<AudioVoice*> m_Voices;
+
+        MOUNTAIN_API static inline List<u32> m_Sources;
+        MOUNTAIN_API static inline List<u32> m_FreeSources;
+
+        /// @brief The playing voices sorted by importance, kept between frames to avoid allocating it every time.
+        MOUNTAIN_API static inline List<AudioVoice*> m_SortedVoices;
+
+        static void Register(AudioVoice* voice);
+
+        static void Unregister(AudioVoice* voice);
+
+        /// @brief Gives a free source to @p voice and starts playing it at its current time.
+        static void Realize(AudioVoice& voice);
+
+        /// @brief Saves the playback position of @p voice and gives its source back to the pool.
+        static void Virtualize(AudioVoice& voice);
+
+        /// @brief Advances the playback position of @p voice by @p deltaTime.
+        /// @return Whether the voice is still playing.
+        static bool Advance(AudioVoice& voice, f32 deltaTime);
+
+        static f32 ComputeAudibility(const AudioVoice& voice, const Vector3& listenerPosition);
+
+        /// @brief Sends the dirty properties of @p voice to its source.
+        static void PushState(AudioVoice& voice);
+    };
+}
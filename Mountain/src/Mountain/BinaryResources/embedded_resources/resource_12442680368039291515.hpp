@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 108> resource_12442680368039291515 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,105,110,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,59,13,10,125,13,10,
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,105,110,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,59,13,10,125,13,10,
 	};
 	const auto resource_12442680368039291515_path = R"(shaders_internal\rectangle\rectangle.frag)";
 }
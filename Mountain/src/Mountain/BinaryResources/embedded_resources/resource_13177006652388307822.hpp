@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 2469> resource_13177006652388307822 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,99,111,109,109,111,110,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,109,111,100,117,108,101,95,116,121,112,101,115,46,103,108,115,108,34,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,116,105,109,101,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,115,104,97,112,101,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,118,101,108,111,99,105,116,121,95,111,118,101,114,95,108,105,102,101,116,105,109,101,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,102,111,114,99,101,95,111,118,101,114,95,108,105,102,101,116,105,109,101,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,99,111,108,111,114,95,111,118,101,114,95,108,105,102,101,116,105,109,101,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,99,111,108,111,114,95,98,121,95,115,112,101,101,100,46,103,108,115,108,34,13,10,13,10,117,110,105,102,111,114,109,32,117,105,110,116,32,101,110,97,98,108,101,100,77,111,100,117,108,101,115,59,13,10,13,10,99,111,110,115,116,32,118,101,99,50,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,83,116,97,114,116,86,101,108,111,99,105,116,121,32,61,32,118,101,99,50,40,48,46,102,44,32,45,49,46,102,41,59,13,10,99,111,110,115,116,32,118,101,99,50,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,79,102,102,115,101,116,32,61,32,118,101,99,50,40,48,46,102,41,59,13,10,99,111,110,115,116,32,118,101,99,50,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,86,101,108,111,99,105,116,121,32,61,32,118,101,99,50,40,48,46,102,41,59,13,10,13,10,80,97,114,116,105,99,108,101,32,78,101,119,80,97,114,116,105,99,108,101,40,41,13,10,123,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,114,101,115,117,108,116,32,61,32,80,97,114,116,105,99,108,101,40,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,76,105,102,101,116,105,109,101,44,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,83,116,97,114,116,83,105,122,101,44,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,83,116,97,114,116,86,101,108,111,99,105,116,121,44,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,79,102,102,115,101,116,44,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,68,101,102,97,117,108,116,86,101,108,111,99,105,116,121,44,13,10,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,83,116,97,114,116,67,111,108,111,114,13,10,32,32,32,32,41,59,13,10,13,10,32,32,32,32,105,102,32,40,40,101,110,97,98,108,101,100,77,111,100,117,108,101,115,32,38,32,77,111,100,117,108,101,84,121,112,101,115,83,104,97,112,101,41,32,33,61,32,48,41,13,10,32,32,32,32,32,32,32,32,83,104,97,112,101,73,110,105,116,105,97,108,105,122,101,40,114,101,115,117,108,116,41,59,13,10,13,10,32,32,32,32,114,101,115,117,108,116,46,115,116,97,114,116,86,101,108,111,99,105,116,121,32,42,61,32,112,97,114,116,105,99,108,101,83,112,101,101,100,59,13,10,13,10,32,32,32,32,114,101,116,117,114,110,32,114,101,115,117,108,116,59,13,10,125,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,105,100,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,32,61,32,112,97,114,116,105,99,108,101,115,91,105,100,93,59,32,47,47,32,87,101,32,116,97,107,101,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,99,117,114,114,101,110,116,32,112,97,114,116,105,99,108,101,32,104,101,114,101,32,115,111,32,119,101,32,110,101,101,100,32,116,111,32,114,101,109,101,109,98,101,114,32,116,111,32,114,101,105,110,115,101,114,116,32,105,116,32,105,110,32,116,104,101,32,98,117,102,102,101,114,32,98,101,102,111,114,101,32,101,120,105,116,105,110,103,13,10,13,10,32,32,32,32,105,102,32,40,33,108,105,118,101,80,97,114,116,105,99,108,101,115,91,105,100,93,41,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,13,10,32,32,32,32,105,102,32,40,112,97,114,116,105,99,108,101,46,108,105,102,101,116,105,109,101,32,60,61,32,48,46,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,102,32,40,112,97,114,116,105,99,108,101,46,108,105,102,101,116,105,109,101,32,62,32,78,101,103,97,116,105,118,101,73,110,102,105,110,105,116,121,41,13,10,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,108,105,118,101,80,97,114,116,105,99,108,101,115,91,105,100,93,32,61,32,102,97,108,115,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,108,105,102,101,116,105,109,101,32,61,32,78,101,103,97,116,105,118,101,73,110,102,105,110,105,116,121,59,32,47,47,32,85,115,101,32,110,101,103,97,116,105,118,101,32,105,110,102,105,110,105,116,121,32,97,115,32,97,32,102,108,97,103,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,115,91,105,100,93,32,61,32,112,97,114,116,105,99,108,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,32,32,32,32,32,32,32,32,125,13,10,32,32,32,32,32,32,32,32,101,108,115,101,13,10,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,108,105,118,101,80,97,114,116,105,99,108,101,115,91,105,100,93,32,61,32,116,114,117,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,32,61,32,78,101,119,80,97,114,116,105,99,108,101,40,41,59,13,10,32,32,32,32,32,32,32,32,125,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,108,105,102,101,116,105,109,101,32,45,61,32,100,101,108,116,97,84,105,109,101,59,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,99,111,108,111,114,32,61,32,112,97,114,116,105,99,108,101,83,116,97,114,116,67,111,108,111,114,59,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,115,105,122,101,32,61,32,112,97,114,116,105,99,108,101,83,116,97,114,116,83,105,122,101,59,13,10,32,32,32,32,118,101,99,50,32,118,101,108,111,99,105,116,121,32,61,32,112,97,114,116,105,99,108,101,46,115,116,97,114,116,86,101,108,111,99,105,116,121,59,13,10,13,10,32,32,32,32,47,47,32,77,111,100,117,108,101,115,32,117,112,100,97,116,101,115,13,10,32,32,32,32,105,102,32,40,40,101,110,97,98,108,101,100,77,111,100,117,108,101,115,32,38,32,77,111,100,117,108,101,84,121,112,101,115,86,101,108,111,99,105,116,121,79,118,101,114,76,105,102,101,116,105,109,101,41,32,33,61,32,48,41,13,10,32,32,32,32,32,32,32,32,86,101,108,111,99,105,116,121,79,118,101,114,76,105,102,101,116,105,109,101,85,112,100,97,116,101,40,112,97,114,116,105,99,108,101,44,32,118,101,108,111,99,105,116,121,41,59,13,10,32,32,32,32,105,102,32,40,40,101,110,97,98,108,101,100,77,111,100,117,108,101,115,32,38,32,77,111,100,117,108,101,84,121,112,101,115,70,111,114,99,101,79,118,101,114,76,105,102,101,116,105,109,101,41,32,33,61,32,48,41,13,10,32,32,32,32,32,32,32,32,70,111,114,99,101,79,118,101,114,76,105,102,101,116,105,109,101,85,112,100,97,116,101,40,112,97,114,116,105,99,108,101,44,32,112,97,114,116,105,99,108,101,46,97,99,99,117,109,117,108,97,116,101,100,86,101,108,111,99,105,116,121,41,59,13,10,32,32,32,32,105,102,32,40,40,101,110,97,98,108,101,100,77,111,100,117,108,101,115,32,38,32,77,111,100,117,108,101,84,121,112,101,115,67,111,108,111,114,79,118,101,114,76,105,102,101,116,105,109,101,41,32,33,61,32,48,41,13,10,32,32,32,32,32,32,32,32,67,111,108,111,114,79,118,101,114,76,105,102,101,116,105,109,101,85,112,100,97,116,101,40,112,97,114,116,105,99,108,101,41,59,13,10,32,32,32,32,105,102,32,40,40,101,110,97,98,108,101,100,77,111,100,117,108,101,115,32,38,32,77,111,100,117,108,101,84,121,112,101,115,67,111,108,111,114,66,121,83,112,101,101,100,41,32,33,61,32,48,41,13,10,32,32,32,32,32,32,32,32,67,111,108,111,114,66,121,83,112,101,101,100,85,112,100,97,116,101,40,112,97,114,116,105,99,108,101,44,32,83,113,117,97,114,101,100,76,101,110,103,116,104,40,118,101,108,111,99,105,116,121,41,41,59,13,10,13,10,32,32,32,32,118,101,108,111,99,105,116,121,32,43,61,32,112,97,114,116,105,99,108,101,46,97,99,99,117,109,117,108,97,116,101,100,86,101,108,111,99,105,116,121,59,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,43,61,32,118,101,108,111,99,105,116,121,32,42,32,100,101,108,116,97,84,105,109,101,59,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,115,91,105,100,93,32,61,32,112,97,114,116,105,99,108,101,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 838> resource_13177006652388307822 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,54,52,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,115,105,109,117,108,97,116,105,111,110,46,103,108,115,108,34,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,105,100,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,13,10,13,10,32,32,32,32,47,47,32,84,104,101,32,108,97,115,116,32,119,111,114,107,32,103,114,111,117,112,32,99,97,110,32,103,111,32,112,97,115,116,32,116,104,101,32,101,110,100,32,111,102,32,116,104,101,32,108,105,115,116,13,10,32,32,32,32,105,102,32,40,105,100,32,62,61,32,97,108,105,118,101,67,111,117,110,116,41,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,13,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,105,110,100,101,120,32,61,32,97,108,105,118,101,80,97,114,116,105,99,108,101,115,91,105,100,93,59,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,32,61,32,112,97,114,116,105,99,108,101,115,91,105,110,100,101,120,93,59,32,47,47,32,87,101,32,116,97,107,101,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,99,117,114,114,101,110,116,32,112,97,114,116,105,99,108,101,32,104,101,114,101,32,115,111,32,119,101,32,110,101,101,100,32,116,111,32,114,101,109,101,109,98,101,114,32,116,111,32,114,101,105,110,115,101,114,116,32,105,116,32,105,110,32,116,104,101,32,98,117,102,102,101,114,32,98,101,102,111,114,101,32,101,120,105,116,105,110,103,13,10,13,10,32,32,32,32,47,47,32,84,104,101,32,112,97,114,116,105,99,108,101,32,100,105,101,100,32,100,117,114,105,110,103,32,116,104,101,32,108,97,115,116,32,117,112,100,97,116,101,44,32,97,110,100,32,119,97,115,32,100,114,97,119,110,32,111,110,101,32,108,97,115,116,32,116,105,109,101,32,115,105,110,99,101,32,116,104,101,110,13,10,32,32,32,32,105,102,32,40,112,97,114,116,105,99,108,101,46,108,105,102,101,116,105,109,101,32,60,61,32,48,46,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,100,101,97,100,80,97,114,116,105,99,108,101,115,91,97,116,111,109,105,99,65,100,100,40,100,101,97,100,67,111,117,110,116,44,32,49,117,41,93,32,61,32,105,110,100,101,120,59,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,85,112,100,97,116,101,80,97,114,116,105,99,108,101,40,112,97,114,116,105,99,108,101,41,59,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,115,91,105,110,100,101,120,93,32,61,32,112,97,114,116,105,99,108,101,59,13,10,32,32,32,32,110,101,120,116,65,108,105,118,101,80,97,114,116,105,99,108,101,115,91,97,116,111,109,105,99,65,100,100,40,110,101,120,116,65,108,105,118,101,67,111,117,110,116,44,32,49,117,41,93,32,61,32,105,110,100,101,120,59,13,10,125,13,10,
 	};
 	const auto resource_13177006652388307822_path = R"(shaders_internal\particles\update.comp)";
 }
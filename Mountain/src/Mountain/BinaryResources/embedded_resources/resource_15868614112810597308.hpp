@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../resource_holder.hpp"
+
+namespace { 
+	const std::array<std::uint8_t, 543> resource_15868614112810597308 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,54,52,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,115,105,109,117,108,97,116,105,111,110,46,103,108,115,108,34,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,105,100,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,13,10,13,10,32,32,32,32,105,102,32,40,105,100,32,62,61,32,115,112,97,119,110,67,111,117,110,116,41,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,13,10,32,32,32,32,47,47,32,101,109,105,116,46,99,111,109,112,32,97,108,114,101,97,100,121,32,114,101,109,111,118,101,100,32,116,104,101,32,115,112,97,119,110,101,100,32,112,97,114,116,105,99,108,101,115,32,102,114,111,109,32,116,104,101,32,101,110,100,32,111,102,32,116,104,101,32,100,101,97,100,32,108,105,115,116,13,10,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,105,110,100,101,120,32,61,32,100,101,97,100,80,97,114,116,105,99,108,101,115,91,100,101,97,100,67,111,117,110,116,32,43,32,105,100,93,59,13,10,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,32,61,32,78,101,119,80,97,114,116,105,99,108,101,40,41,59,13,10,32,32,32,32,85,112,100,97,116,101,80,97,114,116,105,99,108,101,40,112,97,114,116,105,99,108,101,41,59,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,115,91,105,110,100,101,120,93,32,61,32,112,97,114,116,105,99,108,101,59,13,10,32,32,32,32,110,101,120,116,65,108,105,118,101,80,97,114,116,105,99,108,101,115,91,97,116,111,109,105,99,65,100,100,40,110,101,120,116,65,108,105,118,101,67,111,117,110,116,44,32,49,117,41,93,32,61,32,105,110,100,101,120,59,13,10,125,13,10,
+	};
+	const auto resource_15868614112810597308_path = R"(shaders_internal\particles\spawn.comp)";
+}
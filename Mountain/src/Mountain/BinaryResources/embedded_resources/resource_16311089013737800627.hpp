@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 228> resource_16311089013737800627 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,116,101,120,116,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,116,101,120,116,117,114,101,40,116,101,120,116,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,46,114,41,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 223> resource_16311089013737800627 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,105,110,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,116,101,120,116,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,116,101,120,116,117,114,101,40,116,101,120,116,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,46,114,41,59,13,10,125,13,10,
 	};
 	const auto resource_16311089013737800627_path = R"(shaders_internal\text\text.frag)";
 }
@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 203> resource_1659229443278887099 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,105,110,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,105,109,97,103,101,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,105,109,97,103,101,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,125,32,13,10,
+	const std::array<std::uint8_t, 512> resource_1659229443278887099 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,105,110,32,118,101,99,52,32,99,111,108,111,114,59,13,10,102,108,97,116,32,105,110,32,105,110,116,32,108,97,121,101,114,59,13,10,13,10,108,97,121,111,117,116,32,40,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,105,109,97,103,101,59,13,10,47,47,32,83,97,109,112,108,101,100,32,105,110,115,116,101,97,100,32,111,102,32,105,109,97,103,101,32,119,104,101,110,32,100,114,97,119,105,110,103,32,97,32,116,101,120,116,117,114,101,32,112,97,99,107,101,100,32,105,110,116,111,32,97,32,84,101,120,116,117,114,101,65,116,108,97,115,44,32,108,97,121,101,114,32,98,101,105,110,103,32,105,116,115,32,112,97,103,101,13,10,108,97,121,111,117,116,32,40,98,105,110,100,105,110,103,32,61,32,49,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,97,116,108,97,115,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,102,32,40,108,97,121,101,114,32,60,32,48,41,13,10,32,32,32,32,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,105,109,97,103,101,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,32,32,32,32,101,108,115,101,13,10,32,32,32,32,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,97,116,108,97,115,44,32,118,101,99,51,40,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,44,32,108,97,121,101,114,41,41,59,13,10,125,13,10,
 	};
 	const auto resource_1659229443278887099_path = R"(shaders_internal\texture\texture.frag)";
 }
@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 1135> resource_17150819399866535910 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,105,109,97,103,101,50,68,32,115,111,117,114,99,101,73,109,97,103,101,59,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,105,109,97,103,101,50,68,32,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,105,110,116,101,110,115,105,116,121,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,101,108,102,32,61,32,118,101,99,50,40,116,101,120,101,108,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,111,114,105,103,105,110,97,108,67,111,108,111,114,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,32,32,32,32,118,101,99,52,32,110,101,119,67,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,85,86,115,32,61,32,116,101,120,101,108,102,47,115,105,122,101,102,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,32,61,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,59,13,10,32,32,32,32,118,101,99,50,32,100,105,114,101,99,116,105,111,110,32,61,32,110,111,114,109,97,108,105,122,101,40,85,86,115,32,45,32,99,101,110,116,101,114,41,59,13,10,32,32,32,32,102,108,111,97,116,32,100,105,115,116,32,61,32,108,101,110,103,116,104,40,85,86,115,32,45,32,99,101,110,116,101,114,41,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,111,102,102,115,101,116,32,61,32,48,46,48,48,53,32,42,32,105,110,116,101,110,115,105,116,121,32,42,32,100,105,115,116,59,13,10,13,10,32,32,32,32,118,101,99,50,32,114,101,100,79,102,102,115,101,116,32,61,32,85,86,115,32,43,32,100,105,114,101,99,116,105,111,110,32,42,32,111,102,102,115,101,116,59,13,10,32,32,32,32,118,101,99,50,32,98,108,117,101,79,102,102,115,101,116,32,61,32,85,86,115,32,45,32,100,105,114,101,99,116,105,111,110,32,42,32,111,102,102,115,101,116,59,13,10,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,114,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,114,101,100,79,102,102,115,101,116,32,42,32,115,105,122,101,102,41,41,46,114,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,103,32,61,32,111,114,105,103,105,110,97,108,67,111,108,111,114,46,103,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,98,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,98,108,117,101,79,102,102,115,101,116,32,42,32,115,105,122,101,102,41,41,46,98,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,97,32,61,32,111,114,105,103,105,110,97,108,67,111,108,111,114,46,97,59,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,44,32,116,101,120,101,108,44,32,110,101,119,67,111,108,111,114,41,59,13,10,125,13,10,13,10,
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,105,109,97,103,101,50,68,32,115,111,117,114,99,101,73,109,97,103,101,59,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,105,109,97,103,101,50,68,32,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,105,110,116,101,110,115,105,116,121,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,101,108,102,32,61,32,118,101,99,50,40,116,101,120,101,108,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,111,114,105,103,105,110,97,108,67,111,108,111,114,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,32,32,32,32,118,101,99,52,32,110,101,119,67,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,85,86,115,32,61,32,116,101,120,101,108,102,47,115,105,122,101,102,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,32,61,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,59,13,10,32,32,32,32,118,101,99,50,32,100,105,114,101,99,116,105,111,110,32,61,32,110,111,114,109,97,108,105,122,101,40,85,86,115,32,45,32,99,101,110,116,101,114,41,59,13,10,32,32,32,32,102,108,111,97,116,32,100,105,115,116,32,61,32,108,101,110,103,116,104,40,85,86,115,32,45,32,99,101,110,116,101,114,41,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,111,102,102,115,101,116,32,61,32,48,46,48,48,53,32,42,32,105,110,116,101,110,115,105,116,121,32,42,32,100,105,115,116,59,13,10,13,10,32,32,32,32,118,101,99,50,32,114,101,100,79,102,102,115,101,116,32,61,32,85,86,115,32,43,32,100,105,114,101,99,116,105,111,110,32,42,32,111,102,102,115,101,116,59,13,10,32,32,32,32,118,101,99,50,32,98,108,117,101,79,102,102,115,101,116,32,61,32,85,86,115,32,45,32,100,105,114,101,99,116,105,111,110,32,42,32,111,102,102,115,101,116,59,13,10,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,114,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,114,101,100,79,102,102,115,101,116,32,42,32,115,105,122,101,102,41,41,46,114,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,103,32,61,32,111,114,105,103,105,110,97,108,67,111,108,111,114,46,103,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,98,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,98,108,117,101,79,102,102,115,101,116,32,42,32,115,105,122,101,102,41,41,46,98,59,13,10,32,32,32,32,110,101,119,67,111,108,111,114,46,97,32,61,32,111,114,105,103,105,110,97,108,67,111,108,111,114,46,97,59,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,44,32,116,101,120,101,108,44,32,110,101,119,67,111,108,111,114,41,59,13,10,125,13,10,13,10,
 	};
 	const auto resource_17150819399866535910_path = R"(shaders_internal\effects\chromatic_aberration_transverse.comp)";
 }
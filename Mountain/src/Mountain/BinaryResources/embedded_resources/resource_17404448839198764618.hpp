@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 721> resource_17404448839198764618 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,105,109,97,103,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,115,116,114,101,110,103,116,104,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,111,114,105,103,105,110,97,108,67,111,108,111,114,32,61,32,105,109,97,103,101,76,111,97,100,40,105,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,32,61,32,115,105,122,101,102,32,42,32,48,46,53,102,59,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,68,105,115,116,97,110,99,101,32,61,32,40,99,101,110,116,101,114,32,45,32,118,101,99,50,40,116,101,120,101,108,41,41,32,47,32,115,105,122,101,102,59,13,10,32,32,32,32,102,108,111,97,116,32,97,108,112,104,97,32,61,32,40,50,46,102,32,45,32,108,101,110,103,116,104,40,99,101,110,116,101,114,68,105,115,116,97,110,99,101,41,41,32,45,32,115,116,114,101,110,103,116,104,59,13,10,32,32,32,32,97,108,112,104,97,32,61,32,109,105,110,40,97,108,112,104,97,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,47,47,32,66,111,114,100,101,114,32,100,101,98,117,103,13,10,32,32,32,32,47,47,97,108,112,104,97,32,61,32,115,116,101,112,40,48,46,53,102,44,32,97,108,112,104,97,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,102,97,99,116,111,114,32,61,32,118,101,99,52,40,97,108,112,104,97,44,32,97,108,112,104,97,44,32,97,108,112,104,97,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,105,109,97,103,101,44,32,116,101,120,101,108,44,32,102,97,99,116,111,114,32,42,32,111,114,105,103,105,110,97,108,67,111,108,111,114,41,59,13,10,125,13,10,
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,105,109,97,103,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,115,116,114,101,110,103,116,104,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,111,114,105,103,105,110,97,108,67,111,108,111,114,32,61,32,105,109,97,103,101,76,111,97,100,40,105,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,32,61,32,115,105,122,101,102,32,42,32,48,46,53,102,59,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,68,105,115,116,97,110,99,101,32,61,32,40,99,101,110,116,101,114,32,45,32,118,101,99,50,40,116,101,120,101,108,41,41,32,47,32,115,105,122,101,102,59,13,10,32,32,32,32,102,108,111,97,116,32,97,108,112,104,97,32,61,32,40,50,46,102,32,45,32,108,101,110,103,116,104,40,99,101,110,116,101,114,68,105,115,116,97,110,99,101,41,41,32,45,32,115,116,114,101,110,103,116,104,59,13,10,32,32,32,32,97,108,112,104,97,32,61,32,109,105,110,40,97,108,112,104,97,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,47,47,32,66,111,114,100,101,114,32,100,101,98,117,103,13,10,32,32,32,32,47,47,97,108,112,104,97,32,61,32,115,116,101,112,40,48,46,53,102,44,32,97,108,112,104,97,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,102,97,99,116,111,114,32,61,32,118,101,99,52,40,97,108,112,104,97,44,32,97,108,112,104,97,44,32,97,108,112,104,97,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,105,109,97,103,101,44,32,116,101,120,101,108,44,32,102,97,99,116,111,114,32,42,32,111,114,105,103,105,110,97,108,67,111,108,111,114,41,59,13,10,125,13,10,
 	};
 	const auto resource_17404448839198764618_path = R"(shaders_internal\effects\vignette.comp)";
 }
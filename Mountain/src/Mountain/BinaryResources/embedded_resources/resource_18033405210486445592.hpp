@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../resource_holder.hpp"
+
+namespace { 
+	const std::array<std::uint8_t, 314> resource_18033405210486445592 {
+		47,47,32,80,101,114,45,102,114,97,109,101,32,100,97,116,97,32,115,104,97,114,101,100,32,98,121,32,97,108,108,32,116,104,101,32,105,110,116,101,114,110,97,108,32,115,104,97,100,101,114,115,44,32,117,112,100,97,116,101,100,32,98,121,32,116,104,101,32,68,114,97,119,32,99,108,97,115,115,32,119,104,101,110,32,116,104,101,32,99,97,109,101,114,97,32,99,104,97,110,103,101,115,13,10,108,97,121,111,117,116,32,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,70,114,97,109,101,13,10,123,13,10,32,32,32,32,109,97,116,52,32,112,114,111,106,101,99,116,105,111,110,59,32,47,47,32,80,114,111,106,101,99,116,105,111,110,32,109,97,116,114,105,120,32,109,117,108,116,105,112,108,105,101,100,32,98,121,32,116,104,101,32,99,97,109,101,114,97,32,109,97,116,114,105,120,13,10,32,32,32,32,109,97,116,52,32,99,97,109,101,114,97,59,13,10,32,32,32,32,118,101,99,50,32,99,97,109,101,114,97,83,99,97,108,101,59,13,10,32,32,32,32,102,108,111,97,116,32,116,105,109,101,59,32,47,47,32,84,111,116,97,108,32,116,105,109,101,32,105,110,32,115,101,99,111,110,100,115,13,10,125,59,13,10,
+	};
+	const auto resource_18033405210486445592_path = R"(shaders_internal\frame.glsl)";
+}
@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 966> resource_332208238769912247 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,99,111,109,109,111,110,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,13,10,111,117,116,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,105,110,116,32,112,97,114,116,105,99,108,101,65,108,105,118,101,59,13,10,32,32,32,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,79,117,116,59,13,10,13,10,117,110,105,102,111,114,109,32,109,97,116,52,32,112,114,111,106,101,99,116,105,111,110,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,121,115,116,101,109,80,111,115,105,116,105,111,110,59,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,121,115,116,101,109,82,111,116,97,116,105,111,110,59,32,47,47,32,102,108,111,97,116,32,99,111,115,82,111,116,97,116,105,111,110,44,32,102,108,111,97,116,32,115,105,110,82,111,116,97,116,105,111,110,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,65,108,105,118,101,32,61,32,105,110,116,40,108,105,118,101,80,97,114,116,105,99,108,101,115,91,103,108,95,73,110,115,116,97,110,99,101,73,68,93,41,59,13,10,13,10,32,32,32,32,47,47,32,73,102,32,116,104,101,32,112,97,114,116,105,99,108,101,32,105,115,32,100,101,97,100,44,32,119,101,32,100,111,110,39,116,32,99,97,114,101,32,97,98,111,117,116,32,105,116,115,32,118,101,114,116,101,120,32,112,111,115,105,116,105,111,110,32,97,115,32,105,116,32,119,105,108,108,32,98,101,32,100,105,115,99,97,114,100,101,100,32,105,110,32,116,104,101,32,103,101,111,109,101,116,114,121,47,102,114,97,103,109,101,110,116,32,115,104,97,100,101,114,32,97,110,121,119,97,121,13,10,32,32,32,32,105,102,32,40,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,65,108,105,118,101,32,61,61,32,48,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,48,46,102,44,32,48,46,102,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,32,32,32,32,103,108,95,80,111,105,110,116,83,105,122,101,32,61,32,48,46,102,59,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,32,61,32,112,97,114,116,105,99,108,101,115,91,103,108,95,73,110,115,116,97,110,99,101,73,68,93,59,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,61,32,112,97,114,116,105,99,108,101,46,99,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,114,111,116,97,116,101,100,79,102,102,115,101,116,32,61,32,82,111,116,97,116,101,100,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,44,32,115,121,115,116,101,109,82,111,116,97,116,105,111,110,41,59,13,10,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,40,112,114,111,106,101,99,116,105,111,110,32,42,32,118,101,99,52,40,115,121,115,116,101,109,80,111,115,105,116,105,111,110,32,43,32,114,111,116,97,116,101,100,79,102,102,115,101,116,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,103,108,95,80,111,105,110,116,83,105,122,101,32,61,32,112,97,114,116,105,99,108,101,46,115,105,122,101,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 610> resource_332208238769912247 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,99,111,109,109,111,110,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,46,46,47,102,114,97,109,101,46,103,108,115,108,34,13,10,13,10,111,117,116,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,79,117,116,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,121,115,116,101,109,80,111,115,105,116,105,111,110,59,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,121,115,116,101,109,82,111,116,97,116,105,111,110,59,32,47,47,32,102,108,111,97,116,32,99,111,115,82,111,116,97,116,105,111,110,44,32,102,108,111,97,116,32,115,105,110,82,111,116,97,116,105,111,110,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,32,61,32,112,97,114,116,105,99,108,101,115,91,97,108,105,118,101,80,97,114,116,105,99,108,101,115,91,103,108,95,73,110,115,116,97,110,99,101,73,68,93,93,59,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,61,32,112,97,114,116,105,99,108,101,46,99,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,114,111,116,97,116,101,100,79,102,102,115,101,116,32,61,32,82,111,116,97,116,101,100,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,44,32,115,121,115,116,101,109,82,111,116,97,116,105,111,110,41,59,13,10,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,40,112,114,111,106,101,99,116,105,111,110,32,42,32,118,101,99,52,40,115,121,115,116,101,109,80,111,115,105,116,105,111,110,32,43,32,114,111,116,97,116,101,100,79,102,102,115,101,116,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,103,108,95,80,111,105,110,116,83,105,122,101,32,61,32,112,97,114,116,105,99,108,101,46,115,105,122,101,59,13,10,125,13,10,
 	};
 	const auto resource_332208238769912247_path = R"(shaders_internal\particles\draw_point\draw_point.vert)";
 }
@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 588> resource_4319606583867259020 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,105,110,32,118,101,99,50,32,112,49,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,49,41,32,105,110,32,118,101,99,50,32,112,50,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,50,41,32,105,110,32,118,101,99,50,32,112,51,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,51,41,32,105,110,32,118,101,99,52,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,109,97,116,52,32,112,114,111,106,101,99,116,105,111,110,59,13,10,13,10,111,117,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,99,111,108,111,114,32,61,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,112,111,115,59,13,10,32,32,32,32,115,119,105,116,99,104,32,40,103,108,95,86,101,114,116,101,120,73,68,32,37,32,51,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,48,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,49,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,49,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,50,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,50,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,51,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,32,32,32,32,125,13,10,32,32,32,32,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,40,112,114,111,106,101,99,116,105,111,110,32,42,32,118,101,99,52,40,112,111,115,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,125,13,10,
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,102,114,97,109,101,46,103,108,115,108,34,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,105,110,32,118,101,99,50,32,112,49,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,49,41,32,105,110,32,118,101,99,50,32,112,50,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,50,41,32,105,110,32,118,101,99,50,32,112,51,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,51,41,32,105,110,32,118,101,99,52,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,111,117,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,99,111,108,111,114,32,61,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,112,111,115,59,13,10,32,32,32,32,115,119,105,116,99,104,32,40,103,108,95,86,101,114,116,101,120,73,68,32,37,32,51,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,48,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,49,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,49,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,50,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,50,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,32,61,32,112,51,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,32,32,32,32,125,13,10,32,32,32,32,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,40,112,114,111,106,101,99,116,105,111,110,32,42,32,118,101,99,52,40,112,111,115,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,125,13,10,
 	};
 	const auto resource_4319606583867259020_path = R"(shaders_internal\triangle\triangle.vert)";
 }
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../resource_holder.hpp"
+
+namespace { 
+	const std::array<std::uint8_t, 1067> resource_5095878105932637176 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,115,105,109,117,108,97,116,105,111,110,46,103,108,115,108,34,13,10,13,10,117,110,105,102,111,114,109,32,98,111,111,108,32,115,112,97,119,110,105,110,103,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,101,109,105,115,115,105,111,110,82,97,116,101,79,118,101,114,84,105,109,101,59,13,10,47,47,32,84,104,101,32,112,97,114,116,105,99,108,101,115,32,115,112,97,119,110,101,100,32,98,121,32,116,104,101,32,98,117,114,115,116,115,32,97,110,100,32,116,104,101,32,100,105,115,116,97,110,99,101,32,116,114,97,118,101,108,101,100,32,98,121,32,116,104,101,32,115,121,115,116,101,109,44,32,119,104,105,99,104,32,111,110,108,121,32,100,101,112,101,110,100,32,111,110,32,116,104,101,32,67,80,85,32,115,116,97,116,101,13,10,117,110,105,102,111,114,109,32,117,105,110,116,32,101,120,116,114,97,83,112,97,119,110,67,111,117,110,116,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,117,105,110,116,32,99,111,117,110,116,32,61,32,48,59,13,10,13,10,32,32,32,32,105,102,32,40,115,112,97,119,110,105,110,103,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,102,32,40,115,112,97,119,110,84,105,109,101,114,32,60,61,32,48,46,102,32,38,38,32,101,109,105,115,115,105,111,110,82,97,116,101,79,118,101,114,84,105,109,101,32,62,32,48,46,102,41,13,10,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,108,111,97,116,32,115,112,97,119,110,68,101,108,97,121,32,61,32,49,46,102,32,47,32,101,109,105,115,115,105,111,110,82,97,116,101,79,118,101,114,84,105,109,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,117,105,110,116,32,111,118,101,114,84,105,109,101,67,111,117,110,116,32,61,32,117,105,110,116,40,97,98,115,40,115,112,97,119,110,84,105,109,101,114,41,32,47,32,115,112,97,119,110,68,101,108,97,121,41,32,43,32,49,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,115,112,97,119,110,84,105,109,101,114,32,43,61,32,115,112,97,119,110,68,101,108,97,121,32,42,32,102,108,111,97,116,40,111,118,101,114,84,105,109,101,67,111,117,110,116,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,117,110,116,32,43,61,32,111,118,101,114,84,105,109,101,67,111,117,110,116,59,13,10,32,32,32,32,32,32,32,32,125,13,10,13,10,32,32,32,32,32,32,32,32,99,111,117,110,116,32,43,61,32,101,120,116,114,97,83,112,97,119,110,67,111,117,110,116,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,115,112,97,119,110,84,105,109,101,114,32,45,61,32,100,101,108,116,97,84,105,109,101,59,13,10,13,10,32,32,32,32,47,47,32,79,110,108,121,32,116,104,101,32,102,114,101,101,32,115,108,111,116,115,32,99,97,110,32,98,101,32,117,115,101,100,44,32,116,104,101,32,112,97,114,116,105,99,108,101,115,32,116,104,97,116,32,100,111,110,39,116,32,102,105,116,32,97,114,101,32,110,101,118,101,114,32,115,112,97,119,110,101,100,13,10,32,32,32,32,115,112,97,119,110,67,111,117,110,116,32,61,32,109,105,110,40,99,111,117,110,116,44,32,100,101,97,100,67,111,117,110,116,41,59,13,10,32,32,32,32,100,101,97,100,67,111,117,110,116,32,45,61,32,115,112,97,119,110,67,111,117,110,116,59,13,10,13,10,32,32,32,32,115,112,97,119,110,68,105,115,112,97,116,99,104,91,48,93,32,61,32,87,111,114,107,71,114,111,117,112,67,111,117,110,116,40,115,112,97,119,110,67,111,117,110,116,41,59,13,10,32,32,32,32,115,112,97,119,110,68,105,115,112,97,116,99,104,91,49,93,32,61,32,49,59,13,10,32,32,32,32,115,112,97,119,110,68,105,115,112,97,116,99,104,91,50,93,32,61,32,49,59,13,10,125,13,10,
+	};
+	const auto resource_5095878105932637176_path = R"(shaders_internal\particles\emit.comp)";
+}
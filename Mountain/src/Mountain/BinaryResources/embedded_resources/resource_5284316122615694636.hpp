@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 505> resource_5284316122615694636 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,105,110,32,118,101,99,50,32,118,101,114,116,101,120,80,111,115,105,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,49,41,32,105,110,32,109,97,116,52,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,53,41,32,105,110,32,109,97,116,52,32,117,118,80,114,111,106,101,99,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,57,41,32,105,110,32,118,101,99,52,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,109,97,116,52,32,112,114,111,106,101,99,116,105,111,110,59,13,10,13,10,111,117,116,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,111,117,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,52,32,112,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,118,101,114,116,101,120,80,111,115,105,116,105,111,110,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,13,10,32,32,32,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,32,61,32,40,117,118,80,114,111,106,101,99,116,105,111,110,32,42,32,112,111,115,105,116,105,111,110,41,46,120,121,59,13,10,32,32,32,32,99,111,108,111,114,32,61,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,112,114,111,106,101,99,116,105,111,110,32,42,32,40,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,42,32,112,111,115,105,116,105,111,110,41,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 600> resource_5284316122615694636 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,102,114,97,109,101,46,103,108,115,108,34,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,48,41,32,105,110,32,118,101,99,50,32,118,101,114,116,101,120,80,111,115,105,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,49,41,32,105,110,32,109,97,116,52,32,116,114,97,110,115,102,111,114,109,97,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,53,41,32,105,110,32,109,97,116,52,32,117,118,80,114,111,106,101,99,116,105,111,110,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,57,41,32,105,110,32,118,101,99,52,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,108,97,121,111,117,116,32,40,108,111,99,97,116,105,111,110,32,61,32,49,48,41,32,105,110,32,105,110,116,32,105,110,115,116,97,110,99,101,76,97,121,101,114,59,13,10,13,10,111,117,116,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,111,117,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,102,108,97,116,32,111,117,116,32,105,110,116,32,108,97,121,101,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,52,32,112,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,118,101,114,116,101,120,80,111,115,105,116,105,111,110,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,13,10,32,32,32,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,32,61,32,40,117,118,80,114,111,106,101,99,116,105,111,110,32,42,32,112,111,115,105,116,105,111,110,41,46,120,121,59,13,10,32,32,32,32,99,111,108,111,114,32,61,32,105,110,115,116,97,110,99,101,67,111,108,111,114,59,13,10,32,32,32,32,108,97,121,101,114,32,61,32,105,110,115,116,97,110,99,101,76,97,121,101,114,59,13,10,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,112,114,111,106,101,99,116,105,111,110,32,42,32,40,116,114,97,110,115,102,111,114,109,97,116,105,111,110,32,42,32,112,111,115,105,116,105,111,110,41,59,13,10,125,13,10,
 	};
 	const auto resource_5284316122615694636_path = R"(shaders_internal\texture\texture.vert)";
 }
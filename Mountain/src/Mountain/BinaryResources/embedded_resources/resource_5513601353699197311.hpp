@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 590> resource_5513601353699197311 {
-		13,10,115,116,114,117,99,116,32,80,97,114,116,105,99,108,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,108,105,102,101,116,105,109,101,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,115,105,122,101,59,13,10,32,32,32,32,118,101,99,50,32,115,116,97,114,116,86,101,108,111,99,105,116,121,59,13,10,32,32,32,32,118,101,99,50,32,111,102,102,115,101,116,59,13,10,32,32,32,32,118,101,99,50,32,97,99,99,117,109,117,108,97,116,101,100,86,101,108,111,99,105,116,121,59,13,10,32,32,32,32,118,101,99,52,32,99,111,108,111,114,59,13,10,125,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,99,111,104,101,114,101,110,116,32,98,117,102,102,101,114,32,65,108,105,118,101,80,97,114,116,105,99,108,101,115,13,10,123,13,10,32,32,32,32,98,111,111,108,32,108,105,118,101,80,97,114,116,105,99,108,101,115,91,93,59,32,47,47,32,116,114,117,101,32,105,102,32,116,104,101,32,112,97,114,116,105,99,108,101,32,105,115,32,97,108,105,118,101,32,97,110,100,32,115,104,111,117,108,100,32,98,101,32,117,112,100,97,116,101,100,32,97,110,100,32,100,114,97,119,110,13,10,125,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,98,117,102,102,101,114,32,80,97,114,116,105,99,108,101,115,13,10,123,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,115,91,93,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,117,105,110,116,32,112,97,114,116,105,99,108,101,67,111,117,110,116,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,100,101,108,116,97,84,105,109,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,76,105,102,101,116,105,109,101,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,112,101,101,100,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,112,97,114,116,105,99,108,101,83,116,97,114,116,67,111,108,111,114,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,116,97,114,116,83,105,122,101,59,13,10,
+	const std::array<std::uint8_t, 589> resource_5513601353699197311 {
+		13,10,115,116,114,117,99,116,32,80,97,114,116,105,99,108,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,108,105,102,101,116,105,109,101,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,115,105,122,101,59,13,10,32,32,32,32,118,101,99,50,32,115,116,97,114,116,86,101,108,111,99,105,116,121,59,13,10,32,32,32,32,118,101,99,50,32,111,102,102,115,101,116,59,13,10,32,32,32,32,118,101,99,50,32,97,99,99,117,109,117,108,97,116,101,100,86,101,108,111,99,105,116,121,59,13,10,32,32,32,32,118,101,99,52,32,99,111,108,111,114,59,13,10,125,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,98,117,102,102,101,114,32,65,108,105,118,101,80,97,114,116,105,99,108,101,115,13,10,123,13,10,32,32,32,32,117,105,110,116,32,97,108,105,118,101,80,97,114,116,105,99,108,101,115,91,93,59,32,47,47,32,73,110,100,105,99,101,115,32,105,110,32,112,97,114,116,105,99,108,101,115,32,111,102,32,116,104,101,32,108,105,118,105,110,103,32,112,97,114,116,105,99,108,101,115,44,32,105,110,32,110,111,32,112,97,114,116,105,99,117,108,97,114,32,111,114,100,101,114,13,10,125,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,98,117,102,102,101,114,32,80,97,114,116,105,99,108,101,115,13,10,123,13,10,32,32,32,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,115,91,93,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,117,105,110,116,32,112,97,114,116,105,99,108,101,67,111,117,110,116,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,100,101,108,116,97,84,105,109,101,59,13,10,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,76,105,102,101,116,105,109,101,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,112,101,101,100,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,112,97,114,116,105,99,108,101,83,116,97,114,116,67,111,108,111,114,59,13,10,117,110,105,102,111,114,109,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,116,97,114,116,83,105,122,101,59,13,10,
 	};
 	const auto resource_5513601353699197311_path = R"(shaders_internal\particles\common.glsl)";
 }
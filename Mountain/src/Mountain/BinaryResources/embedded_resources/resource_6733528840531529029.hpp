@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 3439> resource_6733528840531529029 {
-		35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,99,111,109,109,111,110,46,103,108,115,108,34,13,10,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,67,105,114,99,108,101,32,61,32,48,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,76,105,110,101,32,61,32,49,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,82,101,99,116,97,110,103,108,101,32,61,32,50,59,13,10,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,82,97,110,100,111,109,32,61,32,48,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,76,111,111,112,32,61,32,49,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,80,105,110,103,80,111,110,103,32,61,32,50,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,66,117,114,115,116,83,112,114,101,97,100,32,61,32,51,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,65,114,99,13,10,123,13,10,32,32,32,32,117,105,110,116,32,109,111,100,101,59,13,10,32,32,32,32,102,108,111,97,116,32,115,112,114,101,97,100,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,67,105,114,99,108,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,47,47,32,65,32,118,97,108,117,101,32,111,102,32,48,32,109,101,97,110,115,32,116,104,101,32,112,97,114,116,105,99,108,101,115,32,99,97,110,32,111,110,108,121,32,115,112,97,119,110,32,111,110,32,116,104,101,32,101,100,103,101,32,111,102,32,116,104,101,32,114,97,100,105,117,115,44,32,119,104,105,108,101,32,49,32,109,101,97,110,115,32,116,104,101,121,32,99,97,110,32,115,112,97,119,110,32,101,118,101,114,121,119,104,101,114,101,32,119,105,116,104,105,110,32,116,104,101,32,103,105,118,101,110,32,114,97,100,105,117,115,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,59,13,10,32,32,32,32,47,47,32,65,110,103,108,101,32,105,110,32,114,97,100,105,97,110,115,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,50,112,105,93,13,10,32,32,32,32,102,108,111,97,116,32,97,114,99,65,110,103,108,101,59,13,10,32,32,32,32,83,104,97,112,101,65,114,99,32,97,114,99,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,76,105,110,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,83,104,97,112,101,65,114,99,32,97,114,99,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,82,101,99,116,97,110,103,108,101,13,10,123,13,10,32,32,32,32,47,47,32,83,101,101,32,83,104,97,112,101,67,105,114,99,108,101,58,58,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,13,10,32,32,32,32,118,101,99,50,32,115,99,97,108,101,84,104,105,99,107,110,101,115,115,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,115,116,114,117,99,116,32,83,104,97,112,101,13,10,123,13,10,32,32,32,32,117,105,110,116,32,116,121,112,101,59,13,10,13,10,32,32,32,32,83,104,97,112,101,67,105,114,99,108,101,32,99,105,114,99,108,101,59,13,10,32,32,32,32,83,104,97,112,101,76,105,110,101,32,108,105,110,101,59,13,10,32,32,32,32,83,104,97,112,101,82,101,99,116,97,110,103,108,101,32,114,101,99,116,97,110,103,108,101,59,13,10,13,10,32,32,32,32,118,101,99,50,32,111,102,102,115,101,116,59,13,10,32,32,32,32,102,108,111,97,116,32,114,111,116,97,116,105,111,110,59,13,10,32,32,32,32,118,101,99,50,32,115,99,97,108,101,59,13,10,125,32,115,104,97,112,101,59,13,10,13,10,118,111,105,100,32,83,104,97,112,101,73,110,105,116,105,97,108,105,122,101,40,105,110,111,117,116,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,41,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,105,100,32,61,32,102,108,111,97,116,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,41,32,47,32,102,108,111,97,116,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,41,59,13,10,32,32,32,32,118,101,99,50,32,114,97,110,100,111,109,83,101,101,100,32,61,32,118,101,99,50,40,105,100,44,32,102,114,97,99,116,40,116,105,109,101,32,42,32,48,46,49,102,41,41,59,13,10,13,10,32,32,32,32,115,119,105,116,99,104,32,40,115,104,97,112,101,46,116,121,112,101,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,67,105,114,99,108,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,114,97,110,100,111,109,80,111,105,110,116,32,61,32,82,97,110,100,111,109,80,111,105,110,116,73,110,65,114,99,40,114,97,110,100,111,109,83,101,101,100,44,32,118,101,99,50,40,48,46,102,41,44,32,49,46,102,44,32,115,104,97,112,101,46,99,105,114,99,108,101,46,97,114,99,65,110,103,108,101,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,114,97,110,100,111,109,80,111,105,110,116,32,61,32,82,111,116,97,116,101,100,40,114,97,110,100,111,109,80,111,105,110,116,44,32,115,104,97,112,101,46,114,111,116,97,116,105,111,110,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,114,97,110,100,111,109,80,111,105,110,116,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,43,32,110,111,114,109,97,108,105,122,101,40,114,97,110,100,111,109,80,111,105,110,116,41,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,115,116,97,114,116,86,101,108,111,99,105,116,121,32,61,32,110,111,114,109,97,108,105,122,101,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,41,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,115,104,97,112,101,46,115,99,97,108,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,76,105,110,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,82,101,99,116,97,110,103,108,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,61,32,82,97,110,100,111,109,40,114,97,110,100,111,109,83,101,101,100,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,82,97,110,100,111,109,80,111,105,110,116,73,110,82,101,99,116,97,110,103,108,101,40,114,97,110,100,111,109,83,101,101,100,32,42,32,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,44,32,118,101,99,50,40,48,46,102,41,44,32,118,101,99,50,40,49,46,102,41,41,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,84,79,68,79,32,45,32,79,112,116,105,109,105,122,97,116,105,111,110,32,112,111,115,115,105,98,108,101,32,105,102,32,115,99,97,108,101,84,104,105,99,107,110,101,115,115,32,61,61,32,118,101,99,50,40,49,46,102,41,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,61,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,98,111,116,116,111,109,82,101,99,116,97,110,103,108,101,65,114,101,97,32,61,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,121,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,116,111,116,97,108,65,114,101,97,32,61,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,43,32,98,111,116,116,111,109,82,101,99,116,97,110,103,108,101,65,114,101,97,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,109,105,116,32,61,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,47,32,116,111,116,97,108,65,114,101,97,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,60,61,32,108,105,109,105,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,61,32,49,46,102,32,43,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,45,32,49,46,102,41,32,42,32,48,46,53,102,32,42,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,45,61,32,118,101,99,50,40,48,46,53,102,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,60,61,32,108,105,109,105,116,32,42,32,48,46,53,102,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,45,49,46,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,125,13,10,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,61,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,45,32,48,46,53,102,41,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,61,32,49,46,102,32,43,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,45,32,49,46,102,41,32,42,32,48,46,53,102,32,42,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,121,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,45,61,32,48,46,53,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,62,61,32,40,49,46,102,32,43,32,108,105,109,105,116,41,32,42,32,48,46,53,102,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,45,49,46,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,125,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,115,104,97,112,101,46,115,99,97,108,101,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,82,111,116,97,116,101,100,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,44,32,115,104,97,112,101,46,114,111,116,97,116,105,111,110,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,115,116,97,114,116,86,101,108,111,99,105,116,121,32,61,32,110,111,114,109,97,108,105,122,101,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,43,61,32,115,104,97,112,101,46,111,102,102,115,101,116,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 3434> resource_6733528840531529029 {
+		35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,99,111,109,109,111,110,46,103,108,115,108,34,13,10,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,67,105,114,99,108,101,32,61,32,48,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,76,105,110,101,32,61,32,49,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,84,121,112,101,82,101,99,116,97,110,103,108,101,32,61,32,50,59,13,10,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,82,97,110,100,111,109,32,61,32,48,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,76,111,111,112,32,61,32,49,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,80,105,110,103,80,111,110,103,32,61,32,50,59,13,10,99,111,110,115,116,32,117,105,110,116,32,83,104,97,112,101,65,114,99,77,111,100,101,66,117,114,115,116,83,112,114,101,97,100,32,61,32,51,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,65,114,99,13,10,123,13,10,32,32,32,32,117,105,110,116,32,109,111,100,101,59,13,10,32,32,32,32,102,108,111,97,116,32,115,112,114,101,97,100,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,67,105,114,99,108,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,47,47,32,65,32,118,97,108,117,101,32,111,102,32,48,32,109,101,97,110,115,32,116,104,101,32,112,97,114,116,105,99,108,101,115,32,99,97,110,32,111,110,108,121,32,115,112,97,119,110,32,111,110,32,116,104,101,32,101,100,103,101,32,111,102,32,116,104,101,32,114,97,100,105,117,115,44,32,119,104,105,108,101,32,49,32,109,101,97,110,115,32,116,104,101,121,32,99,97,110,32,115,112,97,119,110,32,101,118,101,114,121,119,104,101,114,101,32,119,105,116,104,105,110,32,116,104,101,32,103,105,118,101,110,32,114,97,100,105,117,115,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,59,13,10,32,32,32,32,47,47,32,65,110,103,108,101,32,105,110,32,114,97,100,105,97,110,115,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,50,112,105,93,13,10,32,32,32,32,102,108,111,97,116,32,97,114,99,65,110,103,108,101,59,13,10,32,32,32,32,83,104,97,112,101,65,114,99,32,97,114,99,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,76,105,110,101,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,83,104,97,112,101,65,114,99,32,97,114,99,59,13,10,125,59,13,10,13,10,115,116,114,117,99,116,32,83,104,97,112,101,82,101,99,116,97,110,103,108,101,13,10,123,13,10,32,32,32,32,47,47,32,83,101,101,32,83,104,97,112,101,67,105,114,99,108,101,58,58,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,13,10,32,32,32,32,118,101,99,50,32,115,99,97,108,101,84,104,105,99,107,110,101,115,115,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,115,116,114,117,99,116,32,83,104,97,112,101,13,10,123,13,10,32,32,32,32,117,105,110,116,32,116,121,112,101,59,13,10,13,10,32,32,32,32,83,104,97,112,101,67,105,114,99,108,101,32,99,105,114,99,108,101,59,13,10,32,32,32,32,83,104,97,112,101,76,105,110,101,32,108,105,110,101,59,13,10,32,32,32,32,83,104,97,112,101,82,101,99,116,97,110,103,108,101,32,114,101,99,116,97,110,103,108,101,59,13,10,13,10,32,32,32,32,118,101,99,50,32,111,102,102,115,101,116,59,13,10,32,32,32,32,102,108,111,97,116,32,114,111,116,97,116,105,111,110,59,13,10,32,32,32,32,118,101,99,50,32,115,99,97,108,101,59,13,10,125,32,115,104,97,112,101,59,13,10,13,10,118,111,105,100,32,83,104,97,112,101,73,110,105,116,105,97,108,105,122,101,40,105,110,111,117,116,32,80,97,114,116,105,99,108,101,32,112,97,114,116,105,99,108,101,41,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,105,100,32,61,32,102,108,111,97,116,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,41,32,47,32,102,108,111,97,116,40,112,97,114,116,105,99,108,101,67,111,117,110,116,41,59,13,10,32,32,32,32,118,101,99,50,32,114,97,110,100,111,109,83,101,101,100,32,61,32,118,101,99,50,40,105,100,44,32,102,114,97,99,116,40,116,105,109,101,32,42,32,48,46,49,102,41,41,59,13,10,13,10,32,32,32,32,115,119,105,116,99,104,32,40,115,104,97,112,101,46,116,121,112,101,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,67,105,114,99,108,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,50,32,114,97,110,100,111,109,80,111,105,110,116,32,61,32,82,97,110,100,111,109,80,111,105,110,116,73,110,65,114,99,40,114,97,110,100,111,109,83,101,101,100,44,32,118,101,99,50,40,48,46,102,41,44,32,49,46,102,44,32,115,104,97,112,101,46,99,105,114,99,108,101,46,97,114,99,65,110,103,108,101,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,114,97,110,100,111,109,80,111,105,110,116,32,61,32,82,111,116,97,116,101,100,40,114,97,110,100,111,109,80,111,105,110,116,44,32,115,104,97,112,101,46,114,111,116,97,116,105,111,110,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,114,97,110,100,111,109,80,111,105,110,116,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,43,32,110,111,114,109,97,108,105,122,101,40,114,97,110,100,111,109,80,111,105,110,116,41,32,42,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,99,105,114,99,108,101,46,114,97,100,105,117,115,84,104,105,99,107,110,101,115,115,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,115,116,97,114,116,86,101,108,111,99,105,116,121,32,61,32,110,111,114,109,97,108,105,122,101,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,41,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,115,104,97,112,101,46,115,99,97,108,101,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,76,105,110,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,13,10,32,32,32,32,32,32,32,32,99,97,115,101,32,83,104,97,112,101,84,121,112,101,82,101,99,116,97,110,103,108,101,58,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,61,32,82,97,110,100,111,109,40,114,97,110,100,111,109,83,101,101,100,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,82,97,110,100,111,109,80,111,105,110,116,73,110,82,101,99,116,97,110,103,108,101,40,114,97,110,100,111,109,83,101,101,100,32,42,32,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,44,32,118,101,99,50,40,48,46,102,41,44,32,118,101,99,50,40,49,46,102,41,41,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,84,79,68,79,32,45,32,79,112,116,105,109,105,122,97,116,105,111,110,32,112,111,115,115,105,98,108,101,32,105,102,32,115,99,97,108,101,84,104,105,99,107,110,101,115,115,32,61,61,32,118,101,99,50,40,49,46,102,41,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,61,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,98,111,116,116,111,109,82,101,99,116,97,110,103,108,101,65,114,101,97,32,61,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,121,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,116,111,116,97,108,65,114,101,97,32,61,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,43,32,98,111,116,116,111,109,82,101,99,116,97,110,103,108,101,65,114,101,97,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,109,105,116,32,61,32,114,105,103,104,116,82,101,99,116,97,110,103,108,101,65,114,101,97,32,47,32,116,111,116,97,108,65,114,101,97,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,60,61,32,108,105,109,105,116,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,61,32,49,46,102,32,43,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,45,32,49,46,102,41,32,42,32,48,46,53,102,32,42,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,45,61,32,118,101,99,50,40,48,46,53,102,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,60,61,32,108,105,109,105,116,32,42,32,48,46,53,102,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,45,49,46,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,125,13,10,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,13,10,32,32,32,32,32,32,32,32,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,61,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,120,32,45,32,48,46,53,102,41,32,42,32,40,49,46,102,32,45,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,120,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,61,32,49,46,102,32,43,32,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,45,32,49,46,102,41,32,42,32,48,46,53,102,32,42,32,115,104,97,112,101,46,114,101,99,116,97,110,103,108,101,46,115,99,97,108,101,84,104,105,99,107,110,101,115,115,46,121,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,46,121,32,45,61,32,48,46,53,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,99,116,97,110,103,108,101,67,104,111,105,99,101,32,62,61,32,40,49,46,102,32,43,32,108,105,109,105,116,41,32,42,32,48,46,53,102,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,45,49,46,102,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,125,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,42,61,32,115,104,97,112,101,46,115,99,97,108,101,59,13,10,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,61,32,82,111,116,97,116,101,100,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,44,32,115,104,97,112,101,46,114,111,116,97,116,105,111,110,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,112,97,114,116,105,99,108,101,46,115,116,97,114,116,86,101,108,111,99,105,116,121,32,61,32,110,111,114,109,97,108,105,122,101,40,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,41,59,13,10,32,32,32,32,32,32,32,32,32,32,32,32,98,114,101,97,107,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,112,97,114,116,105,99,108,101,46,111,102,102,115,101,116,32,43,61,32,115,104,97,112,101,46,111,102,102,115,101,116,59,13,10,125,13,10,
 	};
 	const auto resource_6733528840531529029_path = R"(shaders_internal\particles\shape.glsl)";
 }
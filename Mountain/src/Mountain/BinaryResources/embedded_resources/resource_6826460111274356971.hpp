@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 1868> resource_6826460111274356971 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,115,116,114,117,99,116,32,76,105,103,104,116,83,111,117,114,99,101,13,10,123,13,10,32,32,32,32,118,101,99,52,32,99,111,108,111,114,59,13,10,32,32,32,32,102,108,111,97,116,32,105,110,116,101,110,115,105,116,121,59,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,77,105,110,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,77,97,120,59,13,10,32,32,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,59,13,10,125,59,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,105,110,32,118,101,99,50,32,102,114,97,103,109,101,110,116,80,111,115,105,116,105,111,110,59,13,10,13,10,117,110,105,102,111,114,109,32,109,97,116,52,32,99,97,109,101,114,97,59,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,99,97,108,101,59,32,47,47,32,82,101,110,100,101,114,84,97,114,103,101,116,32,115,99,97,108,101,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,97,99,116,117,97,108,83,99,97,108,101,59,32,47,47,32,82,101,110,100,101,114,84,97,114,103,101,116,32,115,99,97,108,101,32,42,32,67,97,109,101,114,97,32,115,99,97,108,101,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,114,97,109,101,98,117,102,102,101,114,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,99,111,108,111,114,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,97,109,98,105,101,110,116,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,105,110,116,32,108,105,103,104,116,83,111,117,114,99,101,67,111,117,110,116,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,76,105,103,104,116,115,13,10,123,13,10,32,32,32,32,76,105,103,104,116,83,111,117,114,99,101,32,108,105,103,104,116,83,111,117,114,99,101,115,91,93,59,13,10,125,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,47,47,32,84,79,68,79,32,45,32,65,100,100,32,98,108,111,111,109,13,10,13,10,102,108,111,97,116,32,76,105,103,104,116,65,116,116,101,110,117,97,116,105,111,110,40,102,108,111,97,116,32,120,41,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,120,50,32,61,32,120,32,42,32,120,59,13,10,32,32,32,32,102,108,111,97,116,32,105,110,116,101,114,32,61,32,49,46,102,32,45,32,50,46,102,32,42,32,120,50,32,43,32,120,50,32,42,32,120,50,59,13,10,32,32,32,32,114,101,116,117,114,110,32,105,110,116,101,114,32,42,32,105,110,116,101,114,59,13,10,125,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,52,32,98,97,115,101,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,102,114,97,109,101,98,117,102,102,101,114,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,13,10,32,32,32,32,47,47,32,67,111,109,112,117,116,101,32,108,105,103,104,116,32,99,111,108,111,114,13,10,32,32,32,32,118,101,99,52,32,108,105,103,104,116,67,111,108,111,114,32,61,32,97,109,98,105,101,110,116,67,111,108,111,114,59,13,10,32,32,32,32,102,111,114,32,40,105,110,116,32,105,32,61,32,48,59,32,105,32,60,32,108,105,103,104,116,83,111,117,114,99,101,67,111,117,110,116,59,32,105,43,43,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,76,105,103,104,116,83,111,117,114,99,101,32,108,105,103,104,116,83,111,117,114,99,101,32,61,32,108,105,103,104,116,83,111,117,114,99,101,115,91,105,93,59,13,10,32,32,32,32,32,32,32,32,118,101,99,50,32,108,105,103,104,116,83,111,117,114,99,101,80,111,115,105,116,105,111,110,32,61,32,40,99,97,109,101,114,97,32,42,32,118,101,99,52,40,108,105,103,104,116,83,111,117,114,99,101,46,112,111,115,105,116,105,111,110,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,32,42,32,115,99,97,108,101,59,13,10,13,10,32,32,32,32,32,32,32,32,118,101,99,50,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,32,61,32,40,108,105,103,104,116,83,111,117,114,99,101,80,111,115,105,116,105,111,110,32,45,32,102,114,97,103,109,101,110,116,80,111,115,105,116,105,111,110,41,32,47,32,97,99,116,117,97,108,83,99,97,108,101,59,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,61,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,120,32,42,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,120,32,43,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,121,32,42,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,121,59,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,32,61,32,108,105,103,104,116,83,111,117,114,99,101,46,114,97,100,105,117,115,32,42,32,108,105,103,104,116,83,111,117,114,99,101,46,114,97,100,105,117,115,59,13,10,32,32,32,32,32,32,32,32,105,102,32,40,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,62,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,116,105,110,117,101,59,13,10,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,97,116,116,101,110,117,97,116,105,111,110,32,61,32,76,105,103,104,116,65,116,116,101,110,117,97,116,105,111,110,40,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,47,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,41,59,13,10,13,10,32,32,32,32,32,32,32,32,108,105,103,104,116,67,111,108,111,114,32,43,61,32,108,105,103,104,116,83,111,117,114,99,101,46,99,111,108,111,114,32,42,32,108,105,103,104,116,83,111,117,114,99,101,46,105,110,116,101,110,115,105,116,121,32,42,32,97,116,116,101,110,117,97,116,105,111,110,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,67,108,97,109,112,32,116,104,101,32,108,105,103,104,116,32,99,111,108,111,114,32,99,111,109,112,111,110,101,110,116,115,32,98,101,116,119,101,101,110,32,48,32,97,110,100,32,49,13,10,32,32,32,32,108,105,103,104,116,67,111,108,111,114,32,61,32,99,108,97,109,112,40,108,105,103,104,116,67,111,108,111,114,44,32,118,101,99,52,40,48,46,102,41,44,32,118,101,99,52,40,49,46,102,41,41,59,13,10,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,108,105,103,104,116,67,111,108,111,114,32,42,32,98,97,115,101,67,111,108,111,114,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 1874> resource_6826460111274356971 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,102,114,97,109,101,46,103,108,115,108,34,13,10,13,10,115,116,114,117,99,116,32,76,105,103,104,116,83,111,117,114,99,101,13,10,123,13,10,32,32,32,32,118,101,99,52,32,99,111,108,111,114,59,13,10,32,32,32,32,102,108,111,97,116,32,105,110,116,101,110,115,105,116,121,59,13,10,32,32,32,32,102,108,111,97,116,32,114,97,100,105,117,115,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,77,105,110,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,77,97,120,59,13,10,32,32,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,59,13,10,125,59,13,10,13,10,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,105,110,32,118,101,99,50,32,102,114,97,103,109,101,110,116,80,111,115,105,116,105,111,110,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,115,99,97,108,101,59,32,47,47,32,82,101,110,100,101,114,84,97,114,103,101,116,32,115,99,97,108,101,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,97,99,116,117,97,108,83,99,97,108,101,59,32,47,47,32,82,101,110,100,101,114,84,97,114,103,101,116,32,115,99,97,108,101,32,42,32,67,97,109,101,114,97,32,115,99,97,108,101,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,114,97,109,101,98,117,102,102,101,114,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,99,111,108,111,114,59,13,10,117,110,105,102,111,114,109,32,118,101,99,52,32,97,109,98,105,101,110,116,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,105,110,116,32,108,105,103,104,116,83,111,117,114,99,101,67,111,117,110,116,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,76,105,103,104,116,115,13,10,123,13,10,32,32,32,32,76,105,103,104,116,83,111,117,114,99,101,32,108,105,103,104,116,83,111,117,114,99,101,115,91,93,59,13,10,125,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,47,47,32,84,79,68,79,32,45,32,65,100,100,32,98,108,111,111,109,13,10,13,10,102,108,111,97,116,32,76,105,103,104,116,65,116,116,101,110,117,97,116,105,111,110,40,102,108,111,97,116,32,120,41,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,120,50,32,61,32,120,32,42,32,120,59,13,10,32,32,32,32,102,108,111,97,116,32,105,110,116,101,114,32,61,32,49,46,102,32,45,32,50,46,102,32,42,32,120,50,32,43,32,120,50,32,42,32,120,50,59,13,10,32,32,32,32,114,101,116,117,114,110,32,105,110,116,101,114,32,42,32,105,110,116,101,114,59,13,10,125,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,52,32,98,97,115,101,67,111,108,111,114,32,61,32,99,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,102,114,97,109,101,98,117,102,102,101,114,44,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,13,10,32,32,32,32,47,47,32,67,111,109,112,117,116,101,32,108,105,103,104,116,32,99,111,108,111,114,13,10,32,32,32,32,118,101,99,52,32,108,105,103,104,116,67,111,108,111,114,32,61,32,97,109,98,105,101,110,116,67,111,108,111,114,59,13,10,32,32,32,32,102,111,114,32,40,105,110,116,32,105,32,61,32,48,59,32,105,32,60,32,108,105,103,104,116,83,111,117,114,99,101,67,111,117,110,116,59,32,105,43,43,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,76,105,103,104,116,83,111,117,114,99,101,32,108,105,103,104,116,83,111,117,114,99,101,32,61,32,108,105,103,104,116,83,111,117,114,99,101,115,91,105,93,59,13,10,32,32,32,32,32,32,32,32,118,101,99,50,32,108,105,103,104,116,83,111,117,114,99,101,80,111,115,105,116,105,111,110,32,61,32,40,99,97,109,101,114,97,32,42,32,118,101,99,52,40,108,105,103,104,116,83,111,117,114,99,101,46,112,111,115,105,116,105,111,110,44,32,48,46,102,44,32,49,46,102,41,41,46,120,121,32,42,32,115,99,97,108,101,59,13,10,13,10,32,32,32,32,32,32,32,32,118,101,99,50,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,32,61,32,40,108,105,103,104,116,83,111,117,114,99,101,80,111,115,105,116,105,111,110,32,45,32,102,114,97,103,109,101,110,116,80,111,115,105,116,105,111,110,41,32,47,32,97,99,116,117,97,108,83,99,97,108,101,59,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,61,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,120,32,42,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,120,32,43,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,121,32,42,32,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,46,121,59,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,32,61,32,108,105,103,104,116,83,111,117,114,99,101,46,114,97,100,105,117,115,32,42,32,108,105,103,104,116,83,111,117,114,99,101,46,114,97,100,105,117,115,59,13,10,32,32,32,32,32,32,32,32,105,102,32,40,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,62,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,116,105,110,117,101,59,13,10,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,97,116,116,101,110,117,97,116,105,111,110,32,61,32,76,105,103,104,116,65,116,116,101,110,117,97,116,105,111,110,40,108,105,103,104,116,84,111,70,114,97,103,109,101,110,116,68,105,115,116,97,110,99,101,83,113,117,97,114,101,100,32,47,32,108,105,103,104,116,83,111,117,114,99,101,82,97,100,105,117,115,83,113,117,97,114,101,100,41,59,13,10,13,10,32,32,32,32,32,32,32,32,108,105,103,104,116,67,111,108,111,114,32,43,61,32,108,105,103,104,116,83,111,117,114,99,101,46,99,111,108,111,114,32,42,32,108,105,103,104,116,83,111,117,114,99,101,46,105,110,116,101,110,115,105,116,121,32,42,32,97,116,116,101,110,117,97,116,105,111,110,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,67,108,97,109,112,32,116,104,101,32,108,105,103,104,116,32,99,111,108,111,114,32,99,111,109,112,111,110,101,110,116,115,32,98,101,116,119,101,101,110,32,48,32,97,110,100,32,49,13,10,32,32,32,32,108,105,103,104,116,67,111,108,111,114,32,61,32,99,108,97,109,112,40,108,105,103,104,116,67,111,108,111,114,44,32,118,101,99,52,40,48,46,102,41,44,32,118,101,99,52,40,49,46,102,41,41,59,13,10,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,108,105,103,104,116,67,111,108,111,114,32,42,32,98,97,115,101,67,111,108,111,114,59,13,10,125,13,10,
 	};
 	const auto resource_6826460111274356971_path = R"(shaders_internal\render_target\render_target.frag)";
 }
@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 1039> resource_6975910120903775418 {
-		239,187,191,35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,105,109,97,103,101,50,68,32,115,111,117,114,99,101,73,109,97,103,101,59,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,105,109,97,103,101,50,68,32,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,99,111,104,101,114,101,110,116,32,98,117,102,102,101,114,32,75,101,114,110,101,108,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,119,101,105,103,104,116,91,93,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,105,110,116,32,114,97,100,105,117,115,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,101,108,102,32,61,32,118,101,99,50,40,116,101,120,101,108,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,110,101,119,67,111,108,111,114,32,61,32,118,101,99,52,40,48,46,48,102,41,59,13,10,13,10,32,32,32,32,110,101,119,67,111,108,111,114,32,43,61,32,119,101,105,103,104,116,91,48,93,32,42,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,13,10,32,32,32,32,102,111,114,32,40,105,110,116,32,105,32,61,32,49,59,32,105,32,60,61,32,114,97,100,105,117,115,59,32,105,43,43,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,110,116,32,121,49,32,61,32,99,108,97,109,112,40,116,101,120,101,108,46,121,32,43,32,105,44,32,48,44,32,115,105,122,101,46,121,32,45,32,49,41,59,13,10,32,32,32,32,32,32,32,32,105,110,116,32,121,50,32,61,32,99,108,97,109,112,40,116,101,120,101,108,46,121,32,45,32,105,44,32,48,44,32,115,105,122,101,46,121,32,45,32,49,41,59,13,10,13,10,32,32,32,32,32,32,32,32,118,101,99,52,32,118,49,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,116,101,120,101,108,46,120,44,32,121,49,41,41,59,13,10,32,32,32,32,32,32,32,32,118,101,99,52,32,118,50,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,116,101,120,101,108,46,120,44,32,121,50,41,41,59,13,10,13,10,32,32,32,32,32,32,32,32,110,101,119,67,111,108,111,114,32,43,61,32,119,101,105,103,104,116,91,105,93,32,42,32,40,118,49,32,43,32,118,50,41,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,44,32,116,101,120,101,108,44,32,99,108,97,109,112,40,110,101,119,67,111,108,111,114,44,32,48,46,48,44,32,49,46,48,41,41,59,13,10,13,10,125,
+		239,187,191,35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,105,109,97,103,101,50,68,32,115,111,117,114,99,101,73,109,97,103,101,59,13,10,108,97,121,111,117,116,32,40,114,103,98,97,51,50,102,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,117,110,105,102,111,114,109,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,105,109,97,103,101,50,68,32,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,59,13,10,13,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,99,111,104,101,114,101,110,116,32,98,117,102,102,101,114,32,75,101,114,110,101,108,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,119,101,105,103,104,116,91,93,59,13,10,125,59,13,10,13,10,117,110,105,102,111,114,109,32,105,110,116,32,114,97,100,105,117,115,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,118,101,99,50,32,116,101,120,101,108,32,61,32,105,118,101,99,50,40,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,101,108,102,32,61,32,118,101,99,50,40,116,101,120,101,108,41,59,13,10,32,32,32,32,105,118,101,99,50,32,115,105,122,101,32,61,32,105,118,101,99,50,40,103,108,95,78,117,109,87,111,114,107,71,114,111,117,112,115,46,120,121,41,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,102,32,61,32,118,101,99,50,40,115,105,122,101,41,59,13,10,13,10,32,32,32,32,118,101,99,52,32,110,101,119,67,111,108,111,114,32,61,32,118,101,99,52,40,48,46,48,102,41,59,13,10,13,10,32,32,32,32,110,101,119,67,111,108,111,114,32,43,61,32,119,101,105,103,104,116,91,48,93,32,42,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,116,101,120,101,108,41,59,13,10,13,10,32,32,32,32,102,111,114,32,40,105,110,116,32,105,32,61,32,49,59,32,105,32,60,61,32,114,97,100,105,117,115,59,32,105,43,43,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,110,116,32,121,49,32,61,32,99,108,97,109,112,40,116,101,120,101,108,46,121,32,43,32,105,44,32,48,44,32,115,105,122,101,46,121,32,45,32,49,41,59,13,10,32,32,32,32,32,32,32,32,105,110,116,32,121,50,32,61,32,99,108,97,109,112,40,116,101,120,101,108,46,121,32,45,32,105,44,32,48,44,32,115,105,122,101,46,121,32,45,32,49,41,59,13,10,13,10,32,32,32,32,32,32,32,32,118,101,99,52,32,118,49,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,116,101,120,101,108,46,120,44,32,121,49,41,41,59,13,10,32,32,32,32,32,32,32,32,118,101,99,52,32,118,50,32,61,32,105,109,97,103,101,76,111,97,100,40,115,111,117,114,99,101,73,109,97,103,101,44,32,105,118,101,99,50,40,116,101,120,101,108,46,120,44,32,121,50,41,41,59,13,10,13,10,32,32,32,32,32,32,32,32,110,101,119,67,111,108,111,114,32,43,61,32,119,101,105,103,104,116,91,105,93,32,42,32,40,118,49,32,43,32,118,50,41,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,100,101,115,116,105,110,97,116,105,111,110,73,109,97,103,101,44,32,116,101,120,101,108,44,32,99,108,97,109,112,40,110,101,119,67,111,108,111,114,44,32,48,46,48,44,32,49,46,48,41,41,59,13,10,13,10,125,
 	};
 	const auto resource_6975910120903775418_path = R"(shaders_internal\effects\gaussian_blur_vertical.comp)";
 }
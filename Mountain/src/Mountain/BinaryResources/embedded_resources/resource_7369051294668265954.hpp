@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 1489> resource_7369051294668265954 {
-		239,187,191,35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,40,112,111,105,110,116,115,41,32,105,110,59,13,10,108,97,121,111,117,116,40,116,114,105,97,110,103,108,101,95,115,116,114,105,112,44,32,109,97,120,95,118,101,114,116,105,99,101,115,32,61,32,52,41,32,111,117,116,59,13,10,13,10,105,110,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,105,110,116,32,112,97,114,116,105,99,108,101,65,108,105,118,101,59,13,10,32,32,32,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,105,122,101,59,13,10,32,32,32,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,73,110,91,93,59,13,10,13,10,111,117,116,32,71,101,111,109,101,116,114,121,79,117,116,13,10,123,13,10,32,32,32,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,125,32,115,104,97,100,101,114,79,117,116,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,105,109,97,103,101,83,105,122,101,78,111,114,109,97,108,105,122,101,100,59,32,47,47,32,84,101,120,116,117,114,101,32,115,105,122,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,49,93,41,13,10,13,10,118,111,105,100,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,105,110,32,118,101,99,52,32,112,111,115,105,116,105,111,110,44,32,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,13,10,123,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,112,111,115,105,116,105,111,110,59,13,10,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,91,48,93,46,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,32,61,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,40,41,59,13,10,125,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,102,32,40,115,104,97,100,101,114,73,110,91,48,93,46,112,97,114,116,105,99,108,101,65,108,105,118,101,32,61,61,32,48,41,32,47,47,32,73,102,32,116,104,101,32,112,97,114,116,105,99,108,101,32,105,115,32,100,101,97,100,44,32,100,111,110,39,116,32,99,114,101,97,116,101,32,97,110,121,32,118,101,114,116,105,99,101,115,13,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,13,10,13,10,32,32,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,32,61,32,103,108,95,105,110,91,48,93,46,103,108,95,80,111,115,105,116,105,111,110,46,120,121,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,32,61,32,105,109,97,103,101,83,105,122,101,78,111,114,109,97,108,105,122,101,100,32,42,32,115,104,97,100,101,114,73,110,91,48,93,46,112,97,114,116,105,99,108,101,83,105,122,101,59,13,10,32,32,32,32,118,101,99,50,32,104,97,108,102,83,105,122,101,32,61,32,115,105,122,101,32,42,32,48,46,53,102,59,13,10,13,10,32,32,32,32,118,101,99,52,32,102,105,114,115,116,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,45,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,45,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,115,101,99,111,110,100,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,43,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,45,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,116,104,105,114,100,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,43,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,43,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,102,111,117,114,116,104,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,45,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,43,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,115,101,99,111,110,100,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,49,46,102,44,32,48,46,102,41,41,59,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,102,105,114,115,116,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,48,46,102,44,32,48,46,102,41,41,59,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,116,104,105,114,100,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,49,46,102,44,32,49,46,102,41,41,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,102,111,117,114,116,104,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,48,46,102,44,32,49,46,102,41,41,59,13,10,13,10,32,32,32,32,69,110,100,80,114,105,109,105,116,105,118,101,40,41,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 1356> resource_7369051294668265954 {
+		239,187,191,35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,40,112,111,105,110,116,115,41,32,105,110,59,13,10,108,97,121,111,117,116,40,116,114,105,97,110,103,108,101,95,115,116,114,105,112,44,32,109,97,120,95,118,101,114,116,105,99,101,115,32,61,32,52,41,32,111,117,116,59,13,10,13,10,105,110,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,102,108,111,97,116,32,112,97,114,116,105,99,108,101,83,105,122,101,59,13,10,32,32,32,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,73,110,91,93,59,13,10,13,10,111,117,116,32,71,101,111,109,101,116,114,121,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,125,32,115,104,97,100,101,114,79,117,116,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,105,109,97,103,101,83,105,122,101,78,111,114,109,97,108,105,122,101,100,59,32,47,47,32,84,101,120,116,117,114,101,32,115,105,122,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,49,93,41,13,10,13,10,118,111,105,100,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,105,110,32,118,101,99,52,32,112,111,115,105,116,105,111,110,44,32,105,110,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,13,10,123,13,10,32,32,32,32,103,108,95,80,111,115,105,116,105,111,110,32,61,32,112,111,115,105,116,105,111,110,59,13,10,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,91,48,93,46,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,115,104,97,100,101,114,79,117,116,46,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,32,61,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,40,41,59,13,10,125,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,32,61,32,103,108,95,105,110,91,48,93,46,103,108,95,80,111,115,105,116,105,111,110,46,120,121,59,13,10,32,32,32,32,118,101,99,50,32,115,105,122,101,32,61,32,105,109,97,103,101,83,105,122,101,78,111,114,109,97,108,105,122,101,100,32,42,32,115,104,97,100,101,114,73,110,91,48,93,46,112,97,114,116,105,99,108,101,83,105,122,101,59,13,10,32,32,32,32,118,101,99,50,32,104,97,108,102,83,105,122,101,32,61,32,115,105,122,101,32,42,32,48,46,53,102,59,13,10,13,10,32,32,32,32,118,101,99,52,32,102,105,114,115,116,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,45,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,45,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,115,101,99,111,110,100,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,43,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,45,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,116,104,105,114,100,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,43,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,43,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,32,32,32,32,118,101,99,52,32,102,111,117,114,116,104,80,111,115,105,116,105,111,110,32,61,32,118,101,99,52,40,112,111,115,105,116,105,111,110,46,120,32,45,32,104,97,108,102,83,105,122,101,46,120,44,32,112,111,115,105,116,105,111,110,46,121,32,43,32,104,97,108,102,83,105,122,101,46,121,44,32,48,46,102,44,32,49,46,102,41,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,115,101,99,111,110,100,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,49,46,102,44,32,48,46,102,41,41,59,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,102,105,114,115,116,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,48,46,102,44,32,48,46,102,41,41,59,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,116,104,105,114,100,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,49,46,102,44,32,49,46,102,41,41,59,13,10,13,10,32,32,32,32,69,109,105,116,86,101,114,116,101,120,68,97,116,97,40,102,111,117,114,116,104,80,111,115,105,116,105,111,110,44,32,118,101,99,50,40,48,46,102,44,32,49,46,102,41,41,59,13,10,13,10,32,32,32,32,69,110,100,80,114,105,109,105,116,105,118,101,40,41,59,13,10,125,13,10,
 	};
 	const auto resource_7369051294668265954_path = R"(shaders_internal\particles\draw\draw.geom)";
 }
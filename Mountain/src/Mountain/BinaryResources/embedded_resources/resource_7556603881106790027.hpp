@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 2781> resource_7556603881106790027 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,108,97,121,111,117,116,40,111,114,105,103,105,110,95,117,112,112,101,114,95,108,101,102,116,41,32,105,110,32,118,101,99,52,32,103,108,95,70,114,97,103,67,111,111,114,100,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,99,101,110,116,101,114,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,115,105,122,101,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,115,99,97,108,101,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,97,110,103,108,101,115,59,32,47,47,32,115,116,97,114,116,105,110,103,65,110,103,108,101,44,32,100,101,108,116,97,65,110,103,108,101,32,47,47,32,98,111,116,104,32,97,114,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,84,119,111,80,105,41,13,10,105,110,32,102,108,97,116,32,102,108,111,97,116,32,116,104,105,99,107,110,101,115,115,59,13,10,105,110,32,102,108,97,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,105,110,32,102,108,97,116,32,105,110,116,32,102,105,108,108,101,100,59,13,10,13,10,117,110,105,102,111,114,109,32,118,101,99,50,32,99,97,109,101,114,97,83,99,97,108,101,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,50,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,32,61,32,118,101,99,50,40,49,46,102,41,32,47,32,99,97,109,101,114,97,83,99,97,108,101,59,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,32,61,32,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,32,45,32,99,101,110,116,101,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,32,61,32,115,105,122,101,59,32,47,47,32,61,32,114,97,100,105,117,115,32,42,32,115,99,97,108,101,13,10,13,10,32,32,32,32,118,101,99,50,32,116,101,109,112,32,61,32,45,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,32,61,32,97,116,97,110,40,116,101,109,112,46,121,44,32,116,101,109,112,46,120,41,59,13,10,13,10,32,32,32,32,97,110,103,108,101,32,61,32,82,101,109,97,112,86,97,108,117,101,40,97,110,103,108,101,44,32,45,80,105,44,32,80,105,44,32,48,46,102,44,32,84,119,111,80,105,41,59,13,10,13,10,32,32,32,32,105,102,32,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,62,32,84,119,111,80,105,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,102,32,40,97,110,103,108,101,32,43,32,84,119,111,80,105,32,62,32,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,38,38,32,97,110,103,108,101,32,60,32,97,110,103,108,101,115,46,120,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,32,32,32,32,125,13,10,32,32,32,32,101,108,115,101,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,97,120,65,110,103,108,101,32,61,32,109,105,110,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,44,32,84,119,111,80,105,41,59,13,10,13,10,32,32,32,32,32,32,32,32,47,47,32,68,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,111,117,116,115,105,100,101,32,116,104,101,32,97,114,99,32,97,110,103,108,101,115,13,10,32,32,32,32,32,32,32,32,105,102,32,40,40,97,110,103,108,101,115,46,120,32,62,32,48,46,102,32,38,38,32,97,110,103,108,101,32,60,32,97,110,103,108,101,115,46,120,41,32,124,124,32,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,60,32,84,119,111,80,105,32,38,38,32,97,110,103,108,101,32,62,32,109,97,120,65,110,103,108,101,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,70,73,88,77,69,32,45,32,65,110,103,108,101,32,105,115,32,34,105,110,99,111,114,114,101,99,116,34,32,119,104,101,110,32,115,99,97,108,101,100,32,111,110,32,111,110,101,32,97,120,105,115,46,13,10,32,32,32,32,47,47,32,73,116,32,105,115,32,97,99,116,117,97,108,108,121,32,116,101,99,104,110,105,99,97,108,108,121,32,99,111,114,114,101,99,116,44,32,98,117,116,32,116,111,32,98,101,32,99,111,110,115,105,115,116,101,110,116,32,119,105,116,104,32,104,111,119,32,119,101,32,115,112,97,119,110,32,116,104,101,32,112,97,114,116,105,99,108,101,115,32,105,110,32,97,110,32,97,114,99,32,115,104,97,112,101,32,40,115,104,97,112,101,46,103,108,115,108,41,44,13,10,32,32,32,32,47,47,32,119,101,32,115,104,111,117,108,100,32,105,110,115,116,101,97,100,32,97,112,112,108,121,32,116,104,101,32,115,99,97,108,101,32,65,70,84,69,82,32,97,110,100,32,110,111,116,32,98,101,102,111,114,101,46,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,32,61,32,97,98,115,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,41,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,59,13,10,32,32,32,32,116,101,109,112,32,61,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,32,47,32,115,99,97,108,101,59,13,10,32,32,32,32,97,110,103,108,101,32,61,32,97,116,97,110,40,116,101,109,112,46,121,44,32,116,101,109,112,46,120,41,59,13,10,32,32,32,32,102,108,111,97,116,32,99,32,61,32,99,111,115,40,97,110,103,108,101,41,44,32,115,32,61,32,115,105,110,40,97,110,103,108,101,41,59,13,10,32,32,32,32,118,101,99,50,32,99,111,115,83,105,110,32,61,32,118,101,99,50,40,99,44,32,115,41,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,104,97,108,102,84,104,105,99,107,110,101,115,115,32,61,32,116,104,105,99,107,110,101,115,115,32,42,32,48,46,53,102,59,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,32,61,32,40,99,105,114,99,108,101,83,105,122,101,32,43,32,118,101,99,50,40,104,97,108,102,84,104,105,99,107,110,101,115,115,41,41,32,42,32,99,111,115,83,105,110,59,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,32,61,32,40,99,105,114,99,108,101,83,105,122,101,32,45,32,118,101,99,50,40,104,97,108,102,84,104,105,99,107,110,101,115,115,41,41,32,42,32,99,111,115,83,105,110,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,32,61,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,32,45,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,59,13,10,13,10,32,32,32,32,47,47,32,70,111,114,32,115,109,97,108,108,32,116,104,105,99,107,110,101,115,115,32,97,110,100,32,104,105,103,104,32,115,99,97,108,101,32,111,110,32,111,110,101,32,97,120,105,115,44,32,119,101,32,109,105,103,104,116,32,109,105,115,115,32,115,111,109,101,32,112,105,120,101,108,115,44,32,115,111,32,119,101,32,109,97,107,101,32,115,117,114,101,32,116,111,32,104,97,118,101,32,97,116,32,108,101,97,115,116,32,111,110,101,32,112,105,120,101,108,32,101,118,101,114,121,119,104,101,114,101,13,10,32,32,32,32,105,102,32,40,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,60,32,48,46,53,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,120,32,43,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,43,32,49,46,102,59,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,120,32,45,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,43,32,49,46,102,59,13,10,32,32,32,32,125,13,10,32,32,32,32,105,102,32,40,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,60,32,48,46,53,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,121,32,43,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,43,32,49,46,102,59,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,121,32,45,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,43,32,49,46,102,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,68,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,111,117,116,115,105,100,101,32,116,104,101,32,99,105,114,99,108,101,13,10,32,32,32,32,105,102,32,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,120,32,62,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,120,32,124,124,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,121,32,62,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,121,41,13,10,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,13,10,32,32,32,32,47,47,32,73,110,32,99,97,115,101,32,111,102,32,97,32,104,111,108,108,111,119,32,99,105,114,99,108,101,44,32,119,101,32,97,108,115,111,32,110,101,101,100,32,116,111,32,100,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,105,110,115,105,100,101,13,10,32,32,32,32,105,102,32,40,102,105,108,108,101,100,32,61,61,32,48,32,38,38,32,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,120,32,60,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,120,32,124,124,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,121,32,60,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,121,41,41,13,10,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 2778> resource_7556603881106790027 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,40,111,114,105,103,105,110,95,117,112,112,101,114,95,108,101,102,116,41,32,105,110,32,118,101,99,52,32,103,108,95,70,114,97,103,67,111,111,114,100,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,117,116,105,108,115,46,103,108,115,108,34,13,10,35,105,110,99,108,117,100,101,32,34,46,46,47,102,114,97,109,101,46,103,108,115,108,34,13,10,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,99,101,110,116,101,114,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,115,105,122,101,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,115,99,97,108,101,59,13,10,105,110,32,102,108,97,116,32,118,101,99,50,32,97,110,103,108,101,115,59,32,47,47,32,115,116,97,114,116,105,110,103,65,110,103,108,101,44,32,100,101,108,116,97,65,110,103,108,101,32,47,47,32,98,111,116,104,32,97,114,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,91,48,44,32,84,119,111,80,105,41,13,10,105,110,32,102,108,97,116,32,102,108,111,97,116,32,116,104,105,99,107,110,101,115,115,59,13,10,105,110,32,102,108,97,116,32,118,101,99,52,32,99,111,108,111,114,59,13,10,105,110,32,102,108,97,116,32,105,110,116,32,102,105,108,108,101,100,59,13,10,13,10,111,117,116,32,118,101,99,52,32,102,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,118,101,99,50,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,32,61,32,118,101,99,50,40,49,46,102,41,32,47,32,99,97,109,101,114,97,83,99,97,108,101,59,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,32,61,32,103,108,95,70,114,97,103,67,111,111,114,100,46,120,121,32,45,32,99,101,110,116,101,114,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,32,61,32,115,105,122,101,59,32,47,47,32,61,32,114,97,100,105,117,115,32,42,32,115,99,97,108,101,13,10,13,10,32,32,32,32,118,101,99,50,32,116,101,109,112,32,61,32,45,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,59,13,10,32,32,32,32,102,108,111,97,116,32,97,110,103,108,101,32,61,32,97,116,97,110,40,116,101,109,112,46,121,44,32,116,101,109,112,46,120,41,59,13,10,13,10,32,32,32,32,97,110,103,108,101,32,61,32,82,101,109,97,112,86,97,108,117,101,40,97,110,103,108,101,44,32,45,80,105,44,32,80,105,44,32,48,46,102,44,32,84,119,111,80,105,41,59,13,10,13,10,32,32,32,32,105,102,32,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,62,32,84,119,111,80,105,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,105,102,32,40,97,110,103,108,101,32,43,32,84,119,111,80,105,32,62,32,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,38,38,32,97,110,103,108,101,32,60,32,97,110,103,108,101,115,46,120,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,32,32,32,32,125,13,10,32,32,32,32,101,108,115,101,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,102,108,111,97,116,32,109,97,120,65,110,103,108,101,32,61,32,109,105,110,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,44,32,84,119,111,80,105,41,59,13,10,13,10,32,32,32,32,32,32,32,32,47,47,32,68,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,111,117,116,115,105,100,101,32,116,104,101,32,97,114,99,32,97,110,103,108,101,115,13,10,32,32,32,32,32,32,32,32,105,102,32,40,40,97,110,103,108,101,115,46,120,32,62,32,48,46,102,32,38,38,32,97,110,103,108,101,32,60,32,97,110,103,108,101,115,46,120,41,32,124,124,32,40,97,110,103,108,101,115,46,120,32,43,32,97,110,103,108,101,115,46,121,32,60,32,84,119,111,80,105,32,38,38,32,97,110,103,108,101,32,62,32,109,97,120,65,110,103,108,101,41,41,13,10,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,70,73,88,77,69,32,45,32,65,110,103,108,101,32,105,115,32,34,105,110,99,111,114,114,101,99,116,34,32,119,104,101,110,32,115,99,97,108,101,100,32,111,110,32,111,110,101,32,97,120,105,115,46,13,10,32,32,32,32,47,47,32,73,116,32,105,115,32,97,99,116,117,97,108,108,121,32,116,101,99,104,110,105,99,97,108,108,121,32,99,111,114,114,101,99,116,44,32,98,117,116,32,116,111,32,98,101,32,99,111,110,115,105,115,116,101,110,116,32,119,105,116,104,32,104,111,119,32,119,101,32,115,112,97,119,110,32,116,104,101,32,112,97,114,116,105,99,108,101,115,32,105,110,32,97,110,32,97,114,99,32,115,104,97,112,101,32,40,115,104,97,112,101,46,103,108,115,108,41,44,13,10,32,32,32,32,47,47,32,119,101,32,115,104,111,117,108,100,32,105,110,115,116,101,97,100,32,97,112,112,108,121,32,116,104,101,32,115,99,97,108,101,32,65,70,84,69,82,32,97,110,100,32,110,111,116,32,98,101,102,111,114,101,46,13,10,13,10,32,32,32,32,118,101,99,50,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,32,61,32,97,98,115,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,41,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,32,42,32,99,97,109,101,114,97,83,99,97,108,101,73,110,118,101,114,115,101,59,13,10,32,32,32,32,116,101,109,112,32,61,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,32,47,32,115,99,97,108,101,59,13,10,32,32,32,32,97,110,103,108,101,32,61,32,97,116,97,110,40,116,101,109,112,46,121,44,32,116,101,109,112,46,120,41,59,13,10,32,32,32,32,102,108,111,97,116,32,99,32,61,32,99,111,115,40,97,110,103,108,101,41,44,32,115,32,61,32,115,105,110,40,97,110,103,108,101,41,59,13,10,32,32,32,32,118,101,99,50,32,99,111,115,83,105,110,32,61,32,118,101,99,50,40,99,44,32,115,41,59,13,10,13,10,32,32,32,32,102,108,111,97,116,32,104,97,108,102,84,104,105,99,107,110,101,115,115,32,61,32,116,104,105,99,107,110,101,115,115,32,42,32,48,46,53,102,59,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,32,61,32,40,99,105,114,99,108,101,83,105,122,101,32,43,32,118,101,99,50,40,104,97,108,102,84,104,105,99,107,110,101,115,115,41,41,32,42,32,99,111,115,83,105,110,59,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,32,61,32,40,99,105,114,99,108,101,83,105,122,101,32,45,32,118,101,99,50,40,104,97,108,102,84,104,105,99,107,110,101,115,115,41,41,32,42,32,99,111,115,83,105,110,59,13,10,13,10,32,32,32,32,118,101,99,50,32,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,32,61,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,32,45,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,59,13,10,13,10,32,32,32,32,47,47,32,70,111,114,32,115,109,97,108,108,32,116,104,105,99,107,110,101,115,115,32,97,110,100,32,104,105,103,104,32,115,99,97,108,101,32,111,110,32,111,110,101,32,97,120,105,115,44,32,119,101,32,109,105,103,104,116,32,109,105,115,115,32,115,111,109,101,32,112,105,120,101,108,115,44,32,115,111,32,119,101,32,109,97,107,101,32,115,117,114,101,32,116,111,32,104,97,118,101,32,97,116,32,108,101,97,115,116,32,111,110,101,32,112,105,120,101,108,32,101,118,101,114,121,119,104,101,114,101,13,10,32,32,32,32,105,102,32,40,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,60,32,48,46,53,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,120,32,43,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,43,32,49,46,102,59,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,120,32,45,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,120,32,43,32,49,46,102,59,13,10,32,32,32,32,125,13,10,32,32,32,32,105,102,32,40,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,60,32,48,46,53,102,41,13,10,32,32,32,32,123,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,121,32,43,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,43,32,49,46,102,59,13,10,32,32,32,32,32,32,32,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,121,32,45,61,32,45,99,105,114,99,108,101,83,105,122,101,68,105,102,102,101,114,101,110,99,101,46,121,32,43,32,49,46,102,59,13,10,32,32,32,32,125,13,10,13,10,32,32,32,32,47,47,32,68,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,111,117,116,115,105,100,101,32,116,104,101,32,99,105,114,99,108,101,13,10,32,32,32,32,105,102,32,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,120,32,62,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,120,32,124,124,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,121,32,62,32,99,105,114,99,108,101,83,105,122,101,79,117,116,101,114,46,121,41,13,10,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,13,10,32,32,32,32,47,47,32,73,110,32,99,97,115,101,32,111,102,32,97,32,104,111,108,108,111,119,32,99,105,114,99,108,101,44,32,119,101,32,97,108,115,111,32,110,101,101,100,32,116,111,32,100,105,115,99,97,114,100,32,116,104,101,32,112,105,120,101,108,115,32,105,110,115,105,100,101,13,10,32,32,32,32,105,102,32,40,102,105,108,108,101,100,32,61,61,32,48,32,38,38,32,40,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,120,32,60,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,120,32,124,124,32,99,101,110,116,101,114,84,111,70,114,97,103,109,101,110,116,65,98,115,46,121,32,60,32,99,105,114,99,108,101,83,105,122,101,73,110,110,101,114,46,121,41,41,13,10,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,13,10,32,32,32,32,102,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,99,111,108,111,114,59,13,10,125,13,10,
 	};
 	const auto resource_7556603881106790027_path = R"(shaders_internal\arc\arc.frag)";
 }
@@ -4,7 +4,7 @@
 
 namespace { 
 	const std::array<std::uint8_t, 281> resource_9582143994837232440 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,105,110,32,71,101,111,109,101,116,114,121,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,125,32,115,104,97,100,101,114,73,110,59,13,10,13,10,111,117,116,32,118,101,99,52,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,105,109,97,103,101,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,105,109,97,103,101,44,32,115,104,97,100,101,114,73,110,46,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,125,13,10,
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,105,110,32,71,101,111,109,101,116,114,121,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,32,32,32,32,118,101,99,50,32,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,59,13,10,125,32,115,104,97,100,101,114,73,110,59,13,10,13,10,111,117,116,32,118,101,99,52,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,105,109,97,103,101,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,46,112,97,114,116,105,99,108,101,67,111,108,111,114,32,42,32,116,101,120,116,117,114,101,40,105,109,97,103,101,44,32,115,104,97,100,101,114,73,110,46,116,101,120,116,117,114,101,67,111,111,114,100,105,110,97,116,101,115,41,59,13,10,125,13,10,
 	};
 	const auto resource_9582143994837232440_path = R"(shaders_internal\particles\draw\draw.frag)";
 }
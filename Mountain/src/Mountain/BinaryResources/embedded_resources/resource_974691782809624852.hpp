@@ -0,0 +1,10 @@
+#pragma once
+
+#include "../resource_holder.hpp"
+
+namespace { 
+	const std::array<std::uint8_t, 343> resource_974691782809624852 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,108,97,121,111,117,116,32,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,49,44,32,108,111,99,97,108,95,115,105,122,101,95,122,32,61,32,49,41,32,105,110,59,13,10,13,10,35,105,110,99,108,117,100,101,32,34,115,105,109,117,108,97,116,105,111,110,46,103,108,115,108,34,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,97,108,105,118,101,67,111,117,110,116,32,61,32,110,101,120,116,65,108,105,118,101,67,111,117,110,116,59,13,10,32,32,32,32,110,101,120,116,65,108,105,118,101,67,111,117,110,116,32,61,32,48,59,13,10,13,10,32,32,32,32,117,112,100,97,116,101,68,105,115,112,97,116,99,104,91,48,93,32,61,32,87,111,114,107,71,114,111,117,112,67,111,117,110,116,40,97,108,105,118,101,67,111,117,110,116,41,59,13,10,32,32,32,32,117,112,100,97,116,101,68,105,115,112,97,116,99,104,91,49,93,32,61,32,49,59,13,10,32,32,32,32,117,112,100,97,116,101,68,105,115,112,97,116,99,104,91,50,93,32,61,32,49,59,13,10,13,10,32,32,32,32,100,114,97,119,73,110,115,116,97,110,99,101,67,111,117,110,116,32,61,32,97,108,105,118,101,67,111,117,110,116,59,13,10,125,13,10,
+	};
+	const auto resource_974691782809624852_path = R"(shaders_internal\particles\finish.comp)";
+}
@@ -3,8 +3,8 @@
 #include "../resource_holder.hpp"
 
 namespace { 
-	const std::array<std::uint8_t, 262> resource_9926314955806432672 {
-		35,118,101,114,115,105,111,110,32,52,54,48,13,10,13,10,105,110,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,105,110,116,32,112,97,114,116,105,99,108,101,65,108,105,118,101,59,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,73,110,59,13,10,13,10,111,117,116,32,118,101,99,52,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,105,102,32,40,115,104,97,100,101,114,73,110,46,112,97,114,116,105,99,108,101,65,108,105,118,101,32,61,61,32,48,41,13,10,32,32,32,32,32,32,32,32,100,105,115,99,97,114,100,59,13,10,13,10,32,32,32,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,46,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,13,10,
+	const std::array<std::uint8_t, 175> resource_9926314955806432672 {
+		35,118,101,114,115,105,111,110,32,52,53,48,13,10,13,10,105,110,32,86,101,114,116,101,120,79,117,116,13,10,123,13,10,32,32,32,32,102,108,97,116,32,118,101,99,52,32,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,32,115,104,97,100,101,114,73,110,59,13,10,13,10,111,117,116,32,118,101,99,52,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,59,13,10,13,10,118,111,105,100,32,109,97,105,110,40,41,13,10,123,13,10,32,32,32,32,111,117,116,70,114,97,103,109,101,110,116,67,111,108,111,114,32,61,32,115,104,97,100,101,114,73,110,46,112,97,114,116,105,99,108,101,67,111,108,111,114,59,13,10,125,13,10,
 	};
 	const auto resource_9926314955806432672_path = R"(shaders_internal\particles\draw_point\draw_point.frag)";
 }
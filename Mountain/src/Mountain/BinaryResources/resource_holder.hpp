@@ -50,11 +50,16 @@
 #include "embedded_resources/resource_17150819399866535910.hpp"
 #include "embedded_resources/resource_12442680368039291515.hpp"
 #include "embedded_resources/resource_4319606583867259020.hpp"
+#include "embedded_resources/resource_18033405210486445592.hpp"
+#include "embedded_resources/resource_7406651483765468539.hpp"
+#include "embedded_resources/resource_5095878105932637176.hpp"
+#include "embedded_resources/resource_15868614112810597308.hpp"
+#include "embedded_resources/resource_974691782809624852.hpp"
 
 namespace {
 class ResourceHolder {
 private:
-	std::array<Resource, 49> resources {
+	std::array<Resource, 54> resources {
 		Resource(resource_14381367057370009788,	resource_14381367057370009788_path),
 		Resource(resource_11952871429675989627,	resource_11952871429675989627_path),
 		Resource(resource_3126981312599726777,	resource_3126981312599726777_path),
@@ -104,6 +109,11 @@ private:
 		Resource(resource_17150819399866535910,	resource_17150819399866535910_path),
 		Resource(resource_12442680368039291515,	resource_12442680368039291515_path),
 		Resource(resource_4319606583867259020,	resource_4319606583867259020_path),
+		Resource(resource_18033405210486445592,	resource_18033405210486445592_path),
+		Resource(resource_7406651483765468539,	resource_7406651483765468539_path),
+		Resource(resource_5095878105932637176,	resource_5095878105932637176_path),
+		Resource(resource_15868614112810597308,	resource_15868614112810597308_path),
+		Resource(resource_974691782809624852,	resource_974691782809624852_path),
 	};
 
 public:
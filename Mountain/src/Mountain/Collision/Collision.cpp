@@ -2,8 +2,444 @@
 
 #include "Mountain/Collision/Collision.hpp"
 
+#include <bit>
+
+#include "Mountain/Collision/Circle.hpp"
+#include "Mountain/Collision/ColliderList.hpp"
+#include "Mountain/Collision/Grid.hpp"
+#include "Mountain/Collision/Hitbox.hpp"
+
 using namespace Mountain;
 
+namespace
+{
+    /// @brief Intersects the line (origin, origin + t * direction) with an axis-aligned box using the slab method.
+    /// @param tEnter The time at which the line enters the box.
+    /// @param tExit The time at which the line exits the box.
+    /// @param normal The outward normal of the face the line enters the box through.
+    /// @return Whether the line goes through the box. Lines parallel to an axis only touching the box don't count.
+    bool IntersectBox(
+        const Vector2 origin,
+        const Vector2 direction,
+        const Vector2 min,
+        const Vector2 max,
+        f32& tEnter,
+        f32& tExit,
+        Vector2& normal
+    )
+    {
+        tEnter = -std::numeric_limits<f32>::infinity();
+        tExit = std::numeric_limits<f32>::infinity();
+        normal = Vector2::Zero();
+
+        const auto slab = [&](const f32 o, const f32 d, const f32 slabMin, const f32 slabMax, const Vector2 axis) -> bool
+        {
+            if (d == 0.f)
+                return o > slabMin && o < slabMax;
+
+            const f32 inverse = 1.f / d;
+            f32 t1 = (slabMin - o) * inverse;
+            f32 t2 = (slabMax - o) * inverse;
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            if (t1 > tEnter)
+            {
+                tEnter = t1;
+                normal = d > 0.f ? -axis : axis;
+            }
+            tExit = std::min(tExit, t2);
+
+            return true;
+        };
+
+        return slab(origin.x, direction.x, min.x, max.x, Vector2::UnitX())
+            && slab(origin.y, direction.y, min.y, max.y, Vector2::UnitY())
+            && tEnter < tExit;
+    }
+
+    /// @brief Returns the first time in [0, @p tMax] at which the line (origin, origin + t * direction) enters the circle,
+    /// or a negative value if it doesn't.
+    f32 IntersectCircle(const Vector2 origin, const Vector2 direction, const Vector2 center, const f32 radius, const f32 tMax)
+    {
+        const Vector2 toOrigin = origin - center;
+        const f32 a = Vector2::Dot(direction, direction);
+        const f32 halfB = Vector2::Dot(toOrigin, direction);
+        const f32 c = toOrigin.SquaredLength() - SQ(radius);
+
+        const f32 discriminant = SQ(halfB) - a * c;
+        if (a == 0.f || discriminant < 0.f)
+            return -1.f;
+
+        const f32 t = (-halfB - std::sqrt(discriminant)) / a;
+        return t <= tMax ? t : -1.f;
+    }
+
+    Collision::RaycastHit MakeRaycastHit(const Collision::Ray& ray, const f32 distance, const Vector2 normal)
+    {
+        return { .hit = true, .distance = distance, .point = ray.origin + ray.direction * distance, .normal = normal };
+    }
+
+    Collision::SweepHit MakeSweepHit(const Hitbox& hitbox, const Vector2 delta, const f32 time, const Vector2 normal)
+    {
+        return { .hit = true, .time = time, .position = hitbox.GetActualPosition() + delta * time, .normal = normal };
+    }
+
+    Collision::SweepHit MakeSweepMiss(const Hitbox& hitbox, const Vector2 delta)
+    {
+        return { .hit = false, .time = 1.f, .position = hitbox.GetActualPosition() + delta, .normal = Vector2::Zero() };
+    }
+
+    /// @brief Sweeps the box at @p position of the given @p size by @p delta against the box [@p min, @p max].
+    bool SweepBox(
+        const Vector2 position,
+        const Vector2 size,
+        const Vector2 delta,
+        const Vector2 min,
+        const Vector2 max,
+        f32& time,
+        Vector2& normal
+    )
+    {
+        // Sweeping a box against another one is the same as casting its top-left corner against the other box grown by its size
+        f32 tEnter, tExit;
+        if (!IntersectBox(position, delta, min - size, max, tEnter, tExit, normal) || tExit <= 0.f || tEnter > 1.f)
+            return false;
+
+        time = std::max(tEnter, 0.f);
+        if (tEnter < 0.f)
+            normal = Vector2::Zero();
+        return true;
+    }
+}
+
+Collision::Ray Collision::Ray::FromPoints(const Vector2 from, const Vector2 to)
+{
+    const Vector2 difference = to - from;
+    const f32 length = difference.Length();
+    return { .origin = from, .direction = length > 0.f ? difference / length : Vector2::Zero(), .length = length };
+}
+
+Collision::RaycastHit Collision::Raycast(const Ray& ray, const Collider& collider)
+{
+    switch (collider.type)
+    {
+        case ColliderType::Hitbox:
+            return Raycast(ray, reinterpret_cast<const Hitbox&>(collider));
+        case ColliderType::Circle:
+            return Raycast(ray, reinterpret_cast<const Circle&>(collider));
+        case ColliderType::Grid:
+            return Raycast(ray, reinterpret_cast<const Grid&>(collider));
+        case ColliderType::List:
+            return Raycast(ray, reinterpret_cast<const ColliderList&>(collider));
+    }
+
+    THROW(InvalidOperationException{"Invalid collider type for raycast"});
+}
+
+Collision::RaycastHit Collision::Raycast(const Ray& ray, const Hitbox& hitbox)
+{
+    const Vector2 position = hitbox.GetActualPosition();
+
+    f32 tEnter, tExit;
+    Vector2 normal;
+    if (!IntersectBox(ray.origin, ray.direction, position, position + hitbox.size, tEnter, tExit, normal)
+        || tExit < 0.f || tEnter > ray.length)
+        return {};
+
+    if (tEnter < 0.f)
+        return MakeRaycastHit(ray, 0.f, Vector2::Zero());
+    return MakeRaycastHit(ray, tEnter, normal);
+}
+
+Collision::RaycastHit Collision::Raycast(const Ray& ray, const Circle& circle)
+{
+    const Vector2 center = circle.GetActualPosition();
+
+    if ((ray.origin - center).SquaredLength() <= SQ(circle.radius))
+        return MakeRaycastHit(ray, 0.f, Vector2::Zero());
+
+    const f32 distance = IntersectCircle(ray.origin, ray.direction, center, circle.radius, ray.length);
+    if (distance < 0.f)
+        return {};
+
+    return MakeRaycastHit(ray, distance, (ray.origin + ray.direction * distance - center) / circle.radius);
+}
+
+Collision::RaycastHit Collision::Raycast(const Ray& ray, const Grid& grid)
+{
+    const Vector2 position = grid.GetActualPosition();
+    const Vector2i gridSize = grid.GetGridSize();
+    const Vector2 tileSize = grid.tileSize;
+
+    f32 tEnter, tExit;
+    Vector2 normal;
+    if (!IntersectBox(ray.origin, ray.direction, position, position + grid.Size(), tEnter, tExit, normal)
+        || tExit < 0.f || tEnter > ray.length)
+        return {};
+
+    f32 distance = tEnter;
+    if (tEnter < 0.f)
+    {
+        distance = 0.f;
+        normal = Vector2::Zero();
+    }
+    const f32 end = std::min(tExit, ray.length);
+
+    // Position of the ray in tiles when it enters the grid
+    const Vector2 start = (ray.origin + ray.direction * distance - position) / tileSize;
+    Vector2i tile{
+        std::clamp(static_cast<s32>(std::floor(start.x)), 0, gridSize.x - 1),
+        std::clamp(static_cast<s32>(std::floor(start.y)), 0, gridSize.y - 1)
+    };
+    const Vector2i step{ray.direction.x > 0.f ? 1 : -1, ray.direction.y > 0.f ? 1 : -1};
+
+    // Distance along the ray to the next tile boundary on each axis, and between two boundaries
+    constexpr f32 Infinity = std::numeric_limits<f32>::infinity();
+    f32 nextX = Infinity, nextY = Infinity;
+    f32 deltaX = Infinity, deltaY = Infinity;
+    if (ray.direction.x != 0.f)
+    {
+        const f32 boundary = static_cast<f32>(tile.x + (step.x > 0 ? 1 : 0));
+        nextX = distance + (boundary - start.x) * tileSize.x / ray.direction.x;
+        deltaX = tileSize.x / std::abs(ray.direction.x);
+    }
+    if (ray.direction.y != 0.f)
+    {
+        const f32 boundary = static_cast<f32>(tile.y + (step.y > 0 ? 1 : 0));
+        nextY = distance + (boundary - start.y) * tileSize.y / ray.direction.y;
+        deltaY = tileSize.y / std::abs(ray.direction.y);
+    }
+
+    while (true)
+    {
+        if (grid.At(tile))
+            return MakeRaycastHit(ray, distance, normal);
+
+        if (nextX < nextY)
+        {
+            if (nextX > end)
+                return {};
+
+            distance = nextX;
+            nextX += deltaX;
+            tile.x += step.x;
+            normal = { static_cast<f32>(-step.x), 0.f };
+        }
+        else
+        {
+            if (nextY > end)
+                return {};
+
+            distance = nextY;
+            nextY += deltaY;
+            tile.y += step.y;
+            normal = { 0.f, static_cast<f32>(-step.y) };
+        }
+
+        if (tile.x < 0 || tile.x >= gridSize.x || tile.y < 0 || tile.y >= gridSize.y)
+            return {};
+    }
+}
+
+Collision::RaycastHit Collision::Raycast(const Ray& ray, const ColliderList& list)
+{
+    RaycastHit closest;
+    for (const Collider* collider : list.list)
+    {
+        const RaycastHit hit = Raycast(ray, *collider);
+        if (hit.hit && (!closest.hit || hit.distance < closest.distance))
+            closest = hit;
+    }
+    return closest;
+}
+
+void Collision::Raycast(const std::span<const Ray> rays, const Collider& collider, const std::span<RaycastHit> hits)
+{
+    if (hits.size() < rays.size())
+        THROW(ArgumentException{"There must be at least as many hits as rays", "hits"});
+
+    // Dispatch on the collider type only once for the whole batch
+    const auto castAll = [&]<typename T>(const T& typedCollider)
+    {
+        for (usize i = 0; i < rays.size(); i++)
+            hits[i] = Raycast(rays[i], typedCollider);
+    };
+
+    switch (collider.type)
+    {
+        case ColliderType::Hitbox:
+            return castAll(reinterpret_cast<const Hitbox&>(collider));
+        case ColliderType::Circle:
+            return castAll(reinterpret_cast<const Circle&>(collider));
+        case ColliderType::Grid:
+            return castAll(reinterpret_cast<const Grid&>(collider));
+        case ColliderType::List:
+            return castAll(reinterpret_cast<const ColliderList&>(collider));
+    }
+
+    THROW(InvalidOperationException{"Invalid collider type for raycast"});
+}
+
+Collision::SweepHit Collision::Sweep(const Hitbox& hitbox, const Vector2 delta, const Collider& collider)
+{
+    switch (collider.type)
+    {
+        case ColliderType::Hitbox:
+            return Sweep(hitbox, delta, reinterpret_cast<const Hitbox&>(collider));
+        case ColliderType::Circle:
+            return Sweep(hitbox, delta, reinterpret_cast<const Circle&>(collider));
+        case ColliderType::Grid:
+            return Sweep(hitbox, delta, reinterpret_cast<const Grid&>(collider));
+        case ColliderType::List:
+            return Sweep(hitbox, delta, reinterpret_cast<const ColliderList&>(collider));
+    }
+
+    THROW(InvalidOperationException{"Invalid collider type for sweep"});
+}
+
+Collision::SweepHit Collision::Sweep(const Hitbox& hitbox, const Vector2 delta, const Hitbox& other)
+{
+    const Vector2 otherPosition = other.GetActualPosition();
+
+    f32 time;
+    Vector2 normal;
+    if (!SweepBox(hitbox.GetActualPosition(), hitbox.size, delta, otherPosition, otherPosition + other.size, time, normal))
+        return MakeSweepMiss(hitbox, delta);
+
+    return MakeSweepHit(hitbox, delta, time, normal);
+}
+
+Collision::SweepHit Collision::Sweep(const Hitbox& hitbox, const Vector2 delta, const Circle& circle)
+{
+    const Vector2 min = hitbox.GetActualPosition();
+    const Vector2 max = min + hitbox.size;
+    const Vector2 center = circle.GetActualPosition();
+    const f32 radius = circle.radius;
+
+    const Vector2 closestPoint{std::clamp(center.x, min.x, max.x), std::clamp(center.y, min.y, max.y)};
+    if ((center - closestPoint).SquaredLength() < SQ(radius))
+        return MakeSweepHit(hitbox, delta, 0.f, Vector2::Zero());
+
+    // From the point of view of the hitbox, the circle center moves by -delta against the hitbox grown by the radius,
+    // with rounded corners
+    f32 tEnter, tExit;
+    Vector2 normal;
+    const Vector2 radiusVector{radius, radius};
+    if (!IntersectBox(center, -delta, min - radiusVector, max + radiusVector, tEnter, tExit, normal) || tExit <= 0.f || tEnter > 1.f)
+        return MakeSweepMiss(hitbox, delta);
+
+    const Vector2 contact = center - delta * std::max(tEnter, 0.f);
+    const bool outsideX = contact.x < min.x || contact.x > max.x;
+    const bool outsideY = contact.y < min.y || contact.y > max.y;
+
+    // The circle center hit one of the straight edges
+    if (!outsideX || !outsideY)
+        return MakeSweepHit(hitbox, delta, std::max(tEnter, 0.f), -normal);
+
+    // Otherwise it went in one of the rounded corners, which is a circle of the same radius
+    const Vector2 corner{contact.x < min.x ? min.x : max.x, contact.y < min.y ? min.y : max.y};
+    const f32 time = IntersectCircle(center, -delta, corner, radius, 1.f);
+    if (time < 0.f)
+        return MakeSweepMiss(hitbox, delta);
+
+    return MakeSweepHit(hitbox, delta, time, (corner - (center - delta * time)) / radius);
+}
+
+Collision::SweepHit Collision::Sweep(const Hitbox& hitbox, const Vector2 delta, const Grid& grid)
+{
+    const Vector2 position = hitbox.GetActualPosition();
+    const Vector2 gridPosition = grid.GetActualPosition();
+    const Vector2i gridSize = grid.GetGridSize();
+    const Vector2 tileSize = grid.tileSize;
+
+    // Only the tiles covered by the area swept by the hitbox can be hit
+    const Vector2 sweptMin = (Vector2{std::min(position.x, position.x + delta.x), std::min(position.y, position.y + delta.y)} - gridPosition) / tileSize;
+    const Vector2 sweptMax = (Vector2{std::max(position.x, position.x + delta.x), std::max(position.y, position.y + delta.y)} + hitbox.size - gridPosition) / tileSize;
+
+    const s32 left = std::max(static_cast<s32>(std::floor(sweptMin.x)), 0);
+    const s32 top = std::max(static_cast<s32>(std::floor(sweptMin.y)), 0);
+    const s32 right = std::min(static_cast<s32>(std::ceil(sweptMax.x)), gridSize.x);
+    const s32 bottom = std::min(static_cast<s32>(std::ceil(sweptMax.y)), gridSize.y);
+
+    f32 closestTime = std::numeric_limits<f32>::infinity();
+    Vector2 closestNormal;
+
+    for (s32 y = top; y < bottom; y++)
+    {
+        for (s32 x = left; x < right; x += 64)
+        {
+            u64 bits = grid.GetRowBits(y, x, std::min(64, right - x));
+            while (bits)
+            {
+                const s32 tileX = x + std::countr_zero(bits);
+                bits &= bits - 1;
+
+                const Vector2 tileMin = gridPosition + Vector2{static_cast<f32>(tileX), static_cast<f32>(y)} * tileSize;
+
+                f32 time;
+                Vector2 normal;
+                if (SweepBox(position, hitbox.size, delta, tileMin, tileMin + tileSize, time, normal) && time < closestTime)
+                {
+                    closestTime = time;
+                    closestNormal = normal;
+                }
+            }
+        }
+    }
+
+    if (closestTime > 1.f)
+        return MakeSweepMiss(hitbox, delta);
+
+    return MakeSweepHit(hitbox, delta, closestTime, closestNormal);
+}
+
+Collision::SweepHit Collision::Sweep(const Hitbox& hitbox, const Vector2 delta, const ColliderList& list)
+{
+    SweepHit closest = MakeSweepMiss(hitbox, delta);
+    for (const Collider* collider : list.list)
+    {
+        const SweepHit hit = Sweep(hitbox, delta, *collider);
+        if (hit.hit && (!closest.hit || hit.time < closest.time))
+            closest = hit;
+    }
+    return closest;
+}
+
+void Collision::Sweep(
+    const std::span<const Hitbox> hitboxes,
+    const std::span<const Vector2> deltas,
+    const Collider& collider,
+    const std::span<SweepHit> hits
+)
+{
+    if (deltas.size() != hitboxes.size())
+        THROW(ArgumentException{"There must be as many deltas as hitboxes", "deltas"});
+    if (hits.size() < hitboxes.size())
+        THROW(ArgumentException{"There must be at least as many hits as hitboxes", "hits"});
+
+    // Dispatch on the collider type only once for the whole batch
+    const auto sweepAll = [&]<typename T>(const T& typedCollider)
+    {
+        for (usize i = 0; i < hitboxes.size(); i++)
+            hits[i] = Sweep(hitboxes[i], deltas[i], typedCollider);
+    };
+
+    switch (collider.type)
+    {
+        case ColliderType::Hitbox:
+            return sweepAll(reinterpret_cast<const Hitbox&>(collider));
+        case ColliderType::Circle:
+            return sweepAll(reinterpret_cast<const Circle&>(collider));
+        case ColliderType::Grid:
+            return sweepAll(reinterpret_cast<const Grid&>(collider));
+        case ColliderType::List:
+            return sweepAll(reinterpret_cast<const ColliderList&>(collider));
+    }
+
+    THROW(InvalidOperationException{"Invalid collider type for sweep"});
+}
+
 std::pair<bool, Vector2> Collision::LinesIntersect(const Vector2 p1, const Vector2 p2, const Vector2 p3, const Vector2 p4)
 {
     const float rxs = Vector2::Cross(p2, p4);
@@ -1,12 +1,95 @@
 #pragma once
 
+#include <limits>
+#include <span>
+
 #include "Mountain/Core.hpp"
 #include "Mountain/Math/Vector2.hpp"
 
+namespace Mountain
+{
+    class Collider;
+    class Hitbox;
+    class Circle;
+    class Grid;
+    class ColliderList;
+}
+
 namespace Mountain::Collision
 {
+    /// @brief A half-line starting at @c origin, going in @c direction for @c length pixels.
+    struct Ray
+    {
+        Vector2 origin;
+        /// @brief The direction of the ray, which must be normalized.
+        Vector2 direction;
+        /// @brief The maximum distance at which a hit is reported.
+        f32 length = std::numeric_limits<f32>::infinity();
+
+        /// @brief Creates a ray going from @p from to @p to.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static Ray FromPoints(Vector2 from, Vector2 to);
+    };
+
+    struct RaycastHit
+    {
+        bool hit = false;
+        /// @brief The distance from the ray origin to the hit point. This is 0 if the origin is inside the collider.
+        f32 distance = 0.f;
+        Vector2 point;
+        /// @brief The normal of the surface that was hit. This is zero if the origin is inside the collider.
+        Vector2 normal;
+    };
+
+    struct SweepHit
+    {
+        bool hit = false;
+        /// @brief The time of impact, in the range [0, 1], as a fraction of the movement.
+        /// This is 0 if the hitbox already overlapped the collider.
+        f32 time = 1.f;
+        /// @brief The position the hitbox can move to without overlapping the collider.
+        Vector2 position;
+        /// @brief The normal of the surface that was hit. This is zero if the hitbox already overlapped the collider.
+        Vector2 normal;
+    };
+
     /// @brief Check if the lines (p1, p1 + p2) and (p3, p3 + p4) collide.
     /// @return A std::pair where the first element is true if the lines intersect,
     ///         and the second element is the position of the collision.
     MOUNTAIN_API std::pair<bool, Vector2> LinesIntersect(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4);
+
+    /// @brief Casts a ray against a collider and returns the closest hit.
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API RaycastHit Raycast(const Ray& ray, const Collider& collider);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API RaycastHit Raycast(const Ray& ray, const Hitbox& hitbox);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API RaycastHit Raycast(const Ray& ray, const Circle& circle);
+    /// @brief Casts a ray against the solid tiles of a grid, visiting only the tiles the ray goes through.
+    /// @see <a href="http://www.cse.yorku.ca/~amana/research/grid.pdf">A Fast Voxel Traversal Algorithm for Ray Tracing</a>
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API RaycastHit Raycast(const Ray& ray, const Grid& grid);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API RaycastHit Raycast(const Ray& ray, const ColliderList& list);
+
+    /// @brief Casts all the @p rays against a collider, writing the result of @c rays[i] in @c hits[i].
+    /// @details This is useful for many line-of-sight checks against the same level geometry.
+    MOUNTAIN_API void Raycast(std::span<const Ray> rays, const Collider& collider, std::span<RaycastHit> hits);
+
+    /// @brief Moves a hitbox by @p delta and returns the first time it touches a collider.
+    /// @details Sliding along a surface the hitbox only touches doesn't count as a hit.
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API SweepHit Sweep(const Hitbox& hitbox, Vector2 delta, const Collider& collider);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API SweepHit Sweep(const Hitbox& hitbox, Vector2 delta, const Hitbox& other);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API SweepHit Sweep(const Hitbox& hitbox, Vector2 delta, const Circle& circle);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API SweepHit Sweep(const Hitbox& hitbox, Vector2 delta, const Grid& grid);
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API SweepHit Sweep(const Hitbox& hitbox, Vector2 delta, const ColliderList& list);
+
+    /// @brief Sweeps all the @p hitboxes by their respective @p deltas against a collider, writing the result of
+    /// @c hitboxes[i] in @c hits[i].
+    MOUNTAIN_API void Sweep(std::span<const Hitbox> hitboxes, std::span<const Vector2> deltas, const Collider& collider, std::span<SweepHit> hits);
 }
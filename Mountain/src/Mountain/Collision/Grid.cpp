@@ -1,30 +1,38 @@
-
-
 #include "Mountain/Collision/Grid.hpp"
 
+#include <bit>
+
 #include "Mountain/Collision/ColliderList.hpp"
 #include "Mountain/Collision/Hitbox.hpp"
 #include "Mountain/Graphics/Draw.hpp"
 
 using namespace Mountain;
 
+namespace
+{
+    /// @brief Returns a mask of the @p count lowest bits.
+    constexpr u64 LowMask(const s32 count) { return count >= 64 ? ~0ull : (1ull << count) - 1; }
+}
+
 Grid::Grid()
     : Collider(ColliderType::Grid)
 {
 }
 
-Grid::Grid(const Vector2i size, const Vector2 tileSize)
+Grid::Grid(const Vector2i size, const Vector2 tileSize, const GridStorage storage)
     : Collider(ColliderType::Grid)
-    , gridSize(size)
     , tileSize(tileSize)
+    , m_GridSize(size)
+    , m_Storage(storage)
 {
     ResizeGrid();
 }
 
-Grid::Grid(const Vector2i size, const Vector2 tileSize, const Vector2 off)
+Grid::Grid(const Vector2i size, const Vector2 tileSize, const Vector2 off, const GridStorage storage)
     : Collider(ColliderType::Grid, off)
-    , gridSize(size)
     , tileSize(tileSize)
+    , m_GridSize(size)
+    , m_Storage(storage)
 {
     ResizeGrid();
 }
@@ -32,14 +40,18 @@ Grid::Grid(const Vector2i size, const Vector2 tileSize, const Vector2 off)
 void Grid::RenderDebug(const Color& color) const
 {
     const Vector2 position = GetActualPosition();
-    for (s32 y = 0; y < gridSize.y; y++)
+    for (s32 y = 0; y < m_GridSize.y; y++)
     {
-        for (s32 x = 0; x < gridSize.x; x++)
+        // Only solid tiles have edges, so empty rows can be skipped entirely
+        if (!AnyInRow(y, 0, m_GridSize.x))
+            continue;
+
+        for (s32 x = 0; x < m_GridSize.x; x++)
         {
-            if (!tiles[y][x])
+            if (!At(y, x))
                 continue;
 
-            if (y > 0 && !tiles[y - 1][x])
+            if (y > 0 && !At(y - 1, x))
             {
                 Draw::Line(
                     position + Vector2(
@@ -54,7 +66,7 @@ void Grid::RenderDebug(const Color& color) const
                     color
                 );
             }
-            if (x > 0 && !tiles[y][x - 1])
+            if (x > 0 && !At(y, x - 1))
             {
                 Draw::Line(
                     position + Vector2(
@@ -69,7 +81,7 @@ void Grid::RenderDebug(const Color& color) const
                     color
                 );
             }
-            if (y < gridSize.y - 1 && !tiles[y + 1][x])
+            if (y < m_GridSize.y - 1 && !At(y + 1, x))
             {
                 Draw::Line(
                     position + Vector2(
@@ -84,7 +96,7 @@ void Grid::RenderDebug(const Color& color) const
                     color
                 );
             }
-            if (x < gridSize.x - 1 && !tiles[y][x + 1])
+            if (x < m_GridSize.x - 1 && !At(y, x + 1))
             {
                 Draw::Line(
                     position + Vector2(
@@ -109,12 +121,12 @@ bool Grid::CheckCollision(const Vector2 point) const
         && point.y >= AbsoluteTop()
         && point.x < AbsoluteRight()
         && point.y < AbsoluteBottom()
-        && tiles[static_cast<u32>((point.y - AbsoluteTop()) / tileSize.y)][static_cast<u32>((point.x - AbsoluteLeft()) / tileSize.x)];
+        && At(static_cast<usize>((point.y - AbsoluteTop()) / tileSize.y), static_cast<usize>((point.x - AbsoluteLeft()) / tileSize.x));
 }
 
 bool Grid::CheckCollision(const Hitbox& hitbox) const
 {
-    if (!Hitbox(GetActualPosition(), gridSize * tileSize).Intersects(hitbox))
+    if (!Hitbox(GetActualPosition(), m_GridSize * tileSize).Intersects(hitbox))
         return false;
 
     s32 x = static_cast<s32>((hitbox.AbsoluteLeft() - AbsoluteLeft()) / tileSize.x);
@@ -124,36 +136,20 @@ bool Grid::CheckCollision(const Hitbox& hitbox) const
     s32 tileRight = static_cast<s32>(subTileRight);
     if (static_cast<f32>(tileRight) != subTileRight)
         tileRight += 1;
-    s32 width =  tileRight - x;
     const f32 subTileBottom = (hitbox.AbsoluteBottom() - AbsoluteTop()) / tileSize.y;
     s32 tileBottom = static_cast<s32>(subTileBottom);
     if (static_cast<f32>(tileBottom) != subTileBottom)
         tileBottom += 1;
-    s32 height =  tileBottom - y;
 
-    if (x < 0)
-    {
-        width += x;
-        x = 0;
-    }
-    if (y < 0)
-    {
-        height += y;
-        y = 0;
-    }
-
-    if (x + width > gridSize.x)
-        width = gridSize.x - x;
-    if (y + height > gridSize.y)
-        height = gridSize.y - y;
+    x = std::max(x, 0);
+    y = std::max(y, 0);
+    tileRight = std::min(tileRight, m_GridSize.x);
+    tileBottom = std::min(tileBottom, m_GridSize.y);
 
-    for (s32 i = 0; i < width; i++)
+    for (s32 row = y; row < tileBottom; row++)
     {
-        for (s32 j = 0; j < height; j++)
-        {
-            if (tiles[y + j][x + i])
-                return true;
-        }
+        if (AnyInRow(row, x, tileRight))
+            return true;
     }
 
     return false;
@@ -164,9 +160,61 @@ bool Grid::CheckCollision(const Circle&) const
     THROW(NotImplementedException{"Currently cannot check collision between grid and circle (should be implemented at some point)"});
 }
 
-bool Grid::CheckCollision(const Grid&) const
+bool Grid::CheckCollision(const Grid& grid) const
 {
-    THROW(InvalidOperationException{"Cannot check collision between grids"});
+    if (AbsoluteRight() <= grid.AbsoluteLeft() || grid.AbsoluteRight() <= AbsoluteLeft()
+        || AbsoluteBottom() <= grid.AbsoluteTop() || grid.AbsoluteBottom() <= AbsoluteTop())
+        return false;
+
+    // Position of the other grid in tiles of this one
+    const Vector2 tileOffset = (grid.GetActualPosition() - GetActualPosition()) / tileSize;
+    const Vector2i offsetTiles{static_cast<s32>(std::round(tileOffset.x)), static_cast<s32>(std::round(tileOffset.y))};
+
+    constexpr f32 AlignmentTolerance = 1e-4f;
+    const bool aligned = tileSize == grid.tileSize
+        && std::abs(tileOffset.x - static_cast<f32>(offsetTiles.x)) < AlignmentTolerance
+        && std::abs(tileOffset.y - static_cast<f32>(offsetTiles.y)) < AlignmentTolerance;
+
+    if (aligned)
+    {
+        const s32 left = std::max(0, offsetTiles.x);
+        const s32 right = std::min(m_GridSize.x, offsetTiles.x + grid.m_GridSize.x);
+        const s32 top = std::max(0, offsetTiles.y);
+        const s32 bottom = std::min(m_GridSize.y, offsetTiles.y + grid.m_GridSize.y);
+
+        for (s32 y = top; y < bottom; y++)
+        {
+            for (s32 x = left; x < right; x += 64)
+            {
+                const s32 count = std::min(64, right - x);
+                if (GetRowBits(y, x, count) & grid.GetRowBits(y - offsetTiles.y, x - offsetTiles.x, count))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    // The tiles don't line up, so check each solid tile of this grid against the other one
+    const Vector2 position = GetActualPosition();
+    for (s32 y = 0; y < m_GridSize.y; y++)
+    {
+        for (s32 x = 0; x < m_GridSize.x; x += 64)
+        {
+            u64 bits = GetRowBits(y, x, std::min(64, m_GridSize.x - x));
+            while (bits)
+            {
+                const s32 tileX = x + std::countr_zero(bits);
+                bits &= bits - 1;
+
+                const Hitbox tile{position + Vector2{static_cast<f32>(tileX), static_cast<f32>(y)} * tileSize, tileSize};
+                if (grid.CheckCollision(tile))
+                    return true;
+            }
+        }
+    }
+
+    return false;
 }
 
 bool Grid::CheckCollision(const ColliderList& list) const { return list.CheckCollision(*this); }
@@ -187,24 +235,185 @@ f32 Grid::AbsoluteTop() const { return GetActualPosition().y; }
 
 f32 Grid::AbsoluteBottom() const { return GetActualPosition().y + Height(); }
 
-f32 Grid::Width() const { return static_cast<f32>(gridSize.x) * tileSize.x; }
+f32 Grid::Width() const { return static_cast<f32>(m_GridSize.x) * tileSize.x; }
+
+f32 Grid::Height() const { return static_cast<f32>(m_GridSize.y) * tileSize.y; }
+
+Vector2 Grid::Size() const { return m_GridSize * tileSize; }
+
+bool Grid::At(const usize y, const usize x) const { return GetRowBits(static_cast<s32>(y), static_cast<s32>(x), 1) != 0; }
+
+bool Grid::At(const Vector2i tilePosition) const { return At(tilePosition.y, tilePosition.x); }
+
+void Grid::Set(const usize y, const usize x, const bool value)
+{
+    switch (m_Storage)
+    {
+        case GridStorage::Packed:
+        {
+            u64& word = m_Words[y * m_WordsPerRow + x / 64];
+            const u64 bit = 1ull << (x % 64);
+            if (value)
+                word |= bit;
+            else
+                word &= ~bit;
+            return;
+        }
+
+        case GridStorage::Chunked:
+        {
+            u32& index = m_ChunkIndices[y / ChunkSize * m_ChunkCount.x + x / ChunkSize];
+            if (index == EmptyChunk)
+            {
+                if (!value)
+                    return;
+
+                index = static_cast<u32>(m_Chunks.GetSize());
+                m_Chunks.Emplace().Fill(0);
+            }
 
-f32 Grid::Height() const { return static_cast<f32>(gridSize.y) * tileSize.y; }
+            u32& row = m_Chunks[index][y % ChunkSize];
+            const u32 chunkBit = 1u << (x % ChunkSize);
+            if (value)
+                row |= chunkBit;
+            else
+                row &= ~chunkBit;
+            return;
+        }
+    }
+}
 
-Vector2 Grid::Size() const { return gridSize * tileSize; }
+void Grid::Set(const Vector2i tilePosition, const bool value) { Set(tilePosition.y, tilePosition.x, value); }
 
-List<bool>& Grid::operator[](const usize y) { return tiles[y]; }
+void Grid::Fill(const bool value)
+{
+    switch (m_Storage)
+    {
+        case GridStorage::Packed:
+            for (u64& word : m_Words)
+                word = value ? ~0ull : 0;
+            break;
+
+        case GridStorage::Chunked:
+            m_Chunks.Clear();
+            if (!value)
+            {
+                for (u32& index : m_ChunkIndices)
+                    index = EmptyChunk;
+                break;
+            }
 
-const List<bool>& Grid::operator[](const usize y) const { return tiles[y]; }
+            for (u32& index : m_ChunkIndices)
+            {
+                index = static_cast<u32>(m_Chunks.GetSize());
+                m_Chunks.Emplace().Fill(~0u);
+            }
+            break;
+    }
+}
+
+u64 Grid::GetRowBits(const s32 y, s32 x, s32 count) const
+{
+    if (m_Storage == GridStorage::Packed)
+    {
+        const u64* const row = &m_Words[static_cast<usize>(y) * m_WordsPerRow];
+        const s32 word = x / 64;
+        const s32 shift = x % 64;
+
+        u64 result = row[word] >> shift;
+        if (shift != 0 && shift + count > 64)
+            result |= row[word + 1] << (64 - shift);
+        return result & LowMask(count);
+    }
+
+    // A range of 64 tiles spans at most 3 chunks
+    const usize chunkRow = static_cast<usize>(y / ChunkSize) * m_ChunkCount.x;
+    const s32 rowInChunk = y % ChunkSize;
+    u64 result = 0;
+    s32 done = 0;
+    while (count > 0)
+    {
+        const s32 shift = x % ChunkSize;
+        const s32 taken = std::min(ChunkSize - shift, count);
 
-bool Grid::At(const usize y, const usize x) const { return tiles[y][x]; }
+        const u32 index = m_ChunkIndices[chunkRow + x / ChunkSize];
+        if (index != EmptyChunk)
+            result |= (static_cast<u64>(m_Chunks[index][rowInChunk] >> shift) & LowMask(taken)) << done;
 
-bool Grid::At(const Vector2i tilePosition) const { return tiles[tilePosition.y][tilePosition.x]; }
+        x += taken;
+        done += taken;
+        count -= taken;
+    }
+    return result;
+}
+
+bool Grid::AnyInRow(const s32 y, const s32 begin, const s32 end) const
+{
+    for (s32 x = begin; x < end; x += 64)
+    {
+        if (GetRowBits(y, x, std::min(64, end - x)))
+            return true;
+    }
+
+    return false;
+}
+
+void Grid::SetGridSize(const Vector2i newGridSize)
+{
+    m_GridSize = newGridSize;
+    ResizeGrid();
+}
+
+void Grid::SetStorage(const GridStorage newStorage)
+{
+    if (newStorage == m_Storage)
+        return;
+
+    Grid converted{m_GridSize, tileSize, newStorage};
+    for (s32 y = 0; y < m_GridSize.y; y++)
+    {
+        for (s32 x = 0; x < m_GridSize.x; x += 64)
+        {
+            u64 bits = GetRowBits(y, x, std::min(64, m_GridSize.x - x));
+            while (bits)
+            {
+                converted.Set(static_cast<usize>(y), static_cast<usize>(x + std::countr_zero(bits)), true);
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    m_Storage = newStorage;
+    m_Words = std::move(converted.m_Words);
+    m_WordsPerRow = converted.m_WordsPerRow;
+    m_ChunkCount = converted.m_ChunkCount;
+    m_ChunkIndices = std::move(converted.m_ChunkIndices);
+    m_Chunks = std::move(converted.m_Chunks);
+}
+
+usize Grid::GetMemorySize() const
+{
+    return m_Words.GetSize() * sizeof(u64) + m_ChunkIndices.GetSize() * sizeof(u32) + m_Chunks.GetSize() * sizeof(Chunk);
+}
 
 void Grid::ResizeGrid()
 {
-    tiles.Resize(gridSize.y);
+    m_Words.Clear();
+    m_WordsPerRow = 0;
+    m_ChunkIndices.Clear();
+    m_Chunks.Clear();
+    m_ChunkCount = Vector2i::Zero();
 
-    for (auto&& row : tiles)
-        row.Resize(gridSize.x);
+    switch (m_Storage)
+    {
+        case GridStorage::Packed:
+            m_WordsPerRow = (m_GridSize.x + 63) / 64;
+            m_Words.Resize(static_cast<usize>(m_WordsPerRow) * m_GridSize.y);
+            break;
+
+        case GridStorage::Chunked:
+            m_ChunkCount = { (m_GridSize.x + ChunkSize - 1) / ChunkSize, (m_GridSize.y + ChunkSize - 1) / ChunkSize };
+            m_ChunkIndices.Resize(static_cast<usize>(m_ChunkCount.x) * m_ChunkCount.y, EmptyChunk);
+            break;
+    }
 }
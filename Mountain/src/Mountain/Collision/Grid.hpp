@@ -1,24 +1,36 @@
 #pragma once
 
+#include <limits>
+
 #include "Mountain/Collision/Collider.hpp"
+#include "Mountain/Containers/Array.hpp"
 #include "Mountain/Containers/List.hpp"
 #include "Mountain/Math/Vector2i.hpp"
 
 namespace Mountain
 {
+    /// @brief How the tiles of a @c Grid are stored in memory.
+    enum class GridStorage : u8
+    {
+        /// @brief One bit per tile, each row being stored contiguously in 64-bit words.
+        Packed,
+        /// @brief One bit per tile in blocks of @c Grid::ChunkSize by @c Grid::ChunkSize tiles, empty blocks not being allocated.
+        /// This is better suited to large and sparse tile maps.
+        Chunked
+    };
+
     class Grid : public Collider
     {
     public:
-        /// @brief The size of the grid in tiles.
-        Vector2i gridSize;
+        /// @brief The size of the side of a chunk in tiles when using @c GridStorage::Chunked.
+        static constexpr s32 ChunkSize = 32;
+
         /// @brief The size of a tile in the grid in pixels.
         Vector2 tileSize;
-        /// @brief The tile array, stored in [y, x] indices
-        List<List<bool>> tiles;
 
         MOUNTAIN_API Grid();
-        MOUNTAIN_API Grid(Vector2i size, Vector2 tileSize);
-        MOUNTAIN_API Grid(Vector2i size, Vector2 tileSize, Vector2 off);
+        MOUNTAIN_API Grid(Vector2i size, Vector2 tileSize, GridStorage storage = GridStorage::Packed);
+        MOUNTAIN_API Grid(Vector2i size, Vector2 tileSize, Vector2 off, GridStorage storage = GridStorage::Packed);
 
         // Inherited via Collider
         MOUNTAIN_API void RenderDebug(const Color& color) const override;
@@ -29,6 +41,9 @@ namespace Mountain
         MOUNTAIN_API bool CheckCollision(const Hitbox& hitbox) const override;
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API bool CheckCollision(const Circle& circle) const override;
+        /// @brief Checks for a collision with another grid.
+        /// @details If both grids have the same tile size and are aligned on the same tile boundaries, their rows are
+        /// compared 64 tiles at a time. Otherwise, each solid tile of this grid is checked as a hitbox against the other one.
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API bool CheckCollision(const Grid& grid) const override;
         ATTRIBUTE_NODISCARD
@@ -60,16 +75,61 @@ namespace Mountain
         MOUNTAIN_API Vector2 Size() const override;
 
         ATTRIBUTE_NODISCARD
-        MOUNTAIN_API List<bool>& operator[](usize y);
+        MOUNTAIN_API bool At(usize y, usize x) const;
         ATTRIBUTE_NODISCARD
-        MOUNTAIN_API const List<bool>& operator[](usize y) const;
+        MOUNTAIN_API bool At(Vector2i tilePosition) const;
+
+        MOUNTAIN_API void Set(usize y, usize x, bool value);
+        MOUNTAIN_API void Set(Vector2i tilePosition, bool value);
+
+        /// @brief Sets all the tiles to @p value.
+        MOUNTAIN_API void Fill(bool value);
 
+        /// @brief Returns up to 64 consecutive tiles of a row as bits, the least significant bit being the tile at @p x.
+        /// @param y The row.
+        /// @param x The first tile.
+        /// @param count The number of tiles to get, which must be in the range [1, 64] and not go past the end of the row.
         ATTRIBUTE_NODISCARD
-        MOUNTAIN_API bool At(usize y, usize x) const;
+        MOUNTAIN_API u64 GetRowBits(s32 y, s32 x, s32 count) const;
+
+        /// @brief Returns whether any tile in the range [@p begin, @p end[ of row @p y is solid.
         ATTRIBUTE_NODISCARD
-        MOUNTAIN_API bool At(Vector2i tilePosition) const;
+        MOUNTAIN_API bool AnyInRow(s32 y, s32 begin, s32 end) const;
+
+        /// @brief The size of the grid in tiles.
+        GETTER(Vector2i, GridSize, m_GridSize)
+
+        /// @brief Resizes the grid, clearing all its tiles.
+        MOUNTAIN_API void SetGridSize(Vector2i newGridSize);
+
+        GETTER(GridStorage, Storage, m_Storage)
+
+        /// @brief Changes the way the tiles are stored, keeping their values.
+        MOUNTAIN_API void SetStorage(GridStorage newStorage);
+
+        /// @brief Returns the size of the tile storage in bytes.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API usize GetMemorySize() const;
 
     private:
+        using Chunk = Array<u32, ChunkSize>;
+
+        static constexpr u32 EmptyChunk = std::numeric_limits<u32>::max();
+
+        Vector2i m_GridSize;
+        GridStorage m_Storage = GridStorage::Packed;
+
+        /// @brief The packed tiles, @c m_WordsPerRow words per row.
+        List<u64> m_Words;
+        s32 m_WordsPerRow = 0;
+
+        /// @brief The number of chunks on each axis.
+        Vector2i m_ChunkCount;
+        /// @brief The index in @c m_Chunks of each chunk, or @c EmptyChunk if it doesn't contain any solid tile.
+        List<u32> m_ChunkIndices;
+        /// @brief The allocated chunks, each one storing a row of tiles per 32-bit word.
+        List<Chunk> m_Chunks;
+
         void ResizeGrid();
     };
 }
@@ -0,0 +1,392 @@
+#include "Mountain/Collision/SpatialHash.hpp"
+
+#include "Mountain/Collision/Circle.hpp"
+#include "Mountain/Collision/Hitbox.hpp"
+#include "Mountain/Ecs/Entity.hpp"
+
+using namespace Mountain;
+
+SpatialHash::SpatialHash(const f32 cellSize)
+    : m_CellSize(cellSize)
+    , m_InverseCellSize(1.f / cellSize)
+{
+}
+
+void SpatialHash::Insert(Entity& entity)
+{
+    if (GetProxy(entity) != InvalidProxy)
+        return;
+
+    ProxyId id;
+    if (m_FreeProxies.IsEmpty())
+    {
+        id = static_cast<ProxyId>(m_Proxies.GetSize());
+        m_Proxies.Emplace();
+    }
+    else
+    {
+        id = m_FreeProxies.Last();
+        m_FreeProxies.RemoveLast();
+    }
+
+    Proxy& proxy = m_Proxies[id];
+    proxy.entity = &entity;
+    proxy.collider = entity.GetCollider();
+    proxy.syncStamp = m_SyncStamp;
+    proxy.alive = true;
+
+    entity.m_BroadphaseProxy = id;
+
+    const Collider& collider = *proxy.collider;
+    proxy.left = collider.AbsoluteLeft();
+    proxy.top = collider.AbsoluteTop();
+    proxy.right = collider.AbsoluteRight();
+    proxy.bottom = collider.AbsoluteBottom();
+    proxy.minCell = GetCell({ proxy.left, proxy.top });
+    proxy.maxCell = GetCell({ proxy.right, proxy.bottom });
+    AddToCells(id);
+}
+
+void SpatialHash::Remove(Entity& entity)
+{
+    const ProxyId id = GetProxy(entity);
+    if (id == InvalidProxy)
+        return;
+
+    RemoveProxy(id);
+    entity.m_BroadphaseProxy = InvalidProxy;
+}
+
+void SpatialHash::Update(Entity& entity)
+{
+    Collider* collider = entity.GetCollider();
+    const ProxyId id = GetProxy(entity);
+
+    if (!collider)
+    {
+        if (id != InvalidProxy)
+            Remove(entity);
+        return;
+    }
+
+    if (id == InvalidProxy)
+    {
+        Insert(entity);
+        return;
+    }
+
+    m_Proxies[id].collider = collider;
+    RefreshProxy(id);
+}
+
+void SpatialHash::Synchronize(const List<Entity*>& entities)
+{
+    ZoneScoped;
+
+    m_SyncStamp++;
+
+    usize syncedCount = 0;
+    for (Entity* entity : entities)
+    {
+        Update(*entity);
+
+        const ProxyId id = GetProxy(*entity);
+        if (id != InvalidProxy)
+        {
+            m_Proxies[id].syncStamp = m_SyncStamp;
+            syncedCount++;
+        }
+    }
+
+    // Every proxy was visited, so none of them belongs to an entity that isn't in the list anymore
+    if (syncedCount == GetProxyCount())
+        return;
+
+    for (ProxyId id = 0; id < m_Proxies.GetSize(); id++)
+    {
+        if (m_Proxies[id].alive && m_Proxies[id].syncStamp != m_SyncStamp)
+            RemoveProxy(id);
+    }
+}
+
+bool SpatialHash::Contains(const Entity& entity) const { return GetProxy(entity) != InvalidProxy; }
+
+void SpatialHash::Clear()
+{
+    m_Proxies.Clear();
+    m_FreeProxies.Clear();
+    m_LargeProxies.Clear();
+    m_Cells.clear();
+}
+
+void SpatialHash::QueryRect(const Rectangle& rectangle, const Action<Entity*>& callback) const
+{
+    const Hitbox hitbox{rectangle.position, rectangle.size};
+
+    QueryBounds(
+        rectangle.Left(),
+        rectangle.Top(),
+        rectangle.Right(),
+        rectangle.Bottom(),
+        [&](const Proxy& proxy)
+        {
+            if (proxy.collider->CheckCollision(hitbox))
+                callback(proxy.entity);
+        }
+    );
+}
+
+void SpatialHash::QueryPoint(const Vector2 point, const Action<Entity*>& callback) const
+{
+    QueryBounds(
+        point.x,
+        point.y,
+        point.x,
+        point.y,
+        [&](const Proxy& proxy)
+        {
+            if (proxy.collider->CheckCollision(point))
+                callback(proxy.entity);
+        }
+    );
+}
+
+void SpatialHash::QueryCircle(const Vector2 center, const f32 radius, const Action<Entity*>& callback) const
+{
+    const Circle circle{center, radius};
+
+    QueryBounds(
+        center.x - radius,
+        center.y - radius,
+        center.x + radius,
+        center.y + radius,
+        [&](const Proxy& proxy)
+        {
+            if (proxy.collider->CheckCollision(circle))
+                callback(proxy.entity);
+        }
+    );
+}
+
+void SpatialHash::QueryPairs(const Action<Entity*, Entity*>& callback) const
+{
+    ZoneScoped;
+
+    const auto overlaps = [](const Proxy& a, const Proxy& b)
+    {
+        return a.left <= b.right && b.left <= a.right && a.top <= b.bottom && b.top <= a.bottom;
+    };
+
+    for (const auto& [key, cell] : m_Cells)
+    {
+        const usize size = cell.GetSize();
+        if (size < 2)
+            continue;
+
+        const Vector2i cellPosition{static_cast<s32>(key >> 32), static_cast<s32>(key & 0xFFFFFFFF)};
+
+        for (usize i = 0; i < size - 1; i++)
+        {
+            const Proxy& a = m_Proxies[cell[i]];
+
+            for (usize j = i + 1; j < size; j++)
+            {
+                const Proxy& b = m_Proxies[cell[j]];
+
+                if (!overlaps(a, b))
+                    continue;
+
+                // Two proxies share every cell covered by the intersection of their bounds, so only report the pair in the cell
+                // containing the top-left corner of that intersection
+                if (GetCell({ std::max(a.left, b.left), std::max(a.top, b.top) }) != cellPosition)
+                    continue;
+
+                if (a.collider->CheckCollision(*b.collider))
+                    callback(a.entity, b.entity);
+            }
+        }
+    }
+
+    // Large proxies aren't in the cells so test them against every other proxy, visiting the pairs of large proxies only once
+    for (usize i = 0; i < m_LargeProxies.GetSize(); i++)
+    {
+        const Proxy& large = m_Proxies[m_LargeProxies[i]];
+
+        for (const Proxy& other : m_Proxies)
+        {
+            if (!other.alive || &other == &large || (other.large && &other < &large))
+                continue;
+
+            if (overlaps(large, other) && large.collider->CheckCollision(*other.collider))
+                callback(large.entity, other.entity);
+        }
+    }
+}
+
+void SpatialHash::SetCellSize(const f32 newCellSize)
+{
+    m_CellSize = newCellSize;
+    m_InverseCellSize = 1.f / newCellSize;
+
+    m_LargeProxies.Clear();
+    m_Cells.clear();
+
+    for (ProxyId id = 0; id < m_Proxies.GetSize(); id++)
+    {
+        Proxy& proxy = m_Proxies[id];
+        if (!proxy.alive)
+            continue;
+
+        proxy.minCell = GetCell({ proxy.left, proxy.top });
+        proxy.maxCell = GetCell({ proxy.right, proxy.bottom });
+        AddToCells(id);
+    }
+}
+
+usize SpatialHash::GetProxyCount() const { return m_Proxies.GetSize() - m_FreeProxies.GetSize(); }
+
+usize SpatialHash::GetCellCount() const { return m_Cells.size(); }
+
+u64 SpatialHash::GetCellKey(const s32 x, const s32 y) { return static_cast<u64>(static_cast<u32>(x)) << 32 | static_cast<u32>(y); }
+
+Vector2i SpatialHash::GetCell(const Vector2 position) const
+{
+    return { static_cast<s32>(std::floor(position.x * m_InverseCellSize)), static_cast<s32>(std::floor(position.y * m_InverseCellSize)) };
+}
+
+SpatialHash::ProxyId SpatialHash::GetProxy(const Entity& entity) const
+{
+    const ProxyId id = entity.m_BroadphaseProxy;
+    if (id >= m_Proxies.GetSize() || !m_Proxies[id].alive || m_Proxies[id].entity != &entity)
+        return InvalidProxy;
+    return id;
+}
+
+void SpatialHash::RefreshProxy(const ProxyId id)
+{
+    Proxy& proxy = m_Proxies[id];
+    const Collider& collider = *proxy.collider;
+
+    proxy.left = collider.AbsoluteLeft();
+    proxy.top = collider.AbsoluteTop();
+    proxy.right = collider.AbsoluteRight();
+    proxy.bottom = collider.AbsoluteBottom();
+
+    const Vector2i minCell = GetCell({ proxy.left, proxy.top });
+    const Vector2i maxCell = GetCell({ proxy.right, proxy.bottom });
+
+    // Most moves stay within the same cells, in which case only the bounds need to be updated
+    if (minCell == proxy.minCell && maxCell == proxy.maxCell)
+        return;
+
+    RemoveFromCells(id);
+    proxy.minCell = minCell;
+    proxy.maxCell = maxCell;
+    AddToCells(id);
+}
+
+void SpatialHash::AddToCells(const ProxyId id)
+{
+    Proxy& proxy = m_Proxies[id];
+
+    const s64 cellCount = static_cast<s64>(proxy.maxCell.x - proxy.minCell.x + 1) * (proxy.maxCell.y - proxy.minCell.y + 1);
+    proxy.large = cellCount > MaxProxyCells;
+
+    if (proxy.large)
+    {
+        m_LargeProxies.Add(id);
+        return;
+    }
+
+    for (s32 y = proxy.minCell.y; y <= proxy.maxCell.y; y++)
+    {
+        for (s32 x = proxy.minCell.x; x <= proxy.maxCell.x; x++)
+            m_Cells[GetCellKey(x, y)].Add(id);
+    }
+}
+
+void SpatialHash::RemoveFromCells(const ProxyId id)
+{
+    const Proxy& proxy = m_Proxies[id];
+
+    if (proxy.large)
+    {
+        m_LargeProxies.Remove(id);
+        return;
+    }
+
+    for (s32 y = proxy.minCell.y; y <= proxy.maxCell.y; y++)
+    {
+        for (s32 x = proxy.minCell.x; x <= proxy.maxCell.x; x++)
+        {
+            const auto it = m_Cells.find(GetCellKey(x, y));
+            if (it == m_Cells.end())
+                continue;
+
+            List<ProxyId>& cell = it->second;
+
+            // The order of the proxies in a cell doesn't matter, so swap with the last one to avoid shifting the others
+            for (usize i = 0; i < cell.GetSize(); i++)
+            {
+                if (cell[i] != id)
+                    continue;
+
+                cell[i] = cell.Last();
+                cell.RemoveLast();
+                break;
+            }
+
+            // Erase empty cells so that entities moving through the world don't leave a trail of allocated cells behind
+            if (cell.IsEmpty())
+                m_Cells.erase(it);
+        }
+    }
+}
+
+void SpatialHash::RemoveProxy(const ProxyId id)
+{
+    RemoveFromCells(id);
+
+    Proxy& proxy = m_Proxies[id];
+    proxy.entity = nullptr;
+    proxy.collider = nullptr;
+    proxy.alive = false;
+    proxy.large = false;
+
+    m_FreeProxies.Add(id);
+}
+
+void SpatialHash::QueryBounds(const f32 left, const f32 top, const f32 right, const f32 bottom, const Action<const Proxy&>& callback) const
+{
+    const u32 stamp = ++m_QueryStamp;
+
+    const auto visit = [&](const ProxyId id)
+    {
+        const Proxy& proxy = m_Proxies[id];
+        if (proxy.queryStamp == stamp)
+            return;
+        proxy.queryStamp = stamp;
+
+        if (proxy.left <= right && left <= proxy.right && proxy.top <= bottom && top <= proxy.bottom)
+            callback(proxy);
+    };
+
+    const Vector2i minCell = GetCell({ left, top });
+    const Vector2i maxCell = GetCell({ right, bottom });
+
+    for (s32 y = minCell.y; y <= maxCell.y; y++)
+    {
+        for (s32 x = minCell.x; x <= maxCell.x; x++)
+        {
+            const auto it = m_Cells.find(GetCellKey(x, y));
+            if (it == m_Cells.end())
+                continue;
+
+            for (const ProxyId id : it->second)
+                visit(id);
+        }
+    }
+
+    for (const ProxyId id : m_LargeProxies)
+        visit(id);
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <limits>
+#include <unordered_map>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/FunctionTypes.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Math/Vector2.hpp"
+#include "Mountain/Math/Vector2i.hpp"
+#include "Mountain/Utils/Rectangle.hpp"
+
+/// @file SpatialHash.hpp
+/// @brief Defines the Mountain::SpatialHash class.
+
+namespace Mountain
+{
+    class Collider;
+    class Entity;
+
+    /// @brief Broadphase spatial index bucketing the bounds of entity colliders in a uniform grid of cells.
+    /// @details Each @c Entity with a @c Collider gets a proxy storing its absolute bounds and the range of cells it covers.
+    /// Moving an entity only touches the cell buckets when the range of cells it covers changes.
+    /// Proxies covering more than @c MaxProxyCells cells, e.g. large @c Grid colliders, are kept in a separate list that
+    /// is tested against every query instead of being inserted in every cell they cover.
+    ///
+    /// Queries use the bounds stored in the proxies to find candidates, then run the narrow-phase @c Collider::CheckCollision()
+    /// on them, so an entity that moved since the last @c Update() or @c Synchronize() can be missed.
+    ///
+    /// The queries aren't thread-safe and must not be nested, as they mark the visited proxies to avoid reporting an entity more than once.
+    /// In particular, they must not be called from @c Entity::ParallelUpdate(), and neither can the functions modifying
+    /// the spatial hash. Defer them with @c Scene::CallNextFrame() instead.
+    class SpatialHash
+    {
+    public:
+        /// @brief Index of a proxy in the spatial hash.
+        using ProxyId = u32;
+
+        static constexpr ProxyId InvalidProxy = std::numeric_limits<ProxyId>::max();
+
+        static constexpr f32 DefaultCellSize = 64.f;
+
+        /// @brief Maximum number of cells a proxy can cover before being stored in the large proxy list.
+        static constexpr s32 MaxProxyCells = 64;
+
+        MOUNTAIN_API explicit SpatialHash(f32 cellSize = DefaultCellSize);
+
+        /// @brief Inserts the given @p entity, which must have a collider.
+        /// @details Does nothing if the @p entity is already in this spatial hash.
+        MOUNTAIN_API void Insert(Entity& entity);
+
+        /// @brief Removes the given @p entity. Does nothing if it isn't in this spatial hash.
+        MOUNTAIN_API void Remove(Entity& entity);
+
+        /// @brief Updates the bounds of the given @p entity after it moved or its collider changed.
+        /// @details The entity is inserted if it isn't in this spatial hash yet, and removed if it doesn't have a collider anymore.
+        MOUNTAIN_API void Update(Entity& entity);
+
+        /// @brief Updates all the given @p entities and removes the proxies of the entities that aren't in the list anymore.
+        /// @details Only the proxies whose range of cells changed are moved between cells. The proxies that weren't
+        /// visited are only searched for if there are more proxies than visited entities, which doesn't happen when the
+        /// entities are removed through @c Remove(). The removed entities are never dereferenced, so they are allowed to be
+        /// deleted already.
+        MOUNTAIN_API void Synchronize(const List<Entity*>& entities);
+
+        /// @brief Returns whether the given @p entity is in this spatial hash.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool Contains(const Entity& entity) const;
+
+        /// @brief Removes all the entities.
+        MOUNTAIN_API void Clear();
+
+        /// @brief Calls @p callback for each entity whose collider overlaps @p rectangle.
+        MOUNTAIN_API void QueryRect(const Rectangle& rectangle, const Action<Entity*>& callback) const;
+
+        /// @brief Calls @p callback for each entity whose collider contains @p point.
+        MOUNTAIN_API void QueryPoint(Vector2 point, const Action<Entity*>& callback) const;
+
+        /// @brief Calls @p callback for each entity whose collider overlaps the circle at @p center with the given @p radius.
+        MOUNTAIN_API void QueryCircle(Vector2 center, f32 radius, const Action<Entity*>& callback) const;
+
+        /// @brief Calls @p callback once for each pair of entities whose colliders overlap.
+        MOUNTAIN_API void QueryPairs(const Action<Entity*, Entity*>& callback) const;
+
+        GETTER(f32, CellSize, m_CellSize)
+
+        /// @brief Sets the size of the cells and rebuilds the spatial hash.
+        /// @details The cell size should be around the size of the most common colliders.
+        MOUNTAIN_API void SetCellSize(f32 newCellSize);
+
+        /// @brief Returns the number of entities in this spatial hash.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API usize GetProxyCount() const;
+
+        /// @brief Returns the number of cells containing at least one entity.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API usize GetCellCount() const;
+
+    private:
+        struct Proxy
+        {
+            Entity* entity = nullptr;
+            Collider* collider = nullptr;
+
+            f32 left = 0.f, top = 0.f, right = 0.f, bottom = 0.f;
+            Vector2i minCell, maxCell;
+
+            /// @brief Value of @c m_QueryStamp the last time this proxy was visited by a query.
+            mutable u32 queryStamp = 0;
+            /// @brief Value of @c m_SyncStamp the last time this proxy was updated by @c Synchronize().
+            u32 syncStamp = 0;
+
+            bool alive = false;
+            bool large = false;
+        };
+
+        f32 m_CellSize;
+        f32 m_InverseCellSize;
+
+        List<Proxy> m_Proxies;
+        List<ProxyId> m_FreeProxies;
+        List<ProxyId> m_LargeProxies;
+
+        std::unordered_map<u64, List<ProxyId>> m_Cells;
+
+        mutable u32 m_QueryStamp = 0;
+        u32 m_SyncStamp = 0;
+
+        ATTRIBUTE_NODISCARD
+        static u64 GetCellKey(s32 x, s32 y);
+
+        ATTRIBUTE_NODISCARD
+        Vector2i GetCell(Vector2 position) const;
+
+        ATTRIBUTE_NODISCARD
+        ProxyId GetProxy(const Entity& entity) const;
+
+        /// @brief Reads the bounds of the proxy collider and moves it to its new cells if needed.
+        void RefreshProxy(ProxyId id);
+
+        void AddToCells(ProxyId id);
+        void RemoveFromCells(ProxyId id);
+        void RemoveProxy(ProxyId id);
+
+        /// @brief Calls @p callback for each proxy overlapping the given bounds, visiting each proxy only once.
+        void QueryBounds(f32 left, f32 top, f32 right, f32 bottom, const Action<const Proxy&>& callback) const;
+    };
+}
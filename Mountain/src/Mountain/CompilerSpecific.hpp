@@ -26,6 +26,19 @@
     #define COMPILER_ATTRIBUTE(x) __declspec(x)
 #endif
 
+#if defined(_M_X64) || defined(__x86_64__)
+    #define ARCHITECTURE_X64
+#endif
+
+#if defined(COMPILER_GCC) || defined(COMPILER_CLANG)
+    /// @brief Allows a function to use the intrinsics of the given instruction sets, e.g. @c "avx2", even if the rest of the
+    /// program isn't compiled for them. The function must only be called after checking that the CPU supports them.
+    #define TARGET_ISA(isa) COMPILER_ATTRIBUTE(target(isa))
+#else
+    // MSVC allows using the intrinsics of any instruction set without a compiler flag
+    #define TARGET_ISA(isa)
+#endif
+
 #ifdef ENVIRONMENT_WINDOWS
     #ifdef MOUNTAIN_EXPORT
         #define SHARED_PUBLIC COMPILER_ATTRIBUTE(dllexport)
@@ -1,16 +1,7 @@
-
-
 #include "Mountain/Ecs/Component/AudioSource.hpp"
 
-#include <AL/al.h>
-
-#include <imgui.h>
-
 #include "Mountain/Audio/Audio.hpp"
-#include "Mountain/Audio/AudioContext.hpp"
 #include "Mountain/Ecs/Entity.hpp"
-#include "Mountain/Ecs/Component/AudioListener.hpp"
-#include "Mountain/Input/Input.hpp"
 #include "Mountain/Input/Time.hpp"
 #include "Mountain/Utils/Logger.hpp"
 
@@ -18,55 +9,26 @@ using namespace Mountain;
 
 AudioSource::AudioSource()
 {
-    Audio::GetContext()->MakeCurrent();
-    alGenSources(1, &m_Handle);
-    AudioContext::CheckError();
     SetLooping(true);
 }
 
-AudioSource::~AudioSource()
-{
-    Audio::GetContext()->MakeCurrent();
-    alDeleteSources(1, &m_Handle);
-    AudioContext::CheckError();
-}
-
 void AudioSource::Added()
 {
-    // Update pitch and volume in OpenAL
-    SetVolume(m_Volume);
-    SetPitch(m_Pitch);
-
     if (m_PlayOnAdded)
         Play();
 }
 
 void AudioSource::Update()
 {
-    // If the track is not in mono, there is no audio spatialization
-    if (audioTrack->GetChannels() >= 2)
-        return;
-
-    Audio::GetContext()->MakeCurrent();
+    const Vector2 position = m_Entity->position * Audio::GetDistanceFactor();
 
-    const Vector2& position = m_Entity->position * Audio::GetDistanceFactor();
-
-    // Position
+    // These are only sent to OpenAL if they changed, and ignored for tracks that aren't in mono
     constexpr f32 positionZ = -20.f;
-    alSourcefv(m_Handle, AL_POSITION, Vector3(position.x, position.y, positionZ * Audio::GetDistanceFactor()).Data());
-    AudioContext::CheckError();
+    m_Voice.SetPosition(Vector3(position.x, position.y, positionZ * Audio::GetDistanceFactor()));
 
     const f32 deltaTime = Time::GetDeltaTime();
     const Vector2 velocity = deltaTime == 0.f ? Vector2::Zero() : (position - m_LastPosition) / deltaTime;
-    std::array direction = { Vector3::UnitZ(), Vector3::UnitY() };
-
-    // Velocity
-    alSourcefv(m_Handle, AL_VELOCITY, static_cast<Vector3>(velocity).Data());
-    AudioContext::CheckError();
-
-    // Direction
-    alSourcefv(m_Handle, AL_DIRECTION, direction[0].Data());
-    AudioContext::CheckError();
+    m_Voice.SetVelocity(static_cast<Vector3>(velocity));
 
     m_LastPosition = position;
 }
@@ -75,66 +37,33 @@ void AudioSource::Play() { if (audioTrack) Play(*audioTrack); }
 
 void AudioSource::Play(AudioTrack& track)
 {
-    Audio::GetContext()->MakeCurrent();
-
     if (!track.IsLoaded())
     {
         Logger::LogWarning("Tried to play an AudioTrack ({}) that wasn't loaded in the audio interface. Loading it", track.GetName());
         track.Load();
     }
 
-    alSourceRewind(m_Handle);
-    SetBuffer(track.GetBuffer());
-    alSourcePlay(m_Handle);
-    AudioContext::CheckError();
+    m_Voice.Play(track);
 }
 
-// ReSharper disable once CppMemberFunctionMayBeConst
-void AudioSource::SetBuffer(const AudioBuffer* buffer)
-{
-    Audio::GetContext()->MakeCurrent();
-    alSourcei(m_Handle, AL_BUFFER, static_cast<s32>(buffer->GetHandle()));
-    AudioContext::CheckError();
-}
+void AudioSource::Stop() { m_Voice.Stop(); }
 
-f32 AudioSource::GetVolume() const
-{
-    return m_Volume;
-}
+void AudioSource::Seek(const f32 seconds) { m_Voice.Seek(seconds); }
 
-void AudioSource::SetVolume(const f32 newVolume)
-{
-    m_Volume = std::max(0.f, newVolume);
+f32 AudioSource::GetVolume() const { return m_Voice.GetVolume(); }
 
-    Audio::GetContext()->MakeCurrent();
-    alSourcef(m_Handle, AL_GAIN, m_Volume);
-    AudioContext::CheckError();
-}
+void AudioSource::SetVolume(const f32 newVolume) { m_Voice.SetVolume(newVolume); }
 
-f32 AudioSource::GetPitch() const
-{
-    return m_Pitch;
-}
+f32 AudioSource::GetPitch() const { return m_Voice.GetPitch(); }
 
-void AudioSource::SetPitch(const f32 newPitch)
-{
-    m_Pitch = std::max(0.f, newPitch);
+void AudioSource::SetPitch(const f32 newPitch) { m_Voice.SetPitch(newPitch); }
 
-    Audio::GetContext()->MakeCurrent();
-    alSourcef(m_Handle, AL_PITCH, m_Pitch);
-    AudioContext::CheckError();
-}
+bool AudioSource::GetLooping() const { return m_Voice.GetLooping(); }
 
-bool AudioSource::GetLooping() const
-{
-    return m_Looping;
-}
+void AudioSource::SetLooping(const bool newLooping) { m_Voice.SetLooping(newLooping); }
 
-void AudioSource::SetLooping(const bool newLooping)
-{
-    m_Looping = newLooping;
+s32 AudioSource::GetPriority() const { return m_Voice.priority; }
 
-    Audio::GetContext()->MakeCurrent();
-    alSourcei(m_Handle, AL_LOOPING, m_Looping);
-    AudioContext::CheckError();
-}
+void AudioSource::SetPriority(const s32 newPriority) { m_Voice.priority = newPriority; }
+
+bool AudioSource::IsPlaying() const { return m_Voice.IsPlaying(); }
@@ -1,12 +1,16 @@
 #pragma once
 
 #include "Mountain/Core.hpp"
+#include "Mountain/Audio/VoiceManager.hpp"
 #include "Mountain/Ecs/Component/Component.hpp"
 #include "Mountain/Math/Vector2.hpp"
 #include "Mountain/Resource/AudioTrack.hpp"
 
 namespace Mountain
 {
+    /// @brief Plays an AudioTrack at the position of its Entity.
+    /// @details The track is played by an @c AudioVoice, so it only uses an OpenAL source while it is among the most
+    /// audible sounds, and its properties are sent to OpenAL once per frame.
     class AudioSource : public Component
     {
     public:
@@ -14,7 +18,7 @@ namespace Mountain
 
         MOUNTAIN_API AudioSource();
 
-        MOUNTAIN_API ~AudioSource() override;
+        MOUNTAIN_API ~AudioSource() override = default;
 
         DELETE_COPY_MOVE_OPERATIONS(AudioSource)
 
@@ -24,9 +28,13 @@ namespace Mountain
 
         MOUNTAIN_API void Play();
 
+        /// @brief Plays @p track from the start, streaming it if @c AudioTrack::IsStreamed() is true.
         MOUNTAIN_API void Play(AudioTrack& track);
 
-        MOUNTAIN_API void SetBuffer(const AudioBuffer* buffer);
+        MOUNTAIN_API void Stop();
+
+        /// @brief Moves the playback position to @p seconds from the start of the current track.
+        MOUNTAIN_API void Seek(f32 seconds);
 
         MOUNTAIN_API f32 GetVolume() const;
 
@@ -40,16 +48,19 @@ namespace Mountain
 
         MOUNTAIN_API void SetLooping(bool newLooping);
 
-    private:
-        u32 m_Handle = 0;
+        /// @brief Returns the priority of the voice of this source. Sources with a higher priority are heard before the
+        /// ones with a lower priority when there are more sounds playing than OpenAL sources.
+        MOUNTAIN_API s32 GetPriority() const;
 
-        /// @brief Volume in the range [0, inf]. Default value is 1.
-        f32 m_Volume = 1.f;
+        MOUNTAIN_API void SetPriority(s32 newPriority);
 
-        /// @brief Pitch in the range [0, inf]. Default value is 1.
-        f32 m_Pitch = 1.f;
+        /// @brief Returns whether the track is playing, even if it can't be heard because of more important sounds.
+        MOUNTAIN_API bool IsPlaying() const;
 
-        bool m_Looping = false;
+        GETTER_NON_CONST(AudioVoice&, Voice, m_Voice)
+
+    private:
+        AudioVoice m_Voice;
 
         bool m_PlayOnAdded = true;
 
@@ -4,6 +4,28 @@
 
 using namespace Mountain;
 
+Component::Component(const Component& other) noexcept
+    : m_Entity(other.m_Entity)
+{
+}
+
+Component::Component(Component&& other) noexcept
+    : m_Entity(other.m_Entity)
+{
+}
+
+Component& Component::operator=(const Component& other) noexcept
+{
+    m_Entity = other.m_Entity;
+    return *this;
+}
+
+Component& Component::operator=(Component&& other) noexcept
+{
+    m_Entity = other.m_Entity;
+    return *this;
+}
+
 void Component::Added()
 {
 }
@@ -36,6 +58,10 @@ void Component::Update()
 {
 }
 
+void Component::ParallelUpdate()
+{
+}
+
 void Component::Render()
 {
 }
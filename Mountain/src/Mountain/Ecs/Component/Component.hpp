@@ -4,6 +4,7 @@
 
 namespace Mountain
 {
+    class ComponentPoolBase;
     class Entity;
     class Scene;
 
@@ -11,12 +12,19 @@ namespace Mountain
     class MOUNTAIN_API Component
     {
         friend class Entity;
+        friend class ComponentPoolBase;
+        friend class ComponentRegistry;
 
     public:
         Component() = default;
         virtual ~Component() = default;
 
-        DEFAULT_COPY_MOVE_OPERATIONS(Component)
+        /// @brief Copies the Entity of the other component. The copy never belongs to the pool of the original.
+        Component(const Component& other) noexcept;
+        /// @brief Moves the Entity of the other component. The component never belongs to the pool of the original.
+        Component(Component&& other) noexcept;
+        Component& operator=(const Component& other) noexcept;
+        Component& operator=(Component&& other) noexcept;
 
         /// @brief Called when the component is added to an Entity.
         virtual void Added();
@@ -27,6 +35,12 @@ namespace Mountain
         /// @brief Updates the component.
         virtual void Update();
 
+        /// @brief Updates the component on any thread, before @c Update() is called on all the entities of the Scene.
+        /// @details This is only called if @c Scene::parallelUpdate is enabled. This must only modify the component and its
+        /// Entity, structural changes to the Scene have to go through @c Scene::AddNextFrame(), @c Scene::RemoveNextFrame()
+        /// and @c Scene::CallNextFrame().
+        virtual void ParallelUpdate();
+
         /// @brief Renders the component.
         virtual void Render();
 
@@ -55,5 +69,13 @@ namespace Mountain
     protected:
         /// @brief Entity bound to the component
         Entity* m_Entity = nullptr;
+
+    private:
+        /// @brief The pool this component was created in, or @c nullptr if it was allocated with @c new.
+        ComponentPoolBase* m_Pool = nullptr;
+        /// @brief The index of this component in its pool, or in the components of its type allocated with @c new.
+        u32 m_PoolSlot = 0;
+        /// @brief The ComponentTypeId of the dynamic type of this component, set when it is added to an Entity.
+        u32 m_TypeId = 0;
     };
 }
@@ -0,0 +1,118 @@
+#include "Mountain/Ecs/Component/ComponentPool.hpp"
+
+using namespace Mountain;
+
+void ComponentPoolBase::Destroy(Component* component)
+{
+    if (!component->m_Pool)
+    {
+        ComponentRegistry::RemoveUnpooled(*component);
+        delete component;
+        return;
+    }
+
+    component->m_Pool->DestroySlot(component->m_PoolSlot);
+}
+
+void ComponentPoolBase::SetPoolSlot(Component& component, const u32 slot)
+{
+    component.m_Pool = this;
+    component.m_PoolSlot = slot;
+}
+
+ComponentTypeId ComponentRegistry::GetTypeId(const std::type_index& type)
+{
+    std::scoped_lock lock{m_Mutex};
+
+    const auto it = m_TypeIds.find(type);
+    if (it != m_TypeIds.end())
+        return it->second;
+
+    const ComponentTypeId id = static_cast<ComponentTypeId>(m_TypeIds.size());
+    m_TypeIds.emplace(type, id);
+    return id;
+}
+
+usize ComponentRegistry::GetTypeCount()
+{
+    std::scoped_lock lock{m_Mutex};
+    return m_TypeIds.size();
+}
+
+void ComponentRegistry::AddUnpooled(Component& component, const ComponentTypeId typeId)
+{
+    std::scoped_lock lock{m_Mutex};
+
+    while (m_Unpooled.GetSize() <= typeId)
+        m_Unpooled.Emplace();
+
+    UnpooledComponents& unpooled = m_Unpooled[typeId];
+
+    u32 slot;
+    if (unpooled.freeSlots.IsEmpty())
+    {
+        slot = static_cast<u32>(unpooled.components.GetSize());
+        unpooled.components.Add(&component);
+    }
+    else
+    {
+        slot = unpooled.freeSlots.Last();
+        unpooled.freeSlots.RemoveLast();
+        unpooled.components[slot] = &component;
+    }
+
+    component.m_PoolSlot = slot;
+}
+
+void ComponentRegistry::RemoveUnpooled(const Component& component)
+{
+    std::scoped_lock lock{m_Mutex};
+
+    // The component may have been destroyed without ever being added to an Entity
+    const ComponentTypeId typeId = component.m_TypeId;
+    if (typeId >= m_Unpooled.GetSize())
+        return;
+
+    UnpooledComponents& unpooled = m_Unpooled[typeId];
+    const u32 slot = component.m_PoolSlot;
+    if (slot >= unpooled.components.GetSize() || unpooled.components[slot] != &component)
+        return;
+
+    // Leave a hole instead of moving the last component so that an ongoing ForEach() doesn't skip it
+    unpooled.components[slot] = nullptr;
+    unpooled.freeSlots.Add(slot);
+}
+
+void ComponentRegistry::ForEachUnpooled(const ComponentTypeId typeId, const Action<Component&>& function)
+{
+    if (typeId >= m_Unpooled.GetSize())
+        return;
+
+    // Adding components may reallocate the lists, so iterate by index over the slots that already exist
+    const usize count = m_Unpooled[typeId].components.GetSize();
+    for (usize i = 0; i < count; i++)
+    {
+        if (Component* component = m_Unpooled[typeId].components[i])
+            function(*component);
+    }
+}
+
+Component* ComponentRegistry::GetAnyComponent(const ComponentTypeId typeId)
+{
+    if (typeId < m_Pools.GetSize() && m_Pools[typeId])
+    {
+        if (Component* component = m_Pools[typeId]->GetAnyComponent())
+            return component;
+    }
+
+    if (typeId < m_Unpooled.GetSize())
+    {
+        for (Component* component : m_Unpooled[typeId].components)
+        {
+            if (component)
+                return component;
+        }
+    }
+
+    return nullptr;
+}
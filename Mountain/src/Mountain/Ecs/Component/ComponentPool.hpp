@@ -0,0 +1,341 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <typeindex>
+#include <unordered_map>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/FunctionTypes.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Ecs/Component/Component.hpp"
+#include "Mountain/Utils/MetaProgramming.hpp"
+
+/// @file ComponentPool.hpp
+/// @brief Defines the Mountain::ComponentPool and Mountain::ComponentRegistry classes.
+
+namespace Mountain
+{
+    /// @brief Dense index identifying a Component type, used to find the components of an Entity in constant time.
+    using ComponentTypeId = u32;
+
+    /// @brief Type-erased base of @c ComponentPool.
+    class MOUNTAIN_API ComponentPoolBase
+    {
+    public:
+        ComponentPoolBase() = default;
+        virtual ~ComponentPoolBase() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(ComponentPoolBase)
+
+        /// @brief Destroys a component, calling @c delete on it if it wasn't created in a pool.
+        static void Destroy(Component* component);
+
+        /// @brief Returns the number of components currently alive in this pool.
+        GETTER(usize, Count, m_Count)
+
+        /// @brief Calls @p function with each alive component of this pool, see @c ComponentPool::ForEach().
+        virtual void ForEachComponent(const Action<Component&>& function) = 0;
+
+        /// @brief Returns any alive component of this pool, or @c nullptr if it is empty.
+        ATTRIBUTE_NODISCARD
+        virtual Component* GetAnyComponent() = 0;
+
+    protected:
+        usize m_Count = 0;
+
+        /// @brief Guards the slots of the pool, as components can be created and destroyed from any thread.
+        std::mutex m_Mutex;
+
+        virtual void DestroySlot(u32 slot) = 0;
+
+        void SetPoolSlot(Component& component, u32 slot);
+    };
+
+    /// @brief Stores all the components of type @p T in pages of @c PageSize contiguous elements.
+    /// @details Components never move once created, so pointers to them stay valid until they are destroyed.
+    /// Destroyed slots are reused by the next created components.
+    /// Components can be created and destroyed from any thread, but not while another thread iterates the pool.
+    template <Concepts::Component T>
+    class ComponentPool final : public ComponentPoolBase
+    {
+    public:
+        /// @brief The number of components in a page, one bit of the alive mask per component.
+        static constexpr u32 PageSize = 64;
+
+        ComponentPool() = default;
+        ~ComponentPool() override;
+
+        DELETE_COPY_MOVE_OPERATIONS(ComponentPool)
+
+        template <typename... Args>
+        T* Create(Args&&... args);
+
+        /// @brief Calls @p function with a reference to each alive component, in memory order.
+        /// @details @p function is allowed to create and destroy components of this pool. The destroyed components are
+        /// skipped if they weren't visited yet, while the created ones may or may not be visited.
+        template <Concepts::Invocable<T&> FunctionT>
+        void ForEach(FunctionT&& function);
+
+        void ForEachComponent(const Action<Component&>& function) override;
+
+        ATTRIBUTE_NODISCARD
+        Component* GetAnyComponent() override;
+
+    protected:
+        void DestroySlot(u32 slot) override;
+
+    private:
+        struct Page
+        {
+            alignas(T) std::byte storage[sizeof(T) * PageSize];
+            u64 aliveMask = 0;
+
+            T* At(const u32 index) { return std::launder(reinterpret_cast<T*>(storage + index * sizeof(T))); }
+        };
+
+        List<Page*> m_Pages;
+        List<u32> m_FreeSlots;
+    };
+
+    /// @brief Static class assigning a @c ComponentTypeId to each Component type and owning their pools.
+    /// @details It also keeps track of the components allocated with @c new and added with @c Entity::AddComponent(Component*),
+    /// so that @c ForEach() visits every component of a type. Ids and pools can be requested from any thread.
+    class ComponentRegistry
+    {
+        STATIC_CLASS(ComponentRegistry)
+
+    public:
+        /// @brief Returns the id of the Component type @p T. Ids are assigned on first use and are the same across modules.
+        template <Concepts::Component T>
+        ATTRIBUTE_NODISCARD
+        static ComponentTypeId GetTypeId();
+
+        /// @brief Returns the id of the Component type with the given runtime @p type.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static ComponentTypeId GetTypeId(const std::type_index& type);
+
+        /// @brief Returns the number of ids assigned until now.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetTypeCount();
+
+        /// @brief Returns the pool containing all the components of type @p T created using @c Entity::AddComponent<T>().
+        template <Concepts::Component T>
+        ATTRIBUTE_NODISCARD
+        static ComponentPool<T>& GetPool();
+
+        /// @brief Calls @p function with each component attached to an Entity whose type is @p T or derived from it.
+        /// @details The pool of @p T is iterated first, then the components of type @p T allocated with @c new. Unless @p T
+        /// is @c final, the same is then done for each type derived from @p T, which is found by casting a single component of
+        /// each other type. @p function is allowed to create and destroy components, with the same guarantees as
+        /// @c ComponentPool::ForEach(), but components must not be created or destroyed from other threads in the meantime.
+        template <Concepts::Component T, Concepts::Invocable<T&> FunctionT>
+        static void ForEach(FunctionT&& function);
+
+    private:
+        /// @brief The components of a type that were allocated with @c new, stored by slot like in a pool.
+        struct UnpooledComponents
+        {
+            List<Component*> components;
+            List<u32> freeSlots;
+        };
+
+        MOUNTAIN_API static inline std::unordered_map<std::type_index, ComponentTypeId> m_TypeIds;
+        /// @brief The pools of each type, indexed by ComponentTypeId. They are never freed, so components destroyed during
+        /// static destruction still have a valid pool.
+        MOUNTAIN_API static inline List<ComponentPoolBase*> m_Pools;
+        /// @brief The components that aren't in a pool, indexed by ComponentTypeId.
+        MOUNTAIN_API static inline List<UnpooledComponents> m_Unpooled;
+        /// @brief Guards @c m_TypeIds, @c m_Pools and @c m_Unpooled, as components can be created from any thread.
+        MOUNTAIN_API static inline std::mutex m_Mutex;
+
+        /// @brief Registers a component allocated with @c new when it is added to an Entity.
+        MOUNTAIN_API static void AddUnpooled(Component& component, ComponentTypeId typeId);
+
+        /// @brief Unregisters a component allocated with @c new before it is deleted.
+        MOUNTAIN_API static void RemoveUnpooled(const Component& component);
+
+        MOUNTAIN_API static void ForEachUnpooled(ComponentTypeId typeId, const Action<Component&>& function);
+
+        /// @brief Returns any component of the given type, or @c nullptr if there isn't any.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static Component* GetAnyComponent(ComponentTypeId typeId);
+
+        // Registers the components allocated with new
+        friend class Entity;
+        // Unregisters them when they are destroyed
+        friend class ComponentPoolBase;
+    };
+}
+
+// Start of ComponentPool.inl
+
+namespace Mountain
+{
+    template <Concepts::Component T>
+    ComponentPool<T>::~ComponentPool()
+    {
+        for (Page* page : m_Pages)
+        {
+            u64 mask = page->aliveMask;
+            while (mask)
+            {
+                page->At(static_cast<u32>(std::countr_zero(mask)))->~T();
+                mask &= mask - 1;
+            }
+            delete page;
+        }
+    }
+
+    template <Concepts::Component T>
+    template <typename... Args>
+    T* ComponentPool<T>::Create(Args&&... args)
+    {
+        u32 slot;
+        Page* page;
+        {
+            std::scoped_lock lock{m_Mutex};
+
+            if (m_FreeSlots.IsEmpty())
+            {
+                slot = static_cast<u32>(m_Pages.GetSize()) * PageSize;
+                m_Pages.Add(new Page);
+                for (u32 i = PageSize - 1; i > 0; i--)
+                    m_FreeSlots.Add(slot + i);
+            }
+            else
+            {
+                slot = m_FreeSlots.Last();
+                m_FreeSlots.RemoveLast();
+            }
+
+            page = m_Pages[slot / PageSize];
+        }
+
+        const u32 index = slot % PageSize;
+
+        // The constructor is called without holding the lock as it may create other components
+        T* result = new (page->storage + index * sizeof(T)) T(std::forward<Args>(args)...);
+
+        {
+            std::scoped_lock lock{m_Mutex};
+            page->aliveMask |= 1ull << index;
+            m_Count++;
+        }
+
+        SetPoolSlot(*result, slot);
+        return result;
+    }
+
+    template <Concepts::Component T>
+    template <Concepts::Invocable<T&> FunctionT>
+    void ComponentPool<T>::ForEach(FunctionT&& function)
+    {
+        // Creating a component may add a page and reallocate m_Pages, so iterate by index over the pages that already exist
+        const usize pageCount = m_Pages.GetSize();
+        for (usize i = 0; i < pageCount; i++)
+        {
+            Page& page = *m_Pages[i];
+            u64 mask = page.aliveMask;
+            while (mask)
+            {
+                const u32 index = static_cast<u32>(std::countr_zero(mask));
+                function(*page.At(index));
+                // Skip the components destroyed by the function
+                mask &= ~(1ull << index) & page.aliveMask;
+            }
+        }
+    }
+
+    template <Concepts::Component T>
+    void ComponentPool<T>::ForEachComponent(const Action<Component&>& function)
+    {
+        ForEach([&](T& component) { function(component); });
+    }
+
+    template <Concepts::Component T>
+    Component* ComponentPool<T>::GetAnyComponent()
+    {
+        for (Page* page : m_Pages)
+        {
+            if (page->aliveMask)
+                return page->At(static_cast<u32>(std::countr_zero(page->aliveMask)));
+        }
+
+        return nullptr;
+    }
+
+    template <Concepts::Component T>
+    void ComponentPool<T>::DestroySlot(const u32 slot)
+    {
+        Page* page;
+        {
+            std::scoped_lock lock{m_Mutex};
+            page = m_Pages[slot / PageSize];
+        }
+
+        const u32 index = slot % PageSize;
+
+        // The destructor is called without holding the lock as it may destroy other components
+        page->At(index)->~T();
+
+        std::scoped_lock lock{m_Mutex};
+        page->aliveMask &= ~(1ull << index);
+        m_Count--;
+
+        m_FreeSlots.Add(slot);
+    }
+
+    template <Concepts::Component T>
+    ComponentTypeId ComponentRegistry::GetTypeId()
+    {
+        static const ComponentTypeId id = GetTypeId(typeid(T));
+        return id;
+    }
+
+    template <Concepts::Component T>
+    ComponentPool<T>& ComponentRegistry::GetPool()
+    {
+        const ComponentTypeId id = GetTypeId<T>();
+
+        std::scoped_lock lock{m_Mutex};
+
+        while (m_Pools.GetSize() <= id)
+            m_Pools.Add(nullptr);
+
+        ComponentPoolBase*& pool = m_Pools[id];
+        if (!pool)
+            pool = new ComponentPool<T>;
+
+        return static_cast<ComponentPool<T>&>(*pool);
+    }
+
+    template <Concepts::Component T, Concepts::Invocable<T&> FunctionT>
+    void ComponentRegistry::ForEach(FunctionT&& function)
+    {
+        const ComponentTypeId typeId = GetTypeId<T>();
+
+        GetPool<T>().ForEach(function);
+        ForEachUnpooled(typeId, [&](Component& component) { function(static_cast<T&>(component)); });
+
+        if constexpr (!std::is_final_v<T>)
+        {
+            // Components of a derived type are stored with the other components of that exact type, all of them being
+            // derived from T if any of them is
+            const usize typeCount = GetTypeCount();
+            for (ComponentTypeId otherId = 0; otherId < typeCount; otherId++)
+            {
+                if (otherId == typeId || !dynamic_cast<T*>(GetAnyComponent(otherId)))
+                    continue;
+
+                const auto visit = [&](Component& component) { function(static_cast<T&>(component)); };
+
+                if (otherId < m_Pools.GetSize() && m_Pools[otherId])
+                    m_Pools[otherId]->ForEachComponent(visit);
+                ForEachUnpooled(otherId, visit);
+            }
+        }
+    }
+}
@@ -1,6 +1,7 @@
 ﻿
 #include "Mountain/Ecs/Component/Sprite.hpp"
 
+#include "Mountain/Graphics/Renderer.hpp"
 #include "Mountain/Input/Time.hpp"
 #include "Mountain/Resource/ResourceManager.hpp"
 
@@ -52,6 +53,10 @@ void Sprite::SetupTextures()
 
     m_Textures.Sort([](const Pointer<Texture>& a, const Pointer<Texture>& b) -> bool { return a->GetName() < b->GetName(); });
 
+    // Pack all frames on the same atlas page so that they can be batched with other sprites
+    if (Pointer<TextureAtlas> atlas = Renderer::GetDefaultTextureAtlas())
+        atlas->AddRange(m_Textures);
+
     m_UpdateTimer = frameDuration;
 }
 
@@ -25,6 +25,7 @@ namespace Mountain
         /// @warning This is a quite heavy operation as it loops over all loaded textures to find the right ones
         /// and is already called in the constructor.
         /// Consider using this only when necessary, i.e., after modifying @c name.
+        /// The found Textures are packed together into the default TextureAtlas, see @c Renderer::GetDefaultTextureAtlas().
         MOUNTAIN_API void SetupTextures();
 
         MOUNTAIN_API const Pointer<Texture>& Get() const;
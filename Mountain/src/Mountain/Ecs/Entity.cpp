@@ -2,6 +2,7 @@
 
 #include "Mountain/Ecs/Entity.hpp"
 
+#include "Mountain/Ecs/Scene.hpp"
 #include "Mountain/Ecs/Component/Component.hpp"
 
 using namespace Mountain;
@@ -13,8 +14,8 @@ Entity::Entity(const Vector2& position)
 
 Entity::~Entity()
 {
-    for (const Component* const component : m_Components)
-        delete component;
+    for (Component* component : m_Components)
+        ComponentPoolBase::Destroy(component);
 }
 
 void Entity::Update()
@@ -23,6 +24,12 @@ void Entity::Update()
         component->Update();
 }
 
+void Entity::ParallelUpdate()
+{
+    for (Component* component : m_Components)
+        component->ParallelUpdate();
+}
+
 void Entity::Render()
 {
     for (Component* component : m_Components)
@@ -38,6 +45,7 @@ void Entity::RenderDebug()
 void Entity::Added(Scene& scene)
 {
     m_Scene = &scene;
+    scene.GetBroadphase().Update(*this);
     for (Component* component : m_Components)
         component->EntityAdded(scene);
 }
@@ -46,6 +54,7 @@ void Entity::Removed(Scene& scene)
 {
     for (Component* component : m_Components)
         component->EntityRemoved(scene);
+    scene.GetBroadphase().Remove(*this);
     m_Scene = nullptr;
 }
 
@@ -69,9 +78,7 @@ void Entity::SceneEnd()
 
 void Entity::AddComponent(Component* component)
 {
-    m_Components.Add(component);
-    component->m_Entity = this;
-    component->Added();
+    AttachComponent(component, ComponentRegistry::GetTypeId(typeid(*component)));
 }
 
 List<Component*>& Entity::GetComponents() { return m_Components; }
@@ -81,12 +88,47 @@ const List<Component*>& Entity::GetComponents() const { return m_Components; }
 void Entity::RemoveComponent(Component* component)
 {
     m_Components.Remove(component);
+
+    // Another component of the same type becomes the one returned by GetComponent()
+    const ComponentTypeId typeId = component->m_TypeId;
+    if (m_ComponentsByType[typeId] == component)
+    {
+        m_ComponentsByType[typeId] = nullptr;
+        for (Component* other : m_Components)
+        {
+            if (other->m_TypeId == typeId)
+            {
+                m_ComponentsByType[typeId] = other;
+                break;
+            }
+        }
+    }
+
     component->Removed();
-    delete component;
+    ComponentPoolBase::Destroy(component);
+}
+
+void Entity::AttachComponent(Component* component, const ComponentTypeId typeId)
+{
+    m_Components.Add(component);
+    component->m_Entity = this;
+    component->m_TypeId = typeId;
+    if (!component->m_Pool)
+        ComponentRegistry::AddUnpooled(*component, typeId);
+
+    while (m_ComponentsByType.GetSize() <= typeId)
+        m_ComponentsByType.Add(nullptr);
+    if (!m_ComponentsByType[typeId])
+        m_ComponentsByType[typeId] = component;
+
+    component->Added();
 }
 
 void Entity::SetCollider(Collider* newCollider) noexcept
 {
     m_Collider = newCollider;
     newCollider->basePosition = &position;
+
+    if (m_Scene)
+        m_Scene->GetBroadphase().Update(*this);
 }
@@ -2,7 +2,10 @@
 
 #include "Mountain/Core.hpp"
 #include "Mountain/Collision/Collider.hpp"
+#include "Mountain/Collision/SpatialHash.hpp"
 #include "Mountain/Containers/List.hpp"
+#include "Mountain/Ecs/Component/ComponentPool.hpp"
+#include "Mountain/Ecs/EntityHandle.hpp"
 #include "Mountain/Math/Vector2.hpp"
 #include "Mountain/Utils/MetaProgramming.hpp"
 
@@ -25,6 +28,13 @@ namespace Mountain
 
         MOUNTAIN_API virtual void Update();
 
+        /// @brief Updates the Entity on any thread, before @c Update() is called on all the entities of the Scene.
+        /// @details This is only called if @c Scene::parallelUpdate is enabled, and calls @c Component::ParallelUpdate() on
+        /// each component by default. This must only modify this Entity and its components, structural changes to the Scene
+        /// have to go through @c Scene::AddNextFrame(), @c Scene::RemoveNextFrame() and @c Scene::CallNextFrame().
+        /// The Scene broadphase isn't thread-safe, so it must not be queried here either.
+        MOUNTAIN_API virtual void ParallelUpdate();
+
         MOUNTAIN_API virtual void Render();
 
         MOUNTAIN_API virtual void RenderDebug();
@@ -40,11 +50,16 @@ namespace Mountain
 
         MOUNTAIN_API virtual void SceneEnd();
 
+        /// @brief Adds a component allocated with @c new. This Entity takes ownership of it.
         MOUNTAIN_API void AddComponent(Component* component);
 
+        /// @brief Creates a component of type @p T in its ComponentPool and adds it to this Entity.
         template <Concepts::Component T, typename... Args>
         T* AddComponent(Args&&... args);
 
+        /// @brief Returns the first component of type @p T or of a type derived from it, or @c nullptr if there isn't any.
+        /// @details A component of exactly type @p T is found in constant time. Otherwise, the components are searched
+        /// linearly for one of a derived type, unless @p T is @c final.
         template <Concepts::Component T>
         ATTRIBUTE_NODISCARD
         T* GetComponent() const;
@@ -55,13 +70,17 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API const List<Component*>& GetComponents() const;
 
+        /// @brief Removes and destroys the given @p component.
         MOUNTAIN_API void RemoveComponent(Component* component);
 
+        /// @brief Removes and destroys the component returned by @c GetComponent<T>(), if any.
         template <Concepts::Component T>
         void RemoveComponent();
 
         GETTER_NON_CONST(Collider*, Collider, m_Collider)
 
+        /// @brief Sets the collider of this Entity and updates its bounds in the broadphase of its Scene, if any.
+        /// @details As this modifies the Scene broadphase, this must not be called from @c ParallelUpdate().
         MOUNTAIN_API void SetCollider(Collider* newCollider) noexcept;
 
         template <Concepts::Collider T, typename... Args>
@@ -71,6 +90,10 @@ namespace Mountain
 
         GETTER(Scene*, Scene, m_Scene)
 
+        /// @brief The handle of this Entity in the EntityList of its Scene, which is invalid if it isn't in any.
+        /// @details Use @c EntityList::GetHandle() to get the handle of this Entity in another list.
+        GETTER(EntityHandle, Handle, m_Handle)
+
     protected:
         Collider* m_Collider = nullptr;
 
@@ -79,8 +102,22 @@ namespace Mountain
 
     private:
         List<Component*> m_Components;
+        /// @brief The first component of each type, indexed by ComponentTypeId.
+        List<Component*> m_ComponentsByType;
 
         Scene* m_Scene = nullptr;
+
+        /// @brief The index of the proxy of this Entity in the @c SpatialHash of its Scene.
+        SpatialHash::ProxyId m_BroadphaseProxy = SpatialHash::InvalidProxy;
+
+        EntityHandle m_Handle;
+
+        friend SpatialHash;
+
+        template <Concepts::Entity EntityT>
+        friend class EntityList;
+
+        MOUNTAIN_API void AttachComponent(Component* component, ComponentTypeId typeId);
     };
 }
 
@@ -91,14 +128,21 @@ namespace Mountain
     template <Concepts::Component T, typename... Args>
     T* Entity::AddComponent(Args&&... args)
     {
-        T* t = new T(std::forward<Args>(args)...);
-        AddComponent(t);
+        T* t = ComponentRegistry::GetPool<T>().Create(std::forward<Args>(args)...);
+        AttachComponent(t, ComponentRegistry::GetTypeId<T>());
         return t;
     }
 
     template <Concepts::Component T>
     T* Entity::GetComponent() const
     {
+        const ComponentTypeId typeId = ComponentRegistry::GetTypeId<T>();
+        if (typeId < m_ComponentsByType.GetSize() && m_ComponentsByType[typeId])
+            return static_cast<T*>(m_ComponentsByType[typeId]);
+
+        if constexpr (std::is_final_v<T>)
+            return nullptr;
+
         for (auto& component : m_Components)
         {
             T* t = dynamic_cast<T*>(component);
@@ -113,16 +157,8 @@ namespace Mountain
     template <Concepts::Component T>
     void Entity::RemoveComponent()
     {
-        for (auto it = m_Components.begin(); it != m_Components.end(); it++)
-        {
-            const T* const t = dynamic_cast<T*>(*it);
-
-            if (t)
-            {
-                m_Components.RemoveAt(it);
-                return;
-            }
-        }
+        if (T* t = GetComponent<T>())
+            RemoveComponent(t);
     }
 
     template <Concepts::Collider T, typename... Args>
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <limits>
+
+#include "Mountain/Core.hpp"
+
+namespace Mountain
+{
+    /// @brief Weak reference to an Entity in an @c EntityList.
+    /// @details A handle stays safe to use after its Entity has been removed, as resolving it with @c EntityList::Get()
+    /// then returns @c nullptr, even if the slot was reused by another Entity since.
+    struct EntityHandle
+    {
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+        /// @brief The index of the slot of the Entity in its list.
+        u32 index = InvalidIndex;
+        /// @brief The generation of the slot when the Entity was added.
+        u32 generation = 0;
+
+        ATTRIBUTE_NODISCARD
+        constexpr bool IsValid() const { return index != InvalidIndex; }
+
+        ATTRIBUTE_NODISCARD
+        friend constexpr bool operator==(EntityHandle, EntityHandle) = default;
+    };
+}
@@ -1,13 +1,23 @@
 ﻿#pragma once
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "Mountain/Core.hpp"
 #include "Mountain/Containers/EnumerableExt.hpp"
 #include "Mountain/Containers/List.hpp"
+#include "Mountain/Ecs/EntityHandle.hpp"
 
 namespace Mountain
 {
     class Scene;
 
+    /// @brief List of entities sorted by depth, giving each of them an @c EntityHandle.
+    /// @details The handles are backed by a slot map, so checking whether an Entity is in the list and resolving a handle
+    /// are constant-time operations. An Entity can be in several lists, each of them keeping its own handle. Only the
+    /// list of a Scene stores it in @c Entity::GetHandle().
+    /// Entities added or removed for the next frame are applied in batch in @c UpdateLists(): the new entities are sorted
+    /// among themselves and merged into the list, and the removed ones are dropped in a single pass that keeps the order.
     template <Concepts::Entity EntityT>
     class EntityList
     {
@@ -39,20 +49,56 @@ namespace Mountain
 
         void Clear();
 
+        /// @brief Returns whether the given @p entity is in this list, in constant time.
+        ATTRIBUTE_NODISCARD
+        bool Has(const EntityT* entity) const;
+
+        /// @brief Returns the Entity referenced by the given @p handle, or @c nullptr if it was removed from this list.
+        ATTRIBUTE_NODISCARD
+        EntityT* Get(EntityHandle handle) const;
+
+        /// @brief Returns the handle of the given @p entity in this list, which is invalid if it isn't in it.
+        ATTRIBUTE_NODISCARD
+        EntityHandle GetHandle(const EntityT* entity) const;
+
         GETTER_NON_CONST(List<EntityT*>&, List, m_Entities)
         GETTER_NON_CONST(List<EntityT*>&, ToAdd, m_ToAdd)
         GETTER_NON_CONST(List<EntityT*>&, ToRemove, m_ToRemove)
 
     private:
+        struct Slot
+        {
+            EntityT* entity = nullptr;
+            /// @brief Incremented each time the slot is freed, invalidating the handles to its previous Entity.
+            u32 generation = 0;
+            /// @brief Whether the Entity is only in @c m_ToAdd yet.
+            bool pending = false;
+        };
+
         List<EntityT*> m_ToAdd;
         List<EntityT*> m_ToRemove;
 
+        List<Slot> m_Slots;
+        List<u32> m_FreeSlots;
+        /// @brief The slot of each Entity of this list, including those added for the next frame.
+        std::unordered_map<const EntityT*, u32> m_SlotIndices;
+
         /// @brief Whether the @c m_Entities list is currently unsorted (and therefore needs to be sorted).
         bool m_Unsorted = false;
 
         Scene* m_Scene = nullptr;
 
         friend Scene; // The scene needs to be able to set m_Scene
+
+        static bool CompareDepth(const EntityT* lhs, const EntityT* rhs);
+
+        /// @brief Gives a slot to the given @p entity, which is only marked as added to the list if not @p pending.
+        void AllocateSlot(EntityT* entity, bool pending);
+
+        /// @brief Marks the pending slot of the given @p entity as added to the list.
+        void ActivateSlot(EntityT* entity);
+
+        void FreeSlot(EntityT* entity);
     };
 
     CHECK_REQUIREMENT(Requirements::MountainEnumerableWrapper, EntityList<Entity>);
@@ -67,40 +113,67 @@ namespace Mountain
     {
         if (!m_ToAdd.IsEmpty())
         {
+            const usize oldSize = m_Entities.GetSize();
+
+            // Only keep the entities that are actually added in m_ToAdd, so that they are the only ones to be awoken
+            usize addedCount = 0;
             for (EntityT* entity : m_ToAdd)
             {
-                if (m_Entities.Contains(entity))
+                // Entities removed since being added for the next frame, and the ones already in the list, don't have a pending slot
+                const auto it = m_SlotIndices.find(entity);
+                if (it == m_SlotIndices.end() || !m_Slots[it->second].pending)
                     continue;
 
+                ActivateSlot(entity);
                 m_Entities.Add(entity);
+                m_ToAdd[addedCount++] = entity;
 
                 if (m_Scene)
                     entity->Added(*m_Scene);
             }
+            m_ToAdd.Resize(addedCount);
 
-            m_Unsorted = true;
+            // Only the new entities need sorting, they can then be merged with the already sorted ones
+            if (!m_Unsorted)
+            {
+                EntityT** const data = m_Entities.GetData();
+                EntityT** const end = data + m_Entities.GetSize();
+                std::stable_sort(data + oldSize, end, CompareDepth);
+                std::inplace_merge(data, data + oldSize, end, CompareDepth);
+            }
         }
 
         if (!m_ToRemove.IsEmpty())
         {
+            bool removedAny = false;
+
             for (EntityT* entity : m_ToRemove)
             {
-                if (!m_Entities.Contains(entity))
+                if (!Has(entity))
                     continue;
 
-                m_Entities.Remove(entity);
+                FreeSlot(entity);
+                removedAny = true;
 
                 if (m_Scene)
                     entity->Removed(*m_Scene);
             }
 
+            // Drop all the removed entities in a single pass, which keeps the order of the others
+            if (removedAny)
+            {
+                EntityT** const data = m_Entities.GetData();
+                EntityT** const end = std::remove_if(data, data + m_Entities.GetSize(), [this](const EntityT* entity) { return !Has(entity); });
+                m_Entities.Resize(static_cast<usize>(end - data));
+            }
+
             m_ToRemove.Clear();
         }
 
         if (m_Unsorted)
         {
             m_Unsorted = false;
-            m_Entities.Sort([](const EntityT* lhs, const EntityT* rhs) { return lhs->GetDepth() > rhs->GetDepth(); });
+            m_Entities.Sort(CompareDepth);
         }
 
         if (m_ToAdd.IsEmpty())
@@ -113,13 +186,32 @@ namespace Mountain
     template <Concepts::Entity EntityT>
     void EntityList<EntityT>::AddNow(EntityT* entity)
     {
-        m_Entities.Add(entity);
-        m_Unsorted = true;
+        // An Entity added for the next frame already has a pending slot, it is then skipped in UpdateLists()
+        const auto it = m_SlotIndices.find(entity);
+        if (it == m_SlotIndices.end())
+            AllocateSlot(entity, false);
+        else if (m_Slots[it->second].pending)
+            ActivateSlot(entity);
+        else
+            return;
+
+        // Insert after the entities of the same depth to keep the list sorted
+        EntityT** const data = m_Entities.GetData();
+        EntityT** const position = std::upper_bound(data, data + m_Entities.GetSize(), entity, CompareDepth);
+        m_Entities.Insert(static_cast<usize>(position - data), entity);
+
+        if (m_Scene)
+            entity->Added(*m_Scene);
     }
 
     template <Concepts::Entity EntityT>
     void EntityList<EntityT>::AddNextFrame(EntityT* entity)
     {
+        // Entities already in the list or already added for the next frame have a slot
+        if (m_SlotIndices.contains(entity))
+            return;
+
+        AllocateSlot(entity, true);
         m_ToAdd.Add(entity);
     }
 
@@ -127,26 +219,46 @@ namespace Mountain
     template <Concepts::Enumerable EnumerableT>
     void EntityList<EntityT>::AddRangeNow(const EnumerableT& enumerable)
     {
-        m_Entities.AddRange(enumerable);
+        for (EntityT* entity : enumerable)
+            AddNow(entity);
     }
 
     template <Concepts::Entity EntityT>
     template <Concepts::Enumerable EnumerableT>
     void EntityList<EntityT>::AddRangeNextFrame(const EnumerableT& enumerable)
     {
-        m_ToAdd.AddRange(enumerable);
+        for (EntityT* entity : enumerable)
+            AddNextFrame(entity);
     }
 
     template <Concepts::Entity EntityT>
     void EntityList<EntityT>::RemoveNow(EntityT* entity)
     {
+        if (!Has(entity))
+            return;
+
+        FreeSlot(entity);
         m_Entities.Remove(entity);
+
+        if (m_Scene)
+            entity->Removed(*m_Scene);
     }
 
     template <Concepts::Entity EntityT>
     void EntityList<EntityT>::RemoveNextFrame(EntityT* entity)
     {
-        m_ToAdd.Remove(entity);
+        const auto it = m_SlotIndices.find(entity);
+        if (it == m_SlotIndices.end())
+            return;
+
+        // Cancel the addition of an Entity added for the next frame, it is then skipped in UpdateLists() as it doesn't have
+        // a pending slot anymore
+        if (m_Slots[it->second].pending)
+        {
+            FreeSlot(entity);
+            return;
+        }
+
         m_ToRemove.Add(entity);
     }
 
@@ -159,6 +271,93 @@ namespace Mountain
     template <Concepts::Entity EntityT>
     void EntityList<EntityT>::Clear()
     {
+        for (EntityT* entity : m_Entities)
+            FreeSlot(entity);
+
         m_Entities.Clear();
     }
+
+    template <Concepts::Entity EntityT>
+    bool EntityList<EntityT>::Has(const EntityT* entity) const
+    {
+        const auto it = m_SlotIndices.find(entity);
+        return it != m_SlotIndices.end() && !m_Slots[it->second].pending;
+    }
+
+    template <Concepts::Entity EntityT>
+    EntityT* EntityList<EntityT>::Get(const EntityHandle handle) const
+    {
+        if (handle.index >= m_Slots.GetSize())
+            return nullptr;
+
+        const Slot& slot = m_Slots[handle.index];
+        return slot.generation == handle.generation && !slot.pending ? slot.entity : nullptr;
+    }
+
+    template <Concepts::Entity EntityT>
+    EntityHandle EntityList<EntityT>::GetHandle(const EntityT* entity) const
+    {
+        const auto it = m_SlotIndices.find(entity);
+        if (it == m_SlotIndices.end() || m_Slots[it->second].pending)
+            return {};
+
+        return { .index = it->second, .generation = m_Slots[it->second].generation };
+    }
+
+    template <Concepts::Entity EntityT>
+    bool EntityList<EntityT>::CompareDepth(const EntityT* lhs, const EntityT* rhs)
+    {
+        return lhs->GetDepth() > rhs->GetDepth();
+    }
+
+    template <Concepts::Entity EntityT>
+    void EntityList<EntityT>::AllocateSlot(EntityT* entity, const bool pending)
+    {
+        u32 index;
+        if (m_FreeSlots.IsEmpty())
+        {
+            index = static_cast<u32>(m_Slots.GetSize());
+            m_Slots.Emplace();
+        }
+        else
+        {
+            index = m_FreeSlots.Last();
+            m_FreeSlots.RemoveLast();
+        }
+
+        Slot& slot = m_Slots[index];
+        slot.entity = entity;
+        slot.pending = true;
+        m_SlotIndices.emplace(entity, index);
+
+        if (!pending)
+            ActivateSlot(entity);
+    }
+
+    template <Concepts::Entity EntityT>
+    void EntityList<EntityT>::ActivateSlot(EntityT* entity)
+    {
+        const u32 index = m_SlotIndices.at(entity);
+        m_Slots[index].pending = false;
+
+        if (m_Scene)
+            entity->m_Handle = { .index = index, .generation = m_Slots[index].generation };
+    }
+
+    template <Concepts::Entity EntityT>
+    void EntityList<EntityT>::FreeSlot(EntityT* entity)
+    {
+        const auto it = m_SlotIndices.find(entity);
+        const u32 index = it->second;
+        m_SlotIndices.erase(it);
+
+        Slot& slot = m_Slots[index];
+        slot.entity = nullptr;
+        slot.pending = false;
+        slot.generation++;
+        m_FreeSlots.Add(index);
+
+        if (m_Scene)
+            entity->m_Handle = {};
+    }
 }
@@ -3,9 +3,16 @@
 #include "Mountain/Ecs/Scene.hpp"
 
 #include "Mountain/Ecs/Entity.hpp"
+#include "Mountain/Utils/JobSystem.hpp"
 
 using namespace Mountain;
 
+Scene::Scene()
+{
+    m_Entities.m_Scene = this;
+    m_CommandBuffers.Resize(JobSystem::GetWorkerCount() + 1);
+}
+
 void Scene::Begin()
 {
     ZoneScoped;
@@ -18,16 +25,60 @@ void Scene::BeforeUpdate()
 {
     ZoneScoped;
 
+    List<Action<>> nextFrame;
+
+    // Any thread, including job workers running jobs unrelated to this Scene, may record commands at any time
+    std::unique_lock buffersLock(m_CommandBuffersMutex);
+
+    for (CommandBuffer& buffer : m_CommandBuffers)
+    {
+        for (Entity* entity : buffer.toAdd)
+            m_Entities.AddNextFrame(entity);
+        for (Entity* entity : buffer.toRemove)
+            m_Entities.RemoveNextFrame(entity);
+        for (Action<>& function : buffer.nextFrame)
+            nextFrame.Add(std::move(function));
+
+        buffer.toAdd.Clear();
+        buffer.toRemove.Clear();
+        buffer.nextFrame.Clear();
+    }
+
+    // The job system may have been started after this Scene was created
+    m_CommandBuffers.Resize(JobSystem::GetWorkerCount() + 1);
+
+    buffersLock.unlock();
+
     m_Entities.UpdateLists();
     const auto onNextFrameCopy = onNextFrame;
     onNextFrame.Clear();
     onNextFrameCopy();
+
+    for (const Action<>& function : nextFrame)
+        function();
 }
 
 void Scene::Update()
 {
     ZoneScoped;
 
+    if (parallelUpdate)
+    {
+        ZoneScopedN("Parallel update");
+
+        Entity* const* entities = m_Entities.GetList().GetData();
+        JobSystem::ParallelFor(
+            0,
+            m_Entities.GetList().GetSize(),
+            parallelUpdateGrain,
+            [entities](const usize begin, const usize end)
+            {
+                for (usize i = begin; i < end; i++)
+                    entities[i]->ParallelUpdate();
+            }
+        );
+    }
+
     for (Entity* entity : m_Entities)
         entity->Update();
 }
@@ -36,6 +87,8 @@ void Scene::AfterUpdate()
 {
     ZoneScoped;
 
+    UpdateBroadphase();
+
     const auto onEndOfCurrentFrameCopy = onEndOfCurrentFrame;
     onEndOfCurrentFrame.Clear();
     onEndOfCurrentFrameCopy();
@@ -80,3 +133,35 @@ void Scene::End()
     for (Entity* entity : m_Entities)
         entity->SceneEnd();
 }
+
+void Scene::UpdateBroadphase()
+{
+    m_Broadphase.Synchronize(m_Entities.GetList());
+}
+
+void Scene::AddNextFrame(Entity* entity) { RecordCommand([entity](CommandBuffer& buffer) { buffer.toAdd.Add(entity); }); }
+
+void Scene::RemoveNextFrame(Entity* entity) { RecordCommand([entity](CommandBuffer& buffer) { buffer.toRemove.Add(entity); }); }
+
+void Scene::CallNextFrame(Action<> function)
+{
+    RecordCommand([&function](CommandBuffer& buffer) { buffer.nextFrame.Add(std::move(function)); });
+}
+
+void Scene::RecordCommand(const Action<CommandBuffer&>& record)
+{
+    std::shared_lock buffersLock(m_CommandBuffersMutex);
+
+    const u32 index = JobSystem::GetThreadIndex();
+
+    // Workers started after the last BeforeUpdate don't have a buffer yet, so they share the first one
+    if (index == 0 || index >= m_CommandBuffers.GetSize())
+    {
+        std::scoped_lock lock(m_SharedCommandBufferMutex);
+        record(m_CommandBuffers[0]);
+        return;
+    }
+
+    // Each job worker has its own buffer, which only it writes to while BeforeUpdate() can't read it
+    record(m_CommandBuffers[index]);
+}
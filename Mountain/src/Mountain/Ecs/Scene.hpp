@@ -1,6 +1,13 @@
 ﻿#pragma once
 
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+
 #include "Mountain/Core.hpp"
+#include "Mountain/Collision/SpatialHash.hpp"
+#include "Mountain/Containers/FunctionTypes.hpp"
+#include "Mountain/Ecs/Entity.hpp"
 #include "Mountain/Ecs/EntityList.hpp"
 #include "Mountain/Utils/Event.hpp"
 
@@ -19,13 +26,23 @@ namespace Mountain
         /// @details This event is invoked in @c AfterUpdate() and cleared afterward.
         Event<> onEndOfCurrentFrame;
 
-        Scene() = default;
-        DEFAULT_COPY_MOVE_OPERATIONS(Scene)
+        /// @brief Whether @c Update() first calls @c Entity::ParallelUpdate() on all the entities using the JobSystem.
+        bool parallelUpdate = false;
+
+        /// @brief The maximum number of entities updated by a single job during the parallel update.
+        u32 parallelUpdateGrain = 64;
+
+        MOUNTAIN_API Scene();
+        // The entities and the entity list point back to their Scene, so it can't be copied nor moved
+        DELETE_COPY_MOVE_OPERATIONS(Scene)
         DEFAULT_VIRTUAL_DESTRUCTOR(Scene)
 
         MOUNTAIN_API virtual void Begin();
 
         MOUNTAIN_API virtual void BeforeUpdate();
+        /// @brief Updates all the entities.
+        /// @details If @c parallelUpdate is enabled, @c Entity::ParallelUpdate() is first called on all the entities in
+        /// parallel, then @c Entity::Update() is called on each of them in order on the calling thread.
         MOUNTAIN_API virtual void Update();
         MOUNTAIN_API virtual void AfterUpdate();
 
@@ -39,9 +56,101 @@ namespace Mountain
 
         MOUNTAIN_API virtual void End();
 
+        /// @brief Updates the broadphase with the current position and collider of each Entity.
+        /// @details Entities are inserted in and removed from the broadphase when they are added to and removed from this
+        /// Scene, so this only needs to pick up their moves. This is called in @c AfterUpdate(), but can also be called after
+        /// moving many entities to get up-to-date query results in the middle of a frame. Use @c SpatialHash::Update() for a
+        /// single Entity.
+        MOUNTAIN_API void UpdateBroadphase();
+
+        /// @brief Adds an Entity to this Scene at the beginning of the next frame.
+        /// @details This can be called from any thread, including from @c Entity::ParallelUpdate(), each job worker
+        /// recording its changes separately until they are applied in @c BeforeUpdate().
+        MOUNTAIN_API void AddNextFrame(Entity* entity);
+
+        /// @brief Removes an Entity from this Scene at the beginning of the next frame.
+        /// @details This can be called from any thread, including from @c Entity::ParallelUpdate(), each job worker
+        /// recording its changes separately until they are applied in @c BeforeUpdate().
+        MOUNTAIN_API void RemoveNextFrame(Entity* entity);
+
+        /// @brief Calls @p function at the beginning of the next frame, after @c onNextFrame.
+        /// @details Unlike @c onNextFrame, this can be called from any thread, including from @c Entity::ParallelUpdate().
+        MOUNTAIN_API void CallNextFrame(Action<> function);
+
+        /// @brief Calls @p function for each Entity of this Scene that has components of all the given types.
+        /// @details The components of type @p T or of a type derived from it are found with @c ComponentRegistry::ForEach(),
+        /// which also visits the ones allocated with @c new, the other components being fetched using
+        /// @c Entity::GetComponent(). Put the rarest component type first to visit as few components as possible.
+        /// Structural changes made by @p function should go through @c AddNextFrame(), @c RemoveNextFrame() and
+        /// @c CallNextFrame(). Components of type @p T created during the iteration may or may not be visited, and the
+        /// destroyed ones are skipped, see @c ComponentPool::ForEach().
+        /// @code
+        /// scene.ForEach<Sprite, AudioSource>([](Sprite& sprite, AudioSource& source) { ... });
+        /// @endcode
+        template <Concepts::Component T, Concepts::Component... Ts, typename FunctionT>
+        void ForEach(FunctionT&& function);
+
         GETTER_NON_CONST(EntityList<Entity>&, Entities, m_Entities)
 
+        /// @brief Returns the broadphase containing all the entities of this Scene that have a collider.
+        GETTER_NON_CONST(SpatialHash&, Broadphase, m_Broadphase)
+
     protected:
         EntityList<Entity> m_Entities;
+
+        SpatialHash m_Broadphase;
+
+    private:
+        /// @brief The structural changes recorded by a single thread during the frame.
+        struct CommandBuffer
+        {
+            List<Entity*> toAdd;
+            List<Entity*> toRemove;
+            List<Action<>> nextFrame;
+        };
+
+        /// @brief The command buffer of each thread, indexed by @c JobSystem::GetThreadIndex().
+        /// @details The first one is shared by all the threads that aren't job workers, e.g. the main thread, the resource
+        /// loading threads or the audio streaming thread, so it is guarded by @c m_SharedCommandBufferMutex. The others are
+        /// only written to by their worker.
+        List<CommandBuffer> m_CommandBuffers;
+        std::mutex m_SharedCommandBufferMutex;
+        /// @brief Held in shared mode while recording a command, and exclusively by @c BeforeUpdate() while it applies and
+        /// resizes the command buffers, so that workers never record in a buffer that is being read or reallocated.
+        std::shared_mutex m_CommandBuffersMutex;
+
+        /// @brief Calls @p record with the command buffer of the calling thread.
+        void RecordCommand(const Action<CommandBuffer&>& record);
     };
 }
+
+// Start of Scene.inl
+
+namespace Mountain
+{
+    template <Concepts::Component T, Concepts::Component... Ts, typename FunctionT>
+    void Scene::ForEach(FunctionT&& function)
+    {
+        ComponentRegistry::ForEach<T>(
+            [&](T& component)
+            {
+                const Entity* entity = component.GetEntity();
+                if (!entity || entity->GetScene() != this)
+                    return;
+
+                if constexpr (sizeof...(Ts) == 0)
+                {
+                    function(component);
+                }
+                else
+                {
+                    const std::tuple<Ts*...> others{entity->GetComponent<Ts>()...};
+                    if (!std::apply([](const auto*... pointers) { return ((pointers != nullptr) && ...); }, others))
+                        return;
+
+                    std::apply([&](Ts*... pointers) { function(component, *pointers...); }, others);
+                }
+            }
+        );
+    }
+}
@@ -0,0 +1,277 @@
+#include "Mountain/FileSystem/Archive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "Mountain/FileSystem/File.hpp"
+#include "Mountain/Platform/Platform.hpp"
+#include "Mountain/Utils/Compression.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+static_assert(sizeof(Archive::Header) == 32, "The archive header layout must not change");
+static_assert(sizeof(Archive::IndexEntry) == 48, "The archive index layout must not change");
+
+namespace
+{
+    u64 WritePadding(std::ofstream& output, const u64 offset)
+    {
+        static constexpr Array<c8, Archive::DataAlignment> Zeros{};
+
+        const u64 alignedOffset = (offset + Archive::DataAlignment - 1) / Archive::DataAlignment * Archive::DataAlignment;
+        output.write(Zeros.data, static_cast<std::streamsize>(alignedOffset - offset));
+        return alignedOffset;
+    }
+}
+
+bool Archive::Write(const std::filesystem::path& path, const List<SourceEntry>& entries, const bool compress)
+{
+    Logger::LogInfo("Writing archive {} with {} entries", path, entries.GetSize());
+
+    std::ofstream output(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!output.is_open())
+    {
+        Logger::LogError("Couldn't open file for writing: {}", path);
+        return false;
+    }
+
+    // Write a placeholder header, the actual one is written once the offsets are known
+    Header header{};
+    output.write(reinterpret_cast<const c8*>(&header), sizeof(header));
+    u64 offset = WritePadding(output, sizeof(header));
+
+    List<IndexEntry> index;
+    index.Reserve(entries.GetSize());
+    std::string paths;
+
+    List<u8> data;
+    List<u8> compressedData;
+
+    for (const SourceEntry& entry : entries)
+    {
+        std::ifstream input(entry.sourcePath, std::ios::in | std::ios::ate | std::ios::binary);
+
+        if (!input.is_open())
+        {
+            Logger::LogError("Couldn't open file for reading: {}", entry.sourcePath);
+            return false;
+        }
+
+        data.Resize(static_cast<usize>(input.tellg()));
+        input.seekg(0);
+        input.read(reinterpret_cast<c8*>(data.GetData()), static_cast<std::streamsize>(data.GetSize()));
+
+        IndexEntry indexEntry{
+            .pathHash = HashPath(entry.path),
+            .offset = offset,
+            .size = data.GetSize(),
+            .compressedSize = data.GetSize(),
+            .pathOffset = static_cast<u32>(paths.size()),
+            .pathLength = static_cast<u32>(entry.path.size()),
+            .compression = CompressionMethod::None,
+            .padding = {}
+        };
+        paths += entry.path;
+
+        const u8* storedData = data.GetData();
+
+        if (compress && !data.IsEmpty())
+        {
+            compressedData.Resize(Compression::Lz4CompressBound(data.GetSize()));
+            const usize compressedSize = Compression::Lz4Compress(data.GetData(), data.GetSize(), compressedData.GetData(), compressedData.GetSize());
+
+            // Keep incompressible files, e.g. already compressed images or audio, as they are to avoid decompressing them for nothing
+            if (compressedSize != 0 && compressedSize < data.GetSize())
+            {
+                indexEntry.compression = CompressionMethod::Lz4;
+                indexEntry.compressedSize = compressedSize;
+                storedData = compressedData.GetData();
+            }
+        }
+
+        output.write(reinterpret_cast<const c8*>(storedData), static_cast<std::streamsize>(indexEntry.compressedSize));
+        offset = WritePadding(output, offset + indexEntry.compressedSize);
+
+        index.Add(indexEntry);
+    }
+
+    index.Sort([](const IndexEntry& lhs, const IndexEntry& rhs) { return lhs.pathHash < rhs.pathHash; });
+
+    for (usize i = 1; i < index.GetSize(); i++)
+    {
+        const IndexEntry& previous = index[i - 1];
+        const IndexEntry& current = index[i];
+
+        if (previous.pathHash == current.pathHash &&
+            std::string_view{paths}.substr(previous.pathOffset, previous.pathLength) == std::string_view{paths}.substr(current.pathOffset, current.pathLength))
+        {
+            Logger::LogError("Duplicate archive entry {}", std::string_view{paths}.substr(current.pathOffset, current.pathLength));
+            return false;
+        }
+    }
+
+    header = {
+        .magic = Magic,
+        .version = Version,
+        .entryCount = static_cast<u32>(index.GetSize()),
+        .reserved = 0,
+        .indexOffset = offset,
+        .pathsOffset = offset + index.GetSize() * sizeof(IndexEntry)
+    };
+
+    output.write(reinterpret_cast<const c8*>(index.GetData()), static_cast<std::streamsize>(index.GetSize() * sizeof(IndexEntry)));
+    output.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+
+    output.seekp(0);
+    output.write(reinterpret_cast<const c8*>(&header), sizeof(header));
+
+    if (!output.good())
+    {
+        Logger::LogError("An error occured while writing archive {}", path);
+        return false;
+    }
+
+    return true;
+}
+
+u64 Archive::HashPath(const std::string_view path)
+{
+    // 64-bit FNV-1a
+    u64 hash = 0xCBF29CE484222325;
+    for (const c8 c : path)
+    {
+        hash ^= static_cast<u8>(c);
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+Archive::~Archive() { Close(); }
+
+bool Archive::Open(const std::filesystem::path& path)
+{
+    Close();
+
+    Logger::LogVerbose("Opening archive {}", path);
+
+    s64 size = 0;
+    void* data = Platform::MapFile(path, &size);
+
+    if (!data)
+    {
+        Logger::LogError("Couldn't open archive {}", path);
+        return false;
+    }
+
+    m_Path = path;
+    m_Data = std::shared_ptr<s8>(static_cast<s8*>(data), [size](s8* mapped) { Platform::UnmapFile(mapped, size); });
+    m_Size = size;
+
+    if (!Validate())
+    {
+        Logger::LogError("Invalid archive {}", path);
+        Close();
+        return false;
+    }
+
+    const Header& header = *reinterpret_cast<const Header*>(m_Data.get());
+    m_Index = { reinterpret_cast<const IndexEntry*>(m_Data.get() + header.indexOffset), header.entryCount };
+    m_Paths = reinterpret_cast<const c8*>(m_Data.get() + header.pathsOffset);
+    m_PathsSize = static_cast<u64>(m_Size) - header.pathsOffset;
+
+    return true;
+}
+
+void Archive::Close()
+{
+    m_Path.clear();
+    m_Data.reset();
+    m_Size = 0;
+    m_Index = {};
+    m_Paths = nullptr;
+    m_PathsSize = 0;
+}
+
+bool Archive::IsOpen() const { return m_Data != nullptr; }
+
+std::span<const Archive::IndexEntry> Archive::GetEntries() const { return m_Index; }
+
+const Archive::IndexEntry* Archive::Find(const std::string_view path) const
+{
+    const u64 hash = HashPath(path);
+
+    // Different paths can have the same hash, so check all the entries with the same hash
+    for (auto it = std::ranges::lower_bound(m_Index, hash, {}, &IndexEntry::pathHash); it != m_Index.end() && it->pathHash == hash; ++it)
+    {
+        if (GetEntryPath(*it) == path)
+            return &*it;
+    }
+
+    return nullptr;
+}
+
+std::string_view Archive::GetEntryPath(const IndexEntry& entry) const { return { m_Paths + entry.pathOffset, entry.pathLength }; }
+
+bool Archive::Load(const IndexEntry& entry, File& file) const
+{
+    if (entry.compression == CompressionMethod::None)
+    {
+        // Share the ownership of the archive memory so that the file data stays valid even if the archive is closed
+        file.SetStorage(std::shared_ptr<s8>(m_Data, m_Data.get() + entry.offset), static_cast<s64>(entry.size), File::StorageMode::Mapped);
+        return true;
+    }
+
+    std::shared_ptr<s8> storage{new s8[entry.size], std::default_delete<s8[]>()};
+
+    if (!Compression::Lz4Decompress(
+        reinterpret_cast<const u8*>(m_Data.get() + entry.offset),
+        entry.compressedSize,
+        reinterpret_cast<u8*>(storage.get()),
+        entry.size
+    ))
+    {
+        Logger::LogError("Corrupted entry {} in archive {}", GetEntryPath(entry), m_Path);
+        return false;
+    }
+
+    file.SetStorage(std::move(storage), static_cast<s64>(entry.size), File::StorageMode::Owned);
+    return true;
+}
+
+bool Archive::Validate() const
+{
+    if (static_cast<u64>(m_Size) < sizeof(Header))
+        return false;
+
+    const Header& header = *reinterpret_cast<const Header*>(m_Data.get());
+
+    if (std::memcmp(header.magic.data, Magic.data, sizeof(Magic)) != 0 || header.version != Version)
+        return false;
+
+    const u64 size = static_cast<u64>(m_Size);
+    if (header.indexOffset % alignof(IndexEntry) != 0 ||
+        header.indexOffset > size ||
+        header.pathsOffset != header.indexOffset + header.entryCount * sizeof(IndexEntry) ||
+        header.pathsOffset > size)
+        return false;
+
+    const IndexEntry* const index = reinterpret_cast<const IndexEntry*>(m_Data.get() + header.indexOffset);
+    const u64 pathsSize = size - header.pathsOffset;
+
+    for (u32 i = 0; i < header.entryCount; i++)
+    {
+        const IndexEntry& entry = index[i];
+
+        if (entry.offset > header.indexOffset ||
+            entry.compressedSize > header.indexOffset - entry.offset ||
+            static_cast<u64>(entry.pathOffset) + entry.pathLength > pathsSize ||
+            (entry.compression == CompressionMethod::None && entry.compressedSize != entry.size) ||
+            entry.compression > CompressionMethod::Lz4)
+            return false;
+    }
+
+    return true;
+}
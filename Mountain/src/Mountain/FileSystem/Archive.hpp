@@ -0,0 +1,140 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+#include "Mountain/Containers/List.hpp"
+
+/// @file Archive.hpp
+/// @brief Defines the Mountain::Archive class.
+
+namespace Mountain
+{
+    class File;
+
+    /// @brief Read-only packed archive containing many files in a single file on the disk.
+    ///
+    /// The archive is laid out as follows, all values being little-endian:
+    /// - A @c Header
+    /// - The data of each entry, aligned to @c DataAlignment bytes and optionally compressed using LZ4
+    /// - The index, an array of @c IndexEntry sorted by path hash
+    /// - The paths of all entries, stored one after the other without null terminators
+    ///
+    /// An archive is memory-mapped when opened, so uncompressed entries are never copied.
+    /// Archives are usually created with the packer tool and used through @c FileManager::MountArchive().
+    class Archive
+    {
+    public:
+        /// @brief How the data of an entry is stored.
+        enum class CompressionMethod : u8
+        {
+            None,
+            Lz4
+        };
+
+        struct Header
+        {
+            Array<c8, 4> magic;
+            u32 version;
+            u32 entryCount;
+            u32 reserved;
+            u64 indexOffset;
+            u64 pathsOffset;
+        };
+
+        struct IndexEntry
+        {
+            u64 pathHash;
+            u64 offset;
+            u64 size;
+            u64 compressedSize;
+            u32 pathOffset;
+            u32 pathLength;
+            CompressionMethod compression;
+            Array<u8, 7> padding;
+        };
+
+        /// @brief A file to write in an archive.
+        struct SourceEntry
+        {
+            /// @brief The path of the entry in the archive.
+            std::string path;
+            /// @brief The path of the file on the disk.
+            std::filesystem::path sourcePath;
+        };
+
+        static constexpr Array<c8, 4> Magic{ 'M', 'P', 'A', 'K' };
+        static constexpr u32 Version = 1;
+        static constexpr u64 DataAlignment = 16;
+        static constexpr std::string_view FileExtension = ".mpak";
+
+        /// @brief Writes an archive containing the given @p entries.
+        /// @param path Where to write the archive.
+        /// @param entries The files to pack.
+        /// @param compress Whether to compress the entries. Entries that don't get smaller once compressed are always stored uncompressed.
+        /// @return Whether the archive was successfully written.
+        MOUNTAIN_API static bool Write(const std::filesystem::path& path, const List<SourceEntry>& entries, bool compress = true);
+
+        /// @brief Computes the hash of an entry path, as stored in the index.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static u64 HashPath(std::string_view path);
+
+        Archive() = default;
+
+        MOUNTAIN_API ~Archive();
+
+        DELETE_COPY_MOVE_OPERATIONS(Archive)
+
+        /// @brief Opens the archive at the given @p path.
+        /// @return Whether the archive was successfully opened and is valid.
+        MOUNTAIN_API bool Open(const std::filesystem::path& path);
+
+        /// @brief Closes the archive.
+        /// @details Files previously loaded from uncompressed entries keep the archive memory alive until they are unloaded.
+        MOUNTAIN_API void Close();
+
+        /// @brief Returns whether the archive is opened.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsOpen() const;
+
+        /// @brief Returns the path of the archive on the disk.
+        GETTER(const std::filesystem::path&, Path, m_Path)
+
+        /// @brief Returns all the entries of the archive, sorted by path hash.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API std::span<const IndexEntry> GetEntries() const;
+
+        /// @brief Finds the entry with the given @p path using a binary search on the index.
+        /// @return The entry, or @c nullptr if there isn't any entry with this @p path.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API const IndexEntry* Find(std::string_view path) const;
+
+        /// @brief Returns the path of the given @p entry.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API std::string_view GetEntryPath(const IndexEntry& entry) const;
+
+        /// @brief Loads the data of the given @p entry in the given @p file.
+        /// @details Uncompressed entries are referenced directly in the archive memory while compressed ones are decompressed
+        /// in a buffer owned by the @p file.
+        /// @return Whether the entry was successfully loaded.
+        MOUNTAIN_API bool Load(const IndexEntry& entry, File& file) const;
+
+    private:
+        std::filesystem::path m_Path;
+
+        /// Owns the archive memory and is shared with the Files loaded from uncompressed entries
+        std::shared_ptr<s8> m_Data;
+        s64 m_Size = 0;
+
+        std::span<const IndexEntry> m_Index;
+        const c8* m_Paths = nullptr;
+        u64 m_PathsSize = 0;
+
+        bool Validate() const;
+    };
+}
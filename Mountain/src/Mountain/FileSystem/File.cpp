@@ -6,6 +6,7 @@
 #include <ranges>
 
 #include "Mountain/FileSystem/FileManager.hpp"
+#include "Mountain/Platform/Platform.hpp"
 #include "Mountain/Resource/AudioTrack.hpp"
 #include "Mountain/Resource/Font.hpp"
 #include "Mountain/Resource/Resource.hpp"
@@ -30,6 +31,37 @@ File::~File()
 
 bool File::Load()
 {
+    if (m_Archive)
+    {
+        const Archive::IndexEntry* entry = m_Archive->Find(m_ArchiveEntryPath);
+        if (!entry)
+        {
+            Logger::LogError("Couldn't find entry {} in archive {}", m_ArchiveEntryPath, m_Archive->GetPath());
+            return false;
+        }
+
+        return m_Archive->Load(*entry, *this);
+    }
+
+    std::error_code error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(m_Path, error);
+
+    if (!error && memoryMappingThreshold >= 0 && static_cast<s64>(fileSize) >= memoryMappingThreshold)
+    {
+        s64 mappedSize = 0;
+        if (void* mapped = Platform::MapFile(m_Path, &mappedSize))
+        {
+            SetStorage(
+                std::shared_ptr<s8>(static_cast<s8*>(mapped), [mappedSize](s8* data) { Platform::UnmapFile(data, mappedSize); }),
+                mappedSize,
+                StorageMode::Mapped
+            );
+            return true;
+        }
+
+        Logger::LogWarning("Couldn't memory-map file {}, reading it instead", m_Path);
+    }
+
     std::ifstream file(m_Path, std::ios::in | std::ios::ate | std::ios::binary);
 
     if (!file.is_open() || !file.good())
@@ -38,35 +70,51 @@ bool File::Load()
         return false;
     }
 
-    m_Size = file.tellg();
+    const s64 size = file.tellg();
     file.seekg(0);
 
-    m_Data = new s8[m_Size];
+    std::shared_ptr<s8> storage{new s8[size], std::default_delete<s8[]>()};
 
-    file.read(reinterpret_cast<c8*>(m_Data), m_Size);
+    file.read(reinterpret_cast<c8*>(storage.get()), size);
 
-    m_Loaded = true;
+    SetStorage(std::move(storage), size, StorageMode::Owned);
     return true;
 }
 
 void File::Load(const c8* data, const usize size)
 {
-    m_Size = static_cast<s64>(size);
-    m_Data = new s8[m_Size];
-    std::memcpy(m_Data, data, m_Size);
+    const s64 signedSize = static_cast<s64>(size);
 
-    m_Loaded = true;
+    std::shared_ptr<s8> storage{new s8[signedSize], std::default_delete<s8[]>()};
+    std::memcpy(storage.get(), data, size);
+
+    SetStorage(std::move(storage), signedSize, StorageMode::Owned);
+}
+
+void File::LoadBorrowed(const c8* data, const usize size)
+{
+    // The data isn't owned, so the deleter doesn't do anything. It is only cast to non-const to be stored alongside the other
+    // storage modes, and CopyBorrowedData() makes sure it is never written to
+    SetStorage(
+        std::shared_ptr<s8>(reinterpret_cast<s8*>(const_cast<c8*>(data)), [](s8*) {}),
+        static_cast<s64>(size),
+        StorageMode::Borrowed
+    );
 }
 
 void File::Unload()
 {
-    delete[] m_Data;
+    // Handles returned by GetDataHandle() keep the data alive if they still exist
+    m_Storage.reset();
     m_Data = nullptr;
     m_Size = 0;
+    m_StorageMode = StorageMode::None;
 
     m_Loaded = false;
 }
 
+std::shared_ptr<s8> File::GetDataHandle() const { return m_Storage; }
+
 void File::OpenInExplorer() const
 {
     Utils::OpenInExplorer(m_Path, true);
@@ -101,6 +149,24 @@ void File::SetName(const std::string& newName)
     m_Resource->SetName(GetPathString());
 }
 
+void File::SetStorage(std::shared_ptr<s8> storage, const s64 size, const StorageMode mode)
+{
+    m_Storage = std::move(storage);
+    m_Data = m_Storage.get();
+    m_Size = size;
+    m_StorageMode = mode;
+
+    m_Loaded = true;
+}
+
+void File::CopyBorrowedData()
+{
+    std::shared_ptr<s8> storage{new s8[m_Size], std::default_delete<s8[]>()};
+    std::memcpy(storage.get(), m_Data, static_cast<usize>(m_Size));
+
+    SetStorage(std::move(storage), m_Size, StorageMode::Owned);
+}
+
 void File::UpdateUtilityValues()
 {
     Entry::UpdateUtilityValues();
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 
 #include "Mountain/Core.hpp"
+#include "Mountain/FileSystem/Archive.hpp"
 #include "Mountain/FileSystem/Entry.hpp"
 #include "Mountain/Resource/Resource.hpp"
 #include "Mountain/Utils/Pointer.hpp"
@@ -34,6 +36,23 @@ namespace Mountain
             Glsl
         };
 
+        /// @brief How the loaded data of a File is stored.
+        enum class StorageMode : u8
+        {
+            /// @brief The File isn't loaded.
+            None,
+            /// @brief The data was copied in a heap buffer owned by the File.
+            Owned,
+            /// @brief The file on the disk was memory-mapped, pages are only read when they are first accessed.
+            Mapped,
+            /// @brief The data is referenced without being copied, e.g. for embedded binary resources.
+            Borrowed
+        };
+
+        /// @brief Minimum size in bytes of the files that @c Load() memory-maps instead of reading into a heap buffer.
+        /// @details Set this to a negative value to never memory-map files.
+        MOUNTAIN_API static inline s64 memoryMappingThreshold = 64 * 1024;
+
         /// @brief Constructs a File corresponding to the given @p path.
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API explicit File(std::filesystem::path&& filepath);
@@ -44,6 +63,8 @@ namespace Mountain
         DEFAULT_COPY_MOVE_OPERATIONS(File)
 
         /// @brief Loads the contents of this File.
+        /// @details Files at least @c memoryMappingThreshold bytes large are memory-mapped instead of being read in a heap buffer.
+        /// Files mounted from an Archive are loaded from it instead.
         ///
         /// @returns @c false if an error occured while loading.
         MOUNTAIN_API bool Load() override;
@@ -52,6 +73,11 @@ namespace Mountain
         /// Note: This doesn't have anything to do with the file system. This only loads the given data in this resource.
         MOUNTAIN_API void Load(const c8* data, usize size);
 
+        /// @brief Loads the given contents in this File without copying them.
+        /// @details Only use this for data that outlives the File, e.g. static arrays. The data is never written to: the
+        /// non-const @c GetData() overload first copies it in a buffer owned by the File.
+        MOUNTAIN_API void LoadBorrowed(const c8* data, usize size);
+
         /// @brief Unloads the contents of this File.
         MOUNTAIN_API void Unload() override;
 
@@ -85,6 +111,8 @@ namespace Mountain
         const T* GetData() const;
 
         /// @brief Returns a pointer to the raw loaded data.
+        /// @details If the data is @ref StorageMode::Borrowed "borrowed", it is first copied in a buffer owned by this File
+        /// so that it can be safely written to. Prefer the @c const overload when only reading the data.
         template <typename T = c8>
         ATTRIBUTE_NODISCARD
         T* GetData();
@@ -92,6 +120,16 @@ namespace Mountain
         /// @brief Returns the size of the loaded data.
         GETTER(s64, Size, m_Size)
 
+        /// @brief Returns how the loaded data is stored.
+        GETTER(StorageMode, StorageMode, m_StorageMode)
+
+        /// @brief Returns a shared handle to the loaded data.
+        /// @details The data pointed to by the handle stays valid as long as the handle is alive, even if this File is unloaded
+        /// or reloaded in the meantime. Use this when keeping a reference to the data after loading a Resource, e.g. to
+        /// stream it.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API std::shared_ptr<s8> GetDataHandle() const;
+
         /// @brief Sets the name of this File.
         MOUNTAIN_API void SetName(const std::string& newName) override;
 
@@ -101,6 +139,9 @@ namespace Mountain
         /// This implies that the return value of this function can be a @c nullptr.
         GETTER(const Pointer<Resource>&, Resource, m_Resource)
 
+        /// @brief Returns the Archive this File was mounted from, or @c nullptr if it comes from the file system.
+        GETTER(const Pointer<Archive>&, Archive, m_Archive)
+
     protected:
         void UpdateUtilityValues() override;
 
@@ -112,14 +153,29 @@ namespace Mountain
 
         s8* m_Data = nullptr;
         s64 m_Size = 0;
+        StorageMode m_StorageMode = StorageMode::None;
+        /// Owns the heap buffer or the memory mapping, and is shared with the handles returned by @c GetDataHandle()
+        std::shared_ptr<s8> m_Storage;
+
+        void SetStorage(std::shared_ptr<s8> storage, s64 size, StorageMode mode);
+
+        /// Copies borrowed data in an owned buffer before it is written to
+        MOUNTAIN_API void CopyBorrowedData();
 
         /// Null if the file isn't linked to a specific resource or if it is a font file, in which case it can be loaded into
         /// fonts of different sizes
         Pointer<Resource> m_Resource;
 
+        Pointer<Archive> m_Archive;
+        std::string m_ArchiveEntryPath;
+
         // We need this in order to set m_Resource from the ResourceManager
         // which is the only class that needs to modify this field
         friend class ResourceManager;
+        // Sets m_Archive when mounting an archive
+        friend class FileManager;
+        // Loads the data of archive entries
+        friend class Archive;
     };
 }
 
@@ -136,6 +192,9 @@ namespace Mountain
     template <typename T>
     T* File::GetData()
     {
+        if (m_StorageMode == StorageMode::Borrowed)
+            CopyBorrowedData();
+
         return reinterpret_cast<T*>(m_Data);
     }
 }
@@ -157,6 +157,74 @@ Pointer<Directory> FileManager::LoadDirectory(std::filesystem::path path)
     return directory;
 }
 
+Pointer<Archive> FileManager::MountArchive(const std::filesystem::path& path, const std::filesystem::path& mountPoint)
+{
+    Logger::LogInfo("Mounting archive {}...", path);
+
+    START_STOPWATCH;
+
+    Pointer<Archive> archive = Pointer<Archive>::New();
+    if (!archive->Open(path))
+        return nullptr;
+
+    m_Archives.Add(archive.CreateStrongReference());
+
+    // Make sure to keep a weak reference
+    archive.ToWeakReference();
+
+    for (const Archive::IndexEntry& entry : archive->GetEntries())
+    {
+        const std::string_view entryPath = archive->GetEntryPath(entry);
+        std::filesystem::path filePath = mountPoint / std::filesystem::path{entryPath};
+
+        if (Contains(filePath))
+        {
+            Logger::LogWarning("The file {} has already been added, skipping it in archive {}", filePath, path);
+            continue;
+        }
+
+        Pointer<File> file = Add(std::move(filePath));
+        if (!file)
+            continue;
+
+        file->m_Archive = archive;
+        file->m_ArchiveEntryPath = entryPath;
+
+        if (!archive->Load(entry, *file))
+            continue;
+
+        // Add the parent directories that don't exist yet and link the new entries to them
+        Pointer<Entry> child = static_cast<Pointer<Entry>>(file);
+        for (std::filesystem::path parentPath = file->GetPath().parent_path(); !parentPath.empty(); parentPath = parentPath.parent_path())
+        {
+            const bool parentExists = Contains(parentPath);
+            Pointer<Directory> parent = parentExists ? Get<Directory>(parentPath) : AddDirectory(parentPath);
+
+            parent->GetChildEntries().Add(child);
+            if (Pointer<File> childFile = Utils::DynamicPointerCast<File>(child))
+                parent->GetChildFiles().Add(childFile);
+            else
+                parent->GetChildDirectories().Add(Utils::DynamicPointerCast<Directory>(child));
+
+            child->SetParent(Pointer{parent});
+
+            if (parentExists)
+                break;
+
+            child = static_cast<Pointer<Entry>>(parent);
+        }
+    }
+
+    Logger::LogVerbose(
+        "Archive {} mounted with {} entries. Took {}ms",
+        path,
+        archive->GetEntries().size(),
+        stopwatch.GetElapsedMilliseconds()
+    );
+
+    return archive;
+}
+
 bool FileManager::Contains(const std::filesystem::path& path)
 {
     return m_Entries.contains(path);
@@ -223,8 +291,9 @@ void FileManager::UnloadAll()
             entry.second->Unload();
     }
 
-    // Smart pointers are deleted automatically, we only need to clear the container
+    // Smart pointers are deleted automatically, we only need to clear the containers
     m_Entries.clear();
+    m_Archives.Clear();
 
     Logger::LogVerbose("FileManager unload successful. Took {}ms", stopwatch.GetElapsedMilliseconds());
 }
@@ -38,6 +38,15 @@ namespace Mountain
         /// @see Directory::Preload
         MOUNTAIN_API static Pointer<Directory> LoadDirectory(std::filesystem::path path);
 
+        /// @brief Mounts the Archive at the given @p path, adding and loading a File for each of its entries.
+        /// @details The entries are never extracted on the disk: uncompressed entries are referenced directly in the memory-mapped
+        /// archive and compressed ones are decompressed in memory. The parent @ref Directory "Directories" of the entries are added
+        /// as well.
+        /// @param path The path of the archive on the disk.
+        /// @param mountPoint The path under which the entries are added, which is the root by default.
+        /// @return The mounted Archive, or @c nullptr if it couldn't be opened.
+        MOUNTAIN_API static Pointer<Archive> MountArchive(const std::filesystem::path& path, const std::filesystem::path& mountPoint = {});
+
         /// @brief Checks whether the FileManager contains the specified Entry path.
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API static bool Contains(const std::filesystem::path& path);
@@ -116,6 +125,7 @@ namespace Mountain
 
     private:
         MOUNTAIN_API static inline std::unordered_map<std::filesystem::path, Pointer<Entry>> m_Entries;
+        MOUNTAIN_API static inline List<Pointer<Archive>> m_Archives;
     };
 }
 
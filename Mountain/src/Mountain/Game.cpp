@@ -7,6 +7,7 @@
 #include "Mountain/Graphics/Renderer.hpp"
 #include "Mountain/Resource/ResourceManager.hpp"
 #include "Mountain/Utils/Coroutine.hpp"
+#include "Mountain/Utils/JobSystem.hpp"
 #include "Mountain/Utils/Logger.hpp"
 #include "Mountain/Utils/MessageBox.hpp"
 
@@ -31,6 +32,8 @@ Game::~Game()
 
 	Coroutine::StopAll();
 
+    JobSystem::Shutdown();
+
     ResourceManager::UnloadAll();
     FileManager::UnloadAll();
 
@@ -84,6 +87,8 @@ bool Game::NextFrame()
     if (!ManualCoroutineUpdates)
         Coroutine::UpdateAll();
 
+    ResourceManager::UpdateAsyncLoads();
+
     Renderer::PreFrame();
 
     if (ManualFreezeFrames || Time::freezeTimer <= 0.f)
@@ -164,6 +169,8 @@ void Game::InitializeInternal(const std::string& windowTitle, const Vector2i win
     Logger::LogInfo("Initializing Mountain Framework");
     Logger::LogVerbose("Working directory: {}", std::filesystem::current_path());
 
+    JobSystem::Initialize();
+
     if (!Renderer::Initialize(windowTitle, windowSize))
         THROW(InvalidOperationException{"Failed to initialize renderer"});
 
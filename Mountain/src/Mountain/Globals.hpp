@@ -38,4 +38,12 @@ namespace Mountain
     /// @brief Whether to disable the default Mountain audio API.
     /// @details This can be used if you want to use another audio API or if you want to manage the audio yourself.
     PUBLIC_GLOBAL(bool, NoBuiltinAudio, false);
+    /// @brief Whether to render the audio in memory instead of playing it on an audio device.
+    /// @details The audio is then only rendered when calling @c Audio::RenderLoopback(), e.g. to test or benchmark it
+    /// without any audio hardware. This requires the ALC_SOFT_loopback extension.
+    PUBLIC_GLOBAL(bool, LoopbackAudio, false);
+    /// @brief The directory in which linked shader programs are cached to avoid compiling them again on the next launch.
+    /// @details Cached programs are only reused with the exact same source code and graphics driver, and are
+    /// recompiled and replaced otherwise, so there is at most one entry per shader. If this is empty, the cache is disabled.
+    PUBLIC_GLOBAL(std::string, ShaderCachePath, "shader_cache");
 }
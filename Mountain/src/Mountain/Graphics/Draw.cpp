@@ -5,9 +5,11 @@
 #include <variant>
 
 #include "Mountain/Containers/EnumerableExt.hpp"
+#include "Mountain/Input/Time.hpp"
 #include "Mountain/Resource/Font.hpp"
 #include "Mountain/Resource/ResourceManager.hpp"
 #include "Mountain/Resource/Shader.hpp"
+#include "Mountain/Resource/TextureAtlas.hpp"
 
 #define SCHEDULE_RENDER_DATA(drawData, immediateRenderFunction, drawDataList, commandType) \
     do \
@@ -41,6 +43,17 @@
 
 using namespace Mountain;
 
+namespace
+{
+    /// Layers are sorted first, then command types, which map to a shader and a vertex array, then textures
+    u64 MakeSortKey(const s16 layer, const u8 type, const u32 textureId)
+    {
+        // Flip the sign bit so that negative layers come first
+        const u64 biasedLayer = static_cast<u16>(layer) ^ 0x8000u;
+        return biasedLayer << 48 | static_cast<u64>(type) << 32 | textureId;
+    }
+}
+
 void Draw::Clear(const Color& color)
 {
     Graphics::SetClearColor(color);
@@ -266,8 +279,8 @@ void Draw::Texture(
         return;
     }
 
-    const Vector2 uvDiff = uv1 - uv0;
-    const Vector2 lowerUv = uv0;
+    Vector2 uvDiff = uv1 - uv0;
+    Vector2 lowerUv = uv0;
 
     const Vector2i textureSize = texture.GetSize();
     Matrix transformation = Matrix::Translation(static_cast<Vector3>(position))
@@ -281,34 +294,56 @@ void Draw::Texture(
             }
         );
 
+    TextureBinding binding{texture.GetId(), false};
+    s32 layer = -1;
+
+    // Draw from the texture atlas if possible, so that textures of the same atlas end up in the same batch.
+    // Atlas regions cannot wrap around, so UVs outside the texture bounds need the texture itself. The format of the texture
+    // can also have changed since it was packed.
+    const TextureAtlas* atlas = texture.GetAtlas();
+    if (atlas && atlas->IsLoaded() && atlas->GetFilter() == texture.GetFilter() && TextureAtlas::IsCompatible(texture)
+        && uv0.x >= 0.f && uv0.x <= 1.f && uv0.y >= 0.f && uv0.y <= 1.f
+        && uv1.x >= 0.f && uv1.x <= 1.f && uv1.y >= 0.f && uv1.y <= 1.f)
+    {
+        const Vector2 atlasUv0 = texture.GetAtlasUv0();
+        const Vector2 atlasUvDiff = texture.GetAtlasUv1() - atlasUv0;
+
+        lowerUv = atlasUv0 + lowerUv * atlasUvDiff;
+        uvDiff *= atlasUvDiff;
+
+        binding = {atlas->GetId(), true};
+        layer = texture.GetAtlasLayer();
+    }
+
     Matrix uvProjection = Matrix::Translation(static_cast<Vector3>(lowerUv)) * Matrix::Scaling(static_cast<Vector3>(uvDiff));
 
     const TextureData data{
         .transformation = transformation,
         .uvProjection = uvProjection,
-        .color = color
+        .color = color,
+        .layer = layer
     };
 
     if (m_Mode == DrawMode::Immediate)
     {
-        RenderTextureData(data, texture.GetId());
+        RenderTextureData(data, binding);
         return;
     }
 
     m_DrawList.texture.Add(data);
 
-    if (!m_DrawList.textureId.IsEmpty() && Last(m_DrawList.textureId) == texture.GetId())
+    if (!m_DrawList.textureBinding.IsEmpty() && Last(m_DrawList.textureBinding).id == binding.id)
     {
         auto& lastCommand = Last(m_DrawList.commands);
-        if (lastCommand.type == DrawDataType::Texture)
+        if (lastCommand.type == DrawDataType::Texture && lastCommand.layer == m_Layer)
         {
             lastCommand.count++;
             return;
         }
     }
 
-    m_DrawList.textureId.Add(texture.GetId());
-    m_DrawList.commands.Emplace(DrawDataType::Texture, 1ull);
+    m_DrawList.textureBinding.Add(binding);
+    m_DrawList.commands.Emplace(DrawDataType::Texture, 1ull, m_Layer);
 }
 
 void Draw::Text(
@@ -319,14 +354,41 @@ void Draw::Text(
     const Color& color
 )
 {
-    const TextData data{
-        .font = &font,
-        .text = text,
-        .position = position,
-        .scale = scale,
-        .color = color
-    };
-    SCHEDULE_RENDER_DATA(data, RenderTextData, text, DrawDataType::Text);
+    if (!font.IsLoaded())
+    {
+        Logger::LogWarning("Trying to draw text with the non-loaded Font {}, ignoring", font.GetName());
+        return;
+    }
+
+    const u32 atlasId = font.GetAtlas().GetId();
+
+    if (m_Mode == DrawMode::Immediate)
+    {
+        List<GlyphData> glyphs;
+        AddTextGlyphs(font, text, position, scale, color, glyphs);
+        RenderTextData(glyphs, atlasId);
+        return;
+    }
+
+    const usize oldGlyphCount = m_DrawList.text.GetSize();
+    AddTextGlyphs(font, text, position, scale, color, m_DrawList.text);
+    const usize glyphCount = m_DrawList.text.GetSize() - oldGlyphCount;
+
+    if (glyphCount == 0)
+        return;
+
+    if (!m_DrawList.textAtlasId.IsEmpty() && Last(m_DrawList.textAtlasId) == atlasId)
+    {
+        auto& lastCommand = Last(m_DrawList.commands);
+        if (lastCommand.type == DrawDataType::Text && lastCommand.layer == m_Layer)
+        {
+            lastCommand.count += glyphCount;
+            return;
+        }
+    }
+
+    m_DrawList.textAtlasId.Add(atlasId);
+    m_DrawList.commands.Emplace(DrawDataType::Text, glyphCount, m_Layer);
 }
 
 void Draw::RenderTarget(
@@ -380,119 +442,336 @@ void Draw::Flush()
 
     TracyGpuZone("Draw::Flush")
 
+    UpdateFrameUniforms();
+
+    m_FlushStatistics = {};
+
+    if (m_Mode == DrawMode::Sorted)
+    {
+        SortDrawList();
+        RenderDrawList(m_SortedDrawList);
+        m_SortedDrawList.Clear();
+    }
+    else
+    {
+        RenderDrawList(m_DrawList);
+    }
+
+    m_DrawList.Clear();
+
+    CommitFlushStatistics();
+}
+
+void Draw::SetMode(const DrawMode newMode)
+{
+    Flush();
+    m_Mode = newMode;
+}
+
+void Draw::RenderDrawList(const DrawList& drawList)
+{
     usize pointIndex = 0;
     usize lineIndex = 0, lineColoredIndex = 0;
     usize triangleIndex = 0, triangleColoredIndex = 0, triangleFilledIndex = 0, triangleColoredFilledIndex = 0;
     usize rectangleIndex = 0, rectangleFilledIndex = 0;
     usize circleIndex = 0;
     usize arcIndex = 0;
-    usize textureIndex = 0, textureIdIndex = 0;
-    usize textIndex = 0;
+    usize textureIndex = 0, textureBindingIndex = 0;
+    usize textIndex = 0, textAtlasIdIndex = 0;
     usize renderTargetIndex = 0;
 
-    const List<CommandData>& commands = m_DrawList.commands;
+    const List<CommandData>& commands = drawList.commands;
+    DrawDataType lastType = commands[0].type;
+    u32 lastTextureId = 0;
     for (usize i = 0; i < commands.GetSize(); i++)
     {
         const CommandData& command = commands[i];
         const usize count = command.count;
 
+        m_FlushStatistics.instances += count;
+        if (command.type != lastType)
+            m_FlushStatistics.shaderSwitches++;
+        lastType = command.type;
+
         switch (command.type)
         {
             case DrawDataType::Point:
-                RenderPointData(m_DrawList.point, pointIndex, count);
+                RenderPointData(drawList.point, pointIndex, count);
                 pointIndex += count;
                 break;
 
             case DrawDataType::Line:
-                RenderLineData(m_DrawList.line, lineIndex, count);
+                RenderLineData(drawList.line, lineIndex, count);
                 lineIndex += count;
                 break;
 
             case DrawDataType::LineColored:
-                RenderLineColoredData(m_DrawList.lineColored, lineColoredIndex, count);
+                RenderLineColoredData(drawList.lineColored, lineColoredIndex, count);
                 lineColoredIndex += count;
                 break;
 
             case DrawDataType::Triangle:
-                RenderTriangleData(m_DrawList.triangle, false, triangleIndex, count);
+                RenderTriangleData(drawList.triangle, false, triangleIndex, count);
                 triangleIndex += count;
                 break;
 
             case DrawDataType::TriangleColored:
-                RenderTriangleColoredData(m_DrawList.triangleColored, false, triangleColoredIndex, count);
+                RenderTriangleColoredData(drawList.triangleColored, false, triangleColoredIndex, count);
                 triangleColoredIndex += count;
                 break;
 
             case DrawDataType::TriangleFilled:
-                RenderTriangleData(m_DrawList.triangleFilled, true, triangleFilledIndex, count);
+                RenderTriangleData(drawList.triangleFilled, true, triangleFilledIndex, count);
                 triangleFilledIndex += count;
                 break;
 
             case DrawDataType::TriangleColoredFilled:
-                RenderTriangleColoredData(m_DrawList.triangleColoredFilled, true, triangleColoredFilledIndex, count);
+                RenderTriangleColoredData(drawList.triangleColoredFilled, true, triangleColoredFilledIndex, count);
                 triangleColoredFilledIndex += count;
                 break;
 
             case DrawDataType::Rectangle:
-                RenderRectangleData(m_DrawList.rectangle, false, rectangleIndex, count);
+                RenderRectangleData(drawList.rectangle, false, rectangleIndex, count);
                 rectangleIndex += count;
                 break;
 
             case DrawDataType::RectangleFilled:
-                RenderRectangleData(m_DrawList.rectangleFilled, true, rectangleFilledIndex, count);
+                RenderRectangleData(drawList.rectangleFilled, true, rectangleFilledIndex, count);
                 rectangleFilledIndex += count;
                 break;
 
             case DrawDataType::Circle:
-                RenderCircleData(m_DrawList.circle, circleIndex, count);
+                RenderCircleData(drawList.circle, circleIndex, count);
                 circleIndex += count;
                 break;
 
             case DrawDataType::Arc:
-                RenderArcData(m_DrawList.arc, arcIndex, count);
+                RenderArcData(drawList.arc, arcIndex, count);
                 arcIndex += count;
                 break;
 
             case DrawDataType::Texture:
-                RenderTextureData(m_DrawList.texture, m_DrawList.textureId[textureIdIndex], textureIndex, count);
+            {
+                const TextureBinding binding = drawList.textureBinding[textureBindingIndex];
+                if (binding.id != lastTextureId)
+                    m_FlushStatistics.textureSwitches++;
+                lastTextureId = binding.id;
+
+                RenderTextureData(drawList.texture, binding, textureIndex, count);
                 textureIndex += count;
-                textureIdIndex++;
+                textureBindingIndex++;
                 break;
+            }
 
             case DrawDataType::Text:
-                RenderTextData(m_DrawList.text, textIndex, count);
+            {
+                const u32 atlasId = drawList.textAtlasId[textAtlasIdIndex];
+                if (atlasId != lastTextureId)
+                    m_FlushStatistics.textureSwitches++;
+                lastTextureId = atlasId;
+
+                RenderTextData(drawList.text, atlasId, textIndex, count);
                 textIndex += count;
+                textAtlasIdIndex++;
                 break;
+            }
 
             case DrawDataType::RenderTarget:
-                RenderRenderTargetData(m_DrawList.renderTarget, renderTargetIndex, count);
+                // Each RenderTarget is drawn with its own texture
+                m_FlushStatistics.textureSwitches += static_cast<u32>(count);
+                lastTextureId = 0;
+                RenderRenderTargetData(drawList.renderTarget, renderTargetIndex, count);
                 renderTargetIndex += count;
                 break;
         }
     }
+}
 
-    m_DrawList.Clear();
+void Draw::RadixSort(List<SortEntry>& entries, List<SortEntry>& buffer)
+{
+    buffer.Resize(entries.GetSize());
+
+    for (u32 shift = 0; shift < 64; shift += 8)
+    {
+        Array<usize, 256> offsets{};
+        for (const SortEntry& entry : entries)
+            offsets[entry.key >> shift & 0xFF]++;
+
+        // Skip the digits that are the same for all the keys, which is the case for most of them
+        if (offsets[entries[0].key >> shift & 0xFF] == entries.GetSize())
+            continue;
+
+        usize offset = 0;
+        for (usize& digitOffset : offsets)
+        {
+            const usize digitCount = digitOffset;
+            digitOffset = offset;
+            offset += digitCount;
+        }
+
+        for (const SortEntry& entry : entries)
+            buffer[offsets[entry.key >> shift & 0xFF]++] = entry;
+
+        std::swap(entries, buffer);
+    }
 }
 
-void Draw::SetMode(const DrawMode newMode)
+void Draw::CommitFlushStatistics()
 {
-    Flush();
-    m_Mode = newMode;
+    m_LastFlushStatistics = m_FlushStatistics;
+    m_FrameStatistics.drawCalls += m_FlushStatistics.drawCalls;
+    m_FrameStatistics.shaderSwitches += m_FlushStatistics.shaderSwitches;
+    m_FrameStatistics.textureSwitches += m_FlushStatistics.textureSwitches;
+    m_FrameStatistics.instances += m_FlushStatistics.instances;
 }
 
+void Draw::SortDrawList()
+{
+    ZoneScoped;
+
+    const List<CommandData>& commands = m_DrawList.commands;
+
+    // Where the data of each command starts is implicitly given by the submission order, so find it before reordering them
+    List<usize>& dataIndices = m_SortDataIndices;
+    List<usize>& bindingIndices = m_SortBindingIndices;
+    dataIndices.Clear();
+    bindingIndices.Clear();
+
+    Array<usize, magic_enum::enum_count<DrawDataType>()> dataCounts{}, commandCounts{};
+
+    List<SortEntry>& entries = m_SortEntries;
+    entries.Clear();
+
+    for (usize i = 0; i < commands.GetSize(); i++)
+    {
+        const CommandData& command = commands[i];
+        const usize typeIndex = static_cast<usize>(command.type);
+
+        dataIndices.Add(dataCounts[typeIndex]);
+        dataCounts[typeIndex] += command.count;
+
+        // Textures and text have exactly one binding per command
+        const usize bindingIndex = commandCounts[typeIndex]++;
+        bindingIndices.Add(bindingIndex);
+
+        u32 textureId = 0;
+        if (command.type == DrawDataType::Texture)
+            textureId = m_DrawList.textureBinding[bindingIndex].id;
+        else if (command.type == DrawDataType::Text)
+            textureId = m_DrawList.textAtlasId[bindingIndex];
+
+        entries.Emplace(MakeSortKey(command.layer, static_cast<u8>(command.type), textureId), static_cast<u32>(i));
+    }
+
+    RadixSort(entries, m_SortBuffer);
+
+    DrawList& sorted = m_SortedDrawList;
+    for (const SortEntry& entry : entries)
+    {
+        const CommandData& command = commands[entry.index];
+        const usize index = dataIndices[entry.index];
+        const usize count = command.count;
+
+        // Commands can be merged if they are of the same type and use the same texture, as their data is now contiguous
+        bool merge = !sorted.commands.IsEmpty() && Last(sorted.commands).type == command.type;
+
+        switch (command.type)
+        {
+            case DrawDataType::Point:
+                sorted.point.AddRange(&m_DrawList.point[index], count);
+                break;
+
+            case DrawDataType::Line:
+                sorted.line.AddRange(&m_DrawList.line[index], count);
+                break;
+
+            case DrawDataType::LineColored:
+                sorted.lineColored.AddRange(&m_DrawList.lineColored[index], count);
+                break;
+
+            case DrawDataType::Triangle:
+                sorted.triangle.AddRange(&m_DrawList.triangle[index], count);
+                break;
+
+            case DrawDataType::TriangleColored:
+                sorted.triangleColored.AddRange(&m_DrawList.triangleColored[index], count);
+                break;
+
+            case DrawDataType::TriangleFilled:
+                sorted.triangleFilled.AddRange(&m_DrawList.triangleFilled[index], count);
+                break;
+
+            case DrawDataType::TriangleColoredFilled:
+                sorted.triangleColoredFilled.AddRange(&m_DrawList.triangleColoredFilled[index], count);
+                break;
+
+            case DrawDataType::Rectangle:
+                sorted.rectangle.AddRange(&m_DrawList.rectangle[index], count);
+                break;
+
+            case DrawDataType::RectangleFilled:
+                sorted.rectangleFilled.AddRange(&m_DrawList.rectangleFilled[index], count);
+                break;
+
+            case DrawDataType::Circle:
+                sorted.circle.AddRange(&m_DrawList.circle[index], count);
+                break;
+
+            case DrawDataType::Arc:
+                sorted.arc.AddRange(&m_DrawList.arc[index], count);
+                break;
+
+            case DrawDataType::Texture:
+            {
+                sorted.texture.AddRange(&m_DrawList.texture[index], count);
+
+                const TextureBinding binding = m_DrawList.textureBinding[bindingIndices[entry.index]];
+                if (merge && Last(sorted.textureBinding).id != binding.id)
+                    merge = false;
+                if (!merge)
+                    sorted.textureBinding.Add(binding);
+                break;
+            }
+
+            case DrawDataType::Text:
+            {
+                sorted.text.AddRange(&m_DrawList.text[index], count);
+
+                const u32 atlasId = m_DrawList.textAtlasId[bindingIndices[entry.index]];
+                if (merge && Last(sorted.textAtlasId) != atlasId)
+                    merge = false;
+                if (!merge)
+                    sorted.textAtlasId.Add(atlasId);
+                break;
+            }
+
+            case DrawDataType::RenderTarget:
+                sorted.renderTarget.AddRange(&m_DrawList.renderTarget[index], count);
+                break;
+        }
+
+        if (merge)
+            Last(sorted.commands).count += count;
+        else
+            sorted.commands.Add(command);
+    }
+}
+
+void Draw::SetLayer(const s16 newLayer) { m_Layer = newLayer; }
+
 void Draw::DrawList::AddCommand(const DrawDataType type)
 {
     if (!commands.IsEmpty())
     {
         CommandData& lastCommand = Last(commands);
-        if (lastCommand.type == type)
+        if (lastCommand.type == type && lastCommand.layer == m_Layer)
         {
             lastCommand.count++;
             return;
         }
     }
 
-    commands.Emplace(type, 1ull);
+    commands.Emplace(type, 1ull, m_Layer);
 }
 
 void Draw::DrawList::Clear()
@@ -509,19 +788,27 @@ void Draw::DrawList::Clear()
     circle.Clear();
     arc.Clear();
     texture.Clear();
-    textureId.Clear();
+    textureBinding.Clear();
     text.Clear();
+    textAtlasId.Clear();
     renderTarget.Clear();
 
     commands.Clear();
 }
 
+s64 Draw::GetLastFrameStreamedBytes() { return m_InstanceBuffer.GetLastFrameBytesStreamed(); }
+
 void Draw::Initialize()
 {
     ZoneScoped;
 
-    m_Vbo.Create();
-    m_Vbo.SetDebugName("Global VBO");
+    m_InstanceBuffer.Create(InstanceBufferFrameSize);
+    m_InstanceBuffer.SetDebugName("Instance Ring Buffer");
+
+    m_FrameUniformBuffer.Create();
+    m_FrameUniformBuffer.SetDebugName("Frame UBO");
+    m_FrameUniformBuffer.SetStorage(sizeof(FrameUniforms), nullptr, Graphics::BufferStorageFlags::DynamicStorage);
+    BindBufferBase(Graphics::BufferType::UniformBuffer, FrameUniformBufferBinding, m_FrameUniformBuffer);
 
     InitializePointBuffers();
     InitializeLineBuffers();
@@ -562,15 +849,25 @@ void Draw::LoadResources()
     m_RenderTargetShader = ResourceManager::Get<Shader>(basePath + "render_target");
 }
 
+void Draw::BeginFrame() { m_FrameUniformsDirty = true; }
+
+void Draw::EndFrame()
+{
+    m_InstanceBuffer.NextFrame();
+
+    m_LastFrameStatistics = m_FrameStatistics;
+    m_FrameStatistics = {};
+}
+
 void Draw::Shutdown()
 {
     ZoneScoped;
 
     m_RectangleEbo.Delete();
-    m_Vbo.Delete();
+    m_InstanceBuffer.Delete();
+    m_FrameUniformBuffer.Delete();
     m_RectangleVbo.Delete();
     m_TextureVbo.Delete();
-    m_TextVbo.Delete();
     m_RenderTargetVbo.Delete();
     m_RenderTargetSsbo.Delete();
 
@@ -586,6 +883,17 @@ void Draw::Shutdown()
     m_TextVao.Delete();
     m_RenderTargetVao.Delete();
     m_ParticleVao.Delete();
+
+    for (List<usize>* list : { &m_SortDataIndices, &m_SortBindingIndices })
+    {
+        list->Clear();
+        list->Shrink();
+    }
+    for (List<SortEntry>* list : { &m_SortEntries, &m_SortBuffer })
+    {
+        list->Clear();
+        list->Shrink();
+    }
 }
 
 #pragma region InitializeBuffers
@@ -596,7 +904,7 @@ void Draw::InitializePointBuffers()
 
     BindVertexArray(m_PointVao);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     u32 index = 0;
     usize offset = 0;
     // Position
@@ -612,7 +920,7 @@ void Draw::InitializeLineBuffers()
 
     BindVertexArray(m_LineVao);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     u32 index = 0;
     usize offset = 0;
     // Points
@@ -629,7 +937,7 @@ void Draw::InitializeLineColoredBuffers()
 
     BindVertexArray(m_LineColoredVao);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     u32 index = 0;
     usize offset = 0;
     // Points
@@ -647,7 +955,7 @@ void Draw::InitializeTriangleBuffers()
 
     BindVertexArray(m_TriangleVao);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     u32 index = 0;
     usize offset = 0;
     // Points
@@ -665,7 +973,7 @@ void Draw::InitializeTriangleColoredBuffers()
 
     BindVertexArray(m_TriangleColoredVao);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     u32 index = 0;
     usize offset = 0;
     // Points
@@ -714,7 +1022,7 @@ void Draw::InitializeRectangleBuffers()
     // Vertex position
     Graphics::SetVertexAttribute(index, 2, sizeof(Vector2), 0, 0);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     usize offset = 0;
     // Transformation Matrix
     Graphics::SetVertexAttribute(++index, 4, sizeof(RectangleData), offset, 1);
@@ -742,7 +1050,7 @@ void Draw::InitializeCircleBuffers()
     // Vertex position
     Graphics::SetVertexAttribute(index, 2, sizeof(Vector2), 0, 0);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     usize offset = 0;
     // Transformation Matrix
     Graphics::SetVertexAttribute(++index, 4, sizeof(CircleData), offset, 1);
@@ -780,7 +1088,7 @@ void Draw::InitializeArcBuffers()
     // Vertex position
     Graphics::SetVertexAttribute(index, 2, sizeof(Vector2), 0, 0);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     usize offset = 0;
     // Transformation Matrix
     Graphics::SetVertexAttribute(++index, 4, sizeof(ArcData), offset, 1);
@@ -833,7 +1141,7 @@ void Draw::InitializeTextureBuffers()
     // Vertex position
     Graphics::SetVertexAttribute(index, 2, sizeof(Vector2), 0, 0);
 
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_Vbo);
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
     usize offset = 0;
     // Transformation Matrix
     Graphics::SetVertexAttribute(++index, 4, sizeof(TextureData), offset, 1);
@@ -847,21 +1155,35 @@ void Draw::InitializeTextureBuffers()
     Graphics::SetVertexAttribute(++index, 4, sizeof(TextureData), offset += sizeof(Vector4), 1);
     // Color
     Graphics::SetVertexAttribute(++index, 4, sizeof(TextureData), offset += sizeof(Vector4), 1);
+    // Atlas layer
+    Graphics::SetVertexAttributeInt(++index, 1, sizeof(TextureData), offset += sizeof(Color), 1);
 }
 
 void Draw::InitializeTextBuffers()
 {
-    m_TextVbo.Create();
-    m_TextVbo.SetDebugName("Text VBO");
     m_TextVao.Create();
     m_TextVao.SetDebugName("Text VAO");
 
     BindVertexArray(m_TextVao);
+
+    // VBO
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_RectangleVbo);
+    // EBO
     BindBuffer(Graphics::BufferType::ElementArrayBuffer, m_RectangleEbo);
-    BindBuffer(Graphics::BufferType::ArrayBuffer, m_TextVbo);
-    m_TextVbo.SetStorage(sizeof(Vector4) * 4, nullptr, Graphics::BufferStorageFlags::DynamicStorage);
 
-    Graphics::SetVertexAttribute(0, 4, sizeof(Vector4), 0);
+    // VAO
+    u32 index = 0;
+    // Vertex position
+    Graphics::SetVertexAttribute(index, 2, sizeof(Vector2), 0, 0);
+
+    BindBuffer(Graphics::BufferType::ArrayBuffer, m_InstanceBuffer.GetBuffer());
+    usize offset = 0;
+    // Position and size
+    Graphics::SetVertexAttribute(++index, 4, sizeof(GlyphData), offset, 1);
+    // UV rectangle
+    Graphics::SetVertexAttribute(++index, 4, sizeof(GlyphData), offset += sizeof(Vector4), 1);
+    // Color
+    Graphics::SetVertexAttribute(++index, 4, sizeof(GlyphData), offset += sizeof(Vector4), 1);
 }
 
 void Draw::InitializeRenderTargetBuffers()
@@ -906,7 +1228,7 @@ void Draw::SetProjectionMatrix(const Matrix& newProjectionMatrix, const bool upd
     m_ProjectionMatrix = newProjectionMatrix;
 
     if (updateUniforms)
-        UpdateShaderMatrices();
+        m_FrameUniformsDirty = true;
 }
 
 void Draw::SetCamera(const Matrix& newCameraMatrix, const Vector2 newCameraScale, const bool updateUniforms)
@@ -915,29 +1237,24 @@ void Draw::SetCamera(const Matrix& newCameraMatrix, const Vector2 newCameraScale
     m_CameraScale = newCameraScale;
 
     if (updateUniforms)
-        UpdateShaderMatrices();
+        m_FrameUniformsDirty = true;
 }
 
-void Draw::UpdateShaderMatrices()
+void Draw::UpdateFrameUniforms()
 {
-    const Matrix proj = m_ProjectionMatrix * m_CameraMatrix;
-
-    m_PointShader->SetUniform("projection", proj);
-    m_LineShader->SetUniform("projection", proj);
-    m_LineColoredShader->SetUniform("projection", proj);
-    m_TriangleShader->SetUniform("projection", proj);
-    m_TriangleColoredShader->SetUniform("projection", proj);
-    m_RectangleShader->SetUniform("projection", proj);
-    m_CircleShader->SetUniform("projection", proj);
-    m_ArcShader->SetUniform("projection", proj);
-    m_TextureShader->SetUniform("projection", proj);
+    if (!m_FrameUniformsDirty)
+        return;
 
-    m_TextShader->SetUniform("projection", proj);
+    const FrameUniforms uniforms{
+        .projection = m_ProjectionMatrix * m_CameraMatrix,
+        .camera = m_CameraMatrix,
+        .cameraScale = m_CameraScale,
+        .time = Time::GetTotalTime(),
+        .padding = 0.f
+    };
 
-    m_CircleShader->SetUniform("camera", m_CameraMatrix);
-    m_CircleShader->SetUniform("cameraScale", m_CameraScale);
-    m_ArcShader->SetUniform("camera", m_CameraMatrix);
-    m_ArcShader->SetUniform("cameraScale", m_CameraScale);
+    m_FrameUniformBuffer.SetSubData(0, sizeof(uniforms), &uniforms);
+    m_FrameUniformsDirty = false;
 }
 
 void Draw::RectangleInternal(const Mountain::Rectangle& rectangle, const f32 rotation, const Vector2 origin, const bool filled, const Color& color)
@@ -1042,28 +1359,95 @@ void Draw::ArcInternal(
     SCHEDULE_RENDER_DATA(data, RenderArcData, arc, DrawDataType::Arc);
 }
 
+void Draw::AddTextGlyphs(
+    const Font& font,
+    const std::string_view text,
+    const Vector2 position,
+    const f32 scale,
+    const Color& color,
+    List<GlyphData>& glyphs
+)
+{
+    glyphs.Reserve(glyphs.GetSize() + text.size());
+
+    Vector2 offset = position + Vector2::UnitY() * font.CalcTextSize(text).y * scale;
+
+    for (const c8 c : text)
+    {
+        const Font::Character& character = font.m_Characters.At(static_cast<u8>(c));
+
+        if (character.size != Vector2i::Zero()) // Do not draw invisible characters
+        {
+            const Vector2 glyphPosition = Calc::Round(
+                {
+                    offset.x + static_cast<f32>(character.bearing.x) * scale,
+                    offset.y - static_cast<f32>(character.bearing.y) * scale
+                }
+            );
+
+            glyphs.Emplace(glyphPosition, Calc::Round(character.size * scale), character.uv0, character.uv1, color);
+        }
+
+        // Now advance cursors for next glyph (note that advance is number of 1/64 pixels)
+        offset.x += static_cast<f32>(character.advance >> 6) * scale; // bitshift by 6 to get value in pixels (2^6 = 64)
+    }
+}
+
+template <typename T, typename DrawFunc>
+void Draw::StreamInstances(const List<T>& data, usize index, usize count, DrawFunc&& draw)
+{
+    // Leave room for the alignment padding so that a batch always fits in the ring buffer
+    const usize maxBatchCount = static_cast<usize>(m_InstanceBuffer.GetFrameSize()) / sizeof(T) - 1;
+
+    while (count > 0)
+    {
+        const usize batchCount = std::min(count, maxBatchCount);
+        const s64 offset = m_InstanceBuffer.Write(&data[index], static_cast<s64>(sizeof(T) * batchCount), sizeof(T));
+
+        // Instanced attributes are fetched starting from the base instance, so the offset is expressed in instances
+        draw(static_cast<u32>(offset / static_cast<s64>(sizeof(T))), static_cast<s32>(batchCount));
+        m_FlushStatistics.drawCalls++;
+
+        index += batchCount;
+        count -= batchCount;
+    }
+}
+
+template <typename RenderFunc>
+void Draw::RenderImmediate(const usize instances, const bool bindsTexture, RenderFunc&& render)
+{
+    // Immediate draws always bind their shader and texture
+    m_FlushStatistics = { .shaderSwitches = 1, .textureSwitches = bindsTexture ? 1u : 0u, .instances = instances };
+    UpdateFrameUniforms();
+    render();
+    CommitFlushStatistics();
+}
+
 #pragma region Rendering
-void Draw::RenderPointData(const PointData& point) { RenderPointData({point}, 0, 1); }
+void Draw::RenderPointData(const PointData& point) { RenderImmediate(1, false, [&] { RenderPointData({point}, 0, 1); }); }
 
-void Draw::RenderLineData(const LineData& line) { RenderLineData({line}, 0, 1); }
+void Draw::RenderLineData(const LineData& line) { RenderImmediate(1, false, [&] { RenderLineData({line}, 0, 1); }); }
 
-void Draw::RenderLineColoredData(const LineColoredData& lineColored) { RenderLineColoredData({lineColored}, 0, 1); }
+void Draw::RenderLineColoredData(const LineColoredData& lineColored) { RenderImmediate(1, false, [&] { RenderLineColoredData({lineColored}, 0, 1); }); }
 
-void Draw::RenderTriangleData(const TriangleData& triangle, const bool filled) { RenderTriangleData({triangle}, filled, 0, 1); }
+void Draw::RenderTriangleData(const TriangleData& triangle, const bool filled) { RenderImmediate(1, false, [&] { RenderTriangleData({triangle}, filled, 0, 1); }); }
 
-void Draw::RenderTriangleColoredData(const TriangleColoredData& triangleColored, const bool filled) { RenderTriangleColoredData({triangleColored}, filled, 0, 1); }
+void Draw::RenderTriangleColoredData(const TriangleColoredData& triangleColored, const bool filled)
+{
+    RenderImmediate(1, false, [&] { RenderTriangleColoredData({triangleColored}, filled, 0, 1); });
+}
 
-void Draw::RenderRectangleData(const RectangleData& rectangle, const bool filled) { RenderRectangleData({rectangle}, filled, 0, 1); }
+void Draw::RenderRectangleData(const RectangleData& rectangle, const bool filled) { RenderImmediate(1, false, [&] { RenderRectangleData({rectangle}, filled, 0, 1); }); }
 
-void Draw::RenderCircleData(const CircleData& circle) { RenderCircleData({circle}, 0, 1); }
+void Draw::RenderCircleData(const CircleData& circle) { RenderImmediate(1, false, [&] { RenderCircleData({circle}, 0, 1); }); }
 
-void Draw::RenderArcData(const ArcData& arc) { RenderArcData({arc}, 0, 1); }
+void Draw::RenderArcData(const ArcData& arc) { RenderImmediate(1, false, [&] { RenderArcData({arc}, 0, 1); }); }
 
-void Draw::RenderTextureData(const TextureData& texture, const u32 textureId) { RenderTextureData({texture}, textureId, 0, 1); }
+void Draw::RenderTextureData(const TextureData& texture, const TextureBinding binding) { RenderImmediate(1, true, [&] { RenderTextureData({texture}, binding, 0, 1); }); }
 
-void Draw::RenderTextData(const TextData& text) { RenderTextData({text}, 0, 1); }
+void Draw::RenderTextData(const List<GlyphData>& glyphs, const u32 atlasId) { RenderImmediate(glyphs.GetSize(), true, [&] { RenderTextData(glyphs, atlasId, 0, glyphs.GetSize()); }); }
 
-void Draw::RenderRenderTargetData(const RenderTargetData& renderTarget) { RenderRenderTargetData({renderTarget}, 0, 1); }
+void Draw::RenderRenderTargetData(const RenderTargetData& renderTarget) { RenderImmediate(1, true, [&] { RenderRenderTargetData({renderTarget}, 0, 1); }); }
 
 void Draw::RenderPointData(const List<PointData>& points, const usize index, const usize count)
 {
@@ -1072,12 +1456,13 @@ void Draw::RenderPointData(const List<PointData>& points, const usize index, con
 
     TracyGpuZone("Draw::RenderPointData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(PointData) * count), &points[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_PointVao);
     m_PointShader->Use();
 
-    DrawArraysInstanced(Graphics::DrawMode::Points, 0, 1, static_cast<s32>(count));
+    StreamInstances(points, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawArraysInstancedBaseInstance(Graphics::DrawMode::Points, 0, 1, instanceCount, baseInstance);
+    });
 
     m_PointShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1090,12 +1475,13 @@ void Draw::RenderLineData(const List<LineData>& lines, const usize index, const
 
     TracyGpuZone("Draw::RenderLineData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(LineData) * count), &lines[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_LineVao);
     m_LineShader->Use();
 
-    DrawArraysInstanced(Graphics::DrawMode::Lines, 0, 2, static_cast<s32>(count));
+    StreamInstances(lines, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawArraysInstancedBaseInstance(Graphics::DrawMode::Lines, 0, 2, instanceCount, baseInstance);
+    });
 
     m_LineShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1108,12 +1494,13 @@ void Draw::RenderLineColoredData(const List<LineColoredData>& linesColored, cons
 
     TracyGpuZone("Draw::RenderLineColoredData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(LineColoredData) * count), &linesColored[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_LineColoredVao);
     m_LineColoredShader->Use();
 
-    DrawArraysInstanced(Graphics::DrawMode::Lines, 0, 2, static_cast<s32>(count));
+    StreamInstances(linesColored, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawArraysInstancedBaseInstance(Graphics::DrawMode::Lines, 0, 2, instanceCount, baseInstance);
+    });
 
     m_LineColoredShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1126,12 +1513,13 @@ void Draw::RenderTriangleData(const List<TriangleData>& triangles, const bool fi
 
     TracyGpuZone("Draw::RenderTriangleData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(TriangleData) * count), &triangles[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_TriangleVao);
     m_TriangleShader->Use();
 
-    DrawArraysInstanced(filled ? Graphics::DrawMode::Triangles : Graphics::DrawMode::LineLoop, 0, 3, static_cast<s32>(count));
+    StreamInstances(triangles, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawArraysInstancedBaseInstance(filled ? Graphics::DrawMode::Triangles : Graphics::DrawMode::LineLoop, 0, 3, instanceCount, baseInstance);
+    });
 
     m_TriangleShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1144,12 +1532,13 @@ void Draw::RenderTriangleColoredData(const List<TriangleColoredData>& trianglesC
 
     TracyGpuZone("Draw::RenderTriangleColoredData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(TriangleColoredData) * count), &trianglesColored[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_TriangleColoredVao);
     m_TriangleColoredShader->Use();
 
-    DrawArraysInstanced(filled ? Graphics::DrawMode::Triangles : Graphics::DrawMode::LineLoop, 0, 3, static_cast<s32>(count));
+    StreamInstances(trianglesColored, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawArraysInstancedBaseInstance(filled ? Graphics::DrawMode::Triangles : Graphics::DrawMode::LineLoop, 0, 3, instanceCount, baseInstance);
+    });
 
     m_TriangleColoredShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1162,15 +1551,16 @@ void Draw::RenderRectangleData(const List<RectangleData>& rectangles, const bool
 
     TracyGpuZone("Draw::RenderRectangleData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(RectangleData) * count), &rectangles[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_RectangleVao);
     m_RectangleShader->Use();
 
-    if (filled)
-        DrawElementsInstanced(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, static_cast<s32>(count));
-    else
-        DrawArraysInstanced(Graphics::DrawMode::LineLoop, 0, 4, static_cast<s32>(count));
+    StreamInstances(rectangles, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        if (filled)
+            DrawElementsInstancedBaseInstance(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, instanceCount, baseInstance);
+        else
+            DrawArraysInstancedBaseInstance(Graphics::DrawMode::LineLoop, 0, 4, instanceCount, baseInstance);
+    });
 
     m_RectangleShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1183,12 +1573,13 @@ void Draw::RenderCircleData(const List<CircleData>& circles, const usize index,
 
     TracyGpuZone("Draw::RenderCircleData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(CircleData) * count), &circles[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_CircleVao);
     m_CircleShader->Use();
 
-    DrawElementsInstanced(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, static_cast<s32>(count));
+    StreamInstances(circles, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawElementsInstancedBaseInstance(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, instanceCount, baseInstance);
+    });
 
     m_CircleShader->Unuse();
     Graphics::BindVertexArray(0);
@@ -1201,89 +1592,59 @@ void Draw::RenderArcData(const List<ArcData>& arcs, const usize index, const usi
 
     TracyGpuZone("Draw::RenderArcData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(ArcData) * count), &arcs[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_ArcVao);
     m_ArcShader->Use();
 
-    DrawElementsInstanced(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, static_cast<s32>(count));
+    StreamInstances(arcs, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawElementsInstancedBaseInstance(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, instanceCount, baseInstance);
+    });
 
     m_ArcShader->Unuse();
     Graphics::BindVertexArray(0);
 }
 
-void Draw::RenderTextureData(const List<TextureData>& textures, const u32 textureId, const usize index, const usize count)
+void Draw::RenderTextureData(const List<TextureData>& textures, const TextureBinding binding, const usize index, const usize count)
 {
     if (textures.IsEmpty())
         return;
 
     TracyGpuZone("Draw::RenderTextureData")
 
-    m_Vbo.SetData(static_cast<s64>(sizeof(TextureData) * count), &textures[index], Graphics::BufferUsage::StreamDraw);
-
     BindVertexArray(m_TextureVao);
-    Graphics::BindTexture(textureId);
+    // Texture atlases are sampled from a separate texture unit, see the texture fragment shader
+    const u32 textureUnit = binding.atlas ? 1 : 0;
+    Graphics::BindTextureUnit(textureUnit, binding.id);
     m_TextureShader->Use();
 
-    DrawElementsInstanced(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, static_cast<s32>(count));
+    StreamInstances(textures, index, count, [&](const u32 baseInstance, const s32 instanceCount)
+    {
+        DrawElementsInstancedBaseInstance(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, instanceCount, baseInstance);
+    });
 
     m_TextureShader->Unuse();
-    Graphics::BindTexture(0);
+    Graphics::BindTextureUnit(textureUnit, 0);
     Graphics::BindVertexArray(0);
 }
 
-void Draw::RenderTextData(const List<TextData>& texts, const usize index, const usize count)
+void Draw::RenderTextData(const List<GlyphData>& glyphs, const u32 atlasId, const usize index, const usize count)
 {
+    if (glyphs.IsEmpty())
+        return;
+
     TracyGpuZone("Draw::RenderTextData")
 
     BindVertexArray(m_TextVao);
+    Graphics::BindTexture(atlasId);
     m_TextShader->Use();
 
-    for (usize i = 0; i < count; i++)
+    StreamInstances(glyphs, index, count, [&](const u32 baseInstance, const s32 instanceCount)
     {
-        const TextData& data = texts[index + i];
-
-        m_TextShader->SetUniform("color", data.color);
-
-        Vector2 offset = data.position + Vector2::UnitY() * data.font->CalcTextSize(data.text).y * data.scale;
-
-        for (const c8 c : data.text)
-        {
-            const Font::Character& character = data.font->m_Characters.at(c);
-
-            if (character.size != Vector2i::Zero()) // Do not draw invisible characters
-            {
-                const Vector2 pos = Calc::Round(
-                    {
-                        offset.x + static_cast<f32>(character.bearing.x) * data.scale,
-                        offset.y - static_cast<f32>(character.bearing.y) * data.scale
-                    }
-                );
-
-                const Vector2 size = Calc::Round(character.size * data.scale);
-
-                const Array vertices = {
-                    pos.x,          pos.y,           0.f, 0.f,
-                    pos.x + size.x, pos.y,           1.f, 0.f,
-                    pos.x + size.x, pos.y + size.y,  1.f, 1.f,
-                    pos.x,          pos.y + size.y,  0.f, 1.f
-                };
-
-                BindTexture(character.texture);
-
-                m_TextVbo.SetSubData(0, sizeof(vertices), vertices.GetData());
-
-                DrawElements(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr);
-            }
-
-            // Now advance cursors for next glyph (note that advance is number of 1/64 pixels)
-            offset.x += static_cast<f32>(character.advance >> 6) * data.scale; // bitshift by 6 to get value in pixels (2^6 = 64)
-        }
-
-        Graphics::BindTexture(0);
-    }
+        DrawElementsInstancedBaseInstance(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr, instanceCount, baseInstance);
+    });
 
     m_TextShader->Unuse();
+    Graphics::BindTexture(0);
     Graphics::BindVertexArray(0);
 }
 
@@ -1294,10 +1655,6 @@ void Draw::RenderRenderTargetData(const List<RenderTargetData>& renderTargets, c
     BindVertexArray(m_RenderTargetVao);
     m_RenderTargetShader->Use();
 
-    // TODO - Some of the calls to SetUniform can be optimized by using Uniform Buffers
-
-    m_RenderTargetShader->SetUniform("projection", m_ProjectionMatrix * m_CameraMatrix);
-
     for (usize i = 0; i < count; i++)
     {
         const RenderTargetData& data = renderTargets[index + i];
@@ -1305,7 +1662,6 @@ void Draw::RenderRenderTargetData(const List<RenderTargetData>& renderTargets, c
         m_RenderTargetShader->SetUniform("transformation", data.transformation);
         m_RenderTargetShader->SetUniform("uvProjection", data.uvProjection);
 
-        m_RenderTargetShader->SetUniform("camera", m_CameraMatrix);
         m_RenderTargetShader->SetUniform("scale", data.scale);
         m_RenderTargetShader->SetUniform("actualScale", data.scale * data.renderTarget->GetCameraScale());
         m_RenderTargetShader->SetUniform("color", data.color);
@@ -1329,6 +1685,7 @@ void Draw::RenderRenderTargetData(const List<RenderTargetData>& renderTargets, c
 
         BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, m_RenderTargetSsbo);
         DrawElements(Graphics::DrawMode::Triangles, 6, Graphics::DataType::UnsignedInt, nullptr);
+        m_FlushStatistics.drawCalls++;
     }
 
     BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, 0);
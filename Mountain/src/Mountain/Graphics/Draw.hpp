@@ -5,6 +5,7 @@
 #include "Mountain/Core.hpp"
 #include "Mountain/Containers/List.hpp"
 #include "Mountain/Graphics/GpuBuffer.hpp"
+#include "Mountain/Graphics/GpuRingBuffer.hpp"
 #include "Mountain/Graphics/GpuVertexArray.hpp"
 #include "Mountain/Graphics/RenderTarget.hpp"
 #include "Mountain/Math/Vector2.hpp"
@@ -23,6 +24,25 @@ namespace Mountain
         Deferred,
         /// @brief Everything is drawn at individual draw call, instead of @c Draw::Flush().
         Immediate,
+        /// @brief Everything is drawn when @c Draw::Flush() is called, like @c DrawMode::Deferred, but sorted by layer
+        /// (see @c Draw::SetLayer()), then by shader and texture.
+        /// @details Layers are drawn in increasing order. Draw calls of a same layer can be reordered to minimize state
+        /// changes, so they must not overlap each other if their order matters. Draw calls with the same layer, shader and
+        /// texture keep their submission order.
+        Sorted
+    };
+
+    /// @brief Statistics about the GPU work issued by the Draw class.
+    struct DrawStatistics
+    {
+        /// @brief The number of draw calls
+        u32 drawCalls = 0;
+        /// @brief The number of times two consecutive batches are of a different kind, which needs another shader or vertex array
+        u32 shaderSwitches = 0;
+        /// @brief The number of times a different texture had to be bound
+        u32 textureSwitches = 0;
+        /// @brief The number of instances drawn
+        usize instances = 0;
     };
 
     /// @brief The Draw class contains static functions to draw various things on the screen.
@@ -295,6 +315,22 @@ namespace Mountain
         /// @brief Sets the new sort mode, calling @c Flush() beforehand.
         MOUNTAIN_API static void SetMode(DrawMode newMode);
 
+        STATIC_GETTER(s16, Layer, m_Layer)
+
+        /// @brief Sets the layer of the next draw calls, which is only used with @c DrawMode::Sorted.
+        /// @details Lower layers are drawn first.
+        MOUNTAIN_API static void SetLayer(s16 newLayer);
+
+        /// @brief Gets the statistics of the last call to @c Flush().
+        /// @details With @c DrawMode::Immediate, each draw call is counted as a flush of its own.
+        STATIC_GETTER(const DrawStatistics&, LastFlushStatistics, m_LastFlushStatistics)
+
+        /// @brief Gets the statistics of all the calls to @c Flush() of the last frame.
+        STATIC_GETTER(const DrawStatistics&, LastFrameStatistics, m_LastFrameStatistics)
+
+        /// @brief Gets the number of bytes of instance data that were streamed to the GPU during the last frame.
+        MOUNTAIN_API static s64 GetLastFrameStreamedBytes();
+
     private:
         struct PointData
         {
@@ -360,14 +396,21 @@ namespace Mountain
         {
             Matrix transformation, uvProjection;
             Color color;
+            /// @brief The TextureAtlas page to sample from, or -1 if the texture isn't drawn from an atlas
+            s32 layer;
         };
 
-        struct TextData
+        struct TextureBinding
         {
-            const Font* font;
-            std::string text;
-            Vector2 position;
-            f32 scale;
+            u32 id;
+            /// @brief Whether @c id is the array texture of a TextureAtlas
+            bool atlas;
+        };
+
+        struct GlyphData
+        {
+            Vector2 position, size;
+            Vector2 uv0, uv1;
             Color color;
         };
 
@@ -397,10 +440,22 @@ namespace Mountain
             RenderTarget
         };
 
+        /// @brief Layout of the per-frame uniform buffer, which must match the @c Frame uniform block of @c frame.glsl
+        struct FrameUniforms
+        {
+            Matrix projection;
+            Matrix camera;
+            Vector2 cameraScale;
+            f32 time;
+            f32 padding;
+        };
+
         struct CommandData
         {
             DrawDataType type;
             usize count;
+            /// @brief The layer of the command, only used with @c DrawMode::Sorted
+            s16 layer = 0;
         };
 
         class DrawList
@@ -418,8 +473,9 @@ namespace Mountain
             List<CircleData> circle;
             List<ArcData> arc;
             List<TextureData> texture;
-            List<u32> textureId;
-            List<TextData> text;
+            List<TextureBinding> textureBinding;
+            List<GlyphData> text;
+            List<u32> textAtlasId;
             List<RenderTargetData> renderTarget;
 
             List<CommandData> commands;
@@ -431,7 +487,18 @@ namespace Mountain
         static inline Pointer<Shader> m_PointShader, m_LineShader, m_LineColoredShader, m_TriangleShader, m_TriangleColoredShader,
                                       m_RectangleShader, m_CircleShader, m_ArcShader, m_TextureShader, m_TextShader, m_RenderTargetShader;
 
-        static inline Graphics::GpuBuffer m_RectangleEbo, m_Vbo, m_RectangleVbo, m_TextureVbo, m_TextVbo, m_RenderTargetVbo, m_RenderTargetSsbo;
+        /// @brief Size of the instance data that can be streamed each frame before having to wait for the GPU.
+        static constexpr s64 InstanceBufferFrameSize = 4 * 1024 * 1024;
+
+        /// @brief Persistently mapped buffer in which the instance data of all the draw batches is written.
+        static inline Graphics::GpuRingBuffer m_InstanceBuffer;
+        static inline Graphics::GpuBuffer m_RectangleEbo, m_RectangleVbo, m_TextureVbo, m_RenderTargetVbo, m_RenderTargetSsbo;
+
+        /// @brief The binding point of the per-frame uniform buffer
+        static constexpr u32 FrameUniformBufferBinding = 0;
+        static inline Graphics::GpuBuffer m_FrameUniformBuffer;
+        /// @brief Whether the per-frame uniform buffer must be uploaded before the next draw call
+        static inline bool m_FrameUniformsDirty = true;
         static inline Graphics::GpuVertexArray m_PointVao, m_LineVao, m_LineColoredVao, m_TriangleVao, m_TriangleColoredVao, m_RectangleVao,
                                                m_CircleVao, m_ArcVao, m_TextureVao, m_TextVao, m_RenderTargetVao, m_ParticleVao;
 
@@ -441,11 +508,34 @@ namespace Mountain
         MOUNTAIN_API static inline Vector2 m_CameraScale = Vector2::One();
 
         static inline DrawList m_DrawList;
+        /// @brief The draw list reordered by @c SortDrawList()
+        static inline DrawList m_SortedDrawList;
+
+        MOUNTAIN_API static inline s16 m_Layer = 0;
+
+        MOUNTAIN_API static inline DrawStatistics m_LastFlushStatistics, m_LastFrameStatistics;
+        static inline DrawStatistics m_FlushStatistics, m_FrameStatistics;
+
+        struct SortEntry
+        {
+            u64 key;
+            /// @brief The index of the command in @c m_DrawList
+            u32 index;
+        };
+
+        // Scratch buffers of SortDrawList(), kept between flushes to avoid reallocating them
+        static inline List<usize> m_SortDataIndices, m_SortBindingIndices;
+        static inline List<SortEntry> m_SortEntries, m_SortBuffer;
 
         MOUNTAIN_API static inline DrawMode m_Mode = DrawMode::Deferred;
 
         static void Initialize();
         static void LoadResources();
+        /// @brief Marks the per-frame uniforms as outdated so that the time is refreshed once per frame, called before any
+        /// draw call of the frame.
+        static void BeginFrame();
+        /// @brief Fences the instance data of the current frame, called once all the draw calls of the frame have been issued.
+        static void EndFrame();
         static void Shutdown();
 
         static void InitializePointBuffers();
@@ -463,11 +553,27 @@ namespace Mountain
 
         static void SetProjectionMatrix(const Matrix& newProjectionMatrix, bool updateUniforms);
         static void SetCamera(const Matrix& newCameraMatrix, Vector2 newCameraScale, bool updateUniforms);
-        static void UpdateShaderMatrices();
+        /// @brief Uploads the projection, camera and time to the per-frame uniform buffer if they changed since the last upload,
+        /// called before issuing draw calls.
+        static void UpdateFrameUniforms();
+
+        /// @brief Renders all the commands of the given @p drawList in order.
+        static void RenderDrawList(const DrawList& drawList);
+        /// @brief Fills @c m_SortedDrawList with the commands of @c m_DrawList sorted by layer, shader and texture, merging the
+        /// adjacent commands that can be drawn in a single batch.
+        static void SortDrawList();
+        /// @brief Stable least significant digit radix sort of @p entries by key, one byte at a time.
+        /// @param buffer A scratch list of the same size as @p entries, which may be swapped with it.
+        static void RadixSort(List<SortEntry>& entries, List<SortEntry>& buffer);
+
+        /// @brief Adds the statistics of the current flush to the statistics of the frame.
+        static void CommitFlushStatistics();
 
         static void RectangleInternal(const Mountain::Rectangle& rectangle, f32 rotation, Vector2 origin, bool filled, const Color& color);
         static void CircleInternal(Vector2 center, f32 radius, f32 thickness, bool filled, Vector2 scale, const Color& color);
         static void ArcInternal(Vector2 center, f32 radius, f32 startingAngle, f32 deltaAngle, f32 thickness, bool filled, Vector2 scale, const Color& color);
+        /// @brief Appends one GlyphData per visible character of @p text to @p glyphs.
+        static void AddTextGlyphs(const Font& font, std::string_view text, Vector2 position, f32 scale, const Color& color, List<GlyphData>& glyphs);
 
         static void RenderPointData(const PointData& point);
         static void RenderLineData(const LineData& line);
@@ -477,8 +583,8 @@ namespace Mountain
         static void RenderRectangleData(const RectangleData& rectangle, bool filled);
         static void RenderCircleData(const CircleData& circle);
         static void RenderArcData(const ArcData& arc);
-        static void RenderTextureData(const TextureData& texture, u32 textureId);
-        static void RenderTextData(const TextData& text);
+        static void RenderTextureData(const TextureData& texture, TextureBinding binding);
+        static void RenderTextData(const List<GlyphData>& glyphs, u32 atlasId);
         static void RenderRenderTargetData(const RenderTargetData& renderTarget);
 
         static void RenderPointData(const List<PointData>& points, usize index, usize count);
@@ -489,10 +595,20 @@ namespace Mountain
         static void RenderRectangleData(const List<RectangleData>& rectangles, bool filled, usize index, usize count);
         static void RenderCircleData(const List<CircleData>& circles, usize index, usize count);
         static void RenderArcData(const List<ArcData>& arcs, usize index, usize count);
-        static void RenderTextureData(const List<TextureData>& textures, u32 textureId, usize index, usize count);
-        static void RenderTextData(const List<TextData>& texts, usize index, usize count);
+        static void RenderTextureData(const List<TextureData>& textures, TextureBinding binding, usize index, usize count);
+        static void RenderTextData(const List<GlyphData>& glyphs, u32 atlasId, usize index, usize count);
         static void RenderRenderTargetData(const List<RenderTargetData>& renderTargets, usize index, usize count);
 
+        /// @brief Writes the instance data of a batch in the instance buffer and calls @p draw with the base instance and
+        /// instance count to draw, splitting the batch if it doesn't fit in a single frame of the instance buffer.
+        template <typename T, typename DrawFunc>
+        static void StreamInstances(const List<T>& data, usize index, usize count, DrawFunc&& draw);
+
+        /// @brief Calls @p render, which issues a draw call of @c DrawMode::Immediate, and records its statistics as a flush
+        /// of its own.
+        template <typename RenderFunc>
+        static void RenderImmediate(usize instances, bool bindsTexture, RenderFunc&& render);
+
         friend class Renderer;
         friend class RenderTarget;
         friend class ParticleSystem;
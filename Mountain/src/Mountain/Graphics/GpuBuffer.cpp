@@ -26,11 +26,23 @@ void GpuBuffer::SetSubData(const s64 offset, const s64 size, const void* data) c
     glNamedBufferSubData(m_Id, offset, size, data);
 }
 
+void GpuBuffer::GetSubData(const s64 offset, const s64 size, void* data) const
+{
+    glGetNamedBufferSubData(m_Id, offset, size, data);
+}
+
 void GpuBuffer::SetData(const s64 size, const void* data, const BufferUsage usage) const
 {
     glNamedBufferData(m_Id, size, data, ToOpenGl(usage));
 }
 
+void* GpuBuffer::MapRange(const s64 offset, const s64 length, const BufferMapFlags flags) const
+{
+    return glMapNamedBufferRange(m_Id, offset, length, static_cast<GLbitfield>(flags));
+}
+
+void GpuBuffer::Unmap() const { glUnmapNamedBuffer(m_Id); }
+
 void GpuBuffer::SetDebugName(ATTRIBUTE_MAYBE_UNUSED const std::string_view name) const
 {
 #ifdef _DEBUG
@@ -19,8 +19,22 @@ namespace Mountain::Graphics
 
         void SetSubData(s64 offset, s64 size, const void* data) const;
 
+        /// @brief Copies a range of the buffer into client memory
+        /// @warning This waits for the GPU to finish all the commands writing to the buffer, so avoid doing this every frame
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetBufferSubData.xhtml">glGetBufferSubData()</a>
+        void GetSubData(s64 offset, s64 size, void* data) const;
+
         void SetData(s64 size, const void* data, BufferUsage usage) const;
 
+        /// @brief Maps a range of the buffer into client memory
+        /// @return A pointer to the mapped range, or @c nullptr if the mapping failed
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMapBufferRange.xhtml">glMapBufferRange()</a>
+        ATTRIBUTE_NODISCARD
+        void* MapRange(s64 offset, s64 length, BufferMapFlags flags) const;
+
+        /// @brief Unmaps the buffer previously mapped with @c MapRange()
+        void Unmap() const;
+
         void SetDebugName(std::string_view name) const;
 
         ATTRIBUTE_NODISCARD
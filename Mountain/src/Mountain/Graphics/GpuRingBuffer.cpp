@@ -0,0 +1,108 @@
+﻿#include "Mountain/Graphics/GpuRingBuffer.hpp"
+
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "Mountain/Exceptions/ThrowHelper.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain::Graphics;
+
+namespace
+{
+    s64 AlignOffset(const s64 offset, const s64 alignment) { return (offset + alignment - 1) / alignment * alignment; }
+}
+
+void GpuRingBuffer::Create(const s64 frameSize)
+{
+    m_FrameSize = frameSize;
+    m_FrameIndex = 0;
+    m_FrameOffset = 0;
+
+    constexpr BufferStorageFlags storageFlags = BufferStorageFlags::MapWrite | BufferStorageFlags::MapPersistent | BufferStorageFlags::MapCoherent;
+    constexpr BufferMapFlags mapFlags = BufferMapFlags::Write | BufferMapFlags::Persistent | BufferMapFlags::Coherent;
+
+    const s64 size = m_FrameSize * FrameCount;
+    m_Buffer.Create();
+    m_Buffer.SetStorage(size, nullptr, storageFlags);
+    m_Data = static_cast<u8*>(m_Buffer.MapRange(0, size, mapFlags));
+
+    if (!m_Data)
+        THROW(InvalidOperationException{"Couldn't map the ring buffer"});
+}
+
+void GpuRingBuffer::Delete()
+{
+    for (u32 i = 0; i < FrameCount; i++)
+        WaitForFence(i);
+
+    if (m_Data)
+        m_Buffer.Unmap();
+    m_Data = nullptr;
+
+    m_Buffer.Delete();
+}
+
+s64 GpuRingBuffer::Write(const void* data, const s64 size, const s64 alignment)
+{
+    // Make sure the data always fits in a region once aligned
+    if (size + alignment > m_FrameSize)
+        THROW(ArgumentOutOfRangeException{"Cannot write more than the frame size of a ring buffer at once", "size"});
+
+    const s64 frameStart = m_FrameIndex * m_FrameSize;
+    s64 offset = AlignOffset(frameStart + m_FrameOffset, alignment);
+
+    if (offset + size > frameStart + m_FrameSize)
+    {
+        if (!m_OverflowWarningLogged)
+        {
+            Logger::LogWarning("Ring buffer frame size of {} bytes exceeded, consider using a larger one", m_FrameSize);
+            m_OverflowWarningLogged = true;
+        }
+
+        // The draw calls of this frame may still read the start of the region, so they need to complete before overwriting it
+        glFinish();
+        offset = AlignOffset(frameStart, alignment);
+    }
+
+    std::memcpy(m_Data + offset, data, static_cast<usize>(size));
+
+    m_FrameOffset = offset + size - frameStart;
+    m_BytesStreamed += size;
+
+    return offset;
+}
+
+void GpuRingBuffer::NextFrame()
+{
+    m_Fences[m_FrameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    m_LastFrameBytesStreamed = m_BytesStreamed;
+    m_BytesStreamed = 0;
+
+    m_FrameIndex = (m_FrameIndex + 1) % FrameCount;
+    m_FrameOffset = 0;
+
+    WaitForFence(m_FrameIndex);
+}
+
+void GpuRingBuffer::SetDebugName(const std::string_view name) const { m_Buffer.SetDebugName(name); }
+
+void GpuRingBuffer::WaitForFence(const u32 frameIndex)
+{
+    void*& fence = m_Fences[frameIndex];
+    if (!fence)
+        return;
+
+    const GLsync sync = static_cast<GLsync>(fence);
+    constexpr GLuint64 Timeout = 1'000'000; // 1ms
+
+    // Only flush the first time to make sure the fence is eventually signaled
+    GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    while (result == GL_TIMEOUT_EXPIRED)
+        result = glClientWaitSync(sync, 0, Timeout);
+
+    glDeleteSync(sync);
+    fence = nullptr;
+}
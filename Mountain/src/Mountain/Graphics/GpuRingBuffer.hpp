@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
+#include "Mountain/Graphics/GpuBuffer.hpp"
+
+namespace Mountain::Graphics
+{
+    /// @brief Persistently mapped buffer used to stream data to the GPU every frame
+    /// @details The buffer is split in @c FrameCount regions, one per frame in flight. Data is written directly in the mapped
+    /// memory of the current region, so that draw calls can read it at the returned offset without any copy or reallocation.
+    /// When a frame ends, a fence is inserted and the next region is only written to once the GPU is done reading it.
+    struct MOUNTAIN_API GpuRingBuffer
+    {
+        /// @brief The number of frames that can be in flight at the same time
+        static constexpr u32 FrameCount = 3;
+
+        /// @brief Create the buffer on the GPU and map it
+        /// @param frameSize The size in bytes of the region written each frame. The buffer is @c FrameCount times larger.
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml">glBufferStorage()</a>
+        void Create(s64 frameSize);
+
+        /// @brief Unmap and delete the buffer on the GPU
+        void Delete();
+
+        /// @brief Write data in the region of the current frame
+        /// @param data The data to write
+        /// @param size The size of the data in bytes, which must be smaller than @code GetFrameSize() - alignment@endcode
+        /// @param alignment The alignment of the returned offset, which must be a multiple of the data stride to be able to use it
+        /// as a base instance
+        /// @return The offset of the written data from the start of the buffer
+        /// @remark If the region of the current frame is full, this waits for the GPU to finish all its work and starts again
+        /// from the start of the region. Create the buffer with a larger @c frameSize if this happens often.
+        s64 Write(const void* data, s64 size, s64 alignment);
+
+        /// @brief Fence the region of the current frame and move on to the next one, waiting for the GPU to be done with it if
+        /// necessary
+        void NextFrame();
+
+        void SetDebugName(std::string_view name) const;
+
+        GETTER(GpuBuffer, Buffer, m_Buffer)
+
+        /// @brief Get the size in bytes of the region written each frame
+        GETTER(s64, FrameSize, m_FrameSize)
+
+        /// @brief Get the number of bytes written since the start of the current frame
+        GETTER(s64, BytesStreamed, m_BytesStreamed)
+
+        /// @brief Get the number of bytes written during the last frame
+        GETTER(s64, LastFrameBytesStreamed, m_LastFrameBytesStreamed)
+
+    private:
+        GpuBuffer m_Buffer;
+        u8* m_Data = nullptr;
+
+        s64 m_FrameSize = 0;
+        u32 m_FrameIndex = 0;
+        s64 m_FrameOffset = 0;
+
+        s64 m_BytesStreamed = 0;
+        s64 m_LastFrameBytesStreamed = 0;
+
+        /// @brief One GLsync per region, @c nullptr if there isn't any pending GPU work on it
+        Array<void*, FrameCount> m_Fences{};
+
+        bool m_OverflowWarningLogged = false;
+
+        void WaitForFence(u32 frameIndex);
+    };
+}
@@ -83,7 +83,20 @@ MagnificationFilter GpuTexture::GetMinFilter() const
 {
     GLint result;
     glGetTextureParameteriv(m_Id, GL_TEXTURE_MIN_FILTER, &result);
-    return Graphics::FromOpenGl<MagnificationFilter>(result);
+
+    switch (result)
+    {
+        case GL_NEAREST_MIPMAP_NEAREST:
+        case GL_NEAREST_MIPMAP_LINEAR:
+            return MagnificationFilter::Nearest;
+
+        case GL_LINEAR_MIPMAP_NEAREST:
+        case GL_LINEAR_MIPMAP_LINEAR:
+            return MagnificationFilter::Linear;
+
+        default:
+            return Graphics::FromOpenGl<MagnificationFilter>(result);
+    }
 }
 
 void GpuTexture::SetMinFilter(const MagnificationFilter newMinFilter) const
@@ -91,6 +104,17 @@ void GpuTexture::SetMinFilter(const MagnificationFilter newMinFilter) const
     glTextureParameteri(m_Id, GL_TEXTURE_MIN_FILTER, ToOpenGl(newMinFilter));
 }
 
+void GpuTexture::SetMinFilter(const MagnificationFilter newMinFilter, const MagnificationFilter mipmapFilter) const
+{
+    GLint filter;
+    if (newMinFilter == MagnificationFilter::Nearest)
+        filter = mipmapFilter == MagnificationFilter::Nearest ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST_MIPMAP_LINEAR;
+    else
+        filter = mipmapFilter == MagnificationFilter::Nearest ? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+
+    glTextureParameteri(m_Id, GL_TEXTURE_MIN_FILTER, filter);
+}
+
 MagnificationFilter GpuTexture::GetMagFilter() const
 {
     GLint result;
@@ -104,11 +104,17 @@ namespace Mountain::Graphics
         ATTRIBUTE_NODISCARD
         bool GetImmutable() const;
 
+        /// @brief Gets the filter used when sampling within a mipmap level, regardless of the filter used between mipmap levels
         /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetTexParameter.xhtml">glGetTexParameteriv()</a>
         ATTRIBUTE_NODISCARD
         MagnificationFilter GetMinFilter() const;
         /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
         void SetMinFilter(MagnificationFilter newMinFilter) const;
+        /// @brief Sets the minification filter of a mipmapped texture
+        /// @param newMinFilter The filter used when sampling within a mipmap level
+        /// @param mipmapFilter The filter used when sampling between two mipmap levels
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
+        void SetMinFilter(MagnificationFilter newMinFilter, MagnificationFilter mipmapFilter) const;
 
         /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetTexParameter.xhtml">glGetTexParameteriv()</a>
         ATTRIBUTE_NODISCARD
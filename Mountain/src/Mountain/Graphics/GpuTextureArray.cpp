@@ -0,0 +1,85 @@
+﻿
+
+#include "Mountain/Graphics/GpuTextureArray.hpp"
+
+#include <glad/glad.h>
+
+using namespace Mountain::Graphics;
+
+void GpuTextureArray::Create() { glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_Id); }
+
+void GpuTextureArray::Delete() { glDeleteTextures(1, &m_Id); m_Id = 0; }
+
+void GpuTextureArray::Recreate() { Delete(); Create(); }
+
+void GpuTextureArray::SetStorage(const InternalFormat internalFormat, const Vector2i size, const s32 layerCount, const s32 mipmapLevels) const
+{
+    glTextureStorage3D(m_Id, mipmapLevels, ToOpenGl(internalFormat), size.x, size.y, layerCount);
+}
+
+void GpuTextureArray::SetSubData(
+    const Vector2i offset,
+    const s32 layer,
+    const Vector2i size,
+    const Format dataFormat,
+    const DataType dataType,
+    const void* data,
+    const s32 mipmapLevel
+) const
+{
+    glTextureSubImage3D(m_Id, mipmapLevel, offset.x, offset.y, layer, size.x, size.y, 1, ToOpenGl(dataFormat), ToOpenGl(dataType), data);
+}
+
+void GpuTextureArray::Clear(const s32 mipmapLevel) const { glClearTexImage(m_Id, mipmapLevel, GL_RGBA, GL_UNSIGNED_BYTE, nullptr); }
+
+void GpuTextureArray::CopyLayers(const GpuTextureArray source, const Vector2i size, const s32 layerCount) const
+{
+    glCopyImageSubData(
+        source.m_Id,
+        GL_TEXTURE_2D_ARRAY,
+        0,
+        0,
+        0,
+        0,
+        m_Id,
+        GL_TEXTURE_2D_ARRAY,
+        0,
+        0,
+        0,
+        0,
+        size.x,
+        size.y,
+        layerCount
+    );
+}
+
+void GpuTextureArray::SetDebugName(ATTRIBUTE_MAYBE_UNUSED const std::string_view name) const
+{
+#ifdef _DEBUG
+    glObjectLabel(GL_TEXTURE, m_Id, static_cast<GLsizei>(name.length()), name.data());
+#endif
+}
+
+void GpuTextureArray::SetMinFilter(const MagnificationFilter newMinFilter) const
+{
+    glTextureParameteri(m_Id, GL_TEXTURE_MIN_FILTER, ToOpenGl(newMinFilter));
+}
+
+void GpuTextureArray::SetMagFilter(const MagnificationFilter newMagFilter) const
+{
+    glTextureParameteri(m_Id, GL_TEXTURE_MAG_FILTER, ToOpenGl(newMagFilter));
+}
+
+void GpuTextureArray::SetWrappingHorizontal(const Wrapping newWrappingHorizontal) const
+{
+    glTextureParameteri(m_Id, GL_TEXTURE_WRAP_S, ToOpenGl(newWrappingHorizontal));
+}
+
+void GpuTextureArray::SetWrappingVertical(const Wrapping newWrappingVertical) const
+{
+    glTextureParameteri(m_Id, GL_TEXTURE_WRAP_T, ToOpenGl(newWrappingVertical));
+}
+
+u32 GpuTextureArray::GetId() const { return m_Id; }
+
+GpuTextureArray::operator unsigned int() const { return m_Id; }
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Graphics/Graphics.hpp"
+
+namespace Mountain::Graphics
+{
+    /// @brief Low-level interface for OpenGL 2D array textures
+    /// @details Every layer of an array texture has the same size and format, and all of them can be sampled
+    /// from a single @c sampler2DArray, which allows drawing from several layers in a single draw call.
+    struct MOUNTAIN_API GpuTextureArray
+    {
+        /// @brief Create the texture on the GPU
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCreateTextures.xhtml">glCreateTextures()</a>
+        void Create();
+
+        /// @brief Delete the texture on the GPU
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDeleteTextures.xhtml">glDeleteTextures()</a>
+        void Delete();
+
+        /// @brief Shorthand for @code Delete(); Create();@endcode
+        void Recreate();
+
+        /// @brief Initialize the immutable data storage on the GPU
+        /// @param internalFormat The format to use to store the data on the GPU
+        /// @param size The size of each layer of the texture
+        /// @param layerCount The number of layers of the texture
+        /// @param mipmapLevels The number of mipmap levels to initialize
+        /// @note This will fail if the texture data is already immutable, e.g. a call to @c SetStorage() was already made.
+        /// If you want to use this function again, you first need to @c Recreate() the texture.
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexStorage3D.xhtml">glTexStorage3D()</a>
+        void SetStorage(InternalFormat internalFormat, Vector2i size, s32 layerCount, s32 mipmapLevels = 1) const;
+
+        /// @brief Set a portion of the data of a single layer
+        /// @param offset The offset in the layer to set the data from
+        /// @param layer The layer to set the data of
+        /// @param size The size of the data the set
+        /// @param dataFormat The format of the given data
+        /// @param dataType The type of the given format
+        /// @param data The data to set
+        /// @param mipmapLevel The mipmap level to set
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage3D.xhtml">glTexSubImage3D()</a>
+        void SetSubData(
+            Vector2i offset,
+            s32 layer,
+            Vector2i size,
+            Format dataFormat,
+            DataType dataType,
+            const void* data,
+            s32 mipmapLevel = 0
+        ) const;
+
+        /// @brief Fill all the layers of the texture with zeroes, e.g. transparent black for color formats
+        /// @param mipmapLevel The mipmap level to clear
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glClearTexImage.xhtml">glClearTexImage()</a>
+        void Clear(s32 mipmapLevel = 0) const;
+
+        /// @brief Copy whole layers from another array texture
+        /// @param source The texture to copy the layers from. Its format must be compatible with this texture's.
+        /// @param size The size of each layer to copy
+        /// @param layerCount The number of layers to copy, starting from the first one
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCopyImageSubData.xhtml">glCopyImageSubData()</a>
+        void CopyLayers(GpuTextureArray source, Vector2i size, s32 layerCount) const;
+
+        /// @brief Adds a friendly debug name for this GpuTextureArray.
+        /// This is used when debugging graphics in external applications such as Nsight or RenderDoc.
+        /// This function does nothing if the application isn't compiled in Debug.
+        /// @param name The name of this GpuTextureArray
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glObjectLabel.xhtml">glObjectLabel()</a>
+        void SetDebugName(std::string_view name) const;
+
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
+        void SetMinFilter(MagnificationFilter newMinFilter) const;
+
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
+        void SetMagFilter(MagnificationFilter newMagFilter) const;
+
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
+        void SetWrappingHorizontal(Wrapping newWrappingHorizontal) const;
+
+        /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml">glTexParameteri()</a>
+        void SetWrappingVertical(Wrapping newWrappingVertical) const;
+
+        ATTRIBUTE_NODISCARD
+        u32 GetId() const;
+
+        ATTRIBUTE_NODISCARD
+        explicit operator u32() const;
+
+    private:
+        u32 m_Id = 0;
+    };
+}
@@ -54,6 +54,34 @@ void Graphics::DrawElementsInstanced(
     glDrawElementsInstanced(ToOpenGl(mode), vertexCount, ToOpenGl(type), indices, instanceCount);
 }
 
+void Graphics::DrawArraysInstancedBaseInstance(
+    const DrawMode mode,
+    const s32 first,
+    const s32 vertexCount,
+    const s32 instanceCount,
+    const u32 baseInstance
+)
+{
+    glDrawArraysInstancedBaseInstance(ToOpenGl(mode), first, vertexCount, instanceCount, baseInstance);
+}
+
+void Graphics::DrawElementsInstancedBaseInstance(
+    const DrawMode mode,
+    const s32 vertexCount,
+    const DataType type,
+    const void* indices,
+    const s32 instanceCount,
+    const u32 baseInstance
+)
+{
+    glDrawElementsInstancedBaseInstance(ToOpenGl(mode), vertexCount, ToOpenGl(type), indices, instanceCount, baseInstance);
+}
+
+void Graphics::DrawArraysIndirect(const DrawMode mode, const void* indirect)
+{
+    glDrawArraysIndirect(ToOpenGl(mode), indirect);
+}
+
 void Graphics::SetClearColor(const Color& newClearColor)
 {
     glClearColor(newClearColor.r, newClearColor.g, newClearColor.b, newClearColor.a); // FIXME - This seems to be broken since we switched to SDL3
@@ -68,6 +96,8 @@ void Graphics::BindTexture(const u32 textureId) { glBindTexture(GL_TEXTURE_2D, t
 
 void Graphics::BindTexture(const GpuTexture gpuTexture) { BindTexture(gpuTexture.GetId()); }
 
+void Graphics::BindTextureUnit(const u32 unit, const u32 textureId) { glBindTextureUnit(unit, textureId); }
+
 void Graphics::BindBuffer(const BufferType type, const u32 bufferId) { glBindBuffer(ToOpenGl(type), bufferId); }
 
 void Graphics::BindBuffer(const BufferType type, const GpuBuffer gpuBuffer) { BindBuffer(type, gpuBuffer.GetId()); }
@@ -276,6 +306,103 @@ void Graphics::Finish()
     glFinish();
 }
 
+u8 Graphics::GetPixelSize(const InternalFormat format)
+{
+    switch (format)
+    {
+        case InternalFormat::Red:
+        case InternalFormat::Red8:
+        case InternalFormat::Red8Signed:
+        case InternalFormat::Red3Green3Blue2:
+        case InternalFormat::RedGreenBlueAlpha2:
+        case InternalFormat::Red8Int:
+        case InternalFormat::Red8UnsignedInt:
+            return 1;
+
+        case InternalFormat::RedGreen:
+        case InternalFormat::DepthComponent16:
+        case InternalFormat::Red16:
+        case InternalFormat::Red16Signed:
+        case InternalFormat::RedGreen8:
+        case InternalFormat::RedGreen8Signed:
+        case InternalFormat::RedGreenBlue4:
+        case InternalFormat::RedGreenBlue5:
+        case InternalFormat::RedGreenBlueAlpha4:
+        case InternalFormat::RedGreenBlue5Alpha1:
+        case InternalFormat::Red16Float:
+        case InternalFormat::Red16Int:
+        case InternalFormat::Red16UnsignedInt:
+        case InternalFormat::RedGreen8Int:
+        case InternalFormat::RedGreen8UnsignedInt:
+            return 2;
+
+        case InternalFormat::RedGreenBlue:
+        case InternalFormat::DepthComponent24:
+        case InternalFormat::RedGreenBlue8:
+        case InternalFormat::RedGreenBlue8Signed:
+        case InternalFormat::SignedRedGreenBlue8:
+        case InternalFormat::RedGreenBlue8Int:
+        case InternalFormat::RedGreenBlue8UnsignedInt:
+            return 3;
+
+        case InternalFormat::DepthComponent:
+        case InternalFormat::DepthStencil:
+        case InternalFormat::RedGreenBlueAlpha:
+        case InternalFormat::DepthComponent32Float:
+        case InternalFormat::RedGreen16:
+        case InternalFormat::RedGreen16Signed:
+        case InternalFormat::RedGreenBlue10:
+        case InternalFormat::RedGreenBlueAlpha8:
+        case InternalFormat::RedGreenBlueAlpha8Signed:
+        case InternalFormat::RedGreenBlue10Alpha2:
+        case InternalFormat::RedGreenBlue10Alpha2UnsignedInt:
+        case InternalFormat::SignedRedGreenBlueAlpha8:
+        case InternalFormat::RedGreen16Float:
+        case InternalFormat::Red32Float:
+        case InternalFormat::Red11FloatGreen11FloatBlue10Float:
+        case InternalFormat::RedGreenBlue9Shared5:
+        case InternalFormat::Red32Int:
+        case InternalFormat::Red32UnsignedInt:
+        case InternalFormat::RedGreen16Int:
+        case InternalFormat::RedGreen16UnsignedInt:
+        case InternalFormat::RedGreenBlueAlpha8Int:
+        case InternalFormat::RedGreenBlueAlpha8UnsignedInt:
+            return 4;
+
+        case InternalFormat::RedGreenBlue12:
+            return 5;
+
+        case InternalFormat::RedGreenBlue16:
+        case InternalFormat::RedGreenBlue16Signed:
+        case InternalFormat::RedGreenBlueAlpha12:
+        case InternalFormat::RedGreenBlue16Float:
+        case InternalFormat::RedGreenBlue16Int:
+        case InternalFormat::RedGreenBlue16UnsignedInt:
+            return 6;
+
+        case InternalFormat::RedGreenBlueAlpha16:
+        case InternalFormat::RedGreenBlueAlpha16Float:
+        case InternalFormat::RedGreen32Float:
+        case InternalFormat::RedGreen32Int:
+        case InternalFormat::RedGreen32UnsignedInt:
+        case InternalFormat::RedGreenBlueAlpha16Int:
+        case InternalFormat::RedGreenBlueAlpha16UnsignedInt:
+            return 8;
+
+        case InternalFormat::RedGreenBlue32Float:
+        case InternalFormat::RedGreenBlue32Int:
+        case InternalFormat::RedGreenBlue32UnsignedInt:
+            return 12;
+
+        case InternalFormat::RedGreenBlueAlpha32Float:
+        case InternalFormat::RedGreenBlueAlpha32Int:
+        case InternalFormat::RedGreenBlueAlpha32UnsignedInt:
+            return 16;
+    }
+
+    THROW(ArgumentOutOfRangeException{"Invalid internal format", "format"});
+}
+
 template <>
 Graphics::MagnificationFilter Graphics::FromOpenGl<Graphics::MagnificationFilter>(const s32 value)
 {
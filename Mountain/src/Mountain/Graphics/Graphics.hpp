@@ -117,7 +117,9 @@ namespace Mountain::Graphics
         RedGreenBlueAlpha12,
         RedGreenBlueAlpha16,
 
+        /// @brief sRGB color space, not signed
         SignedRedGreenBlue8,
+        /// @brief sRGB color space, not signed
         SignedRedGreenBlueAlpha8,
 
         Red16Float,
@@ -588,6 +590,22 @@ namespace Mountain::Graphics
         ClientStorage   = 0x200
     };
 
+    enum class BufferMapFlags : u16
+    {
+        None                = 0,
+
+        Read                = 0x001,
+        Write               = 0x002,
+
+        InvalidateRange     = 0x004,
+        InvalidateBuffer    = 0x008,
+        FlushExplicit       = 0x010,
+        Unsynchronized      = 0x020,
+
+        Persistent          = 0x040,
+        Coherent            = 0x080
+    };
+
     enum class MemoryBarrierFlags : u16
     {
         None                        = 0,
@@ -749,6 +767,23 @@ namespace Mountain::Graphics
     MOUNTAIN_API void DrawArraysInstanced(DrawMode mode, s32 first, s32 vertexCount, s32 instanceCount);
     MOUNTAIN_API void DrawElements(DrawMode mode, s32 vertexCount, DataType type, const void* indices);
     MOUNTAIN_API void DrawElementsInstanced(DrawMode mode, s32 vertexCount, DataType type, const void* indices, s32 instanceCount);
+    /// @brief Same as @c DrawArraysInstanced() but instanced vertex attributes start at the instance @p baseInstance
+    MOUNTAIN_API void DrawArraysInstancedBaseInstance(DrawMode mode, s32 first, s32 vertexCount, s32 instanceCount, u32 baseInstance);
+    /// @brief Same as @c DrawElementsInstanced() but instanced vertex attributes start at the instance @p baseInstance
+    MOUNTAIN_API void DrawElementsInstancedBaseInstance(
+        DrawMode mode,
+        s32 vertexCount,
+        DataType type,
+        const void* indices,
+        s32 instanceCount,
+        u32 baseInstance
+    );
+    /// @brief Same as @c DrawArraysInstanced() but the draw parameters are read from the buffer bound to
+    /// @c BufferType::DrawIndirectBuffer, which lets the GPU choose how many instances to draw
+    /// @param mode The primitive type to draw
+    /// @param indirect The byte offset of a <c>{ u32 vertexCount, instanceCount, first, baseInstance }</c> struct in the buffer
+    /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawArraysIndirect.xhtml">glDrawArraysIndirect()</a>
+    MOUNTAIN_API void DrawArraysIndirect(DrawMode mode, const void* indirect);
 
     MOUNTAIN_API void SetClearColor(const Color& newClearColor);
     MOUNTAIN_API void Clear(ClearFlags flags);
@@ -756,6 +791,12 @@ namespace Mountain::Graphics
     MOUNTAIN_API void BindTexture(u32 textureId);
     MOUNTAIN_API void BindTexture(GpuTexture gpuTexture);
 
+    /// @brief Binds a texture of any type to the given texture unit
+    /// @param unit The texture unit to bind the texture to
+    /// @param textureId The texture to bind, or @c 0 to unbind all textures from this unit
+    /// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBindTextureUnit.xhtml">glBindTextureUnit()</a>
+    MOUNTAIN_API void BindTextureUnit(u32 unit, u32 textureId);
+
     MOUNTAIN_API void BindBuffer(BufferType type, u32 bufferId);
     MOUNTAIN_API void BindBuffer(BufferType type, GpuBuffer gpuBuffer);
 
@@ -886,6 +927,12 @@ namespace Mountain::Graphics
     MOUNTAIN_API void Flush();
     MOUNTAIN_API void Finish();
 
+    /// @brief Returns the nominal size in bytes of a single pixel stored using the given @p format.
+    /// @details Unsized formats are assumed to use 8 bits per component. Drivers are free to pad some formats, e.g.,
+    /// 3-component formats are often stored using 4 components, so this should be treated as a lower bound.
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API u8 GetPixelSize(InternalFormat format);
+
     template <OpenGlConvertibleT T>
     ATTRIBUTE_NODISCARD
     // ReSharper disable once CppFunctionIsNotImplemented
@@ -967,6 +1014,8 @@ ENUM_FLAGS(Mountain::Graphics::GpuDataSynchronizationFlags);
 
 ENUM_FLAGS(Mountain::Graphics::BufferStorageFlags);
 
+ENUM_FLAGS(Mountain::Graphics::BufferMapFlags);
+
 ENUM_FLAGS(Mountain::Graphics::MemoryBarrierFlags);
 
 ENUM_FLAGS(Mountain::Graphics::ClearFlags);
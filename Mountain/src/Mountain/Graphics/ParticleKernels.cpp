@@ -0,0 +1,750 @@
+#include "Mountain/Graphics/ParticleKernels.hpp"
+
+#ifdef ARCHITECTURE_X64
+#include <immintrin.h>
+#endif
+
+#include "Mountain/Utils/Simd.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    // Odd constants multiplied by the particle seeds, giving each random value of a particle its own sequence
+    constexpr u32 StreamA = 0x9E3779B9u;
+    constexpr u32 StreamB = 0x85EBCA6Bu;
+    constexpr u32 StreamC = 0xC2B2AE35u;
+
+    /// @brief The random values are converted to floats from their 24 most significant bits, which is the precision of a float.
+    constexpr f32 UnitScale = 1.f / static_cast<f32>(1 << 24);
+
+    // Taylor series of sin and cos, precise to about 1e-7 in [-pi/2, pi/2]
+    constexpr f32 Sin1 = -1.f / 6.f;
+    constexpr f32 Sin2 = 1.f / 120.f;
+    constexpr f32 Sin3 = -1.f / 5040.f;
+    constexpr f32 Sin4 = 1.f / 362880.f;
+    constexpr f32 Sin5 = -1.f / 39916800.f;
+    constexpr f32 Cos1 = -1.f / 2.f;
+    constexpr f32 Cos2 = 1.f / 24.f;
+    constexpr f32 Cos3 = -1.f / 720.f;
+    constexpr f32 Cos4 = 1.f / 40320.f;
+    constexpr f32 Cos5 = -1.f / 3628800.f;
+
+    /// @brief Scrambles the bits of @p value using only shifts, xors and additions, which SSE2 has for 32-bit integers.
+    u32 Hash(u32 value)
+    {
+        value ^= value << 13;
+        value ^= value >> 17;
+        value ^= value << 5;
+        value += StreamA;
+        value ^= value << 13;
+        value ^= value >> 17;
+        value ^= value << 5;
+        return value;
+    }
+
+    /// @brief Returns a random value in the range [0, 1[ from the bits of @p value.
+    f32 ToUnit(const u32 value) { return static_cast<f32>(static_cast<s32>(value >> 8)) * UnitScale; }
+
+    f32 Random(const u32 seed, const u32 stream) { return ToUnit(Hash(seed * stream)); }
+
+    /// @brief Computes the sine and cosine of an @p angle in the range [0, 2pi] with polynomials, which unlike @c std::sin()
+    /// and @c std::cos() can be computed the same way with SIMD instructions.
+    void SinCos(const f32 angle, f32& sin, f32& cos)
+    {
+        // Use the symmetries of sin and cos to only compute them in [-pi/2, pi/2]
+        const f32 x = angle - Calc::Pi;
+        const bool above = x > Calc::PiOver2;
+        const bool below = x < -Calc::PiOver2;
+        const f32 y = above ? Calc::Pi - x : below ? -Calc::Pi - x : x;
+
+        const f32 y2 = y * y;
+        const f32 s = y + y * y2 * (Sin1 + y2 * (Sin2 + y2 * (Sin3 + y2 * (Sin4 + y2 * Sin5))));
+        const f32 c = 1.f + y2 * (Cos1 + y2 * (Cos2 + y2 * (Cos3 + y2 * (Cos4 + y2 * Cos5))));
+
+        sin = -s;
+        cos = above || below ? c : -c;
+    }
+
+    /// @brief The values computed once for all the particles of a @c SpawnCircle() call.
+    struct CircleParameters
+    {
+        u32 seed;
+        f32 inner;
+        f32 outer;
+        f32 arcAngle;
+        f32 cosRotation;
+        f32 sinRotation;
+        Vector2 scale;
+        Vector2 offset;
+    };
+
+    void SpawnCircleScalar(const CircleParameters& p, f32* offsetX, f32* offsetY, f32* directionX, f32* directionY, const usize begin, const usize end)
+    {
+        for (usize i = begin; i < end; i++)
+        {
+            const u32 seed = p.seed + static_cast<u32>(i);
+            const f32 angle = Random(seed, StreamA) * p.arcAngle;
+            const f32 distance = std::sqrt(Random(seed, StreamB)) * p.inner + p.outer;
+
+            f32 sin, cos;
+            SinCos(angle, sin, cos);
+
+            const f32 x = cos * p.cosRotation - sin * p.sinRotation;
+            const f32 y = cos * p.sinRotation + sin * p.cosRotation;
+
+            directionX[i] = x;
+            directionY[i] = y;
+            offsetX[i] = x * distance * p.scale.x + p.offset.x;
+            offsetY[i] = y * distance * p.scale.y + p.offset.y;
+        }
+    }
+
+    /// @brief The values computed once for all the particles of a @c SpawnRectangle() call.
+    struct RectangleParameters
+    {
+        u32 seed;
+        /// @brief The probability for a particle to spawn on the left or right sides rather than the top or bottom ones.
+        f32 limit;
+        f32 halfLimit;
+        f32 upperLimit;
+        Vector2 halfThickness;
+        f32 innerWidth;
+        f32 cosRotation;
+        f32 sinRotation;
+        Vector2 scale;
+        Vector2 offset;
+    };
+
+    void SpawnRectangleScalar(const RectangleParameters& p, f32* offsetX, f32* offsetY, f32* directionX, f32* directionY, const usize begin, const usize end)
+    {
+        for (usize i = begin; i < end; i++)
+        {
+            const u32 seed = p.seed + static_cast<u32>(i);
+            const f32 choice = Random(seed, StreamA);
+            const f32 u = Random(seed, StreamB);
+            const f32 v = Random(seed, StreamC);
+
+            // Either on the right side, with the whole height, or on the bottom side, without the width of the right side.
+            // Half of them are then flipped to the left and top sides.
+            const bool side = choice <= p.limit;
+            f32 x = side ? 1.f + (u - 1.f) * p.halfThickness.x - 0.5f : (u - 0.5f) * p.innerWidth;
+            f32 y = side ? v - 0.5f : 1.f + (v - 1.f) * p.halfThickness.y - 0.5f;
+            if (side ? choice <= p.halfLimit : choice >= p.upperLimit)
+            {
+                x = -x;
+                y = -y;
+            }
+
+            x *= p.scale.x;
+            y *= p.scale.y;
+
+            const f32 rotatedX = x * p.cosRotation - y * p.sinRotation;
+            const f32 rotatedY = x * p.sinRotation + y * p.cosRotation;
+
+            const f32 length = std::sqrt(rotatedX * rotatedX + rotatedY * rotatedY);
+            directionX[i] = length > 0.f ? rotatedX / length : 0.f;
+            directionY[i] = length > 0.f ? rotatedY / length : -1.f;
+            offsetX[i] = rotatedX + p.offset.x;
+            offsetY[i] = rotatedY + p.offset.y;
+        }
+    }
+
+#ifdef ARCHITECTURE_X64
+    TARGET_ISA("sse2")
+    __m128 Select(const __m128 mask, const __m128 a, const __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+
+    TARGET_ISA("sse2")
+    __m128 Negate(const __m128 value) { return _mm_xor_ps(value, _mm_set1_ps(-0.f)); }
+
+    TARGET_ISA("sse2")
+    __m128i HashSse2(__m128i value)
+    {
+        value = _mm_xor_si128(value, _mm_slli_epi32(value, 13));
+        value = _mm_xor_si128(value, _mm_srli_epi32(value, 17));
+        value = _mm_xor_si128(value, _mm_slli_epi32(value, 5));
+        value = _mm_add_epi32(value, _mm_set1_epi32(static_cast<s32>(StreamA)));
+        value = _mm_xor_si128(value, _mm_slli_epi32(value, 13));
+        value = _mm_xor_si128(value, _mm_srli_epi32(value, 17));
+        value = _mm_xor_si128(value, _mm_slli_epi32(value, 5));
+        return value;
+    }
+
+    TARGET_ISA("sse2")
+    __m128 RandomSse2(const __m128i seeds) { return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(HashSse2(seeds), 8)), _mm_set1_ps(UnitScale)); }
+
+    /// @brief Returns the seeds of the first 4 particles multiplied by @p stream, to be advanced by @c StreamStep().
+    TARGET_ISA("sse2")
+    __m128i StreamSeeds(const u32 seed, const u32 stream)
+    {
+        const u32 first = seed * stream;
+        return _mm_setr_epi32(
+            static_cast<s32>(first),
+            static_cast<s32>(first + stream),
+            static_cast<s32>(first + stream * 2),
+            static_cast<s32>(first + stream * 3)
+        );
+    }
+
+    TARGET_ISA("sse2")
+    __m128i StreamStep(const u32 stream) { return _mm_set1_epi32(static_cast<s32>(stream * 4)); }
+
+    TARGET_ISA("sse2")
+    void SinCosSse2(const __m128 angle, __m128& sin, __m128& cos)
+    {
+        const __m128 pi = _mm_set1_ps(Calc::Pi);
+        const __m128 piOver2 = _mm_set1_ps(Calc::PiOver2);
+
+        const __m128 x = _mm_sub_ps(angle, pi);
+        const __m128 above = _mm_cmpgt_ps(x, piOver2);
+        const __m128 below = _mm_cmplt_ps(x, Negate(piOver2));
+        const __m128 y = Select(above, _mm_sub_ps(pi, x), Select(below, _mm_sub_ps(Negate(pi), x), x));
+
+        const __m128 y2 = _mm_mul_ps(y, y);
+
+        __m128 s = _mm_add_ps(_mm_set1_ps(Sin4), _mm_mul_ps(y2, _mm_set1_ps(Sin5)));
+        s = _mm_add_ps(_mm_set1_ps(Sin3), _mm_mul_ps(y2, s));
+        s = _mm_add_ps(_mm_set1_ps(Sin2), _mm_mul_ps(y2, s));
+        s = _mm_add_ps(_mm_set1_ps(Sin1), _mm_mul_ps(y2, s));
+        s = _mm_add_ps(y, _mm_mul_ps(_mm_mul_ps(y, y2), s));
+
+        __m128 c = _mm_add_ps(_mm_set1_ps(Cos4), _mm_mul_ps(y2, _mm_set1_ps(Cos5)));
+        c = _mm_add_ps(_mm_set1_ps(Cos3), _mm_mul_ps(y2, c));
+        c = _mm_add_ps(_mm_set1_ps(Cos2), _mm_mul_ps(y2, c));
+        c = _mm_add_ps(_mm_set1_ps(Cos1), _mm_mul_ps(y2, c));
+        c = _mm_add_ps(_mm_set1_ps(1.f), _mm_mul_ps(y2, c));
+
+        sin = Negate(s);
+        cos = Select(_mm_or_ps(above, below), c, Negate(c));
+    }
+
+    TARGET_ISA("sse2")
+    usize SpawnCircleSse2(const CircleParameters& p, f32* offsetX, f32* offsetY, f32* directionX, f32* directionY, const usize count)
+    {
+        const __m128 inner = _mm_set1_ps(p.inner);
+        const __m128 outer = _mm_set1_ps(p.outer);
+        const __m128 arcAngle = _mm_set1_ps(p.arcAngle);
+        const __m128 cosRotation = _mm_set1_ps(p.cosRotation);
+        const __m128 sinRotation = _mm_set1_ps(p.sinRotation);
+        const __m128 scaleX = _mm_set1_ps(p.scale.x);
+        const __m128 scaleY = _mm_set1_ps(p.scale.y);
+        const __m128 positionX = _mm_set1_ps(p.offset.x);
+        const __m128 positionY = _mm_set1_ps(p.offset.y);
+
+        __m128i seedsA = StreamSeeds(p.seed, StreamA);
+        __m128i seedsB = StreamSeeds(p.seed, StreamB);
+        const __m128i stepA = StreamStep(StreamA);
+        const __m128i stepB = StreamStep(StreamB);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 angle = _mm_mul_ps(RandomSse2(seedsA), arcAngle);
+            const __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_sqrt_ps(RandomSse2(seedsB)), inner), outer);
+
+            __m128 sin, cos;
+            SinCosSse2(angle, sin, cos);
+
+            const __m128 x = _mm_sub_ps(_mm_mul_ps(cos, cosRotation), _mm_mul_ps(sin, sinRotation));
+            const __m128 y = _mm_add_ps(_mm_mul_ps(cos, sinRotation), _mm_mul_ps(sin, cosRotation));
+
+            _mm_storeu_ps(directionX + i, x);
+            _mm_storeu_ps(directionY + i, y);
+            _mm_storeu_ps(offsetX + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, distance), scaleX), positionX));
+            _mm_storeu_ps(offsetY + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, distance), scaleY), positionY));
+
+            seedsA = _mm_add_epi32(seedsA, stepA);
+            seedsB = _mm_add_epi32(seedsB, stepB);
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize SpawnRectangleSse2(const RectangleParameters& p, f32* offsetX, f32* offsetY, f32* directionX, f32* directionY, const usize count)
+    {
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 limit = _mm_set1_ps(p.limit);
+        const __m128 halfLimit = _mm_set1_ps(p.halfLimit);
+        const __m128 upperLimit = _mm_set1_ps(p.upperLimit);
+        const __m128 halfThicknessX = _mm_set1_ps(p.halfThickness.x);
+        const __m128 halfThicknessY = _mm_set1_ps(p.halfThickness.y);
+        const __m128 innerWidth = _mm_set1_ps(p.innerWidth);
+        const __m128 cosRotation = _mm_set1_ps(p.cosRotation);
+        const __m128 sinRotation = _mm_set1_ps(p.sinRotation);
+        const __m128 scaleX = _mm_set1_ps(p.scale.x);
+        const __m128 scaleY = _mm_set1_ps(p.scale.y);
+        const __m128 positionX = _mm_set1_ps(p.offset.x);
+        const __m128 positionY = _mm_set1_ps(p.offset.y);
+        const __m128 defaultDirectionY = _mm_set1_ps(-1.f);
+
+        __m128i seedsA = StreamSeeds(p.seed, StreamA);
+        __m128i seedsB = StreamSeeds(p.seed, StreamB);
+        __m128i seedsC = StreamSeeds(p.seed, StreamC);
+        const __m128i stepA = StreamStep(StreamA);
+        const __m128i stepB = StreamStep(StreamB);
+        const __m128i stepC = StreamStep(StreamC);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 choice = RandomSse2(seedsA);
+            const __m128 u = RandomSse2(seedsB);
+            const __m128 v = RandomSse2(seedsC);
+
+            const __m128 side = _mm_cmple_ps(choice, limit);
+            const __m128 sideX = _mm_sub_ps(_mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(u, one), halfThicknessX)), half);
+            const __m128 bottomX = _mm_mul_ps(_mm_sub_ps(u, half), innerWidth);
+            const __m128 sideY = _mm_sub_ps(v, half);
+            const __m128 bottomY = _mm_sub_ps(_mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(v, one), halfThicknessY)), half);
+            const __m128 flip = Select(side, _mm_cmple_ps(choice, halfLimit), _mm_cmpge_ps(choice, upperLimit));
+            const __m128 sign = _mm_and_ps(flip, _mm_set1_ps(-0.f));
+
+            const __m128 x = _mm_mul_ps(_mm_xor_ps(Select(side, sideX, bottomX), sign), scaleX);
+            const __m128 y = _mm_mul_ps(_mm_xor_ps(Select(side, sideY, bottomY), sign), scaleY);
+
+            const __m128 rotatedX = _mm_sub_ps(_mm_mul_ps(x, cosRotation), _mm_mul_ps(y, sinRotation));
+            const __m128 rotatedY = _mm_add_ps(_mm_mul_ps(x, sinRotation), _mm_mul_ps(y, cosRotation));
+
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(rotatedX, rotatedX), _mm_mul_ps(rotatedY, rotatedY)));
+            const __m128 valid = _mm_cmpgt_ps(length, zero);
+            const __m128 safeLength = Select(valid, length, one);
+
+            _mm_storeu_ps(directionX + i, Select(valid, _mm_div_ps(rotatedX, safeLength), zero));
+            _mm_storeu_ps(directionY + i, Select(valid, _mm_div_ps(rotatedY, safeLength), defaultDirectionY));
+            _mm_storeu_ps(offsetX + i, _mm_add_ps(rotatedX, positionX));
+            _mm_storeu_ps(offsetY + i, _mm_add_ps(rotatedY, positionY));
+
+            seedsA = _mm_add_epi32(seedsA, stepA);
+            seedsB = _mm_add_epi32(seedsB, stepB);
+            seedsC = _mm_add_epi32(seedsC, stepC);
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize AgeSse2(f32* lifetimes, f32* progress, const usize count, const f32 deltaTime, const f32 lifetime)
+    {
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 total = _mm_set1_ps(lifetime);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 remaining = _mm_sub_ps(_mm_loadu_ps(lifetimes + i), dt);
+            _mm_storeu_ps(lifetimes + i, remaining);
+            _mm_storeu_ps(progress + i, _mm_sub_ps(one, _mm_div_ps(remaining, total)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize AgeAvx2(f32* lifetimes, f32* progress, const usize count, const f32 deltaTime, const f32 lifetime)
+    {
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        const __m256 total = _mm256_set1_ps(lifetime);
+
+        usize i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 remaining = _mm256_sub_ps(_mm256_loadu_ps(lifetimes + i), dt);
+            _mm256_storeu_ps(lifetimes + i, remaining);
+            _mm256_storeu_ps(progress + i, _mm256_sub_ps(one, _mm256_div_ps(remaining, total)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize LerpAddSse2(const f32* factors, const Vector2 min, const Vector2 delta, const f32 scale, f32* x, f32* y, const usize count)
+    {
+        const __m128 minX = _mm_set1_ps(min.x);
+        const __m128 minY = _mm_set1_ps(min.y);
+        const __m128 deltaX = _mm_set1_ps(delta.x);
+        const __m128 deltaY = _mm_set1_ps(delta.y);
+        const __m128 s = _mm_set1_ps(scale);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 factor = _mm_loadu_ps(factors + i);
+            _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_add_ps(minX, _mm_mul_ps(deltaX, factor)), s)));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_add_ps(minY, _mm_mul_ps(deltaY, factor)), s)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize LerpAddAvx2(const f32* factors, const Vector2 min, const Vector2 delta, const f32 scale, f32* x, f32* y, const usize count)
+    {
+        const __m256 minX = _mm256_set1_ps(min.x);
+        const __m256 minY = _mm256_set1_ps(min.y);
+        const __m256 deltaX = _mm256_set1_ps(delta.x);
+        const __m256 deltaY = _mm256_set1_ps(delta.y);
+        const __m256 s = _mm256_set1_ps(scale);
+
+        usize i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 factor = _mm256_loadu_ps(factors + i);
+            _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(_mm256_add_ps(minX, _mm256_mul_ps(deltaX, factor)), s)));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_add_ps(minY, _mm256_mul_ps(deltaY, factor)), s)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize LerpMultiplySse2(const f32* factors, const Color& min, const Color& delta, f32* r, f32* g, f32* b, f32* a, const usize count)
+    {
+        const __m128 minR = _mm_set1_ps(min.r), minG = _mm_set1_ps(min.g), minB = _mm_set1_ps(min.b), minA = _mm_set1_ps(min.a);
+        const __m128 deltaR = _mm_set1_ps(delta.r), deltaG = _mm_set1_ps(delta.g), deltaB = _mm_set1_ps(delta.b), deltaA = _mm_set1_ps(delta.a);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 factor = _mm_loadu_ps(factors + i);
+            _mm_storeu_ps(r + i, _mm_mul_ps(_mm_loadu_ps(r + i), _mm_add_ps(minR, _mm_mul_ps(deltaR, factor))));
+            _mm_storeu_ps(g + i, _mm_mul_ps(_mm_loadu_ps(g + i), _mm_add_ps(minG, _mm_mul_ps(deltaG, factor))));
+            _mm_storeu_ps(b + i, _mm_mul_ps(_mm_loadu_ps(b + i), _mm_add_ps(minB, _mm_mul_ps(deltaB, factor))));
+            _mm_storeu_ps(a + i, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_add_ps(minA, _mm_mul_ps(deltaA, factor))));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize LerpMultiplyAvx2(const f32* factors, const Color& min, const Color& delta, f32* r, f32* g, f32* b, f32* a, const usize count)
+    {
+        const __m256 minR = _mm256_set1_ps(min.r), minG = _mm256_set1_ps(min.g), minB = _mm256_set1_ps(min.b), minA = _mm256_set1_ps(min.a);
+        const __m256 deltaR = _mm256_set1_ps(delta.r), deltaG = _mm256_set1_ps(delta.g), deltaB = _mm256_set1_ps(delta.b), deltaA = _mm256_set1_ps(delta.a);
+
+        usize i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 factor = _mm256_loadu_ps(factors + i);
+            _mm256_storeu_ps(r + i, _mm256_mul_ps(_mm256_loadu_ps(r + i), _mm256_add_ps(minR, _mm256_mul_ps(deltaR, factor))));
+            _mm256_storeu_ps(g + i, _mm256_mul_ps(_mm256_loadu_ps(g + i), _mm256_add_ps(minG, _mm256_mul_ps(deltaG, factor))));
+            _mm256_storeu_ps(b + i, _mm256_mul_ps(_mm256_loadu_ps(b + i), _mm256_add_ps(minB, _mm256_mul_ps(deltaB, factor))));
+            _mm256_storeu_ps(a + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_add_ps(minA, _mm256_mul_ps(deltaA, factor))));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize SpeedFactorSse2(const f32* velocityX, const f32* velocityY, const f32 min, const f32 scale, f32* factors, const usize count)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 minimum = _mm_set1_ps(min);
+        const __m128 s = _mm_set1_ps(scale);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(velocityX + i);
+            const __m128 y = _mm_loadu_ps(velocityY + i);
+            const __m128 factor = _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), minimum), s);
+            _mm_storeu_ps(factors + i, _mm_min_ps(_mm_max_ps(factor, zero), one));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize SpeedFactorAvx2(const f32* velocityX, const f32* velocityY, const f32 min, const f32 scale, f32* factors, const usize count)
+    {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 minimum = _mm256_set1_ps(min);
+        const __m256 s = _mm256_set1_ps(scale);
+
+        usize i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(velocityX + i);
+            const __m256 y = _mm256_loadu_ps(velocityY + i);
+            const __m256 factor = _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), minimum), s);
+            _mm256_storeu_ps(factors + i, _mm256_min_ps(_mm256_max_ps(factor, zero), one));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("sse2")
+    usize IntegrateSse2(
+        const f32* velocityX,
+        const f32* velocityY,
+        const f32* accumulatedVelocityX,
+        const f32* accumulatedVelocityY,
+        const f32 deltaTime,
+        f32* offsetX,
+        f32* offsetY,
+        const usize count
+    )
+    {
+        const __m128 dt = _mm_set1_ps(deltaTime);
+
+        usize i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 x = _mm_add_ps(_mm_loadu_ps(velocityX + i), _mm_loadu_ps(accumulatedVelocityX + i));
+            const __m128 y = _mm_add_ps(_mm_loadu_ps(velocityY + i), _mm_loadu_ps(accumulatedVelocityY + i));
+            _mm_storeu_ps(offsetX + i, _mm_add_ps(_mm_loadu_ps(offsetX + i), _mm_mul_ps(x, dt)));
+            _mm_storeu_ps(offsetY + i, _mm_add_ps(_mm_loadu_ps(offsetY + i), _mm_mul_ps(y, dt)));
+        }
+
+        return i;
+    }
+
+    TARGET_ISA("avx2")
+    usize IntegrateAvx2(
+        const f32* velocityX,
+        const f32* velocityY,
+        const f32* accumulatedVelocityX,
+        const f32* accumulatedVelocityY,
+        const f32 deltaTime,
+        f32* offsetX,
+        f32* offsetY,
+        const usize count
+    )
+    {
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+
+        usize i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 x = _mm256_add_ps(_mm256_loadu_ps(velocityX + i), _mm256_loadu_ps(accumulatedVelocityX + i));
+            const __m256 y = _mm256_add_ps(_mm256_loadu_ps(velocityY + i), _mm256_loadu_ps(accumulatedVelocityY + i));
+            _mm256_storeu_ps(offsetX + i, _mm256_add_ps(_mm256_loadu_ps(offsetX + i), _mm256_mul_ps(x, dt)));
+            _mm256_storeu_ps(offsetY + i, _mm256_add_ps(_mm256_loadu_ps(offsetY + i), _mm256_mul_ps(y, dt)));
+        }
+
+        return i;
+    }
+#endif
+}
+
+void ParticleKernels::SpawnCircle(
+    const u32 seed,
+    const f32 radius,
+    const f32 radiusThickness,
+    const f32 arcAngle,
+    const f32 rotation,
+    const Vector2 scale,
+    const Vector2 offset,
+    f32* offsetX,
+    f32* offsetY,
+    f32* directionX,
+    f32* directionY,
+    const usize count
+)
+{
+    const CircleParameters parameters{
+        .seed = seed,
+        .inner = radius * radiusThickness,
+        .outer = radius * (1.f - radiusThickness),
+        .arcAngle = std::clamp(arcAngle, 0.f, Calc::TwoPi),
+        .cosRotation = std::cos(rotation),
+        .sinRotation = std::sin(rotation),
+        .scale = scale,
+        .offset = offset
+    };
+
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2:
+        case SimdLevel::Sse2: i = SpawnCircleSse2(parameters, offsetX, offsetY, directionX, directionY, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    SpawnCircleScalar(parameters, offsetX, offsetY, directionX, directionY, i, count);
+}
+
+void ParticleKernels::SpawnRectangle(
+    const u32 seed,
+    const Vector2 scaleThickness,
+    const f32 rotation,
+    const Vector2 scale,
+    const Vector2 offset,
+    f32* offsetX,
+    f32* offsetY,
+    f32* directionX,
+    f32* directionY,
+    const usize count
+)
+{
+    // The right side covers the whole height, and the bottom side the remaining width
+    const f32 sideArea = scaleThickness.x;
+    const f32 bottomArea = scaleThickness.y * (1.f - scaleThickness.x);
+    const f32 totalArea = sideArea + bottomArea;
+    const f32 limit = totalArea > 0.f ? sideArea / totalArea : 1.f;
+
+    const RectangleParameters parameters{
+        .seed = seed,
+        .limit = limit,
+        .halfLimit = limit * 0.5f,
+        .upperLimit = (1.f + limit) * 0.5f,
+        .halfThickness = scaleThickness * 0.5f,
+        .innerWidth = 1.f - scaleThickness.x,
+        .cosRotation = std::cos(rotation),
+        .sinRotation = std::sin(rotation),
+        .scale = scale,
+        .offset = offset
+    };
+
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2:
+        case SimdLevel::Sse2: i = SpawnRectangleSse2(parameters, offsetX, offsetY, directionX, directionY, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    SpawnRectangleScalar(parameters, offsetX, offsetY, directionX, directionY, i, count);
+}
+
+void ParticleKernels::Age(f32* lifetimes, f32* progress, const usize count, const f32 deltaTime, const f32 lifetime)
+{
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = AgeAvx2(lifetimes, progress, count, deltaTime, lifetime); break;
+        case SimdLevel::Sse2: i = AgeSse2(lifetimes, progress, count, deltaTime, lifetime); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        lifetimes[i] -= deltaTime;
+        progress[i] = 1.f - lifetimes[i] / lifetime;
+    }
+}
+
+void ParticleKernels::Ease(const Easing::Type type, f32* values, const usize count)
+{
+    if (type == Easing::Type::Linear)
+        return;
+
+    const Easing::Easer easer = Easing::FromType(type);
+    for (usize i = 0; i < count; i++)
+        values[i] = easer(values[i]);
+}
+
+void ParticleKernels::LerpAdd(const f32* factors, const Vector2 min, const Vector2 max, const f32 scale, f32* x, f32* y, const usize count)
+{
+    const Vector2 delta = max - min;
+
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = LerpAddAvx2(factors, min, delta, scale, x, y, count); break;
+        case SimdLevel::Sse2: i = LerpAddSse2(factors, min, delta, scale, x, y, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        x[i] += (min.x + delta.x * factors[i]) * scale;
+        y[i] += (min.y + delta.y * factors[i]) * scale;
+    }
+}
+
+void ParticleKernels::LerpMultiply(const f32* factors, const Color& min, const Color& max, f32* r, f32* g, f32* b, f32* a, const usize count)
+{
+    const Color delta{max.r - min.r, max.g - min.g, max.b - min.b, max.a - min.a};
+
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = LerpMultiplyAvx2(factors, min, delta, r, g, b, a, count); break;
+        case SimdLevel::Sse2: i = LerpMultiplySse2(factors, min, delta, r, g, b, a, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        r[i] *= min.r + delta.r * factors[i];
+        g[i] *= min.g + delta.g * factors[i];
+        b[i] *= min.b + delta.b * factors[i];
+        a[i] *= min.a + delta.a * factors[i];
+    }
+}
+
+void ParticleKernels::SpeedFactor(const f32* velocityX, const f32* velocityY, const f32 speedMin, const f32 speedMax, f32* factors, const usize count)
+{
+    const f32 min = speedMin * speedMin;
+    const f32 range = speedMax * speedMax - min;
+    // With an empty range, the factor is 0 below the minimum speed and 1 from it
+    const f32 scale = range > 0.f ? 1.f / range : std::numeric_limits<f32>::max();
+
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = SpeedFactorAvx2(velocityX, velocityY, min, scale, factors, count); break;
+        case SimdLevel::Sse2: i = SpeedFactorSse2(velocityX, velocityY, min, scale, factors, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const f32 factor = (velocityX[i] * velocityX[i] + velocityY[i] * velocityY[i] - min) * scale;
+        factors[i] = std::min(std::max(factor, 0.f), 1.f);
+    }
+}
+
+void ParticleKernels::Integrate(
+    const f32* velocityX,
+    const f32* velocityY,
+    const f32* accumulatedVelocityX,
+    const f32* accumulatedVelocityY,
+    const f32 deltaTime,
+    f32* offsetX,
+    f32* offsetY,
+    const usize count
+)
+{
+    usize i = 0;
+
+#ifdef ARCHITECTURE_X64
+    switch (Simd::GetLevel())
+    {
+        case SimdLevel::Avx2: i = IntegrateAvx2(velocityX, velocityY, accumulatedVelocityX, accumulatedVelocityY, deltaTime, offsetX, offsetY, count); break;
+        case SimdLevel::Sse2: i = IntegrateSse2(velocityX, velocityY, accumulatedVelocityX, accumulatedVelocityY, deltaTime, offsetX, offsetY, count); break;
+        case SimdLevel::None: break;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        offsetX[i] += (velocityX[i] + accumulatedVelocityX[i]) * deltaTime;
+        offsetY[i] += (velocityY[i] + accumulatedVelocityY[i]) * deltaTime;
+    }
+}
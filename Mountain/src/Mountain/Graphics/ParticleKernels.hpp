@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Math/Vector2.hpp"
+#include "Mountain/Utils/Color.hpp"
+#include "Mountain/Utils/Utils.hpp"
+
+/// @file ParticleKernels.hpp
+/// @brief Defines the Mountain::ParticleKernels class.
+
+namespace Mountain
+{
+    /// @brief Static class containing the particle update functions of the @c ParticleSimulation.
+    /// @details The functions work on structure-of-arrays particle data, i.e. a separate array for each component of the
+    /// particles, and have SSE2 and AVX2 versions chosen depending on @c Simd::GetLevel(). The spawning functions only have
+    /// an SSE2 version since they only run on the particles spawned in the frame.
+    ///
+    /// All the versions give the exact same results, so a simulation doesn't depend on the CPU it runs on.
+    class ParticleKernels
+    {
+        STATIC_CLASS(ParticleKernels)
+
+    public:
+        /// @brief Spawns particles in a circle arc, as done by the @c ParticleSystemModules::Shape module.
+        /// @param seed The seed of the random positions, particle @c i using the seed @c seed + @c i.
+        /// @param radius The radius of the circle.
+        /// @param radiusThickness The part of the radius in which the particles spawn, from the edge of the circle.
+        /// @param arcAngle The angle of the arc in radians, in the range [0, 2pi].
+        /// @param rotation The rotation of the arc in radians.
+        /// @param scale The scale applied to the positions.
+        /// @param offset The offset added to the positions after scaling them.
+        /// @param offsetX The X position of each particle.
+        /// @param offsetY The Y position of each particle.
+        /// @param directionX The X component of the normalized start direction of each particle.
+        /// @param directionY The Y component of the normalized start direction of each particle.
+        /// @param count The number of particles to spawn.
+        MOUNTAIN_API static void SpawnCircle(
+            u32 seed,
+            f32 radius,
+            f32 radiusThickness,
+            f32 arcAngle,
+            f32 rotation,
+            Vector2 scale,
+            Vector2 offset,
+            f32* offsetX,
+            f32* offsetY,
+            f32* directionX,
+            f32* directionY,
+            usize count
+        );
+
+        /// @brief Spawns particles in a rectangle centered on the origin, as done by the @c ParticleSystemModules::Shape module.
+        /// @param seed The seed of the random positions, particle @c i using the seed @c seed + @c i.
+        /// @param scaleThickness The part of the size in which the particles spawn on each axis, from the edges of the rectangle.
+        /// @param rotation The rotation of the rectangle in radians.
+        /// @param scale The size of the rectangle.
+        /// @param offset The offset added to the positions after scaling and rotating them.
+        /// @param offsetX The X position of each particle.
+        /// @param offsetY The Y position of each particle.
+        /// @param directionX The X component of the normalized start direction of each particle.
+        /// @param directionY The Y component of the normalized start direction of each particle.
+        /// @param count The number of particles to spawn.
+        MOUNTAIN_API static void SpawnRectangle(
+            u32 seed,
+            Vector2 scaleThickness,
+            f32 rotation,
+            Vector2 scale,
+            Vector2 offset,
+            f32* offsetX,
+            f32* offsetY,
+            f32* directionX,
+            f32* directionY,
+            usize count
+        );
+
+        /// @brief Subtracts @p deltaTime from the remaining lifetime of the particles and computes how far they are in their life.
+        /// @param lifetimes The remaining lifetime of each particle, updated in place.
+        /// @param progress The progress of each particle, from 0 when it spawns to 1 when it dies.
+        /// @param count The number of particles.
+        /// @param deltaTime The time elapsed since the last update.
+        /// @param lifetime The total lifetime of the particles.
+        MOUNTAIN_API static void Age(f32* lifetimes, f32* progress, usize count, f32 deltaTime, f32 lifetime);
+
+        /// @brief Applies the easing function @p type to each of the @p count @p values.
+        /// @details The easing functions are called one by one, except @c Easing::Type::Linear which doesn't change anything.
+        MOUNTAIN_API static void Ease(Easing::Type type, f32* values, usize count);
+
+        /// @brief Adds the linear interpolation between @p min and @p max multiplied by @p scale to vectors.
+        /// @param factors The interpolation factor of each vector.
+        /// @param min The value for a factor of 0.
+        /// @param max The value for a factor of 1.
+        /// @param scale The value to multiply the interpolated values by.
+        /// @param x The X component of each vector.
+        /// @param y The Y component of each vector.
+        /// @param count The number of vectors.
+        MOUNTAIN_API static void LerpAdd(const f32* factors, Vector2 min, Vector2 max, f32 scale, f32* x, f32* y, usize count);
+
+        /// @brief Multiplies colors by the linear interpolation between @p min and @p max.
+        /// @param factors The interpolation factor of each color.
+        /// @param min The value for a factor of 0.
+        /// @param max The value for a factor of 1.
+        /// @param r The red component of each color.
+        /// @param g The green component of each color.
+        /// @param b The blue component of each color.
+        /// @param a The alpha component of each color.
+        /// @param count The number of colors.
+        MOUNTAIN_API static void LerpMultiply(const f32* factors, const Color& min, const Color& max, f32* r, f32* g, f32* b, f32* a, usize count);
+
+        /// @brief Computes where the speed of each particle is between @p speedMin and @p speedMax.
+        /// @details As in the compute shader, this uses the squared speeds, so the result isn't linear in the speed.
+        /// @param velocityX The X velocity of each particle.
+        /// @param velocityY The Y velocity of each particle.
+        /// @param speedMin The speed giving a factor of 0.
+        /// @param speedMax The speed giving a factor of 1.
+        /// @param factors The factor of each particle, in the range [0, 1].
+        /// @param count The number of particles.
+        MOUNTAIN_API static void SpeedFactor(const f32* velocityX, const f32* velocityY, f32 speedMin, f32 speedMax, f32* factors, usize count);
+
+        /// @brief Moves the particles by their velocity.
+        /// @param velocityX The X velocity of each particle.
+        /// @param velocityY The Y velocity of each particle.
+        /// @param accumulatedVelocityX The X velocity accumulated by the forces applied to each particle.
+        /// @param accumulatedVelocityY The Y velocity accumulated by the forces applied to each particle.
+        /// @param deltaTime The time elapsed since the last update.
+        /// @param offsetX The X position of each particle.
+        /// @param offsetY The Y position of each particle.
+        /// @param count The number of particles.
+        MOUNTAIN_API static void Integrate(
+            const f32* velocityX,
+            const f32* velocityY,
+            const f32* accumulatedVelocityX,
+            const f32* accumulatedVelocityY,
+            f32 deltaTime,
+            f32* offsetX,
+            f32* offsetY,
+            usize count
+        );
+    };
+}
@@ -0,0 +1,275 @@
+#include "Mountain/Graphics/ParticleSimulation.hpp"
+
+#include "Mountain/Graphics/ParticleKernels.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    /// @brief The start velocity of the particles when the Shape module is disabled, as in the compute shader.
+    constexpr Vector2 DefaultStartVelocity = { 0.f, -1.f };
+
+    /// @brief Calls @p function with each component list of @p data.
+    template <typename FunctionT>
+    void ForEachComponent(ParticleData& data, FunctionT&& function)
+    {
+        function(data.lifetime);
+        function(data.size);
+        function(data.startVelocityX);
+        function(data.startVelocityY);
+        function(data.offsetX);
+        function(data.offsetY);
+        function(data.accumulatedVelocityX);
+        function(data.accumulatedVelocityY);
+        function(data.colorR);
+        function(data.colorG);
+        function(data.colorB);
+        function(data.colorA);
+    }
+
+    void Fill(List<f32>& list, const usize begin, const usize end, const f32 value) { std::fill(list.GetData() + begin, list.GetData() + end, value); }
+}
+
+ParticleSimulation::ParticleSimulation(const u32 maxParticles, const u32 seed)
+    : m_Seed(seed)
+{
+    SetMaxParticles(maxParticles);
+}
+
+void ParticleSimulation::SetMaxParticles(const u32 newMaxParticles)
+{
+    m_MaxParticles = newMaxParticles;
+    m_ParticleCount = 0;
+
+    ForEachComponent(m_Particles, [&](List<f32>& component) { component.Resize(newMaxParticles); });
+    m_VelocityX.Resize(newMaxParticles);
+    m_VelocityY.Resize(newMaxParticles);
+    m_Progress.Resize(newMaxParticles);
+    m_Factors.Resize(newMaxParticles);
+}
+
+void ParticleSimulation::Clear() { m_ParticleCount = 0; }
+
+void ParticleSimulation::Update(const f32 deltaTime, const ParticleSimulationSettings& settings, const u32 spawnCount)
+{
+    ZoneScoped;
+
+    // Like in the compute shader, the particles that died in the last update are removed before spawning new ones, so
+    // that they are still drawn once with a lifetime that reached 0
+    RemoveDeadParticles();
+
+    if (spawnCount > 0)
+        Spawn(spawnCount, settings);
+
+    const usize count = m_ParticleCount;
+    if (count == 0)
+        return;
+
+    ParticleData& p = m_Particles;
+
+    ParticleKernels::Age(p.lifetime.GetData(), m_Progress.GetData(), count, deltaTime, settings.lifetime);
+
+    std::copy_n(p.startVelocityX.GetData(), count, m_VelocityX.GetData());
+    std::copy_n(p.startVelocityY.GetData(), count, m_VelocityY.GetData());
+    Fill(p.size, 0, count, settings.startSize);
+    Fill(p.colorR, 0, count, settings.startColor.r);
+    Fill(p.colorG, 0, count, settings.startColor.g);
+    Fill(p.colorB, 0, count, settings.startColor.b);
+    Fill(p.colorA, 0, count, settings.startColor.a);
+
+    if (const ParticleSystemModules::VelocityOverLifetime* module = settings.velocityOverLifetime)
+    {
+        const f32* factors = EaseProgress(module->easingType);
+        ParticleKernels::LerpAdd(factors, module->velocityMin, module->velocityMax, 1.f, m_VelocityX.GetData(), m_VelocityY.GetData(), count);
+    }
+
+    if (const ParticleSystemModules::ForceOverLifetime* module = settings.forceOverLifetime)
+    {
+        const f32* factors = EaseProgress(module->easingType);
+        ParticleKernels::LerpAdd(
+            factors,
+            module->forceMin,
+            module->forceMax,
+            deltaTime,
+            p.accumulatedVelocityX.GetData(),
+            p.accumulatedVelocityY.GetData(),
+            count
+        );
+    }
+
+    if (const ParticleSystemModules::ColorOverLifetime* module = settings.colorOverLifetime)
+    {
+        const f32* factors = EaseProgress(module->easingType);
+        ParticleKernels::LerpMultiply(
+            factors,
+            module->colorMin,
+            module->colorMax,
+            p.colorR.GetData(),
+            p.colorG.GetData(),
+            p.colorB.GetData(),
+            p.colorA.GetData(),
+            count
+        );
+    }
+
+    // The compute shader uses the velocity without the accumulated forces here
+    if (const ParticleSystemModules::ColorBySpeed* module = settings.colorBySpeed)
+    {
+        ParticleKernels::SpeedFactor(m_VelocityX.GetData(), m_VelocityY.GetData(), module->speedMin, module->speedMax, m_Factors.GetData(), count);
+        ParticleKernels::Ease(module->easingType, m_Factors.GetData(), count);
+        ParticleKernels::LerpMultiply(
+            m_Factors.GetData(),
+            module->colorMin,
+            module->colorMax,
+            p.colorR.GetData(),
+            p.colorG.GetData(),
+            p.colorB.GetData(),
+            p.colorA.GetData(),
+            count
+        );
+    }
+
+    ParticleKernels::Integrate(
+        m_VelocityX.GetData(),
+        m_VelocityY.GetData(),
+        p.accumulatedVelocityX.GetData(),
+        p.accumulatedVelocityY.GetData(),
+        deltaTime,
+        p.offsetX.GetData(),
+        p.offsetY.GetData(),
+        count
+    );
+}
+
+void ParticleSimulation::WriteGpuData(u8* output) const
+{
+    ZoneScoped;
+
+    const ParticleData& p = m_Particles;
+    f32* particle = reinterpret_cast<f32*>(output);
+
+    static_assert(GpuParticleSize == 12 * sizeof(f32));
+
+    for (u32 i = 0; i < m_ParticleCount; i++, particle += 12)
+    {
+        particle[0] = p.lifetime[i];
+        particle[1] = p.size[i];
+        particle[2] = p.startVelocityX[i];
+        particle[3] = p.startVelocityY[i];
+        particle[4] = p.offsetX[i];
+        particle[5] = p.offsetY[i];
+        particle[6] = p.accumulatedVelocityX[i];
+        particle[7] = p.accumulatedVelocityY[i];
+        particle[8] = p.colorR[i];
+        particle[9] = p.colorG[i];
+        particle[10] = p.colorB[i];
+        particle[11] = p.colorA[i];
+    }
+}
+
+void ParticleSimulation::RemoveDeadParticles()
+{
+    List<f32>& lifetime = m_Particles.lifetime;
+
+    // Move the last particle in place of each dead one, which is cheaper than keeping the order since few particles die
+    // at each update
+    u32 i = 0;
+    while (i < m_ParticleCount)
+    {
+        if (lifetime[i] > 0.f)
+        {
+            i++;
+            continue;
+        }
+
+        const u32 last = --m_ParticleCount;
+        ForEachComponent(m_Particles, [&](List<f32>& component) { component[i] = component[last]; });
+    }
+}
+
+void ParticleSimulation::Spawn(const u32 count, const ParticleSimulationSettings& settings)
+{
+    const usize begin = m_ParticleCount;
+    const usize end = begin + std::min(count, m_MaxParticles - m_ParticleCount);
+    const usize spawned = end - begin;
+
+    if (spawned == 0)
+        return;
+
+    ParticleData& p = m_Particles;
+
+    Fill(p.lifetime, begin, end, settings.lifetime);
+    Fill(p.accumulatedVelocityX, begin, end, 0.f);
+    Fill(p.accumulatedVelocityY, begin, end, 0.f);
+
+    f32* offsetX = p.offsetX.GetData() + begin;
+    f32* offsetY = p.offsetY.GetData() + begin;
+    f32* directionX = p.startVelocityX.GetData() + begin;
+    f32* directionY = p.startVelocityY.GetData() + begin;
+
+    const ParticleSystemModules::Shape* shape = settings.shape;
+    switch (shape ? shape->type : ParticleSystemModules::ShapeType::Line)
+    {
+        case ParticleSystemModules::ShapeType::Circle:
+            ParticleKernels::SpawnCircle(
+                m_Seed,
+                shape->circle.radius,
+                shape->circle.radiusThickness,
+                shape->circle.arcAngle,
+                shape->rotation,
+                shape->scale,
+                shape->offset,
+                offsetX,
+                offsetY,
+                directionX,
+                directionY,
+                spawned
+            );
+            break;
+
+        case ParticleSystemModules::ShapeType::Rectangle:
+            ParticleKernels::SpawnRectangle(
+                m_Seed,
+                shape->rectangle.scaleThickness,
+                shape->rotation,
+                shape->scale,
+                shape->offset,
+                offsetX,
+                offsetY,
+                directionX,
+                directionY,
+                spawned
+            );
+            break;
+
+        case ParticleSystemModules::ShapeType::Line:
+        {
+            // The compute shader doesn't handle lines yet, so they spawn everything at the offset of the shape
+            const Vector2 offset = shape ? shape->offset : Vector2::Zero();
+            Fill(p.offsetX, begin, end, offset.x);
+            Fill(p.offsetY, begin, end, offset.y);
+            Fill(p.startVelocityX, begin, end, DefaultStartVelocity.x);
+            Fill(p.startVelocityY, begin, end, DefaultStartVelocity.y);
+            break;
+        }
+    }
+
+    for (usize i = 0; i < spawned; i++)
+    {
+        directionX[i] *= settings.speed;
+        directionY[i] *= settings.speed;
+    }
+
+    m_Seed += static_cast<u32>(spawned);
+    m_ParticleCount = static_cast<u32>(end);
+}
+
+const f32* ParticleSimulation::EaseProgress(const Easing::Type easingType)
+{
+    if (easingType == Easing::Type::Linear)
+        return m_Progress.GetData();
+
+    std::copy_n(m_Progress.GetData(), m_ParticleCount, m_Factors.GetData());
+    ParticleKernels::Ease(easingType, m_Factors.GetData(), m_ParticleCount);
+    return m_Factors.GetData();
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Graphics/ParticleSystemModules.hpp"
+#include "Mountain/Utils/Color.hpp"
+
+/// @file ParticleSimulation.hpp
+/// @brief Defines the Mountain::ParticleSimulation class.
+
+namespace Mountain
+{
+    /// @brief The settings of a @c ParticleSystem used by a @c ParticleSimulation.
+    struct ParticleSimulationSettings
+    {
+        f32 lifetime = 5.f;
+        f32 speed = 5.f;
+        Color startColor = Color::White();
+        f32 startSize = 1.f;
+
+        // Each module is ignored if it is nullptr
+
+        const ParticleSystemModules::Shape* shape = nullptr;
+        const ParticleSystemModules::VelocityOverLifetime* velocityOverLifetime = nullptr;
+        const ParticleSystemModules::ForceOverLifetime* forceOverLifetime = nullptr;
+        const ParticleSystemModules::ColorOverLifetime* colorOverLifetime = nullptr;
+        const ParticleSystemModules::ColorBySpeed* colorBySpeed = nullptr;
+    };
+
+    /// @brief The particles of a @c ParticleSimulation, stored as one array per component.
+    /// @details Only the first @c ParticleSimulation::GetParticleCount() elements of each array are alive particles.
+    struct ParticleData
+    {
+        List<f32> lifetime;
+        List<f32> size;
+        List<f32> startVelocityX;
+        List<f32> startVelocityY;
+        List<f32> offsetX;
+        List<f32> offsetY;
+        List<f32> accumulatedVelocityX;
+        List<f32> accumulatedVelocityY;
+        List<f32> colorR;
+        List<f32> colorG;
+        List<f32> colorB;
+        List<f32> colorA;
+    };
+
+    /// @brief Simulates the particles of a @c ParticleSystem on the CPU, the same way as its particle update compute shader.
+    /// @details The particles are stored as structure-of-arrays and updated with the SIMD functions of @c ParticleKernels.
+    /// The alive particles are always packed at the start of the arrays, in no particular order, so the update only goes
+    /// through them.
+    ///
+    /// A simulation doesn't use OpenGL, so different simulations can be updated on different threads at once.
+    class ParticleSimulation
+    {
+    public:
+        /// @brief The size of a particle in the buffer read by the particle draw shaders, i.e. the @c Particle struct of
+        /// @c particles/common.glsl.
+        static constexpr usize GpuParticleSize = 48;
+
+        MOUNTAIN_API explicit ParticleSimulation(u32 maxParticles = 0, u32 seed = 0);
+
+        /// @brief Kills all the particles and sets the maximum particle count.
+        MOUNTAIN_API void SetMaxParticles(u32 newMaxParticles);
+
+        /// @brief Kills all the particles.
+        MOUNTAIN_API void Clear();
+
+        /// @brief Removes the dead particles, spawns new ones and updates all of them.
+        /// @param deltaTime The time elapsed since the last update.
+        /// @param settings The settings of the particle system.
+        /// @param spawnCount The number of particles to spawn, which is limited by the maximum particle count.
+        MOUNTAIN_API void Update(f32 deltaTime, const ParticleSimulationSettings& settings, u32 spawnCount);
+
+        /// @brief Writes the alive particles to @p output in the layout of the particle draw shaders.
+        /// @param output The buffer to write to, which must hold @c GetParticleCount() * @c GpuParticleSize bytes.
+        MOUNTAIN_API void WriteGpuData(u8* output) const;
+
+        GETTER(u32, MaxParticles, m_MaxParticles)
+
+        /// @brief Returns the number of alive particles.
+        GETTER(u32, ParticleCount, m_ParticleCount)
+
+        GETTER(const ParticleData&, Particles, m_Particles)
+
+    private:
+        u32 m_MaxParticles = 0;
+        u32 m_ParticleCount = 0;
+        /// @brief The seed of the next spawned particle, which is incremented for each of them.
+        u32 m_Seed = 0;
+
+        ParticleData m_Particles;
+
+        // Per-frame values that don't need to be kept in the particles
+
+        List<f32> m_VelocityX;
+        List<f32> m_VelocityY;
+        List<f32> m_Progress;
+        List<f32> m_Factors;
+
+        void RemoveDeadParticles();
+
+        void Spawn(u32 count, const ParticleSimulationSettings& settings);
+
+        /// @brief Returns the progress of the particles with the easing function @p easingType applied to it.
+        /// @details This uses @c m_Factors unless @p easingType is @c Easing::Type::Linear, in which case it returns @c m_Progress.
+        const f32* EaseProgress(Easing::Type easingType);
+    };
+}
@@ -2,7 +2,8 @@
 
 #include "Mountain/Graphics/ParticleSystem.hpp"
 
-#include <glad/glad.h>
+#include <cstddef>
+#include <numeric>
 
 #include <imgui_stdlib.h>
 
@@ -11,13 +12,27 @@
 #include "Mountain/Graphics/Renderer.hpp"
 #include "Mountain/Resource/ResourceManager.hpp"
 #include "Mountain/Utils/ImGuiUtils.hpp"
+#include "Mountain/Utils/JobSystem.hpp"
 #include "Mountain/Utils/Random.hpp"
 
 using namespace Mountain;
 
 namespace
 {
-    constexpr usize GpuParticleStructSize = 48;
+    /// @brief The @c IndirectCommands buffer of @c particles/simulation.glsl.
+    struct GpuIndirectCommands
+    {
+        u32 updateDispatch[3] = { 0, 1, 1 };
+        u32 spawnDispatch[3] = { 0, 1, 1 };
+        // Each particle is drawn as one point
+        u32 drawVertexCount = 1;
+        u32 drawInstanceCount = 0;
+        u32 drawFirst = 0;
+        u32 drawBaseInstance = 0;
+    };
+
+    static_assert(sizeof(ParticleSystemGpuCounters) == 5 * sizeof(u32));
+    static_assert(sizeof(GpuIndirectCommands) == 10 * sizeof(u32));
 }
 
 ParticleSystem::ParticleSystem()
@@ -27,15 +42,31 @@ ParticleSystem::ParticleSystem()
 
 // ReSharper disable CppObjectMemberMightNotBeInitialized
 ParticleSystem::ParticleSystem(const u32 maxParticles)
+    : ParticleSystem{maxParticles, ParticleSystemBackend::Gpu}
 {
-    m_UpdateComputeShader = ResourceManager::Get<ComputeShader>(Utils::GetBuiltinShadersPath() + "particles/update.comp");
+}
+
+ParticleSystem::ParticleSystem(const u32 maxParticles, const ParticleSystemBackend backend)
+    : m_Backend{backend}
+    , m_Simulation{0, Random::Instance().UInt()}
+{
+    if (m_Backend == ParticleSystemBackend::Gpu)
+        LoadComputeShaders();
     m_DrawShader = ResourceManager::Get<Shader>(Utils::GetBuiltinShadersPath() + "particles/draw_point");
 
-    m_LiveSsbo.Create();
     m_ParticleSsbo.Create();
+    m_AliveSsbo.Create();
+    m_NextAliveSsbo.Create();
+    m_DeadSsbo.Create();
+    m_CountersSsbo.Create();
+    m_IndirectBuffer.Create();
 
-    m_LiveSsbo.SetDebugName("Particle System Live SSBO");
     m_ParticleSsbo.SetDebugName("Particle System Particle SSBO");
+    m_AliveSsbo.SetDebugName("Particle System Alive SSBO");
+    m_NextAliveSsbo.SetDebugName("Particle System Next Alive SSBO");
+    m_DeadSsbo.SetDebugName("Particle System Dead SSBO");
+    m_CountersSsbo.SetDebugName("Particle System Counters SSBO");
+    m_IndirectBuffer.SetDebugName("Particle System Indirect Buffer");
 
     SetMaxParticles(maxParticles);
 }
@@ -43,20 +74,23 @@ ParticleSystem::ParticleSystem(const u32 maxParticles)
 
 ParticleSystem::~ParticleSystem()
 {
-    glUnmapNamedBuffer(m_LiveSsbo.GetId());
-
-    m_LiveSsbo.Delete();
     m_ParticleSsbo.Delete();
+    m_AliveSsbo.Delete();
+    m_NextAliveSsbo.Delete();
+    m_DeadSsbo.Delete();
+    m_CountersSsbo.Delete();
+    m_IndirectBuffer.Delete();
 }
 
 void ParticleSystem::Update()
 {
-    Update(useUnscaledDeltaTime ? Time::GetDeltaTimeUnscaled() : Time::GetDeltaTime());
+    Update(GetDeltaTime());
 }
 
 void ParticleSystem::Render()
 {
     Draw::Flush();
+    Draw::UpdateFrameUniforms();
 
     m_RenderTargetSize = Renderer::GetCurrentRenderTarget().GetSize();
 
@@ -67,13 +101,9 @@ void ParticleSystem::Render()
         if (m_LastUseTexture != useTexture)
             m_DrawShader = ResourceManager::Get<Shader>(Utils::GetBuiltinShadersPath() + (useTexture ? "particles/draw" : "particles/draw_point"));
 
-        m_DrawShader->SetUniform("particleCount", m_MaxParticles);
-
         if (useTexture)
             m_DrawShader->SetUniform("imageSizeNormalized", m_RendererModule->texture->GetSize() / m_RenderTargetSize);
 
-        m_DrawShader->SetUniform("projection", Draw::m_ProjectionMatrix * Draw::m_CameraMatrix);
-
         m_DrawShader->SetUniform("systemPosition", position);
         m_DrawShader->SetUniform("systemRotation", Vector2{std::cos(rotation), std::sin(rotation)});
 
@@ -82,10 +112,20 @@ void ParticleSystem::Render()
 
         BindVertexArray(Draw::m_ParticleVao);
         m_DrawShader->Use();
-        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, m_LiveSsbo);
+        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, m_AliveSsbo);
         BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 1, m_ParticleSsbo);
 
-        DrawArraysInstanced(Graphics::DrawMode::Points, 0, 1, static_cast<s32>(m_MaxParticles));
+        if (m_Backend == ParticleSystemBackend::Cpu)
+        {
+            DrawArraysInstanced(Graphics::DrawMode::Points, 0, 1, static_cast<s32>(m_Simulation.GetParticleCount()));
+        }
+        else
+        {
+            // The number of particles to draw was written by the last update, so it never needs to be read back
+            BindBuffer(Graphics::BufferType::DrawIndirectBuffer, m_IndirectBuffer);
+            DrawArraysIndirect(Graphics::DrawMode::Points, reinterpret_cast<const void*>(offsetof(GpuIndirectCommands, drawVertexCount)));
+            BindBuffer(Graphics::BufferType::DrawIndirectBuffer, 0);
+        }
 
         BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 1, 0);
         BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, 0);
@@ -138,14 +178,30 @@ void ParticleSystem::RenderImGui()
         if (maxParticles != m_MaxParticles)
             SetMaxParticles(maxParticles);
 
+        ParticleSystemBackend backend = m_Backend;
+        if (ImGui::ComboEnum("Backend", &backend))
+            SetBackend(backend);
+
         ImGuiUtils::PopSeparatorText();
     }
 
     if (ImGuiUtils::PushSeparatorText("System info"))
     {
+        // Reading the count of the GPU backend back waits for the GPU, so it is only done when asked
+        if (m_Backend == ParticleSystemBackend::Cpu)
+            m_GuiCurrentParticles = GetCurrentParticles();
+
+        ImGui::BeginDisabled();
+        ImGui::DragScalar("Current particles", ImGuiDataType_U32, &m_GuiCurrentParticles);
+        ImGui::EndDisabled();
+        if (m_Backend == ParticleSystemBackend::Gpu)
+        {
+            ImGui::SameLine();
+            if (ImGui::Button("Read"))
+                m_GuiCurrentParticles = GetCurrentParticles();
+        }
+
         ImGui::BeginDisabled();
-        u32 currentParticles = GetCurrentParticles();
-        ImGui::DragScalar("Current particles", ImGuiDataType_U32, &currentParticles);
         ImGui::DragFloat("Playback time", &m_PlaybackTime, 1, 0, 0, "%.2f");
         ImGui::EndDisabled();
 
@@ -410,109 +466,156 @@ void ParticleSystem::RemoveModules(const ParticleSystemModules::Types types)
 }
 #pragma endregion
 
-u32 ParticleSystem::GetCurrentParticles()
+void ParticleSystem::UpdateAll(const List<ParticleSystem*>& systems)
 {
-    WaitBufferSync(m_SyncObject);
-    u32 currentParticles = 0;
-    for (u32 i = 0; i < m_MaxParticles; i++)
+    UpdateAllInternal(systems, {});
+}
+
+void ParticleSystem::UpdateAll(const List<ParticleSystem*>& systems, const f32 deltaTime)
+{
+    UpdateAllInternal(systems, deltaTime);
+}
+
+void ParticleSystem::UpdateAllInternal(const List<ParticleSystem*>& systems, const Optional<f32>& deltaTime)
+{
+    ZoneScoped;
+
+    List<ParticleSystem*> cpuSystems;
+
+    for (ParticleSystem* system : systems)
     {
-        if (m_LiveParticles[i])
-            currentParticles++;
+        const f32 systemDeltaTime = deltaTime.ValueOr(system->GetDeltaTime());
+
+        if (system->m_Backend == ParticleSystemBackend::Gpu)
+            system->Update(systemDeltaTime);
+        else if (system->PrepareCpuUpdate(systemDeltaTime))
+            cpuSystems.Add(system);
     }
-    LockBuffer(m_SyncObject);
 
-    return currentParticles;
+    JobSystem::ParallelFor(
+        0,
+        cpuSystems.GetSize(),
+        1,
+        [&](const usize begin, const usize end)
+        {
+            for (usize i = begin; i < end; i++)
+                cpuSystems[i]->SimulateCpu();
+        }
+    );
+
+    for (ParticleSystem* system : cpuSystems)
+        system->UploadCpuParticles();
+}
+
+u32 ParticleSystem::GetCurrentParticles()
+{
+    if (m_Backend == ParticleSystemBackend::Cpu)
+        return m_Simulation.GetParticleCount();
+
+    return ReadGpuCounters().aliveCount;
+}
+
+ParticleSystemGpuCounters ParticleSystem::ReadGpuCounters() const
+{
+    if (m_Backend != ParticleSystemBackend::Gpu)
+        THROW(InvalidOperationException{"Only a ParticleSystem using the GPU backend has GPU counters"});
+
+    // The counters are written by the compute shaders, which isn't visible to a read back without this barrier
+    Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::BufferUpdateBarrier);
+
+    ParticleSystemGpuCounters counters;
+    m_CountersSsbo.GetSubData(0, static_cast<s64>(sizeof(counters)), &counters);
+    return counters;
 }
 
 bool ParticleSystem::IsComplete()
 {
-    return !(looping || m_PlaybackTime - startDelay < duration) && GetCurrentParticles() == 0;
+    return !(looping || m_PlaybackTime - startDelay < duration) && !HasLivingParticles();
 }
 
 void ParticleSystem::SetMaxParticles(const u32 newMaxParticles)
 {
     m_MaxParticles = newMaxParticles;
+    m_GuiCurrentParticles = 0;
 
-    // Set up the GPU particle buffer
-    // This is done in a very archaic way, but most of the time this won't matter anyway
-    // because this function should only be called once per system in a real application
-    {
-        List<u8> emptyData;
-        emptyData.Resize(GpuParticleStructSize * newMaxParticles);
-        for (usize i = 0; i < emptyData.GetSize(); i += GpuParticleStructSize)
-        {
-            f32& lifetime = reinterpret_cast<f32&>(emptyData[i]);
-            lifetime = -std::numeric_limits<f32>::infinity(); // Set the negative infinity flag for the GPU
-        }
-        m_ParticleSsbo.SetData(static_cast<s64>(GpuParticleStructSize * newMaxParticles), emptyData.GetData(), Graphics::BufferUsage::DynamicCopy);
-    }
+    // The particles don't need to be initialized as only the ones in an alive list are ever read
+    m_ParticleSsbo.SetData(static_cast<s64>(ParticleSimulation::GpuParticleSize * newMaxParticles), nullptr, Graphics::BufferUsage::DynamicCopy);
+
+    const s64 listSize = static_cast<s64>(sizeof(u32) * newMaxParticles);
+
+    List<u32> indices;
+    indices.Resize(newMaxParticles);
+    std::iota(indices.GetData(), indices.GetData() + newMaxParticles, 0u);
 
-    if (m_LiveParticles)
+    if (m_Backend == ParticleSystemBackend::Cpu)
     {
-        glUnmapNamedBuffer(m_LiveSsbo.GetId());
+        m_AliveSsbo.SetData(listSize, indices.GetData(), Graphics::BufferUsage::StaticDraw);
 
-        // As we use an immutable buffer to allow buffer mapping,
-        // we need to recreate the buffer back each time we want to change its size.
-        // Usually this should not happen during gameplay though, so it's not that much of a concern.
-        m_LiveSsbo.Recreate();
+        m_Simulation.SetMaxParticles(newMaxParticles);
+        m_SimulationGpuData.Resize(ParticleSimulation::GpuParticleSize * newMaxParticles);
     }
+    else
+    {
+        // Every particle starts in the dead list
+        m_AliveSsbo.SetData(listSize, nullptr, Graphics::BufferUsage::DynamicCopy);
+        m_NextAliveSsbo.SetData(listSize, nullptr, Graphics::BufferUsage::DynamicCopy);
+        m_DeadSsbo.SetData(listSize, indices.GetData(), Graphics::BufferUsage::DynamicCopy);
 
-    const GLsizeiptr aliveSsboSize = static_cast<GLsizeiptr>(sizeof(s32) * newMaxParticles);
-    m_LiveSsbo.SetStorage(
-        aliveSsboSize,
-        nullptr,
-        Graphics::BufferStorageFlags::MapPersistent | Graphics::BufferStorageFlags::MapRead |
-        Graphics::BufferStorageFlags::MapWrite | Graphics::BufferStorageFlags::MapCoherent
-    );
+        const ParticleSystemGpuCounters counters{ .deadCount = newMaxParticles };
+        m_CountersSsbo.SetData(static_cast<s64>(sizeof(counters)), &counters, Graphics::BufferUsage::DynamicCopy);
 
-    m_LiveParticles = static_cast<s32*>(glMapNamedBufferRange(m_LiveSsbo.GetId(), 0, aliveSsboSize, GL_MAP_PERSISTENT_BIT | GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_COHERENT_BIT));
+        constexpr GpuIndirectCommands Commands;
+        m_IndirectBuffer.SetData(static_cast<s64>(sizeof(Commands)), &Commands, Graphics::BufferUsage::DynamicCopy);
 
-    m_UpdateComputeShader->SetUniform("particleCount", newMaxParticles);
+        m_Simulation.SetMaxParticles(0);
+        m_SimulationGpuData.Clear();
+    }
 
     Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::ShaderStorageBarrier);
 }
 
-void ParticleSystem::Update(const f32 deltaTime)
+void ParticleSystem::SetBackend(const ParticleSystemBackend newBackend)
 {
-    if (!m_Playing || m_MaxParticles == 0)
-        return;
+    m_Backend = newBackend;
 
-    if (m_PlaybackTime >= startDelay)
-    {
-        SetComputeShaderUniforms(deltaTime);
+    if (m_Backend == ParticleSystemBackend::Gpu && !m_UpdateComputeShader)
+        LoadComputeShaders();
 
-        u32 shaderEnabledModules = 0;
+    SetMaxParticles(m_MaxParticles); // Reset the buffers
+}
 
-        for (const auto& module : m_Modules)
+void ParticleSystem::Update(const f32 deltaTime)
+{
+    if (m_Backend == ParticleSystemBackend::Cpu)
+    {
+        if (PrepareCpuUpdate(deltaTime))
         {
-            const ParticleSystemModules::Types type = module->GetType();
-            if (enabledModules & type)
-            {
-                module->SetComputeShaderUniforms(*m_UpdateComputeShader);
-                shaderEnabledModules |= type;
-            }
+            SimulateCpu();
+            UploadCpuParticles();
         }
+        return;
+    }
 
-        m_UpdateComputeShader->SetUniform("enabledModules", shaderEnabledModules);
+    if (!m_Playing || m_MaxParticles == 0)
+        return;
 
+    if (m_PlaybackTime >= startDelay)
+    {
         const bool spawning = looping || m_PlaybackTime - startDelay < duration;
 
-        if (!spawning && GetCurrentParticles() == 0)
+        if (!spawning && !HasLivingParticles())
             m_Playing = false;
 
-        // Spawn new particles if necessary
-        if (spawning)
-            SpawnNewParticles();
+        SetComputeShaderUniforms(*m_UpdateComputeShader, deltaTime);
+        SetComputeShaderUniforms(*m_SpawnComputeShader, deltaTime);
 
-        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, m_LiveSsbo);
-        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 1, m_ParticleSsbo);
-
-        m_UpdateComputeShader->Dispatch(m_MaxParticles);
-
-        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 1, 0);
-        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, 0);
+        // The spawn timer lives on the GPU, but the other emission settings depend on things only the CPU knows
+        m_EmitComputeShader->SetUniform("deltaTime", deltaTime);
+        m_EmitComputeShader->SetUniform("spawning", spawning);
+        m_EmitComputeShader->SetUniform("emissionRateOverTime", emissionRateOverTime);
+        m_EmitComputeShader->SetUniform("extraSpawnCount", spawning ? ComputeOverDistanceAndBurstSpawnCount() : 0u);
 
-        m_SpawnTimer -= deltaTime;
+        DispatchGpuUpdate();
     }
 
     m_LastPosition = position;
@@ -521,20 +624,98 @@ void ParticleSystem::Update(const f32 deltaTime)
     m_PlaybackTime += deltaTime;
 }
 
-void ParticleSystem::SetComputeShaderUniforms(const f32 deltaTime) const
+f32 ParticleSystem::GetDeltaTime() const
+{
+    return useUnscaledDeltaTime ? Time::GetDeltaTimeUnscaled() : Time::GetDeltaTime();
+}
+
+void ParticleSystem::LoadComputeShaders()
+{
+    const std::string path = Utils::GetBuiltinShadersPath() + "particles/";
+    m_UpdateComputeShader = ResourceManager::Get<ComputeShader>(path + "update.comp");
+    m_EmitComputeShader = ResourceManager::Get<ComputeShader>(path + "emit.comp");
+    m_SpawnComputeShader = ResourceManager::Get<ComputeShader>(path + "spawn.comp");
+    m_FinishComputeShader = ResourceManager::Get<ComputeShader>(path + "finish.comp");
+}
+
+void ParticleSystem::SetComputeShaderUniforms(const ComputeShader& computeShader, const f32 deltaTime) const
+{
+    // The compute shaders are shared by all the systems, so none of their uniforms can be set only once
+    computeShader.SetUniform("particleCount", m_MaxParticles);
+    computeShader.SetUniform("deltaTime", deltaTime);
+    computeShader.SetUniform("time", m_PlaybackTime); // TODO - Maybe multiply by a random seed
+
+    computeShader.SetUniform("particleLifetime", particleLifetime);
+    computeShader.SetUniform("particleSpeed", particleSpeed);
+    computeShader.SetUniform("particleStartColor", particleStartColor);
+    computeShader.SetUniform("particleStartSize", particleStartSize);
+
+    u32 shaderEnabledModules = 0;
+
+    for (const auto& module : m_Modules)
+    {
+        const ParticleSystemModules::Types type = module->GetType();
+        if (enabledModules & type)
+        {
+            module->SetComputeShaderUniforms(computeShader);
+            shaderEnabledModules |= type;
+        }
+    }
+
+    computeShader.SetUniform("enabledModules", shaderEnabledModules);
+}
+
+void ParticleSystem::DispatchGpuUpdate()
 {
-    m_UpdateComputeShader->SetUniform("deltaTime", deltaTime);
-    m_UpdateComputeShader->SetUniform("time", m_PlaybackTime); // TODO - Maybe multiply by a random seed
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 0, m_AliveSsbo);
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 1, m_ParticleSsbo);
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 2, m_NextAliveSsbo);
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 3, m_DeadSsbo);
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 4, m_CountersSsbo);
+    BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, 5, m_IndirectBuffer);
+    BindBuffer(Graphics::BufferType::DispatchIndirectBuffer, m_IndirectBuffer);
+
+    // Each pass reads the counters written by the previous one, and the indirect commands read their work group counts
+    // from the buffer as well
+
+    m_UpdateComputeShader->DispatchIndirect(offsetof(GpuIndirectCommands, updateDispatch));
+    Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::ShaderStorageBarrier);
+
+    m_EmitComputeShader->Dispatch();
+    Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::ShaderStorageBarrier | Graphics::MemoryBarrierFlags::CommandBarrier);
+
+    m_SpawnComputeShader->DispatchIndirect(offsetof(GpuIndirectCommands, spawnDispatch));
+    Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::ShaderStorageBarrier);
+
+    m_FinishComputeShader->Dispatch();
+    Graphics::MemoryBarrier(Graphics::MemoryBarrierFlags::ShaderStorageBarrier | Graphics::MemoryBarrierFlags::CommandBarrier);
+
+    BindBuffer(Graphics::BufferType::DispatchIndirectBuffer, 0);
+    for (u32 i = 0; i <= 5; i++)
+        BindBufferBase(Graphics::BufferType::ShaderStorageBuffer, i, 0);
+
+    // The list written by this update holds the particles to draw and to update next time
+    std::swap(m_AliveSsbo, m_NextAliveSsbo);
+}
+
+bool ParticleSystem::HasLivingParticles() const
+{
+    if (m_Backend == ParticleSystemBackend::Cpu)
+        return m_Simulation.GetParticleCount() > 0;
 
-    m_UpdateComputeShader->SetUniform("particleLifetime", particleLifetime);
-    m_UpdateComputeShader->SetUniform("particleSpeed", particleSpeed);
-    m_UpdateComputeShader->SetUniform("particleStartColor", particleStartColor);
-    m_UpdateComputeShader->SetUniform("particleStartSize", particleStartSize);
+    // Reading the particle count back would wait for the GPU, but no particle can outlive the end of the emission by more
+    // than its lifetime
+    return looping || m_PlaybackTime - startDelay - duration <= particleLifetime;
 }
 
-void ParticleSystem::SpawnNewParticles()
+u32 ParticleSystem::ComputeSpawnCount()
 {
-    u32 overTimeCount = 0, overDistanceCount = 0, burstCount = 0;
+    return ComputeOverTimeSpawnCount() + ComputeOverDistanceAndBurstSpawnCount();
+}
+
+u32 ParticleSystem::ComputeOverTimeSpawnCount()
+{
+    u32 overTimeCount = 0;
     if (m_SpawnTimer <= 0.f && emissionRateOverTime > 0.f)
     {
         const f64 spawnDelay = 1.0 / static_cast<f64>(emissionRateOverTime);
@@ -542,6 +723,13 @@ void ParticleSystem::SpawnNewParticles()
         m_SpawnTimer += spawnDelay * static_cast<f64>(overTimeCount);
     }
 
+    return overTimeCount;
+}
+
+u32 ParticleSystem::ComputeOverDistanceAndBurstSpawnCount()
+{
+    u32 overDistanceCount = 0, burstCount = 0;
+
     if (position != m_LastPosition && emissionRateOverDistance > 0.f)
     {
         const f32 lastFrameDistance = (position - m_LastPosition).Length();
@@ -595,29 +783,85 @@ void ParticleSystem::SpawnNewParticles()
         }
     }
 
-    const u32 totalCount = overTimeCount + overDistanceCount + burstCount;
+    return overDistanceCount + burstCount;
+}
 
-    if (totalCount > 0)
-    {
-        u32 remaining = totalCount;
+bool ParticleSystem::PrepareCpuUpdate(const f32 deltaTime)
+{
+    if (!m_Playing || m_MaxParticles == 0)
+        return false;
 
-        WaitBufferSync(m_SyncObject);
+    const bool simulate = m_PlaybackTime >= startDelay;
 
-        for (u32 i = 0; i < m_MaxParticles; i++)
-        {
-            s32& liveParticle = m_LiveParticles[i];
+    if (simulate)
+    {
+        m_SimulationSettings = {
+            .lifetime = particleLifetime,
+            .speed = particleSpeed,
+            .startColor = particleStartColor,
+            .startSize = particleStartSize,
+        };
 
-            if (liveParticle)
+        for (const auto& module : m_Modules)
+        {
+            const ParticleSystemModules::Types type = module->GetType();
+            if (!(enabledModules & type))
                 continue;
 
-            liveParticle = true;
-
-            if (--remaining <= 0)
-                break;
+            switch (type)
+            {
+                case ParticleSystemModules::Types::Shape:
+                    m_SimulationSettings.shape = static_cast<const ParticleSystemModules::Shape*>(module.get());
+                    break;
+                case ParticleSystemModules::Types::VelocityOverLifetime:
+                    m_SimulationSettings.velocityOverLifetime = static_cast<const ParticleSystemModules::VelocityOverLifetime*>(module.get());
+                    break;
+                case ParticleSystemModules::Types::ForceOverLifetime:
+                    m_SimulationSettings.forceOverLifetime = static_cast<const ParticleSystemModules::ForceOverLifetime*>(module.get());
+                    break;
+                case ParticleSystemModules::Types::ColorOverLifetime:
+                    m_SimulationSettings.colorOverLifetime = static_cast<const ParticleSystemModules::ColorOverLifetime*>(module.get());
+                    break;
+                case ParticleSystemModules::Types::ColorBySpeed:
+                    m_SimulationSettings.colorBySpeed = static_cast<const ParticleSystemModules::ColorBySpeed*>(module.get());
+                    break;
+                default:
+                    break;
+            }
         }
 
-        LockBuffer(m_SyncObject);
+        const bool spawning = looping || m_PlaybackTime - startDelay < duration;
+
+        if (!spawning && m_Simulation.GetParticleCount() == 0)
+            m_Playing = false;
+
+        m_SimulationDeltaTime = deltaTime;
+        m_SimulationSpawnCount = spawning ? ComputeSpawnCount() : 0;
+
+        m_SpawnTimer -= deltaTime;
     }
+
+    m_LastPosition = position;
+    m_LastPlaybackTime = m_PlaybackTime;
+
+    m_PlaybackTime += deltaTime;
+
+    return simulate;
+}
+
+void ParticleSystem::SimulateCpu()
+{
+    m_Simulation.Update(m_SimulationDeltaTime, m_SimulationSettings, m_SimulationSpawnCount);
+    m_Simulation.WriteGpuData(m_SimulationGpuData.GetData());
+}
+
+void ParticleSystem::UploadCpuParticles()
+{
+    const u32 particleCount = m_Simulation.GetParticleCount();
+    if (particleCount == 0)
+        return;
+
+    m_ParticleSsbo.SetSubData(0, static_cast<s64>(ParticleSimulation::GpuParticleSize * particleCount), m_SimulationGpuData.GetData());
 }
 
 void ParticleSystem::AddModule(const std::shared_ptr<ParticleSystemModules::ModuleBase>& module, const bool sort)
@@ -658,23 +902,6 @@ void ParticleSystem::SortModules()
     );
 }
 
-void ParticleSystem::WaitBufferSync(const GLsync syncObject)
-{
-    if (!syncObject)
-        return;
-
-    GLenum waitReturn = GL_UNSIGNALED;
-    while (waitReturn != GL_ALREADY_SIGNALED && waitReturn != GL_CONDITION_SATISFIED)
-        waitReturn = glClientWaitSync(syncObject, GL_SYNC_FLUSH_COMMANDS_BIT, 1);
-}
-
-void ParticleSystem::LockBuffer(GLsync& syncObject)
-{
-    if (syncObject)
-        glDeleteSync(syncObject);
-    syncObject = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, GL_NONE);
-}
-
 u8* ParticleSystem::CreateRawDataCopy()
 {
     usize totalMemory = sizeof(ParticleSystem);
@@ -882,7 +1109,7 @@ bool ParticleSystem::CheckAndDeleteRawDataCopy(const u8* copy)
 {
     s32 check = 0;
 
-    // FIXME - This detects a change in every field, which means it also detects a change in m_SyncObject when calling GetCurrentParticles() for example
+    // FIXME - This detects a change in every field, which means it also detects a change in m_AliveSsbo after each update for example
 
     usize currentOffset = 0;
     check |= std::memcmp(copy, static_cast<void*>(this), sizeof(ParticleSystem));
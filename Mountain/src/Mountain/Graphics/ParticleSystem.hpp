@@ -3,15 +3,13 @@
 #include "Mountain/Core.hpp"
 #include "Mountain/Containers/List.hpp"
 #include "Mountain/Graphics/GpuBuffer.hpp"
+#include "Mountain/Graphics/ParticleSimulation.hpp"
 #include "Mountain/Graphics/ParticleSystemModules.hpp"
 #include "Mountain/Math/Vector2.hpp"
 #include "Mountain/Resource/ComputeShader.hpp"
 #include "Mountain/Resource/Shader.hpp"
 #include "Mountain/Utils/Color.hpp"
-
-// OpenGL type forward declaration
-// ReSharper disable once CppInconsistentNaming
-struct __GLsync;  // NOLINT(clang-diagnostic-reserved-identifier, bugprone-reserved-identifier)
+#include "Mountain/Utils/Optional.hpp"
 
 // TODO - Add settings for negating the delta time when reaching the end of the system lifetime
 
@@ -31,6 +29,36 @@ namespace Mountain
         f32 probability = 1.f;
     };
 
+    /// @brief Where a @c ParticleSystem simulates its particles.
+    enum class ParticleSystemBackend : u8
+    {
+        /// @brief Simulates and spawns the particles with compute shaders, and draws them with the particle count written by
+        /// the GPU.
+        /// @details The CPU only sets the emission settings and never reads anything back from the GPU while updating or
+        /// drawing the system.
+        Gpu,
+        /// @brief Simulates the particles on the CPU with a @c ParticleSimulation and only uploads them to the GPU to draw them.
+        /// @details This doesn't need compute shaders, and the systems updated with @c ParticleSystem::UpdateAll() are
+        /// simulated in parallel.
+        Cpu,
+    };
+
+    /// @brief The counters of the particle lists of a @c ParticleSystem using @c ParticleSystemBackend::Gpu.
+    /// @details This is the layout of the @c Counters buffer of @c particles/simulation.glsl.
+    struct ParticleSystemGpuCounters
+    {
+        /// @brief The number of particles drawn and updated by the next update
+        u32 aliveCount = 0;
+        /// @brief Only used during an update, so this is always 0 once it is done
+        u32 nextAliveCount = 0;
+        /// @brief The number of free particles
+        u32 deadCount = 0;
+        /// @brief The number of particles spawned by the last update
+        u32 spawnCount = 0;
+        /// @brief The time left before spawning the next particle emitted over time
+        f32 spawnTimer = 0.f;
+    };
+
     class ParticleSystem
     {
     public:
@@ -67,11 +95,14 @@ namespace Mountain
         /// @remark This simply calls @c ParticleSystem(u32) with @c 1000 as a parameter
         MOUNTAIN_API ParticleSystem();
         MOUNTAIN_API explicit ParticleSystem(u32 maxParticles);
+        MOUNTAIN_API ParticleSystem(u32 maxParticles, ParticleSystemBackend backend);
         MOUNTAIN_API virtual ~ParticleSystem();
 
         DEFAULT_COPY_MOVE_OPERATIONS(ParticleSystem)
 
         MOUNTAIN_API void Update();
+        /// @brief Updates the system as if @p deltaTime seconds had passed since the last update.
+        MOUNTAIN_API void Update(f32 deltaTime);
         MOUNTAIN_API void Render();
         MOUNTAIN_API void RenderImGui();
         MOUNTAIN_API void RenderDebug();
@@ -87,6 +118,13 @@ namespace Mountain
         MOUNTAIN_API void RemoveModule(ParticleSystemModules::Types type);
         MOUNTAIN_API void RemoveModules(ParticleSystemModules::Types types);
 
+        /// @brief Updates all the @p systems, simulating the ones using @c ParticleSystemBackend::Cpu in parallel.
+        /// @details This is equivalent to calling @c Update() on each system, and must be called on the thread owning the
+        /// OpenGL context.
+        MOUNTAIN_API static void UpdateAll(const List<ParticleSystem*>& systems);
+        /// @brief Updates all the @p systems as if @p deltaTime seconds had passed since their last update.
+        MOUNTAIN_API static void UpdateAll(const List<ParticleSystem*>& systems, f32 deltaTime);
+
         template <Concepts::ParticleSystemModule ModuleT>
         std::shared_ptr<ModuleT> AddModule();
         template <Concepts::ParticleSystemModule ModuleT>
@@ -95,12 +133,21 @@ namespace Mountain
         void RemoveModule();
 
         /// @brief Get the current living particle count.
-        /// @details This can vary a lot from frame to frame because we count the particles on the CPU from the GPU memory.
+        /// @warning With @c ParticleSystemBackend::Gpu, this reads the count back from the GPU and waits for it to finish
+        /// updating the system, so avoid calling it every frame.
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API u32 GetCurrentParticles();
 
+        /// @brief Reads the counters of the particle lists back from the GPU, e.g. to debug or test the GPU backend.
+        /// @warning This waits for the GPU to finish updating the system, so avoid calling it every frame. The system must
+        /// use @c ParticleSystemBackend::Gpu.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API ParticleSystemGpuCounters ReadGpuCounters() const;
+
         /// @brief Get whether the system has finished playing.
         /// @details E.g., whether it is not spawning particles anymore and @code GetCurrentParticles() == 0@endcode.
+        /// With @c ParticleSystemBackend::Gpu, the particles are instead considered dead once @c particleLifetime has passed
+        /// since the end of the emission, so that this doesn't wait for the GPU.
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API bool IsComplete();
 
@@ -109,26 +156,38 @@ namespace Mountain
         /// @warning This can be a quite heavy operation depending on the requested new max particle, avoid doing this every frame
         MOUNTAIN_API void SetMaxParticles(u32 newMaxParticles);
 
+        GETTER(ParticleSystemBackend, Backend, m_Backend)
+        /// @brief Set where the particles are simulated
+        /// @remark This kills all the living particles
+        MOUNTAIN_API void SetBackend(ParticleSystemBackend newBackend);
+
         GETTER(bool, Playing, m_Playing)
         GETTER(const List<std::shared_ptr<ParticleSystemModules::ModuleBase>>&, Modules, m_Modules)
 
     private:
         u32 m_MaxParticles = 0;
-        s32* m_LiveParticles = nullptr;
-        __GLsync* m_SyncObject = nullptr;
 
         f32 m_PlaybackTime = 0.f; // System lifetime
         f32 m_LastPlaybackTime = 0.f;
-        f64 m_SpawnTimer = 0.0;
+        f64 m_SpawnTimer = 0.0; // Only used by the CPU backend, the GPU one keeps its spawn timer in m_CountersSsbo
         bool m_Playing = true;
         Vector2 m_LastPosition;
 
-        Pointer<ComputeShader> m_UpdateComputeShader;
+        // The passes of a GPU update, see particles/simulation.glsl
+        Pointer<ComputeShader> m_UpdateComputeShader, m_EmitComputeShader, m_SpawnComputeShader, m_FinishComputeShader;
 
         Pointer<Shader> m_DrawShader;
-        Graphics::GpuBuffer m_LiveSsbo, m_ParticleSsbo;
+        Graphics::GpuBuffer m_ParticleSsbo;
+        /// @brief The indices of the living particles in @c m_ParticleSsbo, which are drawn.
+        /// @details The GPU backend writes the list of the next frame to @c m_NextAliveSsbo and swaps both buffers after each
+        /// update. The CPU backend packs its particles at the start of @c m_ParticleSsbo, so this is simply @c 0, @c 1, @c 2...
+        Graphics::GpuBuffer m_AliveSsbo, m_NextAliveSsbo;
+        // Only used by the GPU backend
+        Graphics::GpuBuffer m_DeadSsbo, m_CountersSsbo, m_IndirectBuffer;
 
         bool m_GuiParticleBurstTimeHeld = false;
+        /// @brief The particle count shown by @c RenderImGui(), which is only read back on demand with the GPU backend.
+        u32 m_GuiCurrentParticles = 0;
         Vector2 m_RenderTargetSize;
 
         List<std::shared_ptr<ParticleSystemModules::ModuleBase>> m_Modules;
@@ -137,10 +196,49 @@ namespace Mountain
 
         bool m_LastUseTexture = false;
 
-        MOUNTAIN_API void Update(f32 deltaTime);
+        ParticleSystemBackend m_Backend = ParticleSystemBackend::Gpu;
+
+        // CPU backend state, set by PrepareCpuUpdate() for SimulateCpu()
+
+        ParticleSimulation m_Simulation;
+        ParticleSimulationSettings m_SimulationSettings;
+        f32 m_SimulationDeltaTime = 0.f;
+        u32 m_SimulationSpawnCount = 0;
+        /// @brief The particles of @c m_Simulation in the layout of @c m_ParticleSsbo.
+        List<u8> m_SimulationGpuData;
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetDeltaTime() const;
 
-        MOUNTAIN_API void SetComputeShaderUniforms(f32 deltaTime) const;
-        MOUNTAIN_API void SpawnNewParticles();
+        MOUNTAIN_API void LoadComputeShaders();
+
+        MOUNTAIN_API void SetComputeShaderUniforms(const ComputeShader& computeShader, f32 deltaTime) const;
+
+        /// @brief Runs the compute shader passes updating and spawning the particles of a system using the GPU backend.
+        MOUNTAIN_API void DispatchGpuUpdate();
+
+        /// @brief Returns whether there may still be living particles, without waiting for the GPU.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool HasLivingParticles() const;
+
+        /// @brief Computes the number of particles to spawn this frame from the emission settings and advances the spawn timer.
+        MOUNTAIN_API u32 ComputeSpawnCount();
+        /// @brief Computes the number of particles to spawn this frame from @c emissionRateOverTime and advances the spawn timer.
+        MOUNTAIN_API u32 ComputeOverTimeSpawnCount();
+        /// @brief Computes the number of particles to spawn this frame from @c emissionRateOverDistance and @c emissionBursts.
+        MOUNTAIN_API u32 ComputeOverDistanceAndBurstSpawnCount();
+
+        /// @brief Advances the playback of a system using the CPU backend and prepares its simulation step.
+        /// @details This reads the settings of the system, so it must be called on the main thread.
+        /// @return Whether @c SimulateCpu() should be called.
+        MOUNTAIN_API bool PrepareCpuUpdate(f32 deltaTime);
+        /// @brief Simulates the step prepared by @c PrepareCpuUpdate(). This doesn't touch anything outside of the system.
+        MOUNTAIN_API void SimulateCpu();
+        /// @brief Uploads the particles simulated by @c SimulateCpu() to the GPU.
+        MOUNTAIN_API void UploadCpuParticles();
+
+        /// @brief Updates all the @p systems with @p deltaTime, or with their own delta time if it is empty.
+        MOUNTAIN_API static void UpdateAllInternal(const List<ParticleSystem*>& systems, const Optional<f32>& deltaTime);
 
         MOUNTAIN_API void AddModule(const std::shared_ptr<ParticleSystemModules::ModuleBase>& module, bool sort);
         MOUNTAIN_API void AddModules(const List<std::shared_ptr<ParticleSystemModules::ModuleBase>>& modules, bool sort);
@@ -148,11 +246,6 @@ namespace Mountain
 
         MOUNTAIN_API void SortModules();
 
-        /// @brief Wait for the GPU buffer to sync with the CPU. After that call, the CPU can read/write to that buffer.
-        MOUNTAIN_API static void WaitBufferSync(__GLsync* syncObject);
-        /// @brief Lock the buffer to GPU read/write-only. After that call, the CPU cannot access that buffer anymore.
-        MOUNTAIN_API static void LockBuffer(__GLsync*& syncObject);
-
         MOUNTAIN_API u8* CreateRawDataCopy();
         MOUNTAIN_API bool CheckAndDeleteRawDataCopy(const u8* copy);
     };
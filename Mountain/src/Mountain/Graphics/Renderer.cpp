@@ -182,6 +182,8 @@ Mountain::OpenGlVersion& Mountain::Renderer::GetOpenGlVersion() { return m_GlVer
 
 ImGuiContext* Mountain::Renderer::GetImGuiContext() { return ImGui::GetCurrentContext(); }
 
+Mountain::Pointer<Mountain::TextureAtlas> Mountain::Renderer::GetDefaultTextureAtlas() { return m_DefaultTextureAtlas; }
+
 bool Mountain::Renderer::Initialize(const std::string& windowTitle, const Vector2i windowSize, const OpenGlVersion& glVersion)
 {
     ZoneScoped;
@@ -260,6 +262,9 @@ bool Mountain::Renderer::Initialize(const std::string& windowTitle, const Vector
     io.Fonts->AddFontDefault();
     m_DefaultFont = ResourceManager::GetFont(Utils::GetBuiltinAssetsPath() + "font.ttf", 12);
 
+    m_DefaultTextureAtlas = ResourceManager::Add<TextureAtlas>("DefaultTextureAtlas");
+    m_DefaultTextureAtlas->Load();
+
     return true;
 }
 
@@ -280,6 +285,7 @@ void Mountain::Renderer::PreFrame()
     if (windowSize != m_RenderTarget->GetSize())
         m_RenderTarget->SetSize(windowSize);
 
+    Draw::BeginFrame();
     PushRenderTarget(*m_RenderTarget);
     Draw::SetMode(DrawMode::Deferred);
 }
@@ -315,6 +321,7 @@ void Mountain::Renderer::PostFrame()
         m_DebugStrings.Shrink();
 
     Draw::Flush();
+    Draw::EndFrame();
 
     // End ImGui frame
     ImGui::Render();
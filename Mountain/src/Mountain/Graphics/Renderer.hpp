@@ -6,6 +6,7 @@
 #include "Mountain/Core.hpp"
 #include "Mountain/Graphics/RenderTarget.hpp"
 #include "Mountain/Resource/Font.hpp"
+#include "Mountain/Resource/TextureAtlas.hpp"
 #include "Mountain/Utils/DateTime.hpp"
 #include "Mountain/Utils/Pointer.hpp"
 
@@ -15,11 +16,15 @@ typedef struct FT_LibraryRec_* FT_Library;
 
 namespace Mountain
 {
+    /// @brief The version of the OpenGL context, which is also given to ImGui.
+    /// @details The renderer uses direct state access, so the context must be at least 4.5. The internal shaders all
+    /// declare the matching @c #version @c 450 so that they run on every driver that can create this context, e.g. Mesa
+    /// llvmpipe which doesn't support GLSL 4.60.
     struct OpenGlVersion
     {
-        const c8* glsl = "#version 460";
+        const c8* glsl = "#version 450";
         s32 major = 4;
-        s32 minor = 4;
+        s32 minor = 5;
     };
 
     struct DebugStringData
@@ -45,6 +50,9 @@ namespace Mountain
 
         MOUNTAIN_API static ImGuiContext* GetImGuiContext();
 
+        /// @brief Gets the TextureAtlas into which Sprite animation frames are packed
+        MOUNTAIN_API static Pointer<TextureAtlas> GetDefaultTextureAtlas();
+
     private:
         static inline OpenGlVersion m_GlVersion;
         static inline FT_Library m_Freetype;
@@ -53,6 +61,7 @@ namespace Mountain
         static inline RenderTarget* m_RenderTarget;
 
         static inline Pointer<Font> m_DefaultFont;
+        static inline Pointer<TextureAtlas> m_DefaultTextureAtlas;
         static inline List<DebugStringData> m_DebugStrings;
         static inline std::mutex m_DebugStringsMutex;
 
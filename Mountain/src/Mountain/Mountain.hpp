@@ -6,8 +6,13 @@
 
 #include "Mountain/Audio/Audio.hpp"
 #include "Mountain/Audio/AudioBuffer.hpp"
+#include "Mountain/Audio/AudioBus.hpp"
 #include "Mountain/Audio/AudioContext.hpp"
 #include "Mountain/Audio/AudioDevice.hpp"
+#include "Mountain/Audio/AudioKernels.hpp"
+#include "Mountain/Audio/AudioMixer.hpp"
+#include "Mountain/Audio/AudioStream.hpp"
+#include "Mountain/Audio/VoiceManager.hpp"
 
 #include "Mountain/Collision/Circle.hpp"
 #include "Mountain/Collision/Collider.hpp"
@@ -15,6 +20,7 @@
 #include "Mountain/Collision/Collision.hpp"
 #include "Mountain/Collision/Grid.hpp"
 #include "Mountain/Collision/Hitbox.hpp"
+#include "Mountain/Collision/SpatialHash.hpp"
 
 #include "Mountain/Containers/Array.hpp"
 #include "Mountain/Containers/ContiguousIterator.hpp"
@@ -26,10 +32,12 @@
 #include "Mountain/Ecs/Component/AudioListener.hpp"
 #include "Mountain/Ecs/Component/AudioSource.hpp"
 #include "Mountain/Ecs/Component/Component.hpp"
+#include "Mountain/Ecs/Component/ComponentPool.hpp"
 #include "Mountain/Ecs/Component/Sprite.hpp"
 #include "Mountain/Ecs/Component/StateMachine.hpp"
 
 #include "Mountain/Ecs/Entity.hpp"
+#include "Mountain/Ecs/EntityHandle.hpp"
 #include "Mountain/Ecs/EntityList.hpp"
 #include "Mountain/Ecs/Scene.hpp"
 
@@ -37,6 +45,7 @@
 #include "Mountain/Exceptions/Exception.hpp"
 #include "Mountain/Exceptions/ThrowHelper.hpp"
 
+#include "Mountain/FileSystem/Archive.hpp"
 #include "Mountain/FileSystem/Directory.hpp"
 #include "Mountain/FileSystem/Entry.hpp"
 #include "Mountain/FileSystem/File.hpp"
@@ -51,10 +60,14 @@
 #include "Mountain/Graphics/Draw.hpp"
 #include "Mountain/Graphics/Effect.hpp"
 #include "Mountain/Graphics/GpuBuffer.hpp"
+#include "Mountain/Graphics/GpuRingBuffer.hpp"
 #include "Mountain/Graphics/GpuTexture.hpp"
+#include "Mountain/Graphics/GpuTextureArray.hpp"
 #include "Mountain/Graphics/GpuVertexArray.hpp"
 #include "Mountain/Graphics/Graphics.hpp"
 #include "Mountain/Graphics/LightSource.hpp"
+#include "Mountain/Graphics/ParticleKernels.hpp"
+#include "Mountain/Graphics/ParticleSimulation.hpp"
 #include "Mountain/Graphics/ParticleSystem.hpp"
 #include "Mountain/Graphics/ParticleSystemModules.hpp"
 #include "Mountain/Graphics/Renderer.hpp"
@@ -68,8 +81,10 @@
 #include "Mountain/Resource/Shader.hpp"
 #include "Mountain/Resource/ShaderBase.hpp"
 #include "Mountain/Resource/Texture.hpp"
+#include "Mountain/Resource/TextureAtlas.hpp"
 
 #include "Mountain/Utils/Color.hpp"
+#include "Mountain/Utils/Compression.hpp"
 #include "Mountain/Utils/Coroutine.hpp"
 #include "Mountain/Utils/DateTime.hpp"
 #include "Mountain/Utils/Event.hpp"
@@ -77,6 +92,7 @@
 #include "Mountain/Utils/Formatter.hpp"
 #include "Mountain/Utils/Guid.hpp"
 #include "Mountain/Utils/ImGuiUtils.hpp"
+#include "Mountain/Utils/JobSystem.hpp"
 #include "Mountain/Utils/Logger.hpp"
 #include "Mountain/Utils/MessageBox.hpp"
 #include "Mountain/Utils/MetaProgramming.hpp"
@@ -85,6 +101,8 @@
 #include "Mountain/Utils/Rectangle.hpp"
 #include "Mountain/Utils/ReferenceCounter.hpp"
 #include "Mountain/Utils/Requirements.hpp"
+#include "Mountain/Utils/Simd.hpp"
+#include "Mountain/Utils/SkylinePacker.hpp"
 #include "Mountain/Utils/Stopwatch.hpp"
 #include "Mountain/Utils/TimeSpan.hpp"
 #include "Mountain/Utils/TsQueue.hpp"
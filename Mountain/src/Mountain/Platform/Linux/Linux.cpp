@@ -1,9 +1,11 @@
 #include "Mountain/Platform/Linux/Linux.hpp"
 
-#include <fcntl.h>
-
 #ifdef ENVIRONMENT_LINUX
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 using namespace Mountain;
 
 namespace
@@ -176,6 +178,33 @@ s64 Linux::GetTimestamp()
     return ts.tv_sec * static_cast<int64_t>(SecondsToNanoSeconds) + ts.tv_nsec;
 }
 
+void* Linux::MapFile(const std::filesystem::path& path, s64* size)
+{
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1 || fileStat.st_size == 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, static_cast<usize>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after the file descriptor is closed
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    *size = fileStat.st_size;
+    return data;
+}
+
+void Linux::UnmapFile(void* data, const s64 size) { munmap(data, static_cast<usize>(size)); }
+
 void Linux::Cleanup() { }
 
 #endif
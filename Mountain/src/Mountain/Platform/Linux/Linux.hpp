@@ -4,6 +4,8 @@
 
 #ifdef ENVIRONMENT_LINUX
 
+#include <filesystem>
+
 namespace Mountain::Linux
 {
     MOUNTAIN_API bool Sleep(TimeSpan duration);
@@ -23,6 +25,11 @@ namespace Mountain::Linux
     ATTRIBUTE_NODISCARD
     MOUNTAIN_API s64 GetTimestamp();
 
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API void* MapFile(const std::filesystem::path& path, s64* size);
+
+    MOUNTAIN_API void UnmapFile(void* data, s64 size);
+
     MOUNTAIN_API void Cleanup();
 }
 
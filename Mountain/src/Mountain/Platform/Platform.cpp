@@ -28,4 +28,8 @@ s64 Platform::GetTimerFrequency() { return PLATFORM_DEPENDENT_CALL(GetTimerFrequ
 
 s64 Platform::GetTimestamp() { return PLATFORM_DEPENDENT_CALL(GetTimestamp); }
 
+void* Platform::MapFile(const std::filesystem::path& path, s64* size) { return PLATFORM_DEPENDENT_CALL(MapFile, path, size); }
+
+void Platform::UnmapFile(void* data, const s64 size) { return PLATFORM_DEPENDENT_CALL(UnmapFile, data, size); }
+
 void Platform::Cleanup() { return PLATFORM_DEPENDENT_CALL(Cleanup); }
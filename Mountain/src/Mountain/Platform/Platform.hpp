@@ -1,5 +1,7 @@
 #pragma once
 
+#include <filesystem>
+
 #include "Mountain/Core.hpp"
 
 namespace Mountain::Platform
@@ -28,5 +30,17 @@ namespace Mountain::Platform
     ATTRIBUTE_NODISCARD
     MOUNTAIN_API s64 GetTimestamp();
 
+    /// @brief Maps the file at the given @p path in the address space of the process
+    /// @details Pages are only read from the disk when they are first accessed. The mapping is copy-on-write, which means that
+    /// writing to it never modifies the file on the disk.
+    /// @param path The path of the file to map
+    /// @param size Set to the size of the mapped file
+    /// @return The address of the mapping, or @c nullptr if the file couldn't be mapped
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API void* MapFile(const std::filesystem::path& path, s64* size);
+
+    /// @brief Unmaps memory previously mapped with @c MapFile()
+    MOUNTAIN_API void UnmapFile(void* data, s64 size);
+
     MOUNTAIN_API void Cleanup();
 }
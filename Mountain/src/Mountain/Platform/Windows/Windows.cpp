@@ -134,6 +134,52 @@ void Windows::Cleanup()
     }
 }
 
+void* Windows::MapFile(const std::filesystem::path& path, s64* size)
+{
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        SilenceError();
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        SilenceError();
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        CheckError();
+        return nullptr;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+    // The view stays valid after the mapping handle is closed
+    CloseHandle(mapping);
+
+    if (!data)
+    {
+        CheckError();
+        return nullptr;
+    }
+
+    *size = fileSize.QuadPart;
+    return data;
+}
+
+void Windows::UnmapFile(void* data, ATTRIBUTE_MAYBE_UNUSED const s64 size)
+{
+    UnmapViewOfFile(data);
+    CheckError();
+}
+
 std::string Windows::GetAppdataLocalPath()
 {
     CHAR result[MAX_PATH]{};
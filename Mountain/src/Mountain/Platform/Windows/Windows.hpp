@@ -4,6 +4,7 @@
 
 #ifdef ENVIRONMENT_WINDOWS
 
+#include <filesystem>
 #include <string>
 
 #include "Mountain/Utils/TimeSpan.hpp"
@@ -50,6 +51,11 @@ namespace Mountain::Windows
     ATTRIBUTE_NODISCARD
     MOUNTAIN_API s64 GetTimestamp();
 
+    ATTRIBUTE_NODISCARD
+    MOUNTAIN_API void* MapFile(const std::filesystem::path& path, s64* size);
+
+    MOUNTAIN_API void UnmapFile(void* data, s64 size);
+
     MOUNTAIN_API void Cleanup();
 
     ATTRIBUTE_NODISCARD
@@ -7,6 +7,9 @@
 #include <minimp3/minimp3_ex.h>
 
 #include "Mountain/Audio/Audio.hpp"
+#include "Mountain/Audio/AudioMixer.hpp"
+#include "Mountain/Audio/VoiceManager.hpp"
+#include "Mountain/FileSystem/File.hpp"
 #include "Mountain/Utils/Logger.hpp"
 
 using namespace Mountain;
@@ -33,17 +36,26 @@ bool AudioTrack::SetSourceData(const u8* const buffer, const s64 length)
 
 void AudioTrack::Load()
 {
-    m_Buffer = new AudioBuffer(this);
-    Audio::RegisterBuffer(m_Buffer);
+    // Streamed tracks are only decoded in the buffers of the AudioStream playing them
+    if (!m_Streamed)
+    {
+        m_Buffer = new AudioBuffer(this);
+        Audio::RegisterBuffer(m_Buffer);
+    }
 
     m_Loaded = true;
 }
 
 void AudioTrack::Unload()
 {
-    Audio::UnregisterBuffer(m_Buffer);
-    delete m_Buffer;
-    m_Buffer = nullptr;
+    StopPlayback();
+
+    if (m_Buffer)
+    {
+        Audio::UnregisterBuffer(m_Buffer);
+        delete m_Buffer;
+        m_Buffer = nullptr;
+    }
 
     m_Loaded = false;
 }
@@ -53,6 +65,8 @@ void AudioTrack::ResetSourceData()
     if (!m_SourceDataSet)
         return;
 
+    StopPlayback();
+
     switch (m_Format)
     {
         case AudioTrackFormat::Wavefront:
@@ -62,8 +76,9 @@ void AudioTrack::ResetSourceData()
 
         case AudioTrackFormat::OggVorbis:
         case AudioTrackFormat::Mp3:
-            // The buffer was malloc-ed from the third-party library
+            // The buffer was malloc-ed from the third-party library, and streamed tracks don't have one
             free(const_cast<u8*>(m_Data));
+            m_Data = nullptr;
             break;
     }
 
@@ -71,6 +86,12 @@ void AudioTrack::ResetSourceData()
     m_Channels = 0;
     m_SampleRate = 0;
     m_BitDepth = 0;
+    m_FrameCount = 0;
+
+    m_Streamed = false;
+    m_EncodedData = nullptr;
+    m_EncodedDataSize = 0;
+    m_EncodedDataOwner.reset();
 
     m_SourceDataSet = false;
 }
@@ -87,6 +108,12 @@ const AudioBuffer* AudioTrack::GetBuffer() const { return m_Buffer; }
 
 AudioTrackFormat AudioTrack::GetFormat() const { return m_Format; }
 
+bool AudioTrack::IsStreamed() const { return m_Streamed; }
+
+u64 AudioTrack::GetFrameCount() const { return m_FrameCount; }
+
+f32 AudioTrack::GetDuration() const { return m_SampleRate == 0 ? 0.f : static_cast<f32>(m_FrameCount) / static_cast<f32>(m_SampleRate); }
+
 bool AudioTrack::LoadWavefront(const u8* const buffer, const s64 length)
 {
     m_Format = AudioTrackFormat::Wavefront;
@@ -108,6 +135,9 @@ bool AudioTrack::LoadWavefront(const u8* const buffer, const s64 length)
             offset++;
     }
 
+    if (m_Channels != 0 && m_BitDepth != 0)
+        m_FrameCount = static_cast<u64>(m_DataSize) / (m_Channels * (m_BitDepth / 8));
+
     m_SourceDataSet = true;
     return true;
 }
@@ -147,6 +177,23 @@ bool AudioTrack::LoadOggVorbis(const u8* buffer, const s64 length)
 {
     m_Format = AudioTrackFormat::OggVorbis;
 
+    if (streamingThreshold >= 0 && length >= streamingThreshold)
+    {
+        // Only read the header, the AudioStream playing the track opens its own decoder
+        stb_vorbis* const vorbis = stb_vorbis_open_memory(buffer, static_cast<int>(length), nullptr, nullptr);
+        if (!vorbis)
+            return false;
+
+        const stb_vorbis_info info = stb_vorbis_get_info(vorbis);
+        m_Channels = static_cast<u16>(info.channels);
+        m_SampleRate = static_cast<s32>(info.sample_rate);
+        m_FrameCount = stb_vorbis_stream_length_in_samples(vorbis);
+        stb_vorbis_close(vorbis);
+
+        SetStreamed(buffer, length);
+        return true;
+    }
+
     int channels;
     const int decodedSamples = stb_vorbis_decode_memory(
         buffer,
@@ -162,6 +209,7 @@ bool AudioTrack::LoadOggVorbis(const u8* buffer, const s64 length)
     m_Channels = static_cast<u16>(channels);
     m_DataSize = static_cast<s32>(decodedSamples * sizeof(short) * channels);
     m_BitDepth = 16;
+    m_FrameCount = static_cast<u64>(decodedSamples);
 
     m_SourceDataSet = true;
     return true;
@@ -171,6 +219,22 @@ bool AudioTrack::LoadMp3(const u8* buffer, const s64 length)
 {
     m_Format = AudioTrackFormat::Mp3;
 
+    if (streamingThreshold >= 0 && length >= streamingThreshold)
+    {
+        // Only read the header, the AudioStream playing the track opens its own decoder
+        mp3dec_ex_t mp3;
+        if (mp3dec_ex_open_buf(&mp3, buffer, static_cast<size_t>(length), MP3D_SEEK_TO_SAMPLE))
+            return false;
+
+        m_Channels = static_cast<u16>(mp3.info.channels);
+        m_SampleRate = mp3.info.hz;
+        m_FrameCount = mp3.samples / mp3.info.channels;
+        mp3dec_ex_close(&mp3);
+
+        SetStreamed(buffer, length);
+        return true;
+    }
+
     mp3dec_t mp3;
     mp3dec_file_info_t fileInfo;
     if (mp3dec_load_buf(&mp3, buffer, length, &fileInfo, nullptr, nullptr))
@@ -181,7 +245,40 @@ bool AudioTrack::LoadMp3(const u8* buffer, const s64 length)
     m_Channels = static_cast<u16>(fileInfo.channels);
     m_SampleRate = fileInfo.hz;
     m_BitDepth = 16;
+    m_FrameCount = fileInfo.samples / fileInfo.channels;
 
     m_SourceDataSet = true;
     return true;
 }
+
+void AudioTrack::SetStreamed(const u8* buffer, const s64 length)
+{
+    // The AudioStream playing the track decodes it on the streaming thread, so the data must stay alive even if the File is
+    // unloaded or the caller frees its buffer
+    // Only compare against the const data so that borrowed data isn't copied
+    const Pointer<File>& file = m_File;
+    if (file && file->GetData<u8>() == buffer)
+    {
+        m_EncodedDataOwner = file->GetDataHandle();
+    }
+    else
+    {
+        const std::shared_ptr<u8[]> copy = std::make_shared_for_overwrite<u8[]>(static_cast<usize>(length));
+        std::memcpy(copy.get(), buffer, static_cast<usize>(length));
+        buffer = copy.get();
+        m_EncodedDataOwner = copy;
+    }
+
+    m_Streamed = true;
+    m_EncodedData = buffer;
+    m_EncodedDataSize = length;
+    m_BitDepth = 16;
+
+    m_SourceDataSet = true;
+}
+
+void AudioTrack::StopPlayback() const
+{
+    VoiceManager::StopTrack(*this);
+    AudioMixer::Stop(*this);
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "Mountain/Core.hpp"
 #include "Mountain/Audio/AudioBuffer.hpp"
 #include "Mountain/Resource/Resource.hpp"
@@ -15,6 +17,8 @@ namespace Mountain
 
     class AudioTrack : public Resource
     {
+        friend class AudioStream;
+
     public:
         /// @brief Allowed extensions for audio files
         MOUNTAIN_API static constexpr Array FileExtensions
@@ -25,6 +29,13 @@ namespace Mountain
             ".ogg"
         };
 
+        /// @brief Minimum size in bytes of the Ogg Vorbis and MP3 files that are streamed instead of being decoded at once.
+        /// @details A streamed track keeps a handle to the data of its File, or a copy of the raw data it was loaded from,
+        /// and is decoded while being played by an @c AudioStream. It doesn't have any decoded data or AudioBuffer.
+        /// Unloading a track stops all the voices and mixer sounds playing it.
+        /// Set this to a negative value to never stream tracks.
+        MOUNTAIN_API static inline s64 streamingThreshold = 512 * 1024;
+
         // Same constructor from base class
         using Resource::Resource;
 
@@ -75,6 +86,19 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API AudioTrackFormat GetFormat() const;
 
+        /// @brief Returns whether this track is decoded while being played instead of being decoded when loaded.
+        /// @see streamingThreshold
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsStreamed() const;
+
+        /// @brief Returns the length of the track in frames, a frame being one sample for each channel.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API u64 GetFrameCount() const;
+
+        /// @brief Returns the length of the track in seconds.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetDuration() const;
+
     private:
         /// @brief The raw, uncompressed audio data.
         u8* m_Data = nullptr;
@@ -86,6 +110,17 @@ namespace Mountain
         s32 m_SampleRate = 0;
         /// @brief The number of bits per sample.
         u16 m_BitDepth = 0;
+        /// @brief The number of samples for each channel.
+        u64 m_FrameCount = 0;
+
+        /// @brief Whether the track is decoded by the AudioStream playing it instead of being stored in m_Data.
+        bool m_Streamed = false;
+        /// @brief The encoded data of a streamed track, which is owned by @c m_EncodedDataOwner.
+        const u8* m_EncodedData = nullptr;
+        s64 m_EncodedDataSize = 0;
+        /// @brief Keeps @c m_EncodedData alive: the data handle of the File the track was loaded from, or a copy of the raw
+        /// buffer it was loaded from.
+        std::shared_ptr<const void> m_EncodedDataOwner;
 
         AudioBuffer* m_Buffer = nullptr;
 
@@ -97,6 +132,12 @@ namespace Mountain
 
         MOUNTAIN_API bool LoadOggVorbis(const u8* buffer, s64 length);
         MOUNTAIN_API bool LoadMp3(const u8* buffer, s64 length);
+
+        /// @brief Marks this track as streamed from the encoded @p buffer, keeping it alive or copying it.
+        void SetStreamed(const u8* buffer, s64 length);
+
+        /// @brief Stops everything playing this track, as its data is about to be freed.
+        void StopPlayback() const;
     };
 }
 
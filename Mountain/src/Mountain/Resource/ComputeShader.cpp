@@ -35,6 +35,18 @@ bool ComputeShader::Load(const c8* const buffer, const s64 length)
 
 void ComputeShader::Load()
 {
+    const std::string_view source = m_Code;
+    const u64 cacheKey = ComputeCacheKey({ &source, 1 });
+    if (LoadFromCache(cacheKey))
+    {
+#ifdef _DEBUG
+        const std::string name = m_Name.substr(0, m_Name.find_last_of('.')); // Remove file extension
+        glObjectLabel(GL_PROGRAM, m_Id, static_cast<GLsizei>(name.length()), name.c_str());
+#endif
+        m_Loaded = true;
+        return;
+    }
+
     const u32 id = glCreateShader(GL_COMPUTE_SHADER);
 #ifdef _DEBUG
     std::string name = m_Name;
@@ -53,25 +65,32 @@ void ComputeShader::Load()
         return;
     }
 
-    if (glIsProgram(m_Id))
-        glDeleteProgram(m_Id);
-
-    m_Id = glCreateProgram();
+    // Link the new program before deleting the current one, so that a failed reload keeps the previous program
+    const u32 program = glCreateProgram();
 #ifdef _DEBUG
     name = name.substr(0, name.find_last_of('.')); // Remove file extension
-    glObjectLabel(GL_PROGRAM, m_Id, static_cast<GLsizei>(name.length()), name.c_str());
+    glObjectLabel(GL_PROGRAM, program, static_cast<GLsizei>(name.length()), name.c_str());
 #endif
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
-	glAttachShader(m_Id, id);
-    glLinkProgram(m_Id);
+	glAttachShader(program, id);
+    glLinkProgram(program);
 
     if (glIsShader(id))
     {
-        glDetachShader(m_Id, id);
+        glDetachShader(program, id);
         glDeleteShader(id);
     }
 
-    static_cast<void>(CheckLinkError());
+    if (CheckLinkError(program))
+    {
+        Logger::LogWarning("Compute shader load canceled because of link errors");
+        glDeleteProgram(program);
+        return;
+    }
+
+    ReplaceProgram(program);
+    SaveToCache(cacheKey);
 
     m_Loaded = true;
 }
@@ -112,6 +131,13 @@ void ComputeShader::Dispatch(const u32 groupsX, const u32 groupsY, const u32 gro
     glUseProgram(0);
 }
 
+void ComputeShader::DispatchIndirect(const s64 offset) const
+{
+    glUseProgram(m_Id);
+    glDispatchComputeIndirect(offset);
+    glUseProgram(0);
+}
+
 bool ComputeShader::CheckCompileError(const u32 id) const
 {
     return ShaderBase::CheckCompileError(id, "Compute", m_Code);
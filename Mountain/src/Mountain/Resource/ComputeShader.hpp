@@ -43,6 +43,12 @@ namespace Mountain
 
 		MOUNTAIN_API void Dispatch(u32 groupsX = 1, u32 groupsY = 1, u32 groupsZ = 1) const;
 
+		/// @brief Dispatches the compute shader with the work group counts read from the buffer bound to
+		/// @c Graphics::BufferType::DispatchIndirectBuffer, which lets the GPU choose how many work groups to run
+		/// @param offset The byte offset of a <c>{ u32 groupsX, groupsY, groupsZ }</c> struct in the buffer
+		/// @see <a href="https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDispatchComputeIndirect.xhtml">glDispatchComputeIndirect()</a>
+		MOUNTAIN_API void DispatchIndirect(s64 offset = 0) const;
+
 	private:
 		std::string m_Code;
 
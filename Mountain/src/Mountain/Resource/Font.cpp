@@ -3,12 +3,13 @@
 #include "Mountain/Resource/Font.hpp"
 
 #include <algorithm>
-#include <ranges>
+#include <bit>
 
 #include <glad/glad.h>
 
 #include <ft2build.h>
 
+#include "Mountain/Containers/List.hpp"
 #include "Mountain/Graphics/Renderer.hpp"
 #include "Mountain/Utils/Logger.hpp"
 
@@ -57,7 +58,7 @@ Vector2 Font::CalcTextSize(const std::string_view text) const
 
     for (const c8 c : text)
     {
-        const Character& character = m_Characters.at(c);
+        const Character& character = m_Characters.At(static_cast<u8>(c));
 
         result.x += static_cast<f32>(character.advance >> 6);
 
@@ -67,13 +68,19 @@ Vector2 Font::CalcTextSize(const std::string_view text) const
     return result;
 }
 
+Graphics::GpuTexture Font::GetAtlas() const { return m_Atlas; }
+
+Vector2i Font::GetAtlasSize() const { return m_AtlasSize; }
+
 void Font::Load()
 {
     if (m_Loaded)
         return;
 
+    // Read the data through a const File so that embedded fonts aren't copied
+    const Pointer<File>& file = m_File;
     FT_Face face = nullptr;
-    if (FT_New_Memory_Face(Renderer::m_Freetype, m_File->GetData<u8>(), static_cast<FT_Long>(m_File->GetSize()), 0, &face))
+    if (FT_New_Memory_Face(Renderer::m_Freetype, file->GetData<u8>(), static_cast<FT_Long>(file->GetSize()), 0, &face))
     {
         Logger::LogError("Failed to load Font {}", m_Name);
         return;
@@ -81,49 +88,117 @@ void Font::Load()
 
     FT_Set_Pixel_Sizes(face, 0, m_Size);
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    // FreeType reuses the same glyph slot for each character, so we need to keep a copy of each bitmap until the atlas is packed
+    Array<List<u8>, CharacterCount> bitmaps;
+    s32 totalArea = 0;
+    s32 maxGlyphWidth = 0;
 
-    for (u8 c = 0; c < 128; c++)
+    for (u8 c = 0; c < CharacterCount; c++)
     {
+        m_Characters[c] = {};
+
         if (FT_Load_Char(face, c, FT_LOAD_RENDER))
         {
             Logger::LogError("Failed to load glyph {} ({:X}) in Font {}", c, c, m_Name);
             continue;
         }
 
-        const Vector2i glyphSize = Vector2i(static_cast<s32>(face->glyph->bitmap.width), static_cast<s32>(face->glyph->bitmap.rows));
+        const FT_Bitmap& bitmap = face->glyph->bitmap;
+        const Vector2i glyphSize = Vector2i(static_cast<s32>(bitmap.width), static_cast<s32>(bitmap.rows));
 
-        Character character {
+        m_Characters[c] = {
             .size = glyphSize,
             .bearing = { face->glyph->bitmap_left, face->glyph->bitmap_top },
             .advance = static_cast<u32>(face->glyph->advance.x)
         };
 
-        if (glyphSize != Vector2i::Zero())
+        if (glyphSize == Vector2i::Zero())
+            continue;
+
+        List<u8>& pixels = bitmaps[c];
+        pixels.Resize(static_cast<usize>(glyphSize.x * glyphSize.y));
+        for (s32 y = 0; y < glyphSize.y; y++)
+            std::memcpy(&pixels[static_cast<usize>(y * glyphSize.x)], bitmap.buffer + y * bitmap.pitch, static_cast<usize>(glyphSize.x));
+
+        totalArea += (glyphSize.x + AtlasPadding) * (glyphSize.y + AtlasPadding);
+        maxGlyphWidth = std::max(maxGlyphWidth, glyphSize.x);
+    }
+
+    FT_Done_Face(face);
+
+    // Pack the glyphs row by row in a roughly square texture
+    const s32 atlasWidth = static_cast<s32>(std::bit_ceil(static_cast<u32>(std::max(
+        static_cast<s32>(std::ceil(std::sqrt(static_cast<f32>(totalArea)))),
+        maxGlyphWidth + AtlasPadding * 2
+    ))));
+
+    Array<Vector2i, CharacterCount> offsets{};
+    Vector2i cursor = Vector2i::One() * AtlasPadding;
+    s32 rowHeight = 0;
+
+    for (u8 c = 0; c < CharacterCount; c++)
+    {
+        const Vector2i glyphSize = m_Characters[c].size;
+        if (glyphSize == Vector2i::Zero())
+            continue;
+
+        if (cursor.x + glyphSize.x + AtlasPadding > atlasWidth)
         {
-            character.texture.Create();
-            character.texture.SetStorage(Graphics::InternalFormat::Red8, glyphSize);
-            character.texture.SetSubData(Vector2i::Zero(), glyphSize, Graphics::Format::Red, Graphics::DataType::UnsignedByte, face->glyph->bitmap.buffer);
-            character.texture.SetMinFilter(Graphics::MagnificationFilter::Linear);
-            character.texture.SetMagFilter(Graphics::MagnificationFilter::Linear);
-            character.texture.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
-            character.texture.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
+            cursor.x = AtlasPadding;
+            cursor.y += rowHeight + AtlasPadding;
+            rowHeight = 0;
         }
 
-        m_Characters.emplace(c, character);
+        offsets[c] = cursor;
+        cursor.x += glyphSize.x + AtlasPadding;
+        rowHeight = std::max(rowHeight, glyphSize.y);
     }
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    m_AtlasSize = { atlasWidth, static_cast<s32>(std::bit_ceil(static_cast<u32>(cursor.y + rowHeight + AtlasPadding))) };
 
-    FT_Done_Face(face);
+    List<u8> atlasData;
+    atlasData.Resize(static_cast<usize>(m_AtlasSize.x * m_AtlasSize.y));
+
+    for (u8 c = 0; c < CharacterCount; c++)
+    {
+        Character& character = m_Characters[c];
+        if (character.size == Vector2i::Zero())
+            continue;
+
+        const Vector2i offset = offsets[c];
+        for (s32 y = 0; y < character.size.y; y++)
+        {
+            std::memcpy(
+                &atlasData[static_cast<usize>((offset.y + y) * m_AtlasSize.x + offset.x)],
+                &bitmaps[c][static_cast<usize>(y * character.size.x)],
+                static_cast<usize>(character.size.x)
+            );
+        }
+
+        character.uv0 = offset / static_cast<Vector2>(m_AtlasSize);
+        character.uv1 = (offset + character.size) / static_cast<Vector2>(m_AtlasSize);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    m_Atlas.Create();
+    m_Atlas.SetDebugName(m_Name);
+    m_Atlas.SetStorage(Graphics::InternalFormat::Red8, m_AtlasSize);
+    m_Atlas.SetSubData(Vector2i::Zero(), m_AtlasSize, Graphics::Format::Red, Graphics::DataType::UnsignedByte, atlasData.GetData());
+    m_Atlas.SetMinFilter(Graphics::MagnificationFilter::Linear);
+    m_Atlas.SetMagFilter(Graphics::MagnificationFilter::Linear);
+    m_Atlas.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
+    m_Atlas.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
     m_Loaded = true;
 }
 
 void Font::Unload()
 {
-    for (auto&& character : m_Characters | std::views::values)
-        character.texture.Delete();
+    m_Atlas.Delete();
+    m_AtlasSize = Vector2i::Zero();
 
     m_Loaded = false;
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <map>
-
 #include "Mountain/Core.hpp"
+#include "Mountain/Containers/Array.hpp"
 #include "Mountain/Graphics/GpuTexture.hpp"
+#include "Mountain/Math/Vector2.hpp"
 #include "Mountain/Math/Vector2i.hpp"
 #include "Mountain/Resource/Resource.hpp"
 
@@ -34,16 +34,32 @@ namespace Mountain
 
         MOUNTAIN_API Vector2 CalcTextSize(std::string_view text) const;
 
+        /// @brief Gets the texture containing all the glyphs of this Font.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Graphics::GpuTexture GetAtlas() const;
+
+        /// @brief Gets the size in pixels of the glyph atlas texture.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Vector2i GetAtlasSize() const;
+
     private:
+        /// @brief The number of characters loaded from the font file, e.g. the ASCII table.
+        static constexpr usize CharacterCount = 128;
+        /// @brief The number of empty pixels around each glyph in the atlas, to avoid bleeding when sampling with linear filtering.
+        static constexpr s32 AtlasPadding = 1;
+
         struct Character
         {
-            Graphics::GpuTexture texture{};
             Vector2i size;       // Size of glyph
             Vector2i bearing;    // Offset from baseline to left/top of glyph
             u32 advance;
+            Vector2 uv0, uv1;    // Rectangle of the glyph in the atlas
         };
 
-        std::map<c8, Character> m_Characters;
+        Array<Character, CharacterCount> m_Characters{};
+
+        Graphics::GpuTexture m_Atlas;
+        Vector2i m_AtlasSize;
 
         u32 m_Size = 0;
 
@@ -24,6 +24,219 @@ namespace rh
 
 using namespace Mountain;
 
+void ResourceManager::UpdateAsyncLoads()
+{
+    ZoneScoped;
+
+    if (m_AsyncUploadQueue.Empty())
+        return;
+
+    const Stopwatch stopwatch = Stopwatch::StartNew();
+
+    // Always finish at least one load so that a budget too small can't stall the queue
+    do
+    {
+        AsyncLoad load = m_AsyncUploadQueue.Pop();
+        FinishAsyncLoad(load, false);
+
+        usize finishedCount, requestedCount;
+        {
+            std::scoped_lock lock(m_AsyncDecodeMutex);
+            finishedCount = ++m_AsyncFinishedCount;
+            requestedCount = m_AsyncRequestedCount;
+        }
+        onAsyncLoadProgress(finishedCount, requestedCount);
+    }
+    while (!m_AsyncUploadQueue.Empty() && stopwatch.GetElapsedMilliseconds() < m_AsyncUploadBudget);
+
+    // Reset the progress once everything that was requested has been loaded
+    std::scoped_lock lock(m_AsyncDecodeMutex);
+    if (m_AsyncFinishedCount == m_AsyncRequestedCount)
+    {
+        m_AsyncRequestedCount = 0;
+        m_AsyncFinishedCount = 0;
+    }
+}
+
+f32 ResourceManager::GetAsyncUploadBudget() { return m_AsyncUploadBudget; }
+
+void ResourceManager::SetAsyncUploadBudget(const f32 newAsyncUploadBudget) { m_AsyncUploadBudget = newAsyncUploadBudget; }
+
+usize ResourceManager::GetPendingAsyncLoadCount()
+{
+    std::scoped_lock lock(m_AsyncDecodeMutex);
+    return m_AsyncRequestedCount - m_AsyncFinishedCount;
+}
+
+f32 ResourceManager::GetAsyncLoadProgress()
+{
+    std::scoped_lock lock(m_AsyncDecodeMutex);
+
+    if (m_AsyncRequestedCount == 0)
+        return 1.f;
+
+    return static_cast<f32>(m_AsyncFinishedCount) / static_cast<f32>(m_AsyncRequestedCount);
+}
+
+void ResourceManager::StopAsyncLoads()
+{
+    std::deque<AsyncLoad> cancelledLoads;
+
+    {
+        std::scoped_lock lock(m_AsyncDecodeMutex);
+
+        if (!m_AsyncWorkersRunning)
+            return;
+
+        Logger::LogVerbose("Stopping asynchronous resource loading");
+
+        m_AsyncWorkersRunning = false;
+        cancelledLoads.swap(m_AsyncDecodeQueue);
+    }
+    m_AsyncDecodeCondVar.notify_all();
+
+    for (std::thread& worker : m_AsyncWorkers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    m_AsyncWorkers.Clear();
+
+    // The workers are stopped so nothing can be pushed to the upload queue anymore
+    while (!m_AsyncUploadQueue.Empty())
+        cancelledLoads.push_back(m_AsyncUploadQueue.Pop());
+
+    // Fulfill the futures of the cancelled loads with an empty pointer, otherwise they would throw a broken promise error
+    for (AsyncLoad& load : cancelledLoads)
+        FinishAsyncLoad(load, true);
+
+    std::scoped_lock lock(m_AsyncDecodeMutex);
+    m_AsyncRequestedCount = 0;
+    m_AsyncFinishedCount = 0;
+}
+
+void ResourceManager::EnqueueAsyncLoad(AsyncLoad&& load)
+{
+    {
+        std::scoped_lock lock(m_AsyncDecodeMutex);
+
+        // Start the workers lazily so that games that never load asynchronously don't pay for the threads
+        if (!m_AsyncWorkersRunning)
+        {
+            m_AsyncWorkersRunning = true;
+
+            const u32 workerCount = std::clamp(std::thread::hardware_concurrency(), 2u, MaxAsyncWorkerCount + 1) - 1;
+            for (u32 i = 0; i < workerCount; i++)
+            {
+                std::thread& worker = m_AsyncWorkers.Add(std::thread{RunAsyncWorker});
+                Utils::SetThreadName(worker, std::format("Resource Loader {}", i));
+            }
+        }
+
+        m_AsyncLoadStates[load.resource.Get()].pendingCount++;
+        m_AsyncDecodeQueue.push_back(std::move(load));
+        ++m_AsyncRequestedCount;
+    }
+    m_AsyncDecodeCondVar.notify_one();
+}
+
+void ResourceManager::RunAsyncWorker()
+{
+    while (true)
+    {
+        AsyncLoad load;
+        bool unloaded;
+
+        {
+            std::unique_lock lock(m_AsyncDecodeMutex);
+            m_AsyncDecodeCondVar.wait(lock, [] { return !m_AsyncWorkersRunning || !m_AsyncDecodeQueue.empty(); });
+
+            if (!m_AsyncWorkersRunning)
+                return;
+
+            load = std::move(m_AsyncDecodeQueue.front());
+            m_AsyncDecodeQueue.pop_front();
+
+            unloaded = m_AsyncLoadStates.at(load.resource.Get()).unloaded;
+        }
+
+        // The Resource of an unloaded load is only released by FinishAsyncLoad(), so it doesn't need to be decoded
+        if (unloaded)
+        {
+            load.sourceDataSet = false;
+        }
+        else if (load.resource->IsSourceDataSet())
+        {
+            load.sourceDataSet = true;
+        }
+        else if (load.file->GetLoaded() || load.file->Load())
+        {
+            load.sourceDataSet = load.resource->SetSourceData(load.file);
+            if (!load.sourceDataSet)
+                Logger::LogError("Couldn't set the source data of resource {}", load.resource->GetName());
+        }
+
+        m_AsyncUploadQueue.Push(std::move(load));
+    }
+}
+
+void ResourceManager::FinishAsyncLoad(AsyncLoad& load, const bool cancelled)
+{
+    bool unloaded, lastLoad;
+    {
+        std::scoped_lock lock(m_AsyncDecodeMutex);
+
+        const auto state = m_AsyncLoadStates.find(load.resource.Get());
+        unloaded = state->second.unloaded;
+        lastLoad = --state->second.pendingCount == 0;
+        if (lastLoad)
+            m_AsyncLoadStates.erase(state);
+    }
+
+    if (unloaded)
+    {
+        // Release what Unload() left to this load, now that no worker can use the Resource anymore
+        if (lastLoad)
+        {
+            if (load.resource->IsLoaded())
+                load.resource->Unload();
+
+            if (load.resource->IsSourceDataSet())
+                load.resource->ResetSourceData();
+        }
+
+        load.onFinished(false);
+        return;
+    }
+
+    const bool success = !cancelled && load.sourceDataSet;
+    if (success && !load.resource->IsLoaded())
+        load.resource->Load();
+
+    load.onFinished(success);
+}
+
+void ResourceManager::UnloadResource(Resource& resource)
+{
+    {
+        std::scoped_lock lock(m_AsyncDecodeMutex);
+
+        // A worker may be setting the source data of the Resource, so its load releases it once it finishes instead
+        const auto state = m_AsyncLoadStates.find(&resource);
+        if (state != m_AsyncLoadStates.end())
+        {
+            state->second.unloaded = true;
+            return;
+        }
+    }
+
+    if (resource.IsLoaded())
+        resource.Unload();
+
+    if (resource.IsSourceDataSet())
+        resource.ResetSourceData();
+}
+
 Pointer<Font> ResourceManager::LoadFont(const Pointer<File>& file, const u32 size)
 {
     Logger::LogVerbose("Loading font {} with size {}", file->GetPath(), size);
@@ -72,6 +285,7 @@ void ResourceManager::LoadAll()
     FileManager::FindAll<File>([](Pointer<File> file) { return file->GetResource() == nullptr && !IsBinary(file->GetPathString()); }, &files);
 
     const usize oldResourceCount = m_Resources.size();
+    const u32 oldShaderCacheHits = ShaderBase::GetCacheHitCount(), oldShaderCacheMisses = ShaderBase::GetCacheMissCount();
 
     // Preload resource data asynchronously
     std::for_each(
@@ -140,6 +354,12 @@ void ResourceManager::LoadAll()
     for (Pointer shader : shadersToLoad)
         shader->Load();
 
+    Logger::LogVerbose(
+        "Shader program cache: {} hits, {} misses",
+        ShaderBase::GetCacheHitCount() - oldShaderCacheHits,
+        ShaderBase::GetCacheMissCount() - oldShaderCacheMisses
+    );
+
     Logger::LogVerbose(
         "Successfully loaded {} files in {} resources. Took {}ms",
         files.GetSize(),
@@ -156,13 +376,15 @@ void ResourceManager::LoadAllBinaries()
 
     const auto files = rh::embed.ListFiles();
     const usize oldResourceCount = m_Resources.size();
+    const u32 oldShaderCacheHits = ShaderBase::GetCacheHitCount(), oldShaderCacheMisses = ShaderBase::GetCacheMissCount();
 
     for (auto&& fileString : files)
     {
         auto data = rh::embed(fileString);
 
         Pointer file = FileManager::Add(fileString);
-        file->Load(reinterpret_cast<const c8*>(data.data()), data.size());
+        // Embedded resources are static arrays, so reference them directly instead of copying them
+        file->LoadBorrowed(reinterpret_cast<const c8*>(data.data()), data.size());
         file->UpdateUtilityValues();
 
         std::filesystem::path parentPath = file->GetPath().parent_path();
@@ -235,6 +457,12 @@ void ResourceManager::LoadAllBinaries()
     for (Pointer shader : shadersToLoad)
         shader->Load();
 
+    Logger::LogVerbose(
+        "Shader program cache: {} hits, {} misses",
+        ShaderBase::GetCacheHitCount() - oldShaderCacheHits,
+        ShaderBase::GetCacheMissCount() - oldShaderCacheMisses
+    );
+
     Logger::LogVerbose(
         "Successfully loaded {} files in {} resources. Took {}ms",
         files.size(),
@@ -310,11 +538,7 @@ void ResourceManager::Unload(const std::string& name)
         return;
     }
 
-    if (resource->second->IsLoaded())
-        resource->second->Unload();
-
-    if (resource->second->IsSourceDataSet())
-        resource->second->ResetSourceData();
+    UnloadResource(*resource->second);
 
     m_Resources.erase(resource);
 }
@@ -325,6 +549,8 @@ void ResourceManager::UnloadAll()
 
     START_STOPWATCH;
 
+    StopAsyncLoads();
+
     for (auto& resource : m_Resources)
     {
         Logger::LogVerbose("Unloading resource {}", resource.first);
@@ -1,12 +1,20 @@
 ﻿#pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
 #include <unordered_map>
 
 #include "Mountain/FileSystem/File.hpp"
 #include "Mountain/Resource/Resource.hpp"
+#include "Mountain/Resource/ShaderBase.hpp"
+#include "Mountain/Containers/FunctionTypes.hpp"
 #include "Mountain/Containers/List.hpp"
+#include "Mountain/Utils/Event.hpp"
 #include "Mountain/Utils/Logger.hpp"
 #include "Mountain/Utils/Pointer.hpp"
+#include "Mountain/Utils/TsQueue.hpp"
 
 /// @file ResourceManager.hpp
 /// @brief Defines the Mountain::ResourceManager class.
@@ -21,6 +29,11 @@ namespace Mountain
         STATIC_CLASS(ResourceManager)
 
     public:
+        /// @brief Event invoked on the main thread each time an asynchronous load finishes.
+        /// @details The first parameter is the number of finished loads and the second one the number of requested loads since the
+        /// last time the asynchronous loading queue was empty.
+        MOUNTAIN_API static inline Event<usize, usize> onAsyncLoadProgress;
+
         /// @brief Creates the Resource corresponding to the given @p name without loading it.
         template <Concepts::LoadableResource T>
         static Pointer<T> Add(const std::string& name);
@@ -38,6 +51,47 @@ namespace Mountain
         template <Concepts::LoadableResource T>
         static Pointer<T> Load(const std::string& name, bool loadInInterface = true);
 
+        /// @brief Creates the Resource corresponding to the given @p file and loads it asynchronously.
+        /// @details The file contents are read and the source data is set on a worker thread. The Resource is then loaded in the
+        /// backend on the main thread by @c UpdateAsyncLoads(), which only spends @c GetAsyncUploadBudget() milliseconds per frame.
+        /// The source data of shaders is set on the calling thread instead, as resolving their includes uses the @c FileManager.
+        /// @returns A future holding the Resource once it is fully loaded, or a null @c Pointer if its source data couldn't be set
+        /// or if it was unloaded in the meantime.
+        /// @warning Never wait on the returned future from the main thread, as it is only fulfilled by @c UpdateAsyncLoads().
+        template <Concepts::LoadableResource T>
+        static std::shared_future<Pointer<T>> LoadAsync(const Pointer<File>& file);
+
+        /// @brief Creates the Resource corresponding to the given @p name and loads it asynchronously.
+        /// @note If the file hasn't been loaded yet, it will be loaded on a worker thread.
+        /// @see LoadAsync(const Pointer<File>&)
+        template <Concepts::LoadableResource T>
+        static std::shared_future<Pointer<T>> LoadAsync(const std::string& name);
+
+        /// @brief Loads the asynchronously decoded Resources in the backend until the upload budget of the frame is spent.
+        /// @details This function is called automatically each frame by the Game. At least one Resource is loaded per call.
+        MOUNTAIN_API static void UpdateAsyncLoads();
+
+        /// @brief Gets the number of milliseconds @c UpdateAsyncLoads() is allowed to spend each frame.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static f32 GetAsyncUploadBudget();
+
+        /// @brief Sets the number of milliseconds @c UpdateAsyncLoads() is allowed to spend each frame.
+        MOUNTAIN_API static void SetAsyncUploadBudget(f32 newAsyncUploadBudget);
+
+        /// @brief Gets the number of asynchronous loads that haven't finished yet.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static usize GetPendingAsyncLoadCount();
+
+        /// @brief Gets the progress of the asynchronous loads, between 0 and 1.
+        /// @details This is 1 if there are no pending asynchronous loads.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static f32 GetAsyncLoadProgress();
+
+        /// @brief Stops the asynchronous loading worker threads and discards all pending asynchronous loads.
+        /// @details The futures of the discarded loads are fulfilled with an empty pointer.
+        /// This function is called automatically by @c UnloadAll().
+        MOUNTAIN_API static void StopAsyncLoads();
+
         /// @brief Creates the Font corresponding to the given @p file and loads it with the given @p size.
         MOUNTAIN_API static Pointer<Font> LoadFont(const Pointer<File>& file, u32 size);
 
@@ -136,9 +190,12 @@ namespace Mountain
         static void FindAll(const Predicate<Pointer<T>>& predicate, List<Pointer<T>>* result);
 
         /// @brief Unloads the Resource with the given @p name.
+        /// @details If the Resource is being loaded asynchronously, it is removed right away but only released once the load
+        /// reaches @c UpdateAsyncLoads(), which fulfills its future with a null @c Pointer.
         MOUNTAIN_API static void Unload(const std::string& name);
 
         /// @brief Unloads the given @p resource.
+        /// @see Unload(const std::string&)
         template <Concepts::Resource T>
         static void Unload(const Pointer<T>& resource);
 
@@ -150,6 +207,50 @@ namespace Mountain
         MOUNTAIN_API static inline std::mutex m_ResourcesMutex;
         MOUNTAIN_API static inline std::unordered_map<Guid, std::string> m_GuidMap;
 
+        struct AsyncLoad
+        {
+            /// @brief Strong reference to the loaded Resource, so that unloading it can't free it under a worker
+            Pointer<Resource> resource;
+            Pointer<File> file;
+            /// @brief Fulfills the future returned by @c LoadAsync(), with @c false if the source data couldn't be set
+            Action<bool> onFinished;
+            bool sourceDataSet = false;
+        };
+
+        struct AsyncLoadState
+        {
+            u32 pendingCount = 0;
+            /// @brief Whether the Resource was unloaded while being loaded, in which case the last load releases it
+            bool unloaded = false;
+        };
+
+        static constexpr u32 MaxAsyncWorkerCount = 4;
+
+        MOUNTAIN_API static inline List<std::thread> m_AsyncWorkers;
+        MOUNTAIN_API static inline std::deque<AsyncLoad> m_AsyncDecodeQueue;
+        MOUNTAIN_API static inline std::mutex m_AsyncDecodeMutex;
+        MOUNTAIN_API static inline std::condition_variable m_AsyncDecodeCondVar;
+        MOUNTAIN_API static inline bool m_AsyncWorkersRunning = false;
+        /// @brief The Resources with asynchronous loads in progress, guarded by @c m_AsyncDecodeMutex
+        MOUNTAIN_API static inline std::unordered_map<const Resource*, AsyncLoadState> m_AsyncLoadStates;
+
+        MOUNTAIN_API static inline TsQueue<AsyncLoad> m_AsyncUploadQueue;
+        MOUNTAIN_API static inline f32 m_AsyncUploadBudget = 2.f;
+
+        // Both guarded by m_AsyncDecodeMutex so that they are always reset together
+        MOUNTAIN_API static inline usize m_AsyncRequestedCount = 0;
+        MOUNTAIN_API static inline usize m_AsyncFinishedCount = 0;
+
+        MOUNTAIN_API static void EnqueueAsyncLoad(AsyncLoad&& load);
+
+        static void RunAsyncWorker();
+
+        /// @brief Loads the Resource of @p load in the backend, unless it was @p cancelled or unloaded, and fulfills its future.
+        static void FinishAsyncLoad(AsyncLoad& load, bool cancelled);
+
+        /// @brief Unloads @p resource and resets its source data, or lets its asynchronous load do it once it finishes.
+        MOUNTAIN_API static void UnloadResource(Resource& resource);
+
         template <Concepts::Resource T>
         static Pointer<T> AddNoCheck(std::string name);
 
@@ -225,6 +326,68 @@ namespace Mountain
         return Load<T>(FileManager::Contains(name) ? FileManager::Get(name) : FileManager::Load(name), loadInInterface);
     }
 
+    template <Concepts::LoadableResource T>
+    std::shared_future<Pointer<T>> ResourceManager::LoadAsync(const Pointer<File>& file)
+    {
+        Logger::LogVerbose("Loading resource {} asynchronously", file->GetPath());
+
+        auto promise = std::make_shared<std::promise<Pointer<T>>>();
+        std::shared_future<Pointer<T>> future = promise->get_future().share();
+
+        Pointer<T> resource;
+        if (Contains(file->GetPathString()))
+        {
+            resource = GetNoCheck<T>(file->GetPathString());
+            if (resource->IsLoaded())
+            {
+                Logger::LogWarning("This resource has already been loaded, consider using ResourceManager::Get instead");
+                promise->set_value(resource);
+                return future;
+            }
+        }
+        else
+        {
+            resource = AddNoCheck<T>(file->GetPathString());
+        }
+
+        file->m_Resource = Pointer<Resource>(resource, false);
+
+        // The workers can't use the FileManager as it isn't thread-safe, and the shaders need it to resolve their
+        // includes, so their source is set here. They are small text files anyway, the heavy part is compiling them
+        if constexpr (Meta::IsBaseOf<ShaderBase, T>)
+        {
+            if (!resource->IsSourceDataSet() && (file->GetLoaded() || file->Load()))
+                resource->SetSourceData(file);
+        }
+
+        EnqueueAsyncLoad(
+            {
+                .resource = Pointer<Resource>(resource, true),
+                // Keep the file alive even if it is unloaded from the FileManager while the worker reads it
+                .file = file.CreateStrongReference(),
+                .onFinished = [promise, resource](const bool success) { promise->set_value(success ? resource : nullptr); }
+            }
+        );
+
+        return future;
+    }
+
+    template <Concepts::LoadableResource T>
+    std::shared_future<Pointer<T>> ResourceManager::LoadAsync(const std::string& name)
+    {
+        // Only add the file here, its contents are read by the worker thread
+        Pointer<File> file = FileManager::Contains(name) ? FileManager::Get(name) : FileManager::Add(name);
+
+        if (!file)
+        {
+            std::promise<Pointer<T>> promise;
+            promise.set_value(nullptr);
+            return promise.get_future().share();
+        }
+
+        return LoadAsync<T>(file);
+    }
+
     template <Concepts::Resource T>
     Pointer<T> ResourceManager::Get(const std::string& name)
     {
@@ -327,11 +490,7 @@ namespace Mountain
             Pointer<Resource>& storedResource = it->second;
             if (storedResource == resource)
             {
-                if (storedResource->IsLoaded())
-                    storedResource->Unload();
-
-                if (storedResource->IsSourceDataSet())
-                    storedResource->ResetSourceData();
+                UnloadResource(*storedResource);
 
                 it = m_Resources.erase(it);
 
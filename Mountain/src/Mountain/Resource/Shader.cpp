@@ -47,7 +47,11 @@ bool Shader::Load(const c8* const buffer, const s64 length, const Graphics::Shad
 {
     ShaderCode& code = m_Code[static_cast<usize>(type)];
     code.code = Utils::RemoveByteOrderMark(std::string{buffer, static_cast<usize>(length)});
-    ReplaceIncludes(code.code, m_File->GetPath(), m_DependentShaderFiles);
+
+    // Each stage is compiled on its own, so a file included by several stages must be included in all of them
+    std::unordered_set<std::filesystem::path> includedFiles;
+    ReplaceIncludes(code.code, m_File->GetPath(), includedFiles);
+    m_DependentShaderFiles.insert(includedFiles.begin(), includedFiles.end());
     code.type = type;
 
     m_SourceDataSet = true;
@@ -57,6 +61,20 @@ bool Shader::Load(const c8* const buffer, const s64 length, const Graphics::Shad
 
 void Shader::Load()
 {
+    Array<std::string_view, magic_enum::enum_count<Graphics::ShaderType>()> sources;
+    for (usize i = 0; i < sources.GetSize(); i++)
+        sources[i] = m_Code[i].code;
+
+    const u64 cacheKey = ComputeCacheKey({ sources.GetData(), sources.GetSize() });
+    if (LoadFromCache(cacheKey))
+    {
+#ifdef _DEBUG
+        glObjectLabel(GL_PROGRAM, m_Id, static_cast<GLsizei>(m_Name.length()), m_Name.c_str());
+#endif
+        m_Loaded = true;
+        return;
+    }
+
     Array<u32, magic_enum::enum_count<Graphics::ShaderType>()> shaderIds{0};
     bool compileError = false;
     for (usize i = 0; i < shaderIds.GetSize(); i++)
@@ -88,33 +106,38 @@ void Shader::Load()
         return;
     }
 
-    if (glIsProgram(m_Id))
-        glDeleteProgram(m_Id);
-
-    m_Id = glCreateProgram();
+    // Link the new program before deleting the current one, so that a failed reload keeps the previous program
+    const u32 program = glCreateProgram();
 #ifdef _DEBUG
-    glObjectLabel(GL_PROGRAM, m_Id, static_cast<GLsizei>(m_Name.length()), m_Name.c_str());
+    glObjectLabel(GL_PROGRAM, program, static_cast<GLsizei>(m_Name.length()), m_Name.c_str());
 #endif
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
     for (usize i = 0; i < shaderIds.GetSize(); i++)
     {
         if (shaderIds[i] != 0)
-            glAttachShader(m_Id, shaderIds[i]);
+            glAttachShader(program, shaderIds[i]);
     }
 
-    glLinkProgram(m_Id);
+    glLinkProgram(program);
 
     for (const u32 shaderId : shaderIds)
     {
         if (glIsShader(shaderId))
         {
-            glDetachShader(m_Id, shaderId);
+            glDetachShader(program, shaderId);
             glDeleteShader(shaderId);
         }
     }
 
-    if (CheckLinkError())
+    if (CheckLinkError(program))
+    {
+        glDeleteProgram(program);
         THROW(InvalidOperationException{"A Shader failed to link after compiling successfully"});
+    }
+
+    ReplaceProgram(program);
+    SaveToCache(cacheKey);
 
     m_Loaded = true;
 }
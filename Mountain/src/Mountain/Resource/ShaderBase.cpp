@@ -1,7 +1,12 @@
 ﻿#include "Mountain/Resource/ShaderBase.hpp"
 
+#include <fstream>
+
 #include <glad/glad.h>
 
+#include "Mountain/Globals.hpp"
+#include "Mountain/Containers/EnumerableExt.hpp"
+#include "Mountain/Containers/List.hpp"
 #include "Mountain/FileSystem/FileManager.hpp"
 #include "Mountain/Graphics/Graphics.hpp"
 #include "Mountain/Math/Math.hpp"
@@ -9,6 +14,63 @@
 
 using namespace Mountain;
 
+namespace
+{
+    struct CacheHeader
+    {
+        u32 magic;
+        u32 binaryFormat;
+        u64 key;
+    };
+
+    constexpr u32 CacheMagic = 0x4348534D; // "MSHC"
+
+    void HashData(u64& hash, const void* const data, const usize size)
+    {
+        // 64-bit FNV-1a
+        const u8* const bytes = static_cast<const u8*>(data);
+        for (usize i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3;
+        }
+    }
+
+    void HashString(u64& hash, const std::string_view string)
+    {
+        // Also hash the length so that moving code from one stage to the next changes the key
+        const usize length = string.length();
+        HashData(hash, &length, sizeof(length));
+        HashData(hash, string.data(), string.length());
+    }
+
+    const List<s32>& GetBinaryFormats()
+    {
+        static const List<s32> formats = []
+        {
+            s32 count = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+
+            List<s32> result;
+            result.Resize(static_cast<usize>(count));
+            if (count > 0)
+                glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, result.GetData());
+            return result;
+        }();
+
+        return formats;
+    }
+
+    std::filesystem::path GetCacheFilePath(const std::string_view shaderName)
+    {
+        // The file is named after the shader and not after the cache key, so that changing the source code of a shader
+        // overwrites its previous entry instead of leaving it in the cache forever
+        u64 hash = 0xCBF29CE484222325;
+        HashString(hash, shaderName);
+        return std::filesystem::path{ShaderCachePath} / std::format("{:016x}.bin", hash);
+    }
+}
+
 void ShaderBase::Unload()
 {
     Resource::Unload();
@@ -79,17 +141,17 @@ bool ShaderBase::CheckCompileError(const u32 id, const std::string_view type, co
     return false;
 }
 
-bool ShaderBase::CheckLinkError() const
+bool ShaderBase::CheckLinkError(const u32 program) const
 {
     int success = 0;
 
-    glGetProgramiv(m_Id, GL_LINK_STATUS, &success);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
     if (!success)
     {
         GLint infoLogSize = 0;
-        glGetProgramiv(m_Id, GL_INFO_LOG_LENGTH, &infoLogSize);
+        glGetProgramiv(program, GL_INFO_LOG_LENGTH, &infoLogSize);
         std::string infoLog(static_cast<usize>(infoLogSize), '\0');
-        glGetProgramInfoLog(m_Id, infoLogSize, nullptr, infoLog.data());
+        glGetProgramInfoLog(program, infoLogSize, nullptr, infoLog.data());
         Logger::LogError("Error while linking shader program '{}': {}", m_Name, Utils::Trim(infoLog).data());
 
         return true;
@@ -98,6 +160,16 @@ bool ShaderBase::CheckLinkError() const
     return false;
 }
 
+void ShaderBase::ReplaceProgram(const u32 program)
+{
+    if (glIsProgram(m_Id))
+        glDeleteProgram(m_Id);
+
+    m_Id = program;
+    // Uniform locations may differ in the new program
+    m_UniformLocationCache.clear();
+}
+
 s32 ShaderBase::GetUniformLocation(const c8* uniformName) const
 {
     if (m_UniformLocationCache.contains(uniformName))
@@ -140,7 +212,7 @@ void ShaderBase::ReplaceIncludes(std::string& code, const std::filesystem::path&
             continue;
         }
 
-        Pointer file = FileManager::Get(filepath);
+        const Pointer file = FileManager::Get(filepath);
         std::string fileContents{file->GetData(), static_cast<usize>(file->GetSize())};
         fileContents = Utils::RemoveByteOrderMark(fileContents);
 
@@ -153,3 +225,118 @@ void ShaderBase::ReplaceIncludes(std::string& code, const std::filesystem::path&
         initialLineLength = fileContents.length();
     }
 }
+
+u64 ShaderBase::ComputeCacheKey(const std::span<const std::string_view> sources)
+{
+    // Program binaries are only valid for the driver that created them
+    static const u64 DriverHash = []
+    {
+        u64 hash = 0xCBF29CE484222325;
+        for (const GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+        {
+            const c8* const string = reinterpret_cast<const c8*>(glGetString(name));
+            HashString(hash, string ? string : "");
+        }
+        return hash;
+    }();
+
+    u64 hash = DriverHash;
+    for (const std::string_view source : sources)
+        HashString(hash, source);
+    return hash;
+}
+
+bool ShaderBase::LoadFromCache(const u64 key)
+{
+    if (!IsCacheAvailable())
+        return false;
+
+    const std::filesystem::path path = GetCacheFilePath(m_Name);
+    std::ifstream input{path, std::ios::in | std::ios::ate | std::ios::binary};
+    if (!input.is_open())
+    {
+        m_CacheMissCount++;
+        return false;
+    }
+
+    const std::streamoff size = input.tellg();
+    CacheHeader header{};
+    List<u8> binary;
+    if (size > static_cast<std::streamoff>(sizeof(header)))
+    {
+        input.seekg(0);
+        input.read(reinterpret_cast<c8*>(&header), sizeof(header));
+        binary.Resize(static_cast<usize>(size) - sizeof(header));
+        input.read(reinterpret_cast<c8*>(binary.GetData()), static_cast<std::streamsize>(binary.GetSize()));
+    }
+
+    // Passing an unsupported format to glProgramBinary is an error, so check it beforehand
+    if (!input.good() ||
+        header.magic != CacheMagic ||
+        !GetBinaryFormats().Contains(static_cast<s32>(header.binaryFormat)))
+    {
+        Logger::LogWarning("Invalid shader cache file {}, shader {} will be recompiled", path, m_Name);
+        m_CacheMissCount++;
+        return false;
+    }
+
+    // The entry was saved for a different source code or driver, it will be overwritten once the shader is compiled
+    if (header.key != key)
+    {
+        Logger::LogVerbose("Cached binary of shader {} is out of date, recompiling it", m_Name);
+        m_CacheMissCount++;
+        return false;
+    }
+
+    const u32 program = glCreateProgram();
+    glProgramBinary(program, header.binaryFormat, binary.GetData(), static_cast<GLsizei>(binary.GetSize()));
+
+    // The driver may still reject the binary, e.g. if it was updated without changing its version string
+    s32 success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        Logger::LogVerbose("Cached binary of shader {} was rejected by the driver, recompiling it", m_Name);
+        glDeleteProgram(program);
+        m_CacheMissCount++;
+        return false;
+    }
+
+    ReplaceProgram(program);
+    m_CacheHitCount++;
+    return true;
+}
+
+void ShaderBase::SaveToCache(const u64 key) const
+{
+    if (!IsCacheAvailable())
+        return;
+
+    s32 length = 0;
+    glGetProgramiv(m_Id, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    CacheHeader header{ .magic = CacheMagic, .binaryFormat = 0, .key = key };
+    List<u8> binary;
+    binary.Resize(static_cast<usize>(length));
+    glGetProgramBinary(m_Id, length, nullptr, &header.binaryFormat, binary.GetData());
+
+    std::error_code error;
+    std::filesystem::create_directories(ShaderCachePath, error);
+    if (error)
+    {
+        Logger::LogWarning("Couldn't create shader cache directory {}: {}", ShaderCachePath, error.message());
+        return;
+    }
+
+    const std::filesystem::path path = GetCacheFilePath(m_Name);
+    std::ofstream output{path, std::ios::out | std::ios::binary | std::ios::trunc};
+    output.write(reinterpret_cast<const c8*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const c8*>(binary.GetData()), static_cast<std::streamsize>(binary.GetSize()));
+
+    if (!output.good())
+        Logger::LogWarning("Couldn't write shader cache file {}", path);
+}
+
+bool ShaderBase::IsCacheAvailable() { return !ShaderCachePath.empty() && !GetBinaryFormats().IsEmpty(); }
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <span>
 #include <unordered_set>
 
 #include "Mountain/Core.hpp"
@@ -61,6 +62,14 @@ namespace Mountain
 		/// @brief Gets all files that this shader depends on, i.e., that are included in this shader.
 		GETTER(const std::unordered_set<std::filesystem::path>&, DependentShaderFiles, m_DependentShaderFiles)
 
+		/// @brief Gets the number of shader programs that were loaded from the program binary cache.
+		/// @see ShaderCachePath
+		STATIC_GETTER(u32, CacheHitCount, m_CacheHitCount)
+
+		/// @brief Gets the number of shader programs that had to be compiled because they weren't in the program binary cache.
+		/// @see ShaderCachePath
+		STATIC_GETTER(u32, CacheMissCount, m_CacheMissCount)
+
 	protected:
 		u32 m_Id = 0;
 
@@ -70,12 +79,41 @@ namespace Mountain
 		mutable std::unordered_map<const c8*, s32> m_UniformLocationCache;
 
 		bool CheckCompileError(u32 id, std::string_view type, const std::string& code) const;  // NOLINT(modernize-use-nodiscard)
-		bool CheckLinkError() const;  // NOLINT(modernize-use-nodiscard)
+		bool CheckLinkError(u32 program) const;  // NOLINT(modernize-use-nodiscard)
+
+		/// @brief Deletes the current program and replaces it with @p program.
+		/// @details Only call this once the new program is successfully linked, so that a failed reload keeps the previous
+		/// program.
+		void ReplaceProgram(u32 program);
 
 		ATTRIBUTE_NODISCARD
 		s32 GetUniformLocation(const c8* uniformName) const;
 
 		static void ReplaceIncludes(std::string& code, const std::filesystem::path& path, std::unordered_set<std::filesystem::path>& replacedFiles);
+
+		/// @brief Computes the key of a program in the program binary cache.
+		/// @details The key depends on the source code of all stages as well as on the OpenGL vendor, renderer and version,
+		/// as program binaries are only valid for the exact driver that created them.
+		ATTRIBUTE_NODISCARD
+		static u64 ComputeCacheKey(std::span<const std::string_view> sources);
+
+		/// @brief Tries to create the program from the program binary cache.
+		/// @details The current program is only replaced if the cached binary is successfully loaded.
+		/// @return Whether the program was found in the cache and successfully loaded. If not, the shader must be compiled.
+		bool LoadFromCache(u64 key);
+
+		/// @brief Saves the binary of the current program in the program binary cache.
+		/// @details The program must have been linked with @c GL_PROGRAM_BINARY_RETRIEVABLE_HINT set. Each shader has a single
+		/// cache file named after it, so this replaces the entry of its previous source code.
+		void SaveToCache(u64 key) const;
+
+		/// @brief Returns whether the program binary cache can be used, i.e., if it is enabled and the driver supports at least one binary format.
+		ATTRIBUTE_NODISCARD
+		static bool IsCacheAvailable();
+
+	private:
+		MOUNTAIN_API static inline u32 m_CacheHitCount = 0;
+		MOUNTAIN_API static inline u32 m_CacheMissCount = 0;
 	};
 
 	template <Concepts::Enum T>
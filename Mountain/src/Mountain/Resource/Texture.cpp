@@ -2,6 +2,9 @@
 
 #include "Mountain/Resource/Texture.hpp"
 
+#include <bit>
+#include <ranges>
+
 #include <stb_image.h>
 
 #include "Mountain/Utils/Logger.hpp"
@@ -31,15 +34,23 @@ void Texture::Load()
     m_GpuTexture.Create();
     m_GpuTexture.SetDebugName(m_Name);
 
-    m_GpuTexture.SetMinFilter(m_Filter);
-    m_GpuTexture.SetMagFilter(m_Filter);
+    ApplyFilter();
 
-    m_GpuTexture.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
-    m_GpuTexture.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
+    const s32 mipmapLevels = m_GenerateMipmaps ? static_cast<s32>(std::bit_width(static_cast<u32>(std::max({ 1, m_Size.x, m_Size.y })))) : 1;
 
-    m_GpuTexture.SetStorage(Graphics::InternalFormat::RedGreenBlueAlpha32Float, m_Size);
+    m_GpuTexture.SetStorage(m_InternalFormat, m_Size, mipmapLevels);
     if (m_Data)
+    {
         m_GpuTexture.SetSubData(Vector2i::Zero(), m_Size, Graphics::Format::RedGreenBlueAlpha, Graphics::DataType::UnsignedByte, m_Data);
+        if (mipmapLevels > 1)
+            m_GpuTexture.GenerateMipmap();
+    }
+
+    const s64 pixelSize = Graphics::GetPixelSize(m_InternalFormat);
+    m_MemorySize = 0;
+    for (s32 i = 0; i < mipmapLevels; i++)
+        m_MemorySize += static_cast<s64>(std::max(1, m_Size.x >> i)) * std::max(1, m_Size.y >> i) * pixelSize;
+    AddMemoryUsage(m_InternalFormat, m_MemorySize);
 
     m_Loaded = true;
 }
@@ -48,6 +59,9 @@ void Texture::Unload()
 {
     m_GpuTexture.Delete();
 
+    AddMemoryUsage(m_InternalFormat, -m_MemorySize);
+    m_MemorySize = 0;
+
     m_Loaded = false;
 }
 
@@ -72,18 +86,32 @@ Graphics::MagnificationFilter Texture::GetFilter() const { return m_Filter; }
 
 void Texture::SetFilter(const Graphics::MagnificationFilter newFilter)
 {
+    m_Filter = newFilter;
+
     if (m_Loaded)
-    {
-        m_GpuTexture.SetMinFilter(newFilter);
-        m_GpuTexture.SetMagFilter(newFilter);
+        ApplyFilter();
+}
 
-        m_GpuTexture.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
-        m_GpuTexture.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
-    }
+Graphics::InternalFormat Texture::GetInternalFormat() const { return m_InternalFormat; }
 
-    m_Filter = newFilter;
+void Texture::SetInternalFormat(const Graphics::InternalFormat newInternalFormat)
+{
+    if (m_Loaded)
+        THROW(InvalidOperationException{"Texture::SetInternalFormat() cannot be called once the Texture has been loaded"});
+    m_InternalFormat = newInternalFormat;
+}
+
+bool Texture::GetGenerateMipmaps() const { return m_GenerateMipmaps; }
+
+void Texture::SetGenerateMipmaps(const bool newGenerateMipmaps)
+{
+    if (m_Loaded)
+        THROW(InvalidOperationException{"Texture::SetGenerateMipmaps() cannot be called once the Texture has been loaded"});
+    m_GenerateMipmaps = newGenerateMipmaps;
 }
 
+s64 Texture::GetMemorySize() const { return m_MemorySize; }
+
 void Texture::Use() const { Graphics::BindTexture(m_GpuTexture); }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -92,3 +120,53 @@ void Texture::Unuse() const { Graphics::BindTexture(0); }
 u32 Texture::GetId() const { return m_GpuTexture.GetId(); }
 
 Graphics::GpuTexture Texture::GetGpuTexture() const { return m_GpuTexture; }
+
+s64 Texture::GetMemoryUsage(const Graphics::InternalFormat format)
+{
+    std::scoped_lock lock{m_MemoryUsageMutex};
+
+    const auto it = m_MemoryUsage.find(format);
+    return it == m_MemoryUsage.end() ? 0 : it->second;
+}
+
+s64 Texture::GetTotalMemoryUsage()
+{
+    std::scoped_lock lock{m_MemoryUsageMutex};
+
+    s64 total = 0;
+    for (const s64 size : m_MemoryUsage | std::views::values)
+        total += size;
+    return total;
+}
+
+List<std::pair<Graphics::InternalFormat, s64>> Texture::GetMemoryUsagePerFormat()
+{
+    std::scoped_lock lock{m_MemoryUsageMutex};
+
+    List<std::pair<Graphics::InternalFormat, s64>> result;
+    for (const auto& [format, size] : m_MemoryUsage)
+    {
+        if (size != 0)
+            result.Add({ format, size });
+    }
+    return result;
+}
+
+void Texture::AddMemoryUsage(const Graphics::InternalFormat format, const s64 size)
+{
+    std::scoped_lock lock{m_MemoryUsageMutex};
+
+    m_MemoryUsage[format] += size;
+}
+
+void Texture::ApplyFilter() const
+{
+    if (m_GenerateMipmaps)
+        m_GpuTexture.SetMinFilter(m_Filter, Graphics::MagnificationFilter::Linear);
+    else
+        m_GpuTexture.SetMinFilter(m_Filter);
+    m_GpuTexture.SetMagFilter(m_Filter);
+
+    m_GpuTexture.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
+    m_GpuTexture.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
+}
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
 #include "Mountain/Graphics/GpuTexture.hpp"
 #include "Mountain/Graphics/Graphics.hpp"
+#include "Mountain/Math/Vector2.hpp"
 #include "Mountain/Math/Vector2i.hpp"
 #include "Mountain/Resource/Resource.hpp"
 
@@ -11,6 +16,8 @@
 
 namespace Mountain
 {
+    class TextureAtlas;
+
     /// @brief Represents an image in memory.
     class Texture : public Resource
     {
@@ -66,6 +73,29 @@ namespace Mountain
         MOUNTAIN_API Graphics::MagnificationFilter GetFilter() const;
         MOUNTAIN_API void SetFilter(Graphics::MagnificationFilter newFilter);
 
+        /// @brief Gets the format used to store the texture on the GPU
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Graphics::InternalFormat GetInternalFormat() const;
+
+        /// @brief Sets the format used to store the texture on the GPU
+        /// @details The source data is always decoded as 8-bit RGBA. Formats with fewer components only keep the first ones,
+        /// e.g., @c Red8 only keeps the red channel, which is enough for masks.
+        /// Use @c SignedRedGreenBlueAlpha8 for sRGB textures.
+        /// @throws InvalidOperationException If the Texture has already been loaded.
+        MOUNTAIN_API void SetInternalFormat(Graphics::InternalFormat newInternalFormat);
+
+        /// @brief Gets whether mipmaps are generated when loading the texture
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool GetGenerateMipmaps() const;
+
+        /// @brief Sets whether mipmaps are generated when loading the texture
+        /// @throws InvalidOperationException If the Texture has already been loaded.
+        MOUNTAIN_API void SetGenerateMipmaps(bool newGenerateMipmaps);
+
+        /// @brief Gets the number of bytes used by this texture on the GPU, mipmaps included, or 0 if it isn't loaded
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API s64 GetMemorySize() const;
+
         /// @brief Binds the texture
         MOUNTAIN_API void Use() const;
 
@@ -80,11 +110,52 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API Graphics::GpuTexture GetGpuTexture() const;
 
+        /// @brief Gets the TextureAtlas this texture was packed into, or @c nullptr if it isn't part of any
+        GETTER(TextureAtlas*, Atlas, m_Atlas)
+
+        /// @brief Gets the page of the TextureAtlas this texture was packed into
+        GETTER(s32, AtlasLayer, m_AtlasLayer)
+
+        /// @brief Gets the UV position of the top-left corner of this texture in its TextureAtlas page
+        GETTER(Vector2, AtlasUv0, m_AtlasUv0)
+
+        /// @brief Gets the UV position of the bottom-right corner of this texture in its TextureAtlas page
+        GETTER(Vector2, AtlasUv1, m_AtlasUv1)
+
+        /// @brief Gets the number of bytes used on the GPU by all the loaded Textures and TextureAtlases stored using the given @p format
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static s64 GetMemoryUsage(Graphics::InternalFormat format);
+
+        /// @brief Gets the number of bytes used on the GPU by all the loaded Textures and TextureAtlases
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static s64 GetTotalMemoryUsage();
+
+        /// @brief Gets the number of bytes used on the GPU by all the loaded Textures and TextureAtlases, for each format in use
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static List<std::pair<Graphics::InternalFormat, s64>> GetMemoryUsagePerFormat();
+
     private:
         u8* m_Data = nullptr;
         Vector2i m_Size;
         Graphics::GpuTexture m_GpuTexture;
         Graphics::MagnificationFilter m_Filter = Graphics::MagnificationFilter::Nearest;
+        Graphics::InternalFormat m_InternalFormat = Graphics::InternalFormat::RedGreenBlueAlpha8;
+        bool m_GenerateMipmaps = false;
+        s64 m_MemorySize = 0;
+
+        TextureAtlas* m_Atlas = nullptr;
+        s32 m_AtlasLayer = 0;
+        Vector2 m_AtlasUv0, m_AtlasUv1;
+
+        MOUNTAIN_API static inline std::unordered_map<Graphics::InternalFormat, s64> m_MemoryUsage;
+        MOUNTAIN_API static inline std::mutex m_MemoryUsageMutex;
+
+        static void AddMemoryUsage(Graphics::InternalFormat format, s64 size);
+
+        void ApplyFilter() const;
+
+        // Packs textures and needs to set the atlas fields, and reports its memory usage
+        friend class TextureAtlas;
     };
 }
 
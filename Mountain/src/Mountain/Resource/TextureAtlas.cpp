@@ -0,0 +1,331 @@
+
+
+#include "Mountain/Resource/TextureAtlas.hpp"
+
+#include <algorithm>
+
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    /// @brief Copies the RGBA @p pixels of a texture of the given @p size, surrounded by @c TextureAtlas::Padding pixels on
+    /// each side that repeat its border.
+    List<u8> ExtrudeBorders(const u8* pixels, const Vector2i size)
+    {
+        constexpr s32 Padding = TextureAtlas::Padding;
+        const Vector2i paddedSize = size + Vector2i{Padding * 2};
+
+        List<u8> result;
+        result.Resize(static_cast<usize>(paddedSize.x) * paddedSize.y * 4);
+
+        for (s32 y = 0; y < paddedSize.y; y++)
+        {
+            const s32 sourceY = std::clamp(y - Padding, 0, size.y - 1);
+            for (s32 x = 0; x < paddedSize.x; x++)
+            {
+                const s32 sourceX = std::clamp(x - Padding, 0, size.x - 1);
+                std::copy_n(
+                    pixels + (static_cast<usize>(sourceY) * size.x + sourceX) * 4,
+                    4,
+                    result.GetData() + (static_cast<usize>(y) * paddedSize.x + x) * 4
+                );
+            }
+        }
+
+        return result;
+    }
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    if (m_Loaded)
+        TextureAtlas::Unload();
+
+    if (m_SourceDataSet)
+        TextureAtlas::ResetSourceData();
+}
+
+void TextureAtlas::Load()
+{
+    CreateGpuTexture(std::max(GetPageCount(), 1));
+
+    for (const Entry& entry : m_Entries)
+        Upload(entry);
+
+    m_Loaded = true;
+}
+
+void TextureAtlas::Unload()
+{
+    DeleteGpuTexture(m_GpuTexture, m_GpuPageCapacity);
+    m_GpuPageCapacity = 0;
+
+    m_Loaded = false;
+}
+
+void TextureAtlas::ResetSourceData()
+{
+    for (Entry& entry : m_Entries)
+    {
+        if (entry.texture)
+            entry.texture->m_Atlas = nullptr;
+    }
+
+    m_Entries.Clear();
+    m_Pages.Clear();
+
+    m_SourceDataSet = false;
+}
+
+bool TextureAtlas::Add(const Pointer<Texture>& texture)
+{
+    if (!CanAdd(*texture))
+        return false;
+
+    const Vector2i paddedSize = texture->GetSize() + Vector2i{Padding * 2};
+
+    for (usize i = 0; i < m_Pages.GetSize(); i++)
+    {
+        const Optional<Vector2i> position = m_Pages[i].Insert(paddedSize);
+        if (!position.HasValue())
+            continue;
+
+        Pack(texture, static_cast<s32>(i), position.Value());
+        return true;
+    }
+
+    AddPage();
+    Pack(texture, GetPageCount() - 1, Last(m_Pages).Insert(paddedSize).Value());
+    return true;
+}
+
+bool TextureAtlas::AddRange(const List<Pointer<Texture>>& textures)
+{
+    List<Pointer<Texture>> toAdd;
+    bool result = true;
+
+    for (const Pointer<Texture>& texture : textures)
+    {
+        if (Contains(*texture))
+            continue;
+
+        if (CanAdd(*texture))
+            toAdd.Add(texture);
+        else
+            result = false;
+    }
+
+    if (toAdd.IsEmpty())
+        return result;
+
+    // Packing the tallest textures first gives much better results with a skyline
+    toAdd.Sort([](const Pointer<Texture>& a, const Pointer<Texture>& b) { return a->GetSize().y > b->GetSize().y; });
+
+    List<Vector2i> positions;
+    positions.Reserve(toAdd.GetSize());
+
+    // Try to fit all the textures using a copy of a page, and only commit the copy if they all fit
+    const auto tryPage = [&](const SkylinePacker& page) -> Optional<SkylinePacker>
+    {
+        SkylinePacker packer = page;
+        positions.Clear();
+
+        for (const Pointer<Texture>& texture : toAdd)
+        {
+            const Optional<Vector2i> position = packer.Insert(texture->GetSize() + Vector2i{Padding * 2});
+            if (!position.HasValue())
+                return {};
+
+            positions.Add(position.Value());
+        }
+
+        return packer;
+    };
+
+    for (usize i = 0; i < m_Pages.GetSize(); i++)
+    {
+        Optional<SkylinePacker> packer = tryPage(m_Pages[i]);
+        if (!packer.HasValue())
+            continue;
+
+        m_Pages[i] = std::move(packer.Value());
+        for (usize j = 0; j < toAdd.GetSize(); j++)
+            Pack(toAdd[j], static_cast<s32>(i), positions[j]);
+
+        return result;
+    }
+
+    Optional<SkylinePacker> packer = tryPage(SkylinePacker{m_PageSize});
+    if (packer.HasValue())
+    {
+        AddPage();
+        Last(m_Pages) = std::move(packer.Value());
+        for (usize j = 0; j < toAdd.GetSize(); j++)
+            Pack(toAdd[j], GetPageCount() - 1, positions[j]);
+
+        return result;
+    }
+
+    // The textures don't fit in a single page, spread them over as few pages as possible
+    Logger::LogWarning("Textures given to TextureAtlas {} don't fit in a single {}x{} page", m_Name, m_PageSize.x, m_PageSize.y);
+    for (const Pointer<Texture>& texture : toAdd)
+        result &= Add(texture);
+
+    return result;
+}
+
+bool TextureAtlas::IsCompatible(const Texture& texture)
+{
+    return texture.GetInternalFormat() == Graphics::InternalFormat::RedGreenBlueAlpha8 && !texture.GetGenerateMipmaps();
+}
+
+bool TextureAtlas::Contains(const Texture& texture) const { return texture.m_Atlas == this; }
+
+Vector2i TextureAtlas::GetPageSize() const { return m_PageSize; }
+
+void TextureAtlas::SetPageSize(const Vector2i newPageSize)
+{
+    if (!m_Entries.IsEmpty())
+        THROW(InvalidOperationException{"TextureAtlas::SetPageSize() cannot be called once Textures have been added"});
+
+    m_PageSize = newPageSize;
+
+    if (m_Loaded)
+    {
+        DeleteGpuTexture(m_GpuTexture, m_GpuPageCapacity);
+        CreateGpuTexture(1);
+    }
+}
+
+s32 TextureAtlas::GetPageCount() const { return static_cast<s32>(m_Pages.GetSize()); }
+
+f32 TextureAtlas::GetOccupancy(const s32 page) const { return m_Pages.At(static_cast<usize>(page)).GetOccupancy(); }
+
+Graphics::MagnificationFilter TextureAtlas::GetFilter() const { return m_Filter; }
+
+void TextureAtlas::SetFilter(const Graphics::MagnificationFilter newFilter)
+{
+    if (m_Loaded)
+    {
+        m_GpuTexture.SetMinFilter(newFilter);
+        m_GpuTexture.SetMagFilter(newFilter);
+    }
+
+    m_Filter = newFilter;
+}
+
+u32 TextureAtlas::GetId() const { return m_GpuTexture.GetId(); }
+
+Graphics::GpuTextureArray TextureAtlas::GetGpuTexture() const { return m_GpuTexture; }
+
+bool TextureAtlas::CanAdd(const Texture& texture) const
+{
+    if (texture.m_Atlas)
+    {
+        if (texture.m_Atlas != this)
+            Logger::LogWarning("Cannot add Texture {} to TextureAtlas {} as it is already part of another atlas", texture.GetName(), m_Name);
+        return false;
+    }
+
+    if (!IsCompatible(texture))
+    {
+        Logger::LogVerbose("Texture {} cannot be added to TextureAtlas {} as it isn't stored as RGBA8 without mipmaps", texture.GetName(), m_Name);
+        return false;
+    }
+
+    if (!texture.GetData())
+    {
+        Logger::LogWarning("Cannot add Texture {} to TextureAtlas {} as its source data isn't set", texture.GetName(), m_Name);
+        return false;
+    }
+
+    const Vector2i paddedSize = texture.GetSize() + Vector2i{Padding * 2};
+    if (paddedSize.x > m_PageSize.x || paddedSize.y > m_PageSize.y)
+    {
+        Logger::LogVerbose("Texture {} is too big to be added to TextureAtlas {}", texture.GetName(), m_Name);
+        return false;
+    }
+
+    return true;
+}
+
+void TextureAtlas::AddPage()
+{
+    m_Pages.Emplace(m_PageSize);
+
+    if (m_Loaded && GetPageCount() > m_GpuPageCapacity)
+        GrowGpuTexture(GetPageCount());
+}
+
+void TextureAtlas::Pack(const Pointer<Texture>& texture, const s32 page, const Vector2i paddedPosition)
+{
+    const Vector2i position = paddedPosition + Vector2i{Padding};
+    const Vector2 pageSize = static_cast<Vector2>(m_PageSize);
+
+    texture->m_Atlas = this;
+    texture->m_AtlasLayer = page;
+    texture->m_AtlasUv0 = static_cast<Vector2>(position) / pageSize;
+    texture->m_AtlasUv1 = static_cast<Vector2>(position + texture->GetSize()) / pageSize;
+
+    const Vector2i size = texture->GetSize();
+    const Entry& entry = m_Entries.Emplace(texture, page, position, size, ExtrudeBorders(texture->GetData<u8>(), size));
+
+    if (m_Loaded)
+        Upload(entry);
+
+    m_SourceDataSet = true;
+}
+
+void TextureAtlas::Upload(const Entry& entry) const
+{
+    // The Texture may have reset its source data since it was added, so this uses the copy made by Pack()
+    m_GpuTexture.SetSubData(
+        entry.position - Vector2i{Padding},
+        entry.page,
+        entry.size + Vector2i{Padding * 2},
+        Graphics::Format::RedGreenBlueAlpha,
+        Graphics::DataType::UnsignedByte,
+        entry.paddedPixels.GetData()
+    );
+}
+
+void TextureAtlas::CreateGpuTexture(const s32 pageCapacity)
+{
+    m_GpuTexture.Create();
+    m_GpuTexture.SetDebugName(m_Name);
+
+    m_GpuTexture.SetMinFilter(m_Filter);
+    m_GpuTexture.SetMagFilter(m_Filter);
+
+    m_GpuTexture.SetWrappingHorizontal(Graphics::Wrapping::ClampToEdge);
+    m_GpuTexture.SetWrappingVertical(Graphics::Wrapping::ClampToEdge);
+
+    m_GpuTexture.SetStorage(Graphics::InternalFormat::RedGreenBlueAlpha8, m_PageSize, pageCapacity);
+    // Only the free space of the pages stays transparent, the padding is uploaded with each texture
+    m_GpuTexture.Clear();
+
+    m_GpuPageCapacity = pageCapacity;
+
+    Texture::AddMemoryUsage(Graphics::InternalFormat::RedGreenBlueAlpha8, static_cast<s64>(m_PageSize.x) * m_PageSize.y * 4 * pageCapacity);
+}
+
+void TextureAtlas::GrowGpuTexture(const s32 minimumPageCapacity)
+{
+    Graphics::GpuTextureArray oldGpuTexture = m_GpuTexture;
+    const s32 oldPageCapacity = m_GpuPageCapacity;
+
+    // Grow geometrically to avoid copying all the pages each time one is added
+    CreateGpuTexture(std::max(minimumPageCapacity, oldPageCapacity * 2));
+    m_GpuTexture.CopyLayers(oldGpuTexture, m_PageSize, oldPageCapacity);
+
+    DeleteGpuTexture(oldGpuTexture, oldPageCapacity);
+}
+
+void TextureAtlas::DeleteGpuTexture(Graphics::GpuTextureArray& gpuTexture, const s32 pageCapacity) const
+{
+    gpuTexture.Delete();
+
+    Texture::AddMemoryUsage(Graphics::InternalFormat::RedGreenBlueAlpha8, -static_cast<s64>(m_PageSize.x) * m_PageSize.y * 4 * pageCapacity);
+}
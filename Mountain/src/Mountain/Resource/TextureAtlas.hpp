@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Graphics/GpuTextureArray.hpp"
+#include "Mountain/Graphics/Graphics.hpp"
+#include "Mountain/Math/Vector2i.hpp"
+#include "Mountain/Resource/Resource.hpp"
+#include "Mountain/Resource/Texture.hpp"
+#include "Mountain/Utils/SkylinePacker.hpp"
+
+/// @file TextureAtlas.hpp
+/// @brief Defines the Mountain::TextureAtlas class
+
+namespace Mountain
+{
+    /// @brief Packs Textures at runtime into the pages of a single array texture.
+    /// @details Textures that are part of a loaded TextureAtlas are drawn from the atlas by @c Draw::Texture(), which allows
+    /// it to batch them together even if they come from different source files.
+    ///
+    /// A TextureAtlas is a runtime Resource and should be created using @code ResourceManager::Add<TextureAtlas>(name)@endcode.
+    /// Each page is packed using a SkylinePacker, and pages are added on the GPU as they are needed.
+    /// Since pixels are copied from the CPU, packed Textures must have their source data set when they are added. The atlas
+    /// keeps its own copy of their pixels, so it can be reloaded after their source data is reset.
+    class TextureAtlas : public Resource
+    {
+    public:
+        /// @brief Default size of each page of the atlas
+        static constexpr Vector2i DefaultPageSize{2048, 2048};
+
+        /// @brief Number of pixels left around each packed Texture to avoid sampling its neighbors
+        /// @details The padding repeats the border pixels of the Texture, so that linear filtering doesn't blend its edges
+        /// with transparent pixels.
+        static constexpr s32 Padding = 1;
+
+        // Same constructor from base class
+        using Resource::Resource;
+
+        DELETE_COPY_MOVE_OPERATIONS(TextureAtlas)
+
+        MOUNTAIN_API ~TextureAtlas() override;
+
+        /// @brief Creates the array texture on the GPU and uploads all the packed Textures.
+        MOUNTAIN_API void Load() override;
+
+        MOUNTAIN_API void Unload() override;
+
+        /// @brief Removes all the packed Textures from the atlas.
+        MOUNTAIN_API void ResetSourceData() override;
+
+        /// @brief Packs the given @p texture into the first page with enough space left, adding a new page if needed.
+        /// @returns Whether the Texture is now part of this atlas. This fails if the Texture doesn't have its source data set,
+        /// if it is bigger than a page, if it is already part of another atlas, or if @c IsCompatible() returns @c false.
+        MOUNTAIN_API bool Add(const Pointer<Texture>& texture);
+
+        /// @brief Packs all the given @p textures into the same page, adding a new page if no existing one can hold them all.
+        /// @details This is meant for Textures that are usually drawn together, e.g., the frames of an animation.
+        /// Textures that are already part of this atlas are ignored.
+        /// @returns Whether all the Textures are now part of this atlas.
+        MOUNTAIN_API bool AddRange(const List<Pointer<Texture>>& textures);
+
+        /// @brief Returns whether drawing @p texture from an atlas page looks the same as drawing it from its own texture.
+        /// @details Atlas pages are stored as 8-bit RGBA without mipmaps, so Textures using another internal format or
+        /// generating mipmaps would lose them, and are never packed nor drawn from an atlas.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static bool IsCompatible(const Texture& texture);
+
+        /// @brief Returns whether the given @p texture was packed into this atlas.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool Contains(const Texture& texture) const;
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Vector2i GetPageSize() const;
+
+        /// @brief Sets the size of each page.
+        /// @throws InvalidOperationException If Textures were already packed into this atlas.
+        MOUNTAIN_API void SetPageSize(Vector2i newPageSize);
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API s32 GetPageCount() const;
+
+        /// @brief Returns the ratio of the given @p page that is covered by packed Textures, in the range [0, 1].
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API f32 GetOccupancy(s32 page) const;
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Graphics::MagnificationFilter GetFilter() const;
+        MOUNTAIN_API void SetFilter(Graphics::MagnificationFilter newFilter);
+
+        /// @brief Get the ID of the array texture on the GPU
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API u32 GetId() const;
+
+        /// @brief Gets the underlying GpuTextureArray
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API Graphics::GpuTextureArray GetGpuTexture() const;
+
+    private:
+        struct Entry
+        {
+            /// @brief Weak reference to the packed Texture
+            Pointer<Texture> texture;
+            s32 page;
+            /// @brief Top-left position of the Texture in its page, padding excluded
+            Vector2i position;
+            /// @brief Size of the Texture, padding excluded
+            Vector2i size;
+            /// @brief RGBA pixels of the Texture with its padding, which is filled with the nearest border pixels
+            List<u8> paddedPixels;
+        };
+
+        Vector2i m_PageSize = DefaultPageSize;
+        List<SkylinePacker> m_Pages;
+        List<Entry> m_Entries;
+
+        Graphics::GpuTextureArray m_GpuTexture;
+        /// @brief Number of pages allocated on the GPU, which can be higher than the number of pages in use
+        s32 m_GpuPageCapacity = 0;
+        Graphics::MagnificationFilter m_Filter = Graphics::MagnificationFilter::Nearest;
+
+        ATTRIBUTE_NODISCARD
+        bool CanAdd(const Texture& texture) const;
+
+        void AddPage();
+
+        void Pack(const Pointer<Texture>& texture, s32 page, Vector2i paddedPosition);
+
+        void Upload(const Entry& entry) const;
+
+        void CreateGpuTexture(s32 pageCapacity);
+
+        void GrowGpuTexture(s32 minimumPageCapacity);
+
+        void DeleteGpuTexture(Graphics::GpuTextureArray& gpuTexture, s32 pageCapacity) const;
+    };
+}
@@ -0,0 +1,196 @@
+#include "Mountain/Utils/Compression.hpp"
+
+#include <cstring>
+
+#include "Mountain/Containers/List.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    constexpr usize MinMatch = 4;
+    // The last 5 bytes of a block are always literals
+    constexpr usize LastLiterals = 5;
+    // The last match must start at least 12 bytes before the end of a block
+    constexpr usize MatchFindLimit = 12;
+    constexpr usize MaxOffset = 0xFFFF;
+    constexpr u32 HashLog = 16;
+    constexpr usize RunMask = 0xF;
+
+    u32 Read32(const u8* const data)
+    {
+        u32 result;
+        std::memcpy(&result, data, sizeof(result));
+        return result;
+    }
+
+    u32 Hash(const u32 sequence) { return (sequence * 2654435761u) >> (32 - HashLog); }
+
+    u8* WriteLength(u8* destination, usize length)
+    {
+        while (length >= 0xFF)
+        {
+            *destination++ = 0xFF;
+            length -= 0xFF;
+        }
+        *destination++ = static_cast<u8>(length);
+        return destination;
+    }
+
+    bool ReadLength(const u8*& source, const u8* const sourceEnd, usize& length)
+    {
+        u8 value;
+        do
+        {
+            if (source >= sourceEnd)
+                return false;
+            value = *source++;
+            length += value;
+        }
+        while (value == 0xFF);
+
+        return true;
+    }
+
+    u8* WriteSequence(u8* destination, const u8* const literals, const usize literalLength, const usize offset, const usize matchLength)
+    {
+        u8* token = destination++;
+        *token = static_cast<u8>(std::min(literalLength, RunMask) << 4);
+        if (literalLength >= RunMask)
+            destination = WriteLength(destination, literalLength - RunMask);
+
+        std::memcpy(destination, literals, literalLength);
+        destination += literalLength;
+
+        // The last sequence only contains literals
+        if (offset == 0)
+            return destination;
+
+        *destination++ = static_cast<u8>(offset & 0xFF);
+        *destination++ = static_cast<u8>(offset >> 8);
+
+        const usize encodedMatchLength = matchLength - MinMatch;
+        *token |= static_cast<u8>(std::min(encodedMatchLength, RunMask));
+        if (encodedMatchLength >= RunMask)
+            destination = WriteLength(destination, encodedMatchLength - RunMask);
+
+        return destination;
+    }
+}
+
+usize Compression::Lz4Compress(const u8* const source, const usize sourceSize, u8* const destination, const usize destinationCapacity)
+{
+    if (destinationCapacity < Lz4CompressBound(sourceSize))
+        return 0;
+
+    const u8* const sourceEnd = source + sourceSize;
+    const u8* anchor = source;
+    u8* output = destination;
+
+    if (sourceSize >= MatchFindLimit)
+    {
+        // Positions of the last occurrence of each hashed 4-byte sequence, relative to the start of the source
+        List<u32> hashTable;
+        hashTable.Resize(1 << HashLog);
+
+        const u8* const searchLimit = sourceEnd - MatchFindLimit;
+        const u8* const matchLimit = sourceEnd - LastLiterals;
+
+        const u8* input = source;
+        while (input <= searchLimit)
+        {
+            const u32 sequence = Read32(input);
+            u32& entry = hashTable[Hash(sequence)];
+            const u8* match = source + entry;
+            entry = static_cast<u32>(input - source);
+
+            if (match >= input || static_cast<usize>(input - match) > MaxOffset || Read32(match) != sequence)
+            {
+                input++;
+                continue;
+            }
+
+            // Extend the match backwards over the pending literals
+            while (input > anchor && match > source && input[-1] == match[-1])
+            {
+                input--;
+                match--;
+            }
+
+            const u8* matchEnd = input + MinMatch;
+            const u8* matchReference = match + MinMatch;
+            while (matchEnd < matchLimit && *matchEnd == *matchReference)
+            {
+                matchEnd++;
+                matchReference++;
+            }
+
+            output = WriteSequence(
+                output,
+                anchor,
+                static_cast<usize>(input - anchor),
+                static_cast<usize>(input - match),
+                static_cast<usize>(matchEnd - input)
+            );
+
+            input = matchEnd;
+            anchor = input;
+        }
+    }
+
+    output = WriteSequence(output, anchor, static_cast<usize>(sourceEnd - anchor), 0, 0);
+
+    return static_cast<usize>(output - destination);
+}
+
+bool Compression::Lz4Decompress(const u8* source, const usize sourceSize, u8* const destination, const usize destinationSize)
+{
+    const u8* const sourceEnd = source + sourceSize;
+    u8* output = destination;
+    u8* const outputEnd = destination + destinationSize;
+
+    while (source < sourceEnd)
+    {
+        const u8 token = *source++;
+
+        usize literalLength = token >> 4;
+        if (literalLength == RunMask && !ReadLength(source, sourceEnd, literalLength))
+            return false;
+
+        if (literalLength > static_cast<usize>(sourceEnd - source) || literalLength > static_cast<usize>(outputEnd - output))
+            return false;
+
+        std::memcpy(output, source, literalLength);
+        source += literalLength;
+        output += literalLength;
+
+        // The last sequence doesn't have a match
+        if (source == sourceEnd)
+            break;
+
+        if (sourceEnd - source < 2)
+            return false;
+
+        const usize offset = static_cast<usize>(source[0]) | static_cast<usize>(source[1]) << 8;
+        source += 2;
+
+        if (offset == 0 || offset > static_cast<usize>(output - destination))
+            return false;
+
+        usize matchLength = token & RunMask;
+        if (matchLength == RunMask && !ReadLength(source, sourceEnd, matchLength))
+            return false;
+        matchLength += MinMatch;
+
+        if (matchLength > static_cast<usize>(outputEnd - output))
+            return false;
+
+        // Copy byte by byte as the match can overlap the output when the offset is smaller than the match length
+        const u8* match = output - offset;
+        for (usize i = 0; i < matchLength; i++)
+            output[i] = match[i];
+        output += matchLength;
+    }
+
+    return output == outputEnd;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Mountain/Core.hpp"
+
+/// @file Compression.hpp
+/// @brief Defines functions to compress and decompress raw data.
+
+namespace Mountain::Compression
+{
+    /// @brief Gets the maximum size of the data returned by @c Lz4Compress() for an input of the given @p size.
+    ATTRIBUTE_NODISCARD
+    constexpr usize Lz4CompressBound(const usize size) { return size + size / 255 + 16; }
+
+    /// @brief Compresses @p source using the LZ4 block format.
+    /// @details This favors decompression speed over compression ratio, which makes it a good fit for assets that are
+    /// compressed once offline and decompressed each time the game starts.
+    /// @param source The data to compress.
+    /// @param sourceSize The size of @p source in bytes.
+    /// @param destination The buffer in which to write the compressed data.
+    /// @param destinationCapacity The size of @p destination in bytes, which must be at least @c Lz4CompressBound(sourceSize).
+    /// @return The size of the compressed data, or 0 if @p destinationCapacity is too small.
+    /// @see <a href="https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md">LZ4 block format</a>
+    MOUNTAIN_API usize Lz4Compress(const u8* source, usize sourceSize, u8* destination, usize destinationCapacity);
+
+    /// @brief Decompresses LZ4 block data previously compressed with @c Lz4Compress().
+    /// @param source The compressed data.
+    /// @param sourceSize The size of @p source in bytes.
+    /// @param destination The buffer in which to write the decompressed data.
+    /// @param destinationSize The exact size of the decompressed data.
+    /// @return Whether the data was valid and decompressed to exactly @p destinationSize bytes.
+    MOUNTAIN_API bool Lz4Decompress(const u8* source, usize sourceSize, u8* destination, usize destinationSize);
+}
@@ -3,7 +3,8 @@
 
 #include "Mountain/Utils/Coroutine.hpp"
 
-#include <ranges>
+#include <algorithm>
+#include <mutex>
 
 #include "Mountain/Input/Time.hpp"
 #include "Mountain/Utils/Formatter.hpp"
@@ -11,34 +12,70 @@
 
 using namespace Mountain;
 
+namespace
+{
+    /// @brief The size granularity of the pooled coroutine frames.
+    constexpr usize FrameBlockSize = 64;
+    /// @brief The number of frame sizes that are pooled, larger frames being allocated directly.
+    constexpr usize FrameClassCount = 16;
+    constexpr usize FramesPerChunk = 32;
+
+    struct FreeFrame
+    {
+        FreeFrame* next;
+    };
+
+    std::mutex framePoolMutex;
+    /// @brief The free frames of each size. The memory of the pools is never released.
+    Array<FreeFrame*, FrameClassCount> freeFrames{};
+
+    /// @brief Orders the wake-ups so that the heap gives the earliest one first.
+    constexpr auto WakesUpLater = [](const auto& lhs, const auto& rhs) { return lhs.time > rhs.time; };
+}
+
 bool Coroutine::Awaitable::await_ready() { return false; }
 
 void Coroutine::Awaitable::await_suspend(std::coroutine_handle<promise_type>) {}
 
 void Coroutine::Awaitable::await_resume() {}
 
-Guid Coroutine::Start(Coroutine&& coroutine)
+CoroutineId Coroutine::Start(Coroutine&& coroutine)
 {
-    Guid id = Guid::New();
-
-    coroutine.m_Id = id;
     coroutine.Resume();
 
     if (coroutine.Finished()) // If the coroutine didn't yield, no need to keep it for future updates
-        return Guid::Empty();
+        return {};
 
-    m_RunningRoutines.emplace(id, std::move(coroutine));
+    u32 index;
+    if (m_FreeSlots.IsEmpty())
+    {
+        index = static_cast<u32>(m_Slots.GetSize());
+        m_Slots.Emplace();
+    }
+    else
+    {
+        index = m_FreeSlots.Last();
+        m_FreeSlots.RemoveLast();
+    }
+
+    Slot& slot = m_Slots[index];
+    slot.handle = coroutine.m_Handle;
+    slot.useUnscaledDeltaTime = coroutine.useUnscaledDeltaTime;
 
-    return id;
+    // The scheduler now owns the coroutine frame
+    coroutine.Reset();
+
+    Schedule(index);
+
+    return { index, slot.generation };
 }
 
-void Coroutine::Start(Coroutine&& coroutine, Guid* const coroutineId)
+void Coroutine::Start(Coroutine&& coroutine, CoroutineId* const coroutineId)
 {
-    Guid& id = *coroutineId;
-    if (id != Guid::Empty() && IsRunning(id))
+    CoroutineId& id = *coroutineId;
+    if (IsRunning(id))
         Stop(id);
 
-    coroutine.m_Id = id;
     id = Start(std::move(coroutine));
 }
 
@@ -46,51 +83,43 @@ void Coroutine::UpdateAll()
 {
     ZoneScoped;
 
-    List<const Coroutine*> finishedRoutines;
-
-    for (const Coroutine& routine : m_RunningRoutines | std::views::values)
-    {
-        if (!routine.Valid())
-            continue;
-
-        TimeSpan& awaitValue = routine.m_Handle.promise().awaitValue;
-
-        awaitValue -= TimeSpan::FromSeconds(routine.useUnscaledDeltaTime ? Time::GetDeltaTimeUnscaled() : Time::GetDeltaTime());
-        if (awaitValue > TimeSpan::Zero())
-            continue;
-
-        routine.Resume();
+    m_ScaledTime += TimeSpan::FromSeconds(Time::GetDeltaTime());
+    m_UnscaledTime += TimeSpan::FromSeconds(Time::GetDeltaTimeUnscaled());
 
-        if (routine.Finished())
-            finishedRoutines.Add(&routine);
-    }
-
-    for (const Coroutine* const& routine : finishedRoutines)
-        Stop(routine->GetId());
+    ResumeDue(m_ScaledWakeUps, m_ScaledTime);
+    ResumeDue(m_UnscaledWakeUps, m_UnscaledTime);
 }
 
-void Coroutine::Stop(const Guid& coroutineId)
+void Coroutine::Stop(const CoroutineId coroutineId)
 {
-    if (!m_RunningRoutines.contains(coroutineId))
+    if (!IsRunning(coroutineId))
         return;
 
-    m_RunningRoutines.at(coroutineId).Destroy();
-    m_RunningRoutines.erase(coroutineId);
+    m_Slots[coroutineId.index].handle.destroy();
+    FreeSlot(coroutineId.index);
 }
 
 void Coroutine::StopAll()
 {
-    for (auto& coroutine : m_RunningRoutines | std::views::values)
-        coroutine.Destroy();
+    for (u32 i = 0; i < m_Slots.GetSize(); i++)
+    {
+        if (!m_Slots[i].handle)
+            continue;
 
-    m_RunningRoutines.clear();
-}
+        m_Slots[i].handle.destroy();
+        FreeSlot(i);
+    }
 
-bool Coroutine::IsRunning(const Guid& coroutineId) { return m_RunningRoutines.contains(coroutineId); }
+    m_ScaledWakeUps.Clear();
+    m_UnscaledWakeUps.Clear();
+}
 
-bool Coroutine::IsRunningAndNotEmpty(const Guid& coroutineId) { return coroutineId != Guid::Empty() && IsRunning(coroutineId); }
+bool Coroutine::IsRunning(const CoroutineId coroutineId)
+{
+    return coroutineId.index < m_Slots.GetSize() && m_Slots[coroutineId.index].generation == coroutineId.generation && m_Slots[coroutineId.index].handle;
+}
 
-usize Coroutine::GetRunningCount() { return m_RunningRoutines.size(); }
+usize Coroutine::GetRunningCount() { return m_Slots.GetSize() - m_FreeSlots.GetSize(); }
 
 Coroutine Coroutine::promise_type::get_return_object() { return Coroutine(HandleType::from_promise(*this)); }
 
@@ -132,13 +161,57 @@ Coroutine::Awaitable Coroutine::promise_type::await_transform(const f32 duration
 
 std::suspend_always Coroutine::promise_type::yield_value(nullptr_t) { return {}; }
 
+void* Coroutine::promise_type::operator new(const usize size)
+{
+    if (size > FrameBlockSize * FrameClassCount)
+        return ::operator new(size);
+
+    const usize frameClass = (size - 1) / FrameBlockSize;
+
+    std::scoped_lock lock(framePoolMutex);
+
+    FreeFrame*& head = freeFrames[frameClass];
+    if (!head)
+    {
+        // Allocate several frames at once and chain them in the free list
+        const usize blockSize = (frameClass + 1) * FrameBlockSize;
+        std::byte* const chunk = static_cast<std::byte*>(::operator new(blockSize * FramesPerChunk));
+        for (usize i = 0; i < FramesPerChunk; i++)
+        {
+            FreeFrame* const frame = reinterpret_cast<FreeFrame*>(chunk + i * blockSize);
+            frame->next = head;
+            head = frame;
+        }
+    }
+
+    FreeFrame* const frame = head;
+    head = frame->next;
+    return frame;
+}
+
+void Coroutine::promise_type::operator delete(void* const pointer, const usize size) noexcept
+{
+    if (size > FrameBlockSize * FrameClassCount)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    const usize frameClass = (size - 1) / FrameBlockSize;
+
+    std::scoped_lock lock(framePoolMutex);
+
+    FreeFrame* const frame = static_cast<FreeFrame*>(pointer);
+    frame->next = freeFrames[frameClass];
+    freeFrames[frameClass] = frame;
+}
+
 Coroutine::Coroutine(const HandleType handle) : m_Handle(handle) {}
 
 Coroutine::~Coroutine() { DestroySafe(); }
 
 Coroutine::Coroutine(Coroutine&& other) noexcept
     : m_Handle(other.m_Handle)
-    , m_Id(other.m_Id)
 {
     other.Reset();
 }
@@ -146,7 +219,6 @@ Coroutine::Coroutine(Coroutine&& other) noexcept
 Coroutine& Coroutine::operator=(Coroutine&& other) noexcept
 {
     m_Handle = other.m_Handle;
-    m_Id = other.m_Id;
 
     other.Reset();
 
@@ -156,7 +228,6 @@ Coroutine& Coroutine::operator=(Coroutine&& other) noexcept
 Coroutine& Coroutine::operator=(const HandleType handle) noexcept
 {
     m_Handle = handle;
-    m_Id = {};
 
     return *this;
 }
@@ -193,12 +264,64 @@ void Coroutine::DestroySafe()
 
 bool Coroutine::Valid() const { return static_cast<bool>(m_Handle); }
 
-void Coroutine::Reset()
+void Coroutine::Reset() { m_Handle = {}; }
+
+void Coroutine::Schedule(const u32 index)
 {
-    m_Handle = {};
-    m_Id = {};
+    Slot& slot = m_Slots[index];
+    TimeSpan& awaitValue = slot.handle.promise().awaitValue;
+
+    List<WakeUp>& wakeUps = slot.useUnscaledDeltaTime ? m_UnscaledWakeUps : m_ScaledWakeUps;
+    const TimeSpan time = slot.useUnscaledDeltaTime ? m_UnscaledTime : m_ScaledTime;
+
+    wakeUps.Add({ time + awaitValue, { index, slot.generation } });
+    std::push_heap(wakeUps.GetData(), wakeUps.GetData() + wakeUps.GetSize(), WakesUpLater);
+
+    // A co_yield after this resumes the coroutine on the next frame
+    awaitValue = TimeSpan::Zero();
 }
 
-Guid Coroutine::GetId() const { return m_Id; }
+void Coroutine::ResumeDue(List<WakeUp>& wakeUps, const TimeSpan time)
+{
+    // Pop all the due coroutines before resuming any of them, so that those which yield don't get resumed twice
+    List<CoroutineId> due;
+    while (!wakeUps.IsEmpty() && wakeUps[0].time <= time)
+    {
+        std::pop_heap(wakeUps.GetData(), wakeUps.GetData() + wakeUps.GetSize(), WakesUpLater);
+
+        const CoroutineId id = wakeUps.Last().id;
+        wakeUps.RemoveLast();
+
+        if (IsRunning(id))
+            due.Add(id);
+    }
+
+    for (const CoroutineId id : due)
+    {
+        // A previous coroutine may have stopped this one
+        if (!IsRunning(id))
+            continue;
+
+        // Resuming may start other coroutines and reallocate the slots, so don't keep a reference to this one
+        const HandleType handle = m_Slots[id.index].handle;
+        handle.resume();
+
+        if (handle.done())
+        {
+            handle.destroy();
+            FreeSlot(id.index);
+        }
+        else
+        {
+            Schedule(id.index);
+        }
+    }
+}
 
-Coroutine::Coroutine(const Guid& guid, const HandleType handle) : Coroutine(handle) { m_Id = guid; }
+void Coroutine::FreeSlot(const u32 index)
+{
+    Slot& slot = m_Slots[index];
+    slot.handle = {};
+    slot.generation++;
+    m_FreeSlots.Add(index);
+}
@@ -3,10 +3,10 @@
 #include <chrono>
 #include <coroutine>
 #include <functional>
-#include <unordered_map>
+#include <limits>
 
 #include "Mountain/Core.hpp"
-#include "Mountain/Utils/Guid.hpp"
+#include "Mountain/Containers/List.hpp"
 #include "Mountain/Utils/TimeSpan.hpp"
 
 /// @file coroutine.hpp
@@ -14,6 +14,25 @@
 
 namespace Mountain
 {
+    /// @brief Identifies a Coroutine started with @c Coroutine::Start().
+    /// @details An id stays safe to use after its Coroutine has finished, as the slot it refers to gets a new generation
+    /// when it is reused.
+    struct CoroutineId
+    {
+        static constexpr u32 InvalidIndex = std::numeric_limits<u32>::max();
+
+        /// @brief The index of the slot of the Coroutine in the scheduler.
+        u32 index = InvalidIndex;
+        /// @brief The generation of the slot when the Coroutine was started.
+        u32 generation = 0;
+
+        ATTRIBUTE_NODISCARD
+        constexpr bool IsValid() const { return index != InvalidIndex; }
+
+        ATTRIBUTE_NODISCARD
+        friend constexpr bool operator==(CoroutineId, CoroutineId) = default;
+    };
+
     // Everything named using the snake_case convention in this file is required by C++20 coroutines: https://en.cppreference.com/w/cpp/language/coroutines
 
     /// @brief Wrapper around C++20 Coroutines.
@@ -52,11 +71,15 @@ namespace Mountain
     ///
     /// Instead of manually resuming the Coroutine, the framework can do it for you:
     /// @code
-    /// Guid id = Coroutine::Start(Function());
+    /// CoroutineId id = Coroutine::Start(Function());
     /// @endcode
     ///
-    /// And the Coroutine will be resumed automatically each frame.
-    /// Use the returned @c Guid with the static functions in the Coroutine class.
+    /// And the Coroutine will be resumed automatically once its @c co_await duration has elapsed.
+    /// Use the returned @c CoroutineId with the static functions in the Coroutine class.
+    ///
+    /// Started coroutines are kept in a min-heap ordered by the time they have to be resumed at, so @c UpdateAll() only
+    /// touches the ones that are due. Coroutine frames are allocated from pools of fixed-size blocks that are reused
+    /// once the coroutines are destroyed.
     ///
     /// @see <a href="https://en.cppreference.com/w/cpp/language/coroutines">C++20 Coroutines</a>
     class Coroutine
@@ -101,6 +124,12 @@ namespace Mountain
 
             /// @brief Yields the coroutine using a @c nullptr value. The coroutine will be resumed on the next frame.
             MOUNTAIN_API std::suspend_always yield_value(nullptr_t);
+
+            /// @brief Allocates a coroutine frame from the pool of the corresponding size.
+            MOUNTAIN_API static void* operator new(usize size);
+
+            /// @brief Returns a coroutine frame to the pool it was allocated from.
+            MOUNTAIN_API static void operator delete(void* pointer, usize size) noexcept;
         };
 
     private:
@@ -116,34 +145,58 @@ namespace Mountain
             MOUNTAIN_API void await_resume();
         };
 
-        MOUNTAIN_API static inline std::unordered_map<Guid, Coroutine> m_RunningRoutines;
+        struct Slot
+        {
+            std::coroutine_handle<promise_type> handle;
+            /// @brief Incremented each time the slot is freed, invalidating the ids of its previous Coroutine.
+            u32 generation = 0;
+            bool useUnscaledDeltaTime = false;
+        };
+
+        struct WakeUp
+        {
+            TimeSpan time;
+            CoroutineId id;
+        };
+
+        /// @brief The running coroutines, indexed by @c CoroutineId::index.
+        MOUNTAIN_API static inline List<Slot> m_Slots;
+        MOUNTAIN_API static inline List<u32> m_FreeSlots;
+
+        /// @brief Min-heaps of the times at which the coroutines have to be resumed, for each time scale.
+        /// @details Entries of stopped coroutines are only discarded once they reach the top of the heap.
+        MOUNTAIN_API static inline List<WakeUp> m_ScaledWakeUps;
+        MOUNTAIN_API static inline List<WakeUp> m_UnscaledWakeUps;
+
+        /// @brief The total time elapsed in @c UpdateAll() calls, for each time scale.
+        MOUNTAIN_API static inline TimeSpan m_ScaledTime = TimeSpan::Zero();
+        MOUNTAIN_API static inline TimeSpan m_UnscaledTime = TimeSpan::Zero();
 
     public:
         /// @brief The coroutine handle type.
         using HandleType = std::coroutine_handle<promise_type>;
 
-        /// @brief Starts a coroutine, assigning it a @c Guid.
+        /// @brief Starts a coroutine, assigning it a @c CoroutineId.
         /// @details This will run the beginning of the coroutine body. If it
-        /// finishes without yielding, this function returns @c Guid::Empty().
-        /// Otherwise, it returns the @c Guid that was assigned to the coroutine.
-        MOUNTAIN_API static Guid Start(Coroutine&& coroutine);
+        /// finishes without yielding, this function returns an invalid id.
+        /// Otherwise, it returns the id that was assigned to the coroutine. The scheduler takes ownership of the coroutine
+        /// frame and resets @p coroutine, so the returned id is the only way to refer to the started coroutine.
+        MOUNTAIN_API static CoroutineId Start(Coroutine&& coroutine);
 
-        /// @brief Starts a coroutine using an existing coroutine @c Guid.
+        /// @brief Starts a coroutine using an existing @c CoroutineId.
         /// @details This stops the existing coroutine if it is still running
-        /// and assigns the guid with a newly created one.
-        MOUNTAIN_API static void Start(Coroutine&& coroutine, Guid* coroutineId);
+        /// and assigns the id with the one of the new coroutine.
+        MOUNTAIN_API static void Start(Coroutine&& coroutine, CoroutineId* coroutineId);
 
+        /// @brief Resumes all the coroutines whose @c co_await duration has elapsed.
         MOUNTAIN_API static void UpdateAll();
 
-        MOUNTAIN_API static void Stop(const Guid& coroutineId);
+        MOUNTAIN_API static void Stop(CoroutineId coroutineId);
 
         MOUNTAIN_API static void StopAll();
 
         ATTRIBUTE_NODISCARD
-        MOUNTAIN_API static bool IsRunning(const Guid& coroutineId);
-
-        ATTRIBUTE_NODISCARD
-        MOUNTAIN_API static bool IsRunningAndNotEmpty(const Guid& coroutineId);
+        MOUNTAIN_API static bool IsRunning(CoroutineId coroutineId);
 
         ATTRIBUTE_NODISCARD
         MOUNTAIN_API static usize GetRunningCount();
@@ -208,16 +261,16 @@ namespace Mountain
         /// @warning <b>This does not release the allocated memory</b>, make sure to call @c Destroy() beforehand.
         MOUNTAIN_API void Reset();
 
-        /// @brief Returns the Guid of this Coroutine.
-        ATTRIBUTE_NODISCARD
-        MOUNTAIN_API Guid GetId() const;
-
     private:
         HandleType m_Handle;
 
-        Guid m_Id;
+        /// @brief Adds the coroutine in the given slot to the heap of its time scale, using its last @c co_await duration.
+        static void Schedule(u32 index);
+
+        /// @brief Resumes all the coroutines of the given heap that are due at @p time.
+        static void ResumeDue(List<WakeUp>& wakeUps, TimeSpan time);
 
-        Coroutine(const Guid& guid, HandleType handle);
+        static void FreeSlot(u32 index);
     };
 
     /// @brief Coroutine function prototype.
@@ -6,11 +6,13 @@
 
 #include "Mountain/Screen.hpp"
 #include "Mountain/FileSystem/FileManager.hpp"
+#include "Mountain/Graphics/Draw.hpp"
 #include "Mountain/Input/Input.hpp"
 #include "Mountain/Input/Time.hpp"
 #include "Mountain/Platform/Platform.hpp"
 #include "Mountain/Resource/AudioTrack.hpp"
 #include "Mountain/Resource/Font.hpp"
+#include "Mountain/Resource/Texture.hpp"
 #include "Mountain/Utils/FileSystemWatcher.hpp"
 
 using namespace Mountain;
@@ -556,6 +558,8 @@ void ImGuiUtils::ShowResourceManager()
         {
             const std::string_view format = magic_enum::enum_name(audioTrack->GetFormat());
             ImGui::Text("Format: %.*s", static_cast<s32>(format.length()), format.data());
+            ImGui::Text("Duration: %.2fs", audioTrack->GetDuration());
+            ImGui::Text("Streamed: %s", audioTrack->IsStreamed() ? "true" : "false");
         }
     );
 
@@ -688,6 +692,16 @@ void ImGuiUtils::ShowPerformanceMonitoring()
     ImGui::Text("CPU: %.1fms (%.1fms left)", frameDuration * 1000.f, frameDurationLeft * 1000.f);
     ImGui::Text("Memory: %.2fMB", memory);
     ImGui::Text("Framebuffer: %dx%d", framebufferSize.x, framebufferSize.y);
+    ImGui::Text("Streamed draw data: %.1fKB", static_cast<f64>(Draw::GetLastFrameStreamedBytes()) * 1e-3);
+
+    const DrawStatistics& drawStatistics = Draw::GetLastFrameStatistics();
+    ImGui::Text(
+        "Draw calls: %u (%u shader switches, %u texture switches, %zu instances)",
+        drawStatistics.drawCalls,
+        drawStatistics.shaderSwitches,
+        drawStatistics.textureSwitches,
+        drawStatistics.instances
+    );
 
     if (ImGui::TreeNode("Frame duration graph"))
     {
@@ -695,6 +709,14 @@ void ImGuiUtils::ShowPerformanceMonitoring()
         ImGui::TreePop();
     }
 
+    if (ImGui::TreeNode("Texture memory"))
+    {
+        ImGui::Text("Total: %.2fMB", static_cast<f64>(Texture::GetTotalMemoryUsage()) * 1e-6);
+        for (const auto& [format, size] : Texture::GetMemoryUsagePerFormat())
+            ImGui::Text("%s: %.2fMB", magic_enum::enum_name(format).data(), static_cast<f64>(size) * 1e-6);
+        ImGui::TreePop();
+    }
+
     ImGui::End();
 }
 
@@ -0,0 +1,229 @@
+#include "Mountain/Utils/JobSystem.hpp"
+
+#include "Mountain/Utils/Utils.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    thread_local u32 threadIndex = 0;
+}
+
+bool JobCounter::IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+void JobSystem::Initialize(u32 workerCount)
+{
+    ZoneScoped;
+
+    if (m_Running)
+        THROW(InvalidOperationException{"The job system has already been initialized"});
+
+    if (workerCount == 0)
+        workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+    for (u32 i = 0; i < workerCount + 1; i++)
+        m_Queues.Add(new Queue);
+
+    m_Running = true;
+
+    for (u32 i = 1; i <= workerCount; i++)
+    {
+        std::thread& worker = m_Workers.Add(std::thread{RunWorker, i});
+        Utils::SetThreadName(worker, std::format("Job Worker {}", i));
+    }
+
+    Logger::LogVerbose("Started job system with {} workers", workerCount);
+}
+
+void JobSystem::Shutdown()
+{
+    ZoneScoped;
+
+    if (!m_Running)
+        return;
+
+    {
+        std::scoped_lock lock(m_SleepMutex);
+        m_Running = false;
+    }
+    m_SleepCondVar.notify_all();
+
+    // The workers only stop once every queue is empty
+    for (std::thread& worker : m_Workers)
+        worker.join();
+    m_Workers.Clear();
+
+    // Jobs scheduled by this thread after the workers exited
+    while (TryRunJob()) {}
+
+    for (const Queue* queue : m_Queues)
+        delete queue;
+    m_Queues.Clear();
+}
+
+void JobSystem::Run(Action<> job, JobCounter* counter)
+{
+    if (counter)
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+    Push({ std::move(job), counter });
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, Action<> job, JobCounter* counter)
+{
+    if (counter)
+        counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::scoped_lock lock(dependency.m_Mutex);
+        if (!dependency.IsDone())
+        {
+            dependency.m_Continuations.Emplace(std::move(job), counter);
+            return;
+        }
+    }
+
+    Push({ std::move(job), counter });
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    ZoneScoped;
+
+    while (!counter.IsDone())
+    {
+        if (!TryRunJob())
+            std::this_thread::yield();
+    }
+
+    // Make sure the thread that finished the last job doesn't hold the counter anymore
+    std::scoped_lock lock(counter.m_Mutex);
+}
+
+u32 JobSystem::GetWorkerCount() { return static_cast<u32>(m_Workers.GetSize()); }
+
+u32 JobSystem::GetThreadIndex() { return threadIndex; }
+
+void JobSystem::Push(Job&& job)
+{
+    // Without any queue, run the job right away
+    if (m_Queues.IsEmpty())
+    {
+        Execute(job);
+        return;
+    }
+
+    // Count the job before queuing it so that the count never goes below the number of queued jobs
+    {
+        std::scoped_lock lock(m_SleepMutex);
+        m_QueuedJobs.fetch_add(1, std::memory_order_release);
+    }
+
+    {
+        Queue& queue = *m_Queues[threadIndex];
+        std::scoped_lock lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    m_SleepCondVar.notify_one();
+}
+
+bool JobSystem::TryRunJob()
+{
+    const usize queueCount = m_Queues.GetSize();
+    if (queueCount == 0)
+        return false;
+
+    Job job;
+    bool found = false;
+
+    // Run the most recent job of our own queue first since its data is most likely still in the cache
+    {
+        Queue& queue = *m_Queues[threadIndex];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    // Otherwise steal the oldest job of another queue
+    for (usize i = 1; !found && i < queueCount; i++)
+    {
+        Queue& queue = *m_Queues[(threadIndex + i) % queueCount];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job& job)
+{
+    // Let the job finish even if it throws, otherwise its counter would never reach zero and waiting for it would never end
+    try
+    {
+        job.function();
+    }
+    catch (const std::exception& e)
+    {
+        Logger::LogError("Uncaught exception in job: {}", e);
+    }
+    catch (...)
+    {
+        Logger::LogError("Uncaught exception of unknown type in job");
+    }
+
+    if (job.counter)
+        Finish(*job.counter);
+}
+
+void JobSystem::Finish(JobCounter& counter)
+{
+    List<std::pair<Action<>, JobCounter*>> continuations;
+
+    {
+        std::scoped_lock lock(counter.m_Mutex);
+        if (counter.m_Pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        std::swap(continuations, counter.m_Continuations);
+    }
+
+    // The counter must not be used past this point as a waiting thread may have destroyed it
+    for (auto& [function, continuationCounter] : continuations)
+        Push({ std::move(function), continuationCounter });
+}
+
+void JobSystem::RunWorker(const u32 index)
+{
+    threadIndex = index;
+
+#ifdef PROFILING
+    tracy::SetThreadName(std::format("Job Worker {}", index).c_str());
+#endif
+
+    while (true)
+    {
+        if (TryRunJob())
+            continue;
+
+        std::unique_lock lock(m_SleepMutex);
+        m_SleepCondVar.wait(lock, [] { return m_QueuedJobs.load(std::memory_order_acquire) > 0 || !m_Running; });
+
+        if (!m_Running && m_QueuedJobs.load(std::memory_order_acquire) == 0)
+            break;
+    }
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Profiler.hpp"
+#include "Mountain/Containers/FunctionTypes.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Utils/MetaProgramming.hpp"
+
+/// @file JobSystem.hpp
+/// @brief Defines the Mountain::JobSystem static class.
+
+namespace Mountain
+{
+    /// @brief Counts the jobs that still have to run before the ones depending on them can start.
+    /// @details A counter is incremented when a job using it is scheduled and decremented when that job finishes.
+    /// Jobs can be scheduled to run once a counter reaches zero using @c JobSystem::RunAfter(), and a thread can wait for it
+    /// using @c JobSystem::Wait().
+    class JobCounter
+    {
+        friend class JobSystem;
+
+    public:
+        JobCounter() = default;
+        ~JobCounter() = default;
+
+        DELETE_COPY_MOVE_OPERATIONS(JobCounter)
+
+        /// @brief Returns whether all the jobs using this counter have finished.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API bool IsDone() const;
+
+    private:
+        std::atomic<u32> m_Pending = 0;
+
+        /// @brief Held while the counter is decremented, so that a thread waiting for it can't destroy it before the last
+        /// job using it has released it.
+        mutable std::mutex m_Mutex;
+        List<std::pair<Action<>, JobCounter*>> m_Continuations;
+    };
+
+    /// @brief Static class running jobs on a pool of worker threads.
+    /// @details Each worker owns a queue of jobs. It runs the most recently pushed job of its own queue first and steals the
+    /// oldest job of the other queues when its own is empty. Jobs scheduled from any other thread go to a shared queue that
+    /// every worker steals from.
+    ///
+    /// Waiting on a JobCounter runs other jobs in the meantime instead of blocking, so jobs can wait for other jobs without
+    /// deadlocking, and the system keeps working even without any worker thread.
+    ///
+    /// A job that throws an exception is considered finished, the exception being logged with @c Logger::LogError().
+    ///
+    /// The job system is started in @c Game::InitializeInternal() and stopped in @c Game::~Game().
+    class JobSystem
+    {
+        STATIC_CLASS(JobSystem)
+
+    public:
+        /// @brief Starts the worker threads.
+        /// @param workerCount The number of worker threads. If 0, uses one worker per hardware thread except the calling one.
+        MOUNTAIN_API static void Initialize(u32 workerCount = 0);
+
+        /// @brief Runs the remaining jobs and stops the worker threads.
+        MOUNTAIN_API static void Shutdown();
+
+        /// @brief Schedules a job.
+        /// @param job The function to run.
+        /// @param counter An optional counter to increment now and decrement once the job has finished.
+        MOUNTAIN_API static void Run(Action<> job, JobCounter* counter = nullptr);
+
+        /// @brief Schedules a job once all the jobs using @p dependency have finished.
+        /// @details If @p dependency is already done, the job is scheduled immediately.
+        /// @param dependency The counter to wait for. It must be alive until it reaches zero.
+        /// @param job The function to run.
+        /// @param counter An optional counter to increment now and decrement once the job has finished.
+        MOUNTAIN_API static void RunAfter(JobCounter& dependency, Action<> job, JobCounter* counter = nullptr);
+
+        /// @brief Runs jobs on the calling thread until all the jobs using @p counter have finished.
+        MOUNTAIN_API static void Wait(const JobCounter& counter);
+
+        /// @brief Calls @p function on consecutive sub-ranges of [@p begin, @p end[ in parallel and waits for all of them.
+        /// @param begin The first index of the range.
+        /// @param end The index after the last one of the range.
+        /// @param grain The maximum number of indices in each sub-range.
+        /// @param function The function to call with the beginning and end of each sub-range.
+        /// If it throws on the calling thread, the other sub-ranges are waited for before rethrowing.
+        template <Concepts::Invocable<usize, usize> FunctionT>
+        static void ParallelFor(usize begin, usize end, usize grain, const FunctionT& function);
+
+        /// @brief Returns the number of worker threads, not counting the threads that only wait for jobs.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static u32 GetWorkerCount();
+
+        /// @brief Returns the index of the calling thread, from 1 to @c GetWorkerCount() for workers and 0 for any other thread.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static u32 GetThreadIndex();
+
+    private:
+        struct Job
+        {
+            Action<> function;
+            JobCounter* counter = nullptr;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        /// @brief Queues of each thread, the first one being shared by all the threads that aren't workers.
+        MOUNTAIN_API static inline List<Queue*> m_Queues;
+        MOUNTAIN_API static inline List<std::thread> m_Workers;
+
+        MOUNTAIN_API static inline std::atomic<u32> m_QueuedJobs = 0;
+        MOUNTAIN_API static inline std::mutex m_SleepMutex;
+        MOUNTAIN_API static inline std::condition_variable m_SleepCondVar;
+        MOUNTAIN_API static inline std::atomic_bool m_Running = false;
+
+        static void Push(Job&& job);
+
+        /// @brief Runs a single job from the queue of the calling thread or stolen from another one.
+        /// @return Whether a job was run.
+        static bool TryRunJob();
+
+        static void Execute(Job& job);
+
+        static void Finish(JobCounter& counter);
+
+        static void RunWorker(u32 index);
+    };
+}
+
+// Start of JobSystem.inl
+
+namespace Mountain
+{
+    template <Concepts::Invocable<usize, usize> FunctionT>
+    void JobSystem::ParallelFor(const usize begin, const usize end, usize grain, const FunctionT& function)
+    {
+        ZoneScoped;
+
+        if (end <= begin)
+            return;
+
+        grain = std::max<usize>(grain, 1);
+
+        if (m_Workers.IsEmpty() || end - begin <= grain)
+        {
+            function(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+
+        for (usize rangeBegin = begin + grain; rangeBegin < end; rangeBegin += grain)
+        {
+            const usize rangeEnd = std::min(rangeBegin + grain, end);
+            Run([&function, rangeBegin, rangeEnd] { function(rangeBegin, rangeEnd); }, &counter);
+        }
+
+        // Work on the first range while the workers start on the others
+        try
+        {
+            function(begin, begin + grain);
+        }
+        catch (...)
+        {
+            // The other jobs reference the function and the counter, which are about to be destroyed
+            Wait(counter);
+            throw;
+        }
+
+        Wait(counter);
+    }
+}
@@ -2,8 +2,11 @@
 
 #include "Mountain/Utils/Logger.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <mutex>
 
+#include "Mountain/Containers/List.hpp"
 #include "Mountain/Utils/Formatter.hpp"
 
 #define ANSI_COLOR_GRAY     "\x1b[38;5;242m"
@@ -17,6 +20,131 @@
 
 using namespace Mountain;
 
+namespace
+{
+    /// @brief The size in bytes of the ring buffer of each thread.
+    constexpr usize BufferCapacity = 1 << 16;
+    /// @brief The alignment of the records in a ring buffer, which is also their size granularity.
+    constexpr usize RecordAlignment = 64;
+    /// @brief The maximum size of an already formatted message, longer ones being truncated.
+    constexpr usize MaxMessageSize = BufferCapacity / 4;
+
+    constexpr u8 RecordPadding = 1 << 0;
+    constexpr u8 RecordFormatted = 1 << 1;
+    constexpr u8 RecordPrintToConsole = 1 << 2;
+    constexpr u8 RecordPrintToFile = 1 << 3;
+
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief A log written in a ring buffer, followed by either its arguments or its formatted message.
+    struct RecordHeader
+    {
+        /// @brief The size of the whole record, header included.
+        u32 size = 0;
+        u32 payloadSize = 0;
+        Logger::LogLevel level = Logger::LogLevel::Info;
+        u8 flags = 0;
+        s32 line = -1;
+        Clock::rep timestamp = 0;
+        const c8* format = nullptr;
+        const c8* file = nullptr;
+        std::string (*formatFunction)(std::string_view format, const std::byte* arguments) = nullptr;
+    };
+
+    static_assert(sizeof(RecordHeader) % 16 == 0, "Log arguments must stay aligned after the record header");
+    static_assert(sizeof(RecordHeader) <= RecordAlignment, "A padding record must fit at the end of a ring buffer");
+
+    /// @brief Single-producer single-consumer ring buffer of log records, written by a single thread and read by the logger thread.
+    struct ThreadBuffer
+    {
+        /// @brief The total number of bytes written, only modified by the owning thread.
+        alignas(64) std::atomic<u64> head = 0;
+        /// @brief The total number of bytes read, only modified by the logger thread.
+        alignas(64) std::atomic<u64> tail = 0;
+        /// @brief Set once the owning thread exits, so that the logger thread frees the buffer after reading it.
+        std::atomic_bool abandoned = false;
+
+        alignas(RecordAlignment) std::byte data[BufferCapacity];
+    };
+
+    struct ThreadBufferOwner
+    {
+        ThreadBuffer* buffer = nullptr;
+
+        ~ThreadBufferOwner()
+        {
+            if (buffer)
+                buffer->abandoned.store(true, std::memory_order_release);
+        }
+    };
+
+    std::mutex buffersMutex;
+    List<ThreadBuffer*> buffers;
+
+    thread_local ThreadBufferOwner threadBufferOwner;
+
+    std::atomic<u64> droppedCount = 0;
+
+    ThreadBuffer& GetThreadBuffer()
+    {
+        ThreadBuffer*& buffer = threadBufferOwner.buffer;
+        if (!buffer)
+        {
+            buffer = new ThreadBuffer;
+
+            std::scoped_lock lock(buffersMutex);
+            buffers.Add(buffer);
+        }
+        return *buffer;
+    }
+
+    /// @brief Writes a record to the buffer of the calling thread.
+    /// @return Whether there was enough room in the buffer.
+    bool WriteRecord(RecordHeader header, const void* payload)
+    {
+        ThreadBuffer& buffer = GetThreadBuffer();
+
+        const usize size = (sizeof(RecordHeader) + header.payloadSize + RecordAlignment - 1) / RecordAlignment * RecordAlignment;
+        header.size = static_cast<u32>(size);
+
+        u64 head = buffer.head.load(std::memory_order_relaxed);
+        const u64 tail = buffer.tail.load(std::memory_order_acquire);
+
+        // Records are never split, so skip the end of the buffer if it is too small
+        const usize contiguous = BufferCapacity - head % BufferCapacity;
+        const usize needed = size + (contiguous < size ? contiguous : 0);
+        if (BufferCapacity - (head - tail) < needed)
+            return false;
+
+        if (contiguous < size)
+        {
+            RecordHeader padding;
+            padding.size = static_cast<u32>(contiguous);
+            padding.flags = RecordPadding;
+            std::memcpy(buffer.data + head % BufferCapacity, &padding, sizeof(RecordHeader));
+            head += contiguous;
+        }
+
+        std::byte* const record = buffer.data + head % BufferCapacity;
+        std::memcpy(record, &header, sizeof(RecordHeader));
+        if (header.payloadSize > 0)
+            std::memcpy(record + sizeof(RecordHeader), payload, header.payloadSize);
+
+        buffer.head.store(head + size, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Converts a record timestamp to a date.
+    DateTime GetRecordTime(const Clock::rep timestamp)
+    {
+        static const Clock::time_point ClockOrigin = Clock::now();
+        static const DateTime DateOrigin = DateTime::Now();
+
+        const Clock::duration elapsed = Clock::duration{timestamp} - ClockOrigin.time_since_epoch();
+        return DateOrigin + TimeSpan{std::chrono::duration_cast<std::chrono::duration<s64, std::ratio<1, TimeSpan::TicksPerSecond>>>(elapsed).count()};
+    }
+}
+
 void Logger::OpenFile(const std::filesystem::path &filepath)
 {
     CloseFile();
@@ -40,9 +168,9 @@ void Logger::OpenFile(const std::filesystem::path &filepath)
     if (exists)
         m_File << '\n';
 
-    LogInfo("Logging to file: {}", filepath);
     // Prevent this log from being printed to the file
-    m_NewLogs.Back()->printToFile = false;
+    if (ShouldLog(LogLevel::Info))
+        PushMessage(LogLevel::Info, std::format("Logging to file: {}", filepath), nullptr, -1, false);
 
     LogInfo("Starting logging #{}", m_LogIndex);
 }
@@ -97,13 +225,13 @@ void Logger::CloseFile()
 
 void Logger::Synchronize()
 {
-    if (m_NewLogs.Empty())
+    if (!m_Running)
         return;
 
+    std::unique_lock lock(m_Mutex);
     m_Synchronizing = true;
     m_CondVar.notify_one();
-    std::unique_lock lock(m_Mutex);
-    m_CondVar.wait(lock, [] { return !m_Synchronizing; });
+    m_SynchronizeCondVar.wait(lock, [] { return !m_Synchronizing; });
 }
 
 void Logger::Start()
@@ -113,6 +241,9 @@ void Logger::Start()
     if (m_Running)
         return;
 
+    // Make sure the time origin of the logs is set before any log is printed
+    (void) GetRecordTime(0);
+
     LogInfo("Starting logger");
 
     m_Running = true;
@@ -134,18 +265,28 @@ void Logger::Stop()
 
     LogInfo("Stopping logger");
 
+    // The logger thread is detached, so wait for it to print the remaining logs
+    Synchronize();
+
+    std::scoped_lock lock(m_Mutex);
+
     m_Running = false;
     m_CondVar.notify_one();
 
-    if (m_Thread.joinable())
-        m_Thread.join();
-
     CloseFile();
 }
 
-const std::vector<std::shared_ptr<Logger::LogEntry>>& Logger::GetLogList() { return m_Logs; }
+const std::deque<std::shared_ptr<Logger::LogEntry>>& Logger::GetLogList() { return m_Logs; }
+
+void Logger::Clear()
+{
+    std::scoped_lock lock(m_Mutex);
+    m_Logs.clear();
+}
+
+u64 Logger::GetDroppedCount() { return droppedCount.load(std::memory_order_relaxed); }
 
-void Logger::Clear() { m_Logs.clear(); }
+u64 Logger::GetOverwrittenCount() { return m_OverwrittenCount; }
 
 Logger::LogEntry::LogEntry()
     : level(LogLevel::Info)
@@ -192,56 +333,240 @@ void Logger::Run()
     ZoneScoped;
 
     std::unique_lock lock(m_Mutex);
-    while (m_Running || !m_NewLogs.Empty())
+    while (true)
     {
         ZoneScopedN("MainLoop");
 
-        m_CondVar.wait(lock, [] { return !m_NewLogs.Empty() || !m_Running || m_Synchronizing; });
+        // Waking up is only requested once per batch of logs, so also check regularly in case the request was missed
+        m_CondVar.wait_for(
+            lock,
+            std::chrono::milliseconds{10},
+            [] { return m_WakeRequested.load(std::memory_order_acquire) || !m_Running || m_Synchronizing; }
+        );
 
-        m_Logs.reserve(m_Logs.size() + m_NewLogs.Count());
+        // Read these before processing the logs, so that all the logs pushed before they were set get processed
+        const bool running = m_Running;
+        const bool synchronizing = m_Synchronizing;
+        m_WakeRequested.store(false, std::memory_order_release);
 
-        while (!m_NewLogs.Empty())
-        {
-            ZoneScopedN("PrintLogs");
-
-            auto&& log = m_NewLogs.Pop();
-
-            // Check if the log is equal to the previous one
-            if (log->previousLog && *log->previousLog == *log)
-                log->sameAsPrevious = true;
-
-            // Add the log to the list
-            m_Logs.push_back(log);
-
-            // Print the log to the console and/or the file
-            PrintLog(log);
-        }
+        ProcessLogs();
 
         // As we don't use std::endl for newlines, make sure to flush the streams before going back to sleep
         std::cout.flush();
         if (m_File.is_open())
             m_File.flush();
 
-        if (m_Synchronizing)
+        if (synchronizing)
         {
             m_Synchronizing = false;
-            m_CondVar.notify_one();
+            m_SynchronizeCondVar.notify_all();
         }
+
+        if (!running)
+            break;
     }
 
     m_Logs.clear();
 }
 
-void Logger::PushLog(const std::shared_ptr<LogEntry>& log)
+void Logger::PushRecord(
+    const LogLevel level,
+    const c8* format,
+    const c8* file,
+    const s32 line,
+    const FormatFunction formatFunction,
+    const std::byte* arguments,
+    const usize argumentsSize
+)
+{
+    RecordHeader header;
+    header.payloadSize = static_cast<u32>(argumentsSize);
+    header.level = level;
+    header.line = line;
+    header.timestamp = Clock::now().time_since_epoch().count();
+    header.format = format;
+    header.file = file;
+    header.formatFunction = formatFunction;
+
+    if (level >= minimumConsoleLevel)
+        header.flags |= RecordPrintToConsole;
+    if (level >= minimumFileLevel)
+        header.flags |= RecordPrintToFile;
+
+    while (!WriteRecord(header, arguments))
+    {
+        // Low-priority logs aren't worth stalling the calling thread, and nothing will make room if the logger isn't running
+        if (level < LogLevel::Warning || !m_Running)
+        {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        RequestWake();
+        std::this_thread::yield();
+    }
+
+    RequestWake();
+}
+
+void Logger::PushMessage(const LogLevel level, const std::string_view message, const c8* file, const s32 line, const bool printToFile)
 {
-    log->message = Utils::Trim(log->message);
+    RecordHeader header;
+    header.payloadSize = static_cast<u32>(std::min(message.size(), MaxMessageSize));
+    header.level = level;
+    header.flags = RecordFormatted;
+    header.line = line;
+    header.timestamp = Clock::now().time_since_epoch().count();
+    header.file = file;
+
+    if (level >= minimumConsoleLevel)
+        header.flags |= RecordPrintToConsole;
+    if (printToFile && level >= minimumFileLevel)
+        header.flags |= RecordPrintToFile;
+
+    while (!WriteRecord(header, message.data()))
+    {
+        if (level < LogLevel::Warning || !m_Running)
+        {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        RequestWake();
+        std::this_thread::yield();
+    }
+
+    RequestWake();
+}
+
+void Logger::RequestWake()
+{
+    // Only notify once per batch to avoid a system call for each log
+    if (!m_WakeRequested.load(std::memory_order_relaxed) && !m_WakeRequested.exchange(true, std::memory_order_acq_rel))
+        m_CondVar.notify_one();
+}
+
+void Logger::ProcessLogs()
+{
+    ZoneScoped;
 
-    m_NewLogs.Push(log);
+    List<std::pair<Clock::rep, std::shared_ptr<LogEntry>>> newLogs;
+
+    {
+        std::scoped_lock lock(buffersMutex);
+
+        for (usize i = 0; i < buffers.GetSize();)
+        {
+            ThreadBuffer& buffer = *buffers[i];
+
+            // Read the abandoned flag first so that the last logs of an exited thread are read before freeing its buffer
+            const bool abandoned = buffer.abandoned.load(std::memory_order_acquire);
+
+            u64 tail = buffer.tail.load(std::memory_order_relaxed);
+            const u64 head = buffer.head.load(std::memory_order_acquire);
+
+            while (tail < head)
+            {
+                const std::byte* const record = buffer.data + tail % BufferCapacity;
+
+                RecordHeader header;
+                std::memcpy(&header, record, sizeof(RecordHeader));
+                tail += header.size;
+
+                if (header.flags & RecordPadding)
+                    continue;
+
+                const std::byte* const payload = record + sizeof(RecordHeader);
+
+                std::string message;
+                if (header.flags & RecordFormatted)
+                {
+                    message.assign(reinterpret_cast<const c8*>(payload), header.payloadSize);
+                }
+                else
+                {
+                    try
+                    {
+                        message = header.formatFunction(header.format, payload);
+                    }
+                    catch (const std::format_error& e)
+                    {
+                        message = std::format("Invalid log format string \"{}\": {}", header.format, e.what());
+                    }
+                }
+
+                auto log = std::make_shared<LogEntry>(Utils::Trim(message), header.level, GetRecordTime(header.timestamp));
+                log->printToConsole = header.flags & RecordPrintToConsole;
+                log->printToFile = header.flags & RecordPrintToFile;
+                if (header.file)
+                {
+                    log->file = header.file;
+                    log->line = header.line;
+                }
+
+                newLogs.Emplace(header.timestamp, std::move(log));
+            }
+
+            buffer.tail.store(tail, std::memory_order_release);
+
+            if (abandoned)
+            {
+                delete &buffer;
+                buffers[i] = buffers.Last();
+                buffers.RemoveLast();
+                continue;
+            }
+
+            i++;
+        }
+    }
+
+    // Interleave the logs of all the threads in the order they were made
+    std::stable_sort(
+        newLogs.GetData(),
+        newLogs.GetData() + newLogs.GetSize(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }
+    );
+
+    for (const auto& [timestamp, log] : newLogs)
+        AddLog(log);
+
+    const u64 dropped = droppedCount.load(std::memory_order_relaxed);
+    if (dropped != m_ReportedDroppedCount)
+    {
+        AddLog(
+            std::make_shared<LogEntry>(
+                std::format("{} logs were dropped because the log buffer of their thread was full", dropped - m_ReportedDroppedCount),
+                LogLevel::Warning
+            )
+        );
+        m_ReportedDroppedCount = dropped;
+    }
+}
+
+void Logger::AddLog(const std::shared_ptr<LogEntry>& log)
+{
+    // Check if the log is equal to the previous one
     if (m_LastLog)
+    {
         log->previousLog = m_LastLog;
+        log->sameAsPrevious = *m_LastLog == *log;
+    }
     m_LastLog = log;
 
-    m_CondVar.notify_one();
+    if (historyCapacity > 0)
+    {
+        while (m_Logs.size() >= historyCapacity)
+        {
+            m_Logs.pop_front();
+            m_OverwrittenCount++;
+        }
+
+        m_Logs.push_back(log);
+    }
+
+    // Print the log to the console and/or the file
+    PrintLog(log);
 }
 
 void Logger::PrintLog(const std::shared_ptr<LogEntry>& log)
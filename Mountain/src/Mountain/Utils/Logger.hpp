@@ -1,16 +1,23 @@
 ﻿#pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <string_view>
 #include <thread>
 
 #include "Mountain/Core.hpp"
 #include "Mountain/Utils/DateTime.hpp"
 // ReSharper disable once CppUnusedIncludeDirective
 #include "Mountain/Utils/Formatter.hpp"
+#include "Mountain/Utils/MetaProgramming.hpp"
 #include "Mountain/Utils/Requirements.hpp"
-#include "Mountain/Utils/TsQueue.hpp"
 
 /// @file Logger.hpp
 /// @brief Defines the Mountain::Logger static class
@@ -47,6 +54,16 @@ namespace Mountain
     /// [11:26:05.751] [INFO] Starting logging to file.
     /// @endcode
     /// Also, @ref Logger::LogLevel::Debug "debug logs" automatically specify the file and line at which the log was made.
+    ///
+    /// ### Performance
+    /// Each thread writes its logs to its own lock-free ring buffer, which the logger thread reads from.
+    /// If the format string is a string literal and all the arguments are plain values, i.e., arithmetic types, enumerations,
+    /// math types or colors, the arguments are copied as-is and the log is only formatted on the logger thread. Otherwise, e.g.
+    /// for strings, views or pointers, the log is formatted on the calling thread.
+    ///
+    /// When the buffer of a thread is full, its verbose, info and debug logs are dropped, which can be checked using
+    /// @c Logger::GetDroppedCount(), while the other logs wait for the logger thread to make some room.
+    /// Only the last @c Logger::historyCapacity logs are kept in memory.
     class Logger final
     {
         STATIC_CLASS(Logger)
@@ -85,6 +102,29 @@ namespace Mountain
             Fatal
         };
 
+        /// @brief The format string of a log, which is either a string literal or a string only known at runtime.
+        /// @details Only logs using a string literal can be formatted on the logger thread, as the string must outlive the log.
+        struct FormatString
+        {
+            /// @brief The format string if it is a string literal, or @c nullptr otherwise.
+            const c8* literal = nullptr;
+            std::string_view view;
+
+            template <usize N>
+            // ReSharper disable once CppNonExplicitConvertingConstructor
+            consteval FormatString(const c8 (&format)[N]);
+
+            /// @brief Constructs a format string from a mutable character buffer, which can't be a string literal.
+            template <usize N>
+            // ReSharper disable once CppNonExplicitConvertingConstructor
+            FormatString(c8 (&format)[N]);
+
+            template <typename T>
+            requires std::is_convertible_v<const T&, std::string_view> && (!std::is_array_v<T>)
+            // ReSharper disable once CppNonExplicitConvertingConstructor
+            FormatString(const T& format);
+        };
+
     private:
         struct LogEntry
         {
@@ -112,8 +152,8 @@ namespace Mountain
             MOUNTAIN_API bool operator==(const LogEntry& other) const;
         };
 
-        // We thought about using std::list here instead, but because the allocations are made on the logger thread anyway, we can make it a std::vector
-        MOUNTAIN_API static inline std::vector<std::shared_ptr<LogEntry>> m_Logs;
+        /// @brief The last @c historyCapacity logs, the oldest one first.
+        MOUNTAIN_API static inline std::deque<std::shared_ptr<LogEntry>> m_Logs;
 
     public:
         /// @brief The minimum necessary LogLevel for a log to be printed in the console.
@@ -134,6 +174,10 @@ namespace Mountain
             LogLevel::Warning;
 #endif
 
+        /// @brief The maximum number of logs kept in memory and returned by @c GetLogList().
+        /// @details Once reached, the oldest logs are discarded, which can be checked using @c GetOverwrittenCount().
+        MOUNTAIN_API static inline usize historyCapacity = 4096;
+
         /// @brief Logs a message using the specified format string, arguments and LogLevel.
         /// @tparam Args The format arguments types. These are generally automatically deducted by the compiler and often don't need to be manually specified. Also, they must satisfy the Requirements::Formattable concept requirements.
         /// @param level The log severity.
@@ -141,39 +185,39 @@ namespace Mountain
         /// @param args The arguments to replace the format string with.
         /// @see <a href="https://en.cppreference.com/w/cpp/utility/format/spec">The standard format specification</a>
         template <Requirements::Formattable... Args>
-        static void Log(LogLevel level, const std::string& format, Args&&... args);
+        static void Log(LogLevel level, FormatString format, Args&&... args);
 
         /// @brief Logs a temporary debug message using the current file, line, specified format string and arguments.
         /// @note This function shouldn't be used directly. To print a temporary debug log message, instead use @c DEBUG_LOG().
         /// @see Log
         /// @see LogLevel::Debug
         template <Requirements::Formattable... Args>
-        static void LogDebug(const std::string& format, const c8* file, s32 line, Args&&... args);
+        static void LogDebug(FormatString format, const c8* file, s32 line, Args&&... args);
 
         /// @brief Logs a debug message using the specified format string and arguments.
         /// @see Log
         template <Requirements::Formattable... Args>
-        static void LogVerbose(const std::string& format, Args&&... args);
+        static void LogVerbose(FormatString format, Args&&... args);
 
         /// @brief Logs an information message using the specified format string and arguments.
         /// @see Log
         template <Requirements::Formattable... Args>
-        static void LogInfo(const std::string& format, Args&&... args);
+        static void LogInfo(FormatString format, Args&&... args);
 
         /// @brief Logs a warning message using the specified format string and arguments.
         /// @see Log
         template <Requirements::Formattable... Args>
-        static void LogWarning(const std::string& format, Args&&... args);
+        static void LogWarning(FormatString format, Args&&... args);
 
         /// @brief Logs an error message using the specified format string and arguments.
         /// @see Log
         template <Requirements::Formattable... Args>
-        static void LogError(const std::string& format, Args&&... args);
+        static void LogError(FormatString format, Args&&... args);
 
         /// @brief Logs a fatal error message using the specified format string and arguments.
         /// @see Log
         template <Requirements::Formattable... Args>
-        static void LogFatal(const std::string& format, Args&&... args);
+        static void LogFatal(FormatString format, Args&&... args);
 
         /// @brief Opens a file for logging.
         /// @details If a file is already open for logging e.g. if Logger::HasFileOpen returns @c true, this overwrites it with the new file.
@@ -204,12 +248,51 @@ namespace Mountain
         /// @details This function doesn't do anything if the logger has already been stopped.
         MOUNTAIN_API static void Stop();
 
-        MOUNTAIN_API static const std::vector<std::shared_ptr<LogEntry>>& GetLogList();
+        /// @brief Returns the last @c historyCapacity logs. This list is modified by the logger thread, so only access it after
+        /// calling @c Synchronize().
+        MOUNTAIN_API static const std::deque<std::shared_ptr<LogEntry>>& GetLogList();
 
         MOUNTAIN_API static void Clear();
 
+        /// @brief Returns the number of logs that were dropped because the buffer of their thread was full.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static u64 GetDroppedCount();
+
+        /// @brief Returns the number of logs that were discarded from the history because it reached @c historyCapacity.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static u64 GetOverwrittenCount();
+
     private:
-        MOUNTAIN_API static inline TsQueue<std::shared_ptr<LogEntry>> m_NewLogs;
+        /// @brief Formats a log from its format string and arguments copied by @c PushRecord().
+        using FormatFunction = std::string(*)(std::string_view format, const std::byte* arguments);
+
+        /// @brief The layout of the arguments of a log, each one being copied at its own aligned offset.
+        template <typename... Ts>
+        struct ArgumentLayout
+        {
+            static constexpr std::array<usize, sizeof...(Ts)> offsets = []
+            {
+                std::array<usize, sizeof...(Ts)> result{};
+                usize offset = 0, i = 0;
+                ((offset = (offset + alignof(Ts) - 1) / alignof(Ts) * alignof(Ts), result[i++] = offset, offset += sizeof(Ts)), ...);
+                return result;
+            }();
+
+            static constexpr usize size = []
+            {
+                usize offset = 0;
+                ((offset = (offset + alignof(Ts) - 1) / alignof(Ts) * alignof(Ts) + sizeof(Ts)), ...);
+                return offset;
+            }();
+        };
+
+        /// @brief Whether a log argument of type @p T can be copied as raw bytes and formatted later.
+        /// @details This is restricted to types holding plain values, as types referencing other memory such as pointers,
+        /// @c std::string_view or @c std::span may point to memory that is freed before the log is formatted.
+        template <typename T>
+        static constexpr bool IsDeferrable = (std::is_arithmetic_v<T> || std::is_enum_v<T> || Meta::IsMathType<T> || Meta::IsColor<T>)
+            && std::is_trivially_copyable_v<T>
+            && alignof(T) <= 16;
 
         MOUNTAIN_API static inline std::shared_ptr<LogEntry> m_LastLog;
 
@@ -217,23 +300,64 @@ namespace Mountain
 
         MOUNTAIN_API static inline std::condition_variable m_CondVar;
 
+        /// @brief Notified by the logger thread once it is done synchronizing.
+        MOUNTAIN_API static inline std::condition_variable m_SynchronizeCondVar;
+
         MOUNTAIN_API static void Run();
 
         MOUNTAIN_API static inline std::thread m_Thread;
 
         MOUNTAIN_API static inline std::mutex m_Mutex;
 
-        MOUNTAIN_API static inline bool m_Running = false;
+        MOUNTAIN_API static inline std::atomic_bool m_Running = false;
 
         MOUNTAIN_API static inline bool m_Synchronizing = false;
 
+        /// @brief Whether a thread already asked the logger thread to process the new logs.
+        MOUNTAIN_API static inline std::atomic_bool m_WakeRequested = false;
+
+        MOUNTAIN_API static inline u64 m_OverwrittenCount = 0;
+
+        /// @brief The number of dropped logs the logger thread already reported.
+        MOUNTAIN_API static inline u64 m_ReportedDroppedCount = 0;
+
         MOUNTAIN_API static inline std::ofstream m_File;
 
         MOUNTAIN_API static inline std::filesystem::path m_Filepath;
 
         MOUNTAIN_API static inline u32 m_LogIndex = 0;
 
-        MOUNTAIN_API static void PushLog(const std::shared_ptr<LogEntry>& log);
+        template <typename... Args>
+        static void PushLog(LogLevel level, FormatString format, const c8* file, s32 line, Args&... args);
+
+        template <typename... Ts>
+        static std::string FormatArguments(std::string_view format, const std::byte* arguments);
+
+        template <typename T>
+        static T ReadArgument(const std::byte* argument);
+
+        /// @brief Pushes a log whose arguments will be formatted on the logger thread.
+        MOUNTAIN_API static void PushRecord(
+            LogLevel level,
+            const c8* format,
+            const c8* file,
+            s32 line,
+            FormatFunction formatFunction,
+            const std::byte* arguments,
+            usize argumentsSize
+        );
+
+        /// @brief Pushes an already formatted log.
+        MOUNTAIN_API static void PushMessage(LogLevel level, std::string_view message, const c8* file, s32 line, bool printToFile);
+
+        /// @brief Wakes up the logger thread if no other thread did already.
+        MOUNTAIN_API static void RequestWake();
+
+        /// @brief Reads the new logs of all threads, then stores and prints them. Must be called on the logger thread.
+        MOUNTAIN_API static void ProcessLogs();
+
+        /// @brief Adds a log to the history and prints it.
+        MOUNTAIN_API static void AddLog(const std::shared_ptr<LogEntry>& log);
 
         /// @brief Prints a log to the console and the logging file.
         MOUNTAIN_API static void PrintLog(const std::shared_ptr<LogEntry>& log);
@@ -252,58 +376,120 @@ namespace Mountain
 // Start of Logger.inl
 
 #include <format>
+#include <tuple>
 #include <utility>
 
 namespace Mountain
 {
+    template <usize N>
+    consteval Logger::FormatString::FormatString(const c8 (&format)[N])
+        : literal(format)
+        , view(format, N - 1)
+    {
+    }
+
+    template <usize N>
+    Logger::FormatString::FormatString(c8 (&format)[N])
+        : view(format, std::find(format, format + N, '\0') - format)
+    {
+    }
+
+    template <typename T>
+    requires std::is_convertible_v<const T&, std::string_view> && (!std::is_array_v<T>)
+    Logger::FormatString::FormatString(const T& format)
+        : view(format)
+    {
+    }
+
     template <Requirements::Formattable... Args>
-    void Logger::Log(const LogLevel level, const std::string& format, Args&&... args)
+    void Logger::Log(const LogLevel level, const FormatString format, Args&&... args)
     {
         if (!ShouldLog(level))
             return;
 
-        PushLog(std::make_shared<LogEntry>(std::vformat(format, std::make_format_args(args...)), level));
+        PushLog(level, format, nullptr, -1, args...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogDebug(const std::string& format, const c8* file, const s32 line, Args&&... args)
+    void Logger::LogDebug(const FormatString format, const c8* file, const s32 line, Args&&... args)
     {
         if (!ShouldLog(LogLevel::Debug))
             return;
 
-        PushLog(std::make_shared<LogEntry>(std::vformat(format, std::make_format_args(args...)), LogLevel::Debug, file, line));
+        PushLog(LogLevel::Debug, format, file, line, args...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogVerbose(const std::string& format, Args&&... args)
+    void Logger::LogVerbose(const FormatString format, Args&&... args)
     {
         Logger::Log(LogLevel::Verbose, format, std::forward<Args>(args)...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogInfo(const std::string& format, Args&&... args)
+    void Logger::LogInfo(const FormatString format, Args&&... args)
     {
         Logger::Log(LogLevel::Info, format, std::forward<Args>(args)...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogWarning(const std::string& format, Args&&... args)
+    void Logger::LogWarning(const FormatString format, Args&&... args)
     {
         Logger::Log(LogLevel::Warning, format, std::forward<Args>(args)...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogError(const std::string& format, Args&&... args)
+    void Logger::LogError(const FormatString format, Args&&... args)
     {
         Logger::Log(LogLevel::Error, format, std::forward<Args>(args)...);
     }
 
     template <Requirements::Formattable... Args>
-    void Logger::LogFatal(const std::string& format, Args&&... args)
+    void Logger::LogFatal(const FormatString format, Args&&... args)
     {
         Logger::Log(LogLevel::Fatal, format, std::forward<Args>(args)...);
     }
 
+    template <typename... Args>
+    void Logger::PushLog(const LogLevel level, const FormatString format, const c8* file, const s32 line, Args&... args)
+    {
+        if constexpr ((IsDeferrable<std::remove_cvref_t<Args>> && ...))
+        {
+            if (format.literal)
+            {
+                using Layout = ArgumentLayout<std::remove_cvref_t<Args>...>;
+
+                alignas(16) std::byte arguments[std::max<usize>(Layout::size, 1)];
+                usize i = 0;
+                ((std::memcpy(arguments + Layout::offsets[i++], std::addressof(args), sizeof(args))), ...);
+
+                PushRecord(level, format.literal, file, line, FormatArguments<std::remove_cvref_t<Args>...>, arguments, Layout::size);
+                return;
+            }
+        }
+
+        PushMessage(level, std::vformat(format.view, std::make_format_args(args...)), file, line, true);
+    }
+
+    template <typename... Ts>
+    std::string Logger::FormatArguments(const std::string_view format, const std::byte* arguments)
+    {
+        using Layout = ArgumentLayout<Ts...>;
+
+        return [&]<usize... I>(std::index_sequence<I...>)
+        {
+            std::tuple<Ts...> values{ReadArgument<Ts>(arguments + Layout::offsets[I])...};
+            return std::apply([&](Ts&... v) { return std::vformat(format, std::make_format_args(v...)); }, values);
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename T>
+    T Logger::ReadArgument(const std::byte* argument)
+    {
+        std::array<std::byte, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), argument, sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
     constexpr bool Logger::ShouldLog(const LogLevel level)
     {
         return level >= minimumConsoleLevel || (HasFileOpen() && level >= minimumFileLevel);
@@ -48,6 +48,12 @@ namespace Mountain
     /// @c Pointer::ToStrongReference(), or by creating a copy using the copy constructor
     /// and giving a @c true value to the second argument.
     ///
+    /// Weak references don't keep anything registered: they check whether a strong reference is still alive whenever
+    /// they are used, and only keep the reference counter allocated.
+    /// Reference counts are atomic, so Pointer instances can be copied and destroyed on different threads as long as a
+    /// single instance isn't modified by two threads at once. A weak reference used from another thread should be
+    /// converted to a strong one first, which fails and resets it if the object was already destroyed.
+    ///
     /// @tparam T The type to point to. Most of the time, this shouldn't be a pointer type.
     ///
     /// @see <a href="https://en.cppreference.com/book/intro/smart_pointers">Smart Pointers</a>
@@ -112,11 +118,12 @@ namespace Mountain
         ATTRIBUTE_NODISCARD
         T* Get();
 
-        /// @brief Returns whether this Pointer is @c nullptr.
+        /// @brief Returns whether this Pointer is @c nullptr or a weak reference to an object that was destroyed.
         ATTRIBUTE_NODISCARD
         bool IsValid() const;
 
         /// @brief Converts this @ref Pointer to a strong reference.
+        /// @details If this is a weak reference to an object that was destroyed, this Pointer is set to @c nullptr instead.
         void ToStrongReference();
 
         /// @brief Converts this @ref Pointer to a weak reference.
@@ -201,9 +208,12 @@ namespace Mountain
 
         explicit Pointer(ReferenceCounter<T>*&& referenceCounter, bool strongReference);
 
-        void SetReferenceCounter(ReferenceCounter<T>* newReferenceCounter);
+        /// @brief Adds a reference to @p referenceCounter, which must be released beforehand.
+        /// @details A strong reference to an object that was already destroyed leaves this Pointer empty.
+        void Acquire(ReferenceCounter<T>* referenceCounter, bool strongReference);
 
-        void CheckReferenceCounterValid();
+        /// @brief Removes the reference held by this Pointer and empties it.
+        void Release();
     };
 
     /// @brief Compares two @c Pointer by checking if they point to the same address.
@@ -244,32 +254,15 @@ namespace Mountain
 
     template <typename T>
     Pointer<T>::Pointer(const Pointer& other, const bool strongReference)
-        : m_ReferenceCounter(other.m_ReferenceCounter)
-        , m_IsStrongReference(strongReference)
     {
-        if (!other.m_ReferenceCounter)
-            return;
-
-        if (strongReference)
-            m_ReferenceCounter->IncStrong();
-        else
-            m_ReferenceCounter->IncWeak(this);
+        Acquire(other.m_ReferenceCounter, strongReference);
     }
 
     template <typename T>
     Pointer<T>::Pointer(Pointer&& other) noexcept
-        : m_ReferenceCounter(std::move(other.m_ReferenceCounter))
+        : m_ReferenceCounter(other.m_ReferenceCounter)
         , m_IsStrongReference(other.m_IsStrongReference)
     {
-        if (!m_ReferenceCounter)
-            return;
-
-        if (!m_IsStrongReference)
-        {
-            m_ReferenceCounter->DecWeak(&other);
-            m_ReferenceCounter->IncWeak(this);
-        }
-
         other.Reset();
     }
 
@@ -281,16 +274,8 @@ namespace Mountain
     template <typename T>
     template <typename U>
     Pointer<T>::Pointer(const Pointer<U>& other, const bool strongReference)
-        : m_ReferenceCounter(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter())))
-        , m_IsStrongReference(strongReference)
     {
-        if (!m_ReferenceCounter)
-            return;
-
-        if (strongReference)
-            m_ReferenceCounter->IncStrong();
-        else
-            m_ReferenceCounter->IncWeak(this);
+        Acquire(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter())), strongReference);
     }
 
     template <typename T>
@@ -303,25 +288,16 @@ namespace Mountain
     template <typename T>
     template <typename U>
     Pointer<T>::Pointer(Pointer<U>&& other) noexcept  // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
-        : m_ReferenceCounter(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(std::move(other.GetReferenceCounter()))))
-        , m_IsStrongReference(std::move(other.GetIsStrongReference()))
+        : m_ReferenceCounter(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter())))
+        , m_IsStrongReference(other.GetIsStrongReference())
     {
-        if (!m_ReferenceCounter)
-            return;
-
-        if (!m_IsStrongReference)
-        {
-            m_ReferenceCounter->DecWeak(reinterpret_cast<Pointer*>(&other));
-            m_ReferenceCounter->IncWeak(this);
-        }
-
         other.Reset();
     }
 
     template <typename T>
     Pointer<T>::~Pointer()
     {
-        SetReferenceCounter(nullptr);
+        Release();
     }
 
     template <typename T>
@@ -348,9 +324,13 @@ namespace Mountain
         if (this == &other)
             return *this;
 
-        SetReferenceCounter(other.m_ReferenceCounter);
-        if (m_ReferenceCounter)
-            m_ReferenceCounter->IncWeak(this);
+        // Reference the new counter first in case releasing the current one destroys the object owning other
+        ReferenceCounter<T>* const referenceCounter = other.m_ReferenceCounter;
+        if (referenceCounter)
+            referenceCounter->IncWeak();
+
+        Release();
+        m_ReferenceCounter = referenceCounter;
 
         return *this;
     }
@@ -361,15 +341,10 @@ namespace Mountain
         if (this == &other)
             return *this;
 
-        SetReferenceCounter(std::move(other.m_ReferenceCounter));
+        Release();
+        m_ReferenceCounter = other.m_ReferenceCounter;
         m_IsStrongReference = other.m_IsStrongReference;
 
-        if (m_ReferenceCounter && !m_IsStrongReference)
-        {
-            m_ReferenceCounter->DecWeak(&other);
-            m_ReferenceCounter->IncWeak(this);
-        }
-
         other.Reset();
 
         return *this;
@@ -378,8 +353,7 @@ namespace Mountain
     template <typename T>
     Pointer<T>& Pointer<T>::operator=(nullptr_t)
     {
-        SetReferenceCounter(nullptr);
-        m_IsStrongReference = false;
+        Release();
 
         return *this;
     }
@@ -392,8 +366,12 @@ namespace Mountain
         if (reinterpret_cast<const s8*>(this) == reinterpret_cast<const s8*>(&other))
             return *this;
 
-        SetReferenceCounter(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter())));
-        m_ReferenceCounter->IncWeak(this);
+        ReferenceCounter<T>* const referenceCounter = reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter()));
+        if (referenceCounter)
+            referenceCounter->IncWeak();
+
+        Release();
+        m_ReferenceCounter = referenceCounter;
 
         return *this;
     }
@@ -405,14 +383,9 @@ namespace Mountain
         if (reinterpret_cast<const s8*>(this) == reinterpret_cast<const s8*>(&other))
             return *this;
 
-        SetReferenceCounter(reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter())));
-        m_IsStrongReference = std::move(other.GetIsStrongReference());
-
-        if (m_ReferenceCounter && !m_IsStrongReference)
-        {
-            m_ReferenceCounter->DecWeak(reinterpret_cast<const Pointer*>(&other));
-            m_ReferenceCounter->IncWeak(this);
-        }
+        Release();
+        m_ReferenceCounter = reinterpret_cast<ReferenceCounter<T>*>(const_cast<ReferenceCounter<U>*>(other.GetReferenceCounter()));
+        m_IsStrongReference = other.GetIsStrongReference();
 
         other.Reset();
 
@@ -442,29 +415,33 @@ namespace Mountain
     template <typename T>
     T& Pointer<T>::operator*()
     {
-        ENSURE_NOT_NULL(m_ReferenceCounter);
-        return *m_ReferenceCounter->GetPointer();
+        T* const pointer = static_cast<T*>(*this);
+        ENSURE_NOT_NULL(pointer);
+        return *pointer;
     }
 
     template <typename T>
     const T& Pointer<T>::operator*() const
     {
-        ENSURE_NOT_NULL(m_ReferenceCounter);
-        return *m_ReferenceCounter->GetPointer();
+        const T* const pointer = static_cast<const T*>(*this);
+        ENSURE_NOT_NULL(pointer);
+        return *pointer;
     }
 
     template <typename T>
     T* Pointer<T>::operator->()
     {
-        ENSURE_NOT_NULL(m_ReferenceCounter);
-        return m_ReferenceCounter->GetPointer();
+        T* const pointer = static_cast<T*>(*this);
+        ENSURE_NOT_NULL(pointer);
+        return pointer;
     }
 
     template <typename T>
     const T* Pointer<T>::operator->() const
     {
-        ENSURE_NOT_NULL(m_ReferenceCounter);
-        return m_ReferenceCounter->GetPointer();
+        const T* const pointer = static_cast<const T*>(*this);
+        ENSURE_NOT_NULL(pointer);
+        return pointer;
     }
 
     template <typename T>
@@ -482,7 +459,11 @@ namespace Mountain
     }
 
     template <typename T>
-    bool Pointer<T>::IsValid() const { return m_ReferenceCounter != nullptr; }
+    bool Pointer<T>::IsValid() const
+    {
+        // Weak references are only checked here instead of being reset when the object is destroyed
+        return m_ReferenceCounter && (m_IsStrongReference || m_ReferenceCounter->GetStrong() > 0);
+    }
 
     template <typename T>
     bool Pointer<T>::GetIsStrongReference() const { return m_IsStrongReference; }
@@ -490,11 +471,16 @@ namespace Mountain
     template <typename T>
     void Pointer<T>::ToStrongReference()
     {
-        if (m_IsStrongReference)
+        if (m_IsStrongReference || !m_ReferenceCounter)
             return;
 
-        m_ReferenceCounter->IncStrong();
-        m_ReferenceCounter->DecWeak(this);
+        if (!m_ReferenceCounter->TryIncStrong())
+        {
+            Release();
+            return;
+        }
+
+        m_ReferenceCounter->DecWeak();
         m_IsStrongReference = true;
     }
 
@@ -504,8 +490,9 @@ namespace Mountain
         if (!m_IsStrongReference)
             return;
 
+        // Take the weak reference first so that the reference counter outlives the object if this was the last strong one
+        m_ReferenceCounter->IncWeak();
         m_ReferenceCounter->DecStrong();
-        m_ReferenceCounter->IncWeak(this);
         m_IsStrongReference = false;
     }
 
@@ -527,35 +514,37 @@ namespace Mountain
     }
 
     template <typename T>
-    void Pointer<T>::SetReferenceCounter(ReferenceCounter<T>* newReferenceCounter)
+    void Pointer<T>::Acquire(ReferenceCounter<T>* referenceCounter, const bool strongReference)
     {
-        if (m_ReferenceCounter)
+        if (!referenceCounter)
+            return;
+
+        if (strongReference)
         {
-            if (m_IsStrongReference)
-            {
-                if (m_ReferenceCounter->DecStrong())
-                    CheckReferenceCounterValid();
-            }
-            else
-            {
-                m_ReferenceCounter->DecWeak(this);
-            }
+            if (!referenceCounter->TryIncStrong())
+                return;
+        }
+        else
+        {
+            referenceCounter->IncWeak();
         }
 
-        m_ReferenceCounter = newReferenceCounter;
+        m_ReferenceCounter = referenceCounter;
+        m_IsStrongReference = strongReference;
     }
 
     template <typename T>
-    void Pointer<T>::CheckReferenceCounterValid()
+    void Pointer<T>::Release()
     {
-        if (!m_ReferenceCounter)
-            return;
-
-        if (m_ReferenceCounter->GetStrong() == 0)
+        if (m_ReferenceCounter)
         {
-            delete m_ReferenceCounter;
-            Reset();
+            if (m_IsStrongReference)
+                m_ReferenceCounter->DecStrong();
+            else
+                m_ReferenceCounter->DecWeak();
         }
+
+        Reset();
     }
 
     template <typename T>
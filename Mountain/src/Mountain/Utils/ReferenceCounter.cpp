@@ -0,0 +1,104 @@
+#include "Mountain/Utils/ReferenceCounter.hpp"
+
+#include <mutex>
+#include <new>
+
+using namespace Mountain;
+
+namespace
+{
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* head = nullptr;
+        u32 count = 0;
+
+        void Push(FreeBlock* block)
+        {
+            block->next = head;
+            head = block;
+            count++;
+        }
+
+        FreeBlock* Pop()
+        {
+            FreeBlock* block = head;
+            head = block->next;
+            count--;
+            return block;
+        }
+    };
+
+    struct SharedFreeList
+    {
+        std::mutex mutex;
+        FreeList list;
+    };
+
+    /// @brief The number of blocks a thread can keep before giving some back to the shared list.
+    constexpr u32 ThreadCacheCapacity = 256;
+    /// @brief The number of blocks exchanged at once between a thread and the shared list.
+    constexpr u32 BatchSize = 64;
+    /// @brief The number of blocks allocated at once when the shared list is empty.
+    constexpr u32 ChunkBlockCount = 256;
+
+    // This is trivially destructible so that pointers destroyed during the destruction of other thread_local variables can
+    // still use it
+    thread_local FreeList threadCache;
+
+    SharedFreeList& GetSharedFreeList()
+    {
+        // Never deleted so that pointers destroyed during static destruction can still use it
+        static SharedFreeList* const sharedFreeList = new SharedFreeList;
+        return *sharedFreeList;
+    }
+
+    void Refill()
+    {
+        SharedFreeList& shared = GetSharedFreeList();
+
+        {
+            std::scoped_lock lock(shared.mutex);
+            for (u32 i = 0; i < BatchSize && shared.list.head; i++)
+                threadCache.Push(shared.list.Pop());
+        }
+
+        if (threadCache.head)
+            return;
+
+        std::byte* const chunk = static_cast<std::byte*>(
+            ::operator new(ChunkBlockCount * ReferenceCounterAllocator::BlockSize, std::align_val_t{ReferenceCounterAllocator::BlockSize})
+        );
+
+        for (u32 i = ChunkBlockCount; i > 0; i--)
+            threadCache.Push(reinterpret_cast<FreeBlock*>(chunk + (i - 1) * ReferenceCounterAllocator::BlockSize));
+    }
+}
+
+void* ReferenceCounterAllocator::Allocate()
+{
+    if (!threadCache.head)
+        Refill();
+
+    return threadCache.Pop();
+}
+
+void ReferenceCounterAllocator::Free(void* block)
+{
+    if (!block)
+        return;
+
+    threadCache.Push(static_cast<FreeBlock*>(block));
+
+    if (threadCache.count <= ThreadCacheCapacity)
+        return;
+
+    SharedFreeList& shared = GetSharedFreeList();
+    std::scoped_lock lock(shared.mutex);
+    for (u32 i = 0; i < BatchSize; i++)
+        shared.list.Push(threadCache.Pop());
+}
@@ -1,17 +1,35 @@
 ﻿#pragma once
 
-#include <mutex>
-#include <vector>
+#include <atomic>
 
 #include "Mountain/Core.hpp"
-#include "Mountain/Exceptions/ThrowHelper.hpp"
 
 namespace Mountain
 {
-    template <typename>
-    struct Pointer;
+    /// @private
+    /// @brief Static class allocating the control blocks of @c ReferenceCounter.
+    /// @details Blocks are taken from a free list owned by the calling thread, which exchanges them in batches with a list
+    /// shared by all the threads. Memory is never given back to the system, and the blocks cached by a thread are lost
+    /// when it exits.
+    class ReferenceCounterAllocator
+    {
+        STATIC_CLASS(ReferenceCounterAllocator)
+
+    public:
+        /// @brief The size of a block, which must be enough to hold any @c ReferenceCounter.
+        static constexpr usize BlockSize = 32;
+
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static void* Allocate();
+
+        MOUNTAIN_API static void Free(void* block);
+    };
 
     /// @private
+    /// @brief Control block of a @c Pointer.
+    /// @details The weak count holds one additional reference for all the strong ones together, so the object is deleted
+    /// when the strong count reaches zero and the control block is deleted when the weak count does.
+    /// Weak references don't register themselves and instead check the strong count when they are used.
     template <typename T>
     class ReferenceCounter
     {
@@ -29,16 +47,24 @@ namespace Mountain
 
         ReferenceCounter& operator=(ReferenceCounter&& other) = delete;
 
-        ~ReferenceCounter();
+        ~ReferenceCounter() = default;
+
+        static void* operator new(usize size);
+
+        static void operator delete(void* pointer);
 
         void IncStrong();
 
-        void IncWeak(Pointer<T>* weakReferenceOwner);
+        /// @brief Increments the strong ref count only if it isn't 0.
+        /// @return Whether the count was incremented.
+        bool TryIncStrong();
+
+        void IncWeak();
 
         // Returns whether the strong ref count becomes 0
         bool DecStrong();
 
-        void DecWeak(const Pointer<T>* weakReferenceOwner);
+        void DecWeak();
 
         ATTRIBUTE_NODISCARD
         u64 GetStrong() const;
@@ -53,13 +79,11 @@ namespace Mountain
         const T* GetPointer() const;
 
     private:
-        u64 m_Strong = 1;
-
-        T* m_Pointer = nullptr;
+        std::atomic<u64> m_Strong = 1;
 
-        std::vector<Pointer<T>*> m_WeakReferenceOwners;
+        std::atomic<u64> m_Weak = 1;
 
-        std::mutex m_Mutex;
+        std::atomic<T*> m_Pointer = nullptr;
     };
 }
 
@@ -75,71 +99,88 @@ namespace Mountain
     }
 
     template <typename T>
-    ReferenceCounter<T>::~ReferenceCounter()
+    void* ReferenceCounter<T>::operator new([[maybe_unused]] const usize size)
     {
-        for (auto& weakReferenceOwner : m_WeakReferenceOwners)
-            weakReferenceOwner->Reset();
+        static_assert(sizeof(ReferenceCounter) <= ReferenceCounterAllocator::BlockSize);
+        static_assert(alignof(ReferenceCounter) <= ReferenceCounterAllocator::BlockSize);
 
-        delete m_Pointer;
+        return ReferenceCounterAllocator::Allocate();
     }
 
     template <typename T>
-    void ReferenceCounter<T>::IncStrong()
+    void ReferenceCounter<T>::operator delete(void* pointer)
     {
-        m_Strong++;
+        ReferenceCounterAllocator::Free(pointer);
     }
 
     template <typename T>
-    void ReferenceCounter<T>::IncWeak(Pointer<T>* weakReferenceOwner)
+    void ReferenceCounter<T>::IncStrong()
     {
-        std::scoped_lock lock(m_Mutex);
-        m_WeakReferenceOwners.push_back(weakReferenceOwner);
+        m_Strong.fetch_add(1, std::memory_order_relaxed);
     }
 
     template <typename T>
-    bool ReferenceCounter<T>::DecStrong()
+    bool ReferenceCounter<T>::TryIncStrong()
     {
-        if (m_Strong == 0)
-            return true;
-
-        if (--m_Strong == 0)
-            return true;
+        u64 strong = m_Strong.load(std::memory_order_relaxed);
+        while (strong != 0)
+        {
+            if (m_Strong.compare_exchange_weak(strong, strong + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
 
         return false;
     }
 
     template <typename T>
-    void ReferenceCounter<T>::DecWeak(const Pointer<T>* const weakReferenceOwner)
+    void ReferenceCounter<T>::IncWeak()
     {
-        const auto&& it = std::ranges::find(m_WeakReferenceOwners, weakReferenceOwner);
+        m_Weak.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        if (it == m_WeakReferenceOwners.end())
-            THROW(InvalidOperationException{"Tried to decrement the weak reference count of a smart pointer with one that wasn't registered"});
+    template <typename T>
+    bool ReferenceCounter<T>::DecStrong()
+    {
+        if (m_Strong.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return false;
 
-        m_WeakReferenceOwners.erase(it);
+        delete m_Pointer.exchange(nullptr, std::memory_order_acq_rel);
+
+        // Release the weak reference held by the strong ones, which may delete this
+        DecWeak();
+
+        return true;
+    }
+
+    template <typename T>
+    void ReferenceCounter<T>::DecWeak()
+    {
+        if (m_Weak.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
     }
 
     template <typename T>
     u64 ReferenceCounter<T>::GetStrong() const
     {
-        return m_Strong;
+        return m_Strong.load(std::memory_order_acquire);
     }
 
     template <typename T>
     u64 ReferenceCounter<T>::GetWeak() const
     {
-        return m_WeakReferenceOwners.size();
+        const u64 weak = m_Weak.load(std::memory_order_acquire);
+        return GetStrong() > 0 ? weak - 1 : weak;
     }
 
     template <typename T>
     T* ReferenceCounter<T>::GetPointer()
     {
-        return m_Pointer;
+        return m_Pointer.load(std::memory_order_acquire);
     }
 
     template <typename T>
     const T* ReferenceCounter<T>::GetPointer() const
     {
-        return m_Pointer;
+        return m_Pointer.load(std::memory_order_acquire);
     }
 }
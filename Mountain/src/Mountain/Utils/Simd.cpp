@@ -0,0 +1,42 @@
+#include "Mountain/Utils/Simd.hpp"
+
+#include <algorithm>
+#include <array>
+
+#if defined(ARCHITECTURE_X64) && defined(COMPILER_MSVC)
+#include <intrin.h>
+#endif
+
+using namespace Mountain;
+
+SimdLevel Simd::GetSupportedLevel()
+{
+#ifndef ARCHITECTURE_X64
+    return SimdLevel::None;
+#elifdef COMPILER_MSVC
+    std::array<s32, 4> info{};
+
+    __cpuid(info.data(), 0);
+    const s32 maxLeaf = info[0];
+
+    // AVX2 also needs the operating system to save the upper halves of the YMM registers
+    __cpuid(info.data(), 1);
+    const bool osXsave = info[2] & (1 << 27);
+    const bool avx = info[2] & (1 << 28);
+    if (maxLeaf < 7 || !osXsave || !avx || (_xgetbv(0) & 0b110) != 0b110)
+        return SimdLevel::Sse2;
+
+    __cpuidex(info.data(), 7, 0);
+    return info[1] & (1 << 5) ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#else
+    // This also checks that the operating system supports the instruction set
+    return __builtin_cpu_supports("avx2") ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#endif
+}
+
+SimdLevel Simd::GetLevel() { return m_Level.load(std::memory_order_relaxed); }
+
+void Simd::SetLevel(const SimdLevel newLevel)
+{
+    m_Level.store(std::min(newLevel, GetSupportedLevel()), std::memory_order_relaxed);
+}
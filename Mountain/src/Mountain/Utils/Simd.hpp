@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+
+#include "Mountain/Core.hpp"
+
+/// @file Simd.hpp
+/// @brief Defines the Mountain::Simd class.
+
+namespace Mountain
+{
+    /// @brief The SIMD instruction sets that the vectorized code of the framework can use.
+    enum class SimdLevel : u8
+    {
+        /// @brief Only use scalar code.
+        None,
+        /// @brief Use the 128-bit SSE2 instructions, which all x64 CPUs support.
+        Sse2,
+        /// @brief Use the 256-bit AVX2 instructions.
+        Avx2
+    };
+
+    /// @brief Static class choosing the instruction set used by the vectorized code, such as the audio mixing kernels.
+    /// @details The level is detected once at startup. The vectorized functions check it each time they are called, so
+    /// they can be compiled for every level in the same binary without requiring any compiler flag.
+    class Simd
+    {
+        STATIC_CLASS(Simd)
+
+    public:
+        /// @brief Returns the highest level supported by both the CPU and the operating system.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static SimdLevel GetSupportedLevel();
+
+        /// @brief Returns the level currently used by the vectorized code, which is @c GetSupportedLevel() by default.
+        ATTRIBUTE_NODISCARD
+        MOUNTAIN_API static SimdLevel GetLevel();
+
+        /// @brief Sets the level used by the vectorized code, e.g. to compare the different code paths in tests and benchmarks.
+        /// @details Levels higher than @c GetSupportedLevel() are clamped to it.
+        MOUNTAIN_API static void SetLevel(SimdLevel newLevel);
+
+    private:
+        MOUNTAIN_API static inline std::atomic<SimdLevel> m_Level = GetSupportedLevel();
+    };
+}
@@ -0,0 +1,142 @@
+#include "Mountain/Utils/SkylinePacker.hpp"
+
+#include <limits>
+
+using namespace Mountain;
+
+SkylinePacker::SkylinePacker(const Vector2i size) { Reset(size); }
+
+void SkylinePacker::Reset(const Vector2i newSize)
+{
+    m_Size = newSize;
+    Reset();
+}
+
+void SkylinePacker::Reset()
+{
+    m_UsedArea = 0;
+    m_Skyline.Clear();
+    m_Skyline.Add(Node{0, 0, m_Size.x});
+}
+
+Optional<Vector2i> SkylinePacker::Insert(const Vector2i size)
+{
+    if (size.x <= 0 || size.y <= 0)
+        return {};
+
+    const Optional<std::pair<usize, Vector2i>> position = FindPosition(size);
+    if (!position.HasValue())
+        return {};
+
+    const auto& [index, topLeft] = position.Value();
+    AddLevel(index, topLeft, size);
+    m_UsedArea += static_cast<s64>(size.x) * size.y;
+
+    return topLeft;
+}
+
+bool SkylinePacker::CanInsert(const Vector2i size) const { return size.x > 0 && size.y > 0 && FindPosition(size).HasValue(); }
+
+f32 SkylinePacker::GetOccupancy() const
+{
+    if (m_Size.x <= 0 || m_Size.y <= 0)
+        return 0.f;
+
+    return static_cast<f32>(static_cast<f64>(m_UsedArea) / (static_cast<f64>(m_Size.x) * m_Size.y));
+}
+
+Optional<std::pair<usize, Vector2i>> SkylinePacker::FindPosition(const Vector2i size) const
+{
+    Optional<std::pair<usize, Vector2i>> result;
+    s32 bestBottom = std::numeric_limits<s32>::max();
+    s32 bestWidth = std::numeric_limits<s32>::max();
+
+    for (usize i = 0; i < m_Skyline.GetSize(); i++)
+    {
+        const Optional<s32> y = Fit(i, size);
+        if (!y.HasValue())
+            continue;
+
+        // Bottom-left heuristic: keep the skyline as low as possible, and prefer the narrowest node on ties
+        const Node& node = m_Skyline[i];
+        const s32 bottom = y.Value() + size.y;
+        if (bottom < bestBottom || (bottom == bestBottom && node.width < bestWidth))
+        {
+            bestBottom = bottom;
+            bestWidth = node.width;
+            result = std::make_pair(i, Vector2i{node.x, y.Value()});
+        }
+    }
+
+    return result;
+}
+
+Optional<s32> SkylinePacker::Fit(const usize index, const Vector2i size) const
+{
+    const s32 x = m_Skyline[index].x;
+    if (x + size.x > m_Size.x)
+        return {};
+
+    s32 widthLeft = size.x;
+    s32 y = m_Skyline[index].y;
+
+    for (usize i = index; widthLeft > 0; i++)
+    {
+        const Node& node = m_Skyline[i];
+        y = std::max(y, node.y);
+
+        if (y + size.y > m_Size.y)
+            return {};
+
+        widthLeft -= node.width;
+    }
+
+    return y;
+}
+
+void SkylinePacker::AddLevel(const usize index, const Vector2i position, const Vector2i size)
+{
+    m_Skyline.Insert(index, Node{position.x, position.y + size.y, size.x});
+
+    // Shrink or remove the nodes that are now covered by the new one
+    const usize i = index + 1;
+    while (i < m_Skyline.GetSize())
+    {
+        const Node& previous = m_Skyline[i - 1];
+        Node& node = m_Skyline[i];
+
+        const s32 previousRight = previous.x + previous.width;
+        if (node.x >= previousRight)
+            break;
+
+        const s32 shrink = previousRight - node.x;
+        node.x += shrink;
+        node.width -= shrink;
+
+        if (node.width > 0)
+            break;
+
+        m_Skyline.RemoveAt(i);
+    }
+
+    Merge();
+}
+
+void SkylinePacker::Merge()
+{
+    for (usize i = 0; i + 1 < m_Skyline.GetSize();)
+    {
+        Node& node = m_Skyline[i];
+        const Node& next = m_Skyline[i + 1];
+
+        if (node.y == next.y)
+        {
+            node.width += next.width;
+            m_Skyline.RemoveAt(i + 1);
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <utility>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Math/Vector2i.hpp"
+#include "Mountain/Utils/Optional.hpp"
+
+/// @file SkylinePacker.hpp
+/// @brief Defines the Mountain::SkylinePacker class.
+
+namespace Mountain
+{
+    /// @brief Packs rectangles into a fixed-size area using the skyline bottom-left heuristic.
+    /// @details The packer only keeps track of the top edge (the skyline) of the rectangles placed so far,
+    /// which makes insertions cheap at the cost of not being able to remove a rectangle once it has been placed.
+    class MOUNTAIN_API SkylinePacker
+    {
+    public:
+        SkylinePacker() = default;
+
+        explicit SkylinePacker(Vector2i size);
+
+        /// @brief Clears all placed rectangles and resizes the packing area.
+        void Reset(Vector2i newSize);
+
+        /// @brief Clears all placed rectangles.
+        void Reset();
+
+        /// @brief Tries to find room for a rectangle of the given @p size.
+        /// @returns The top-left position of the placed rectangle, or an empty Optional if it doesn't fit anymore.
+        Optional<Vector2i> Insert(Vector2i size);
+
+        /// @brief Returns whether a rectangle of the given @p size could currently be inserted, without inserting it.
+        ATTRIBUTE_NODISCARD
+        bool CanInsert(Vector2i size) const;
+
+        /// @brief Returns the ratio of the packing area that is covered by placed rectangles, in the range [0, 1].
+        ATTRIBUTE_NODISCARD
+        f32 GetOccupancy() const;
+
+        GETTER(Vector2i, Size, m_Size)
+        GETTER(s64, UsedArea, m_UsedArea)
+
+    private:
+        struct Node
+        {
+            s32 x, y, width;
+        };
+
+        Vector2i m_Size;
+        s64 m_UsedArea = 0;
+        List<Node> m_Skyline;
+
+        /// @brief Returns the index of the best skyline node to place a rectangle of the given @p size on,
+        /// along with the resulting position, or an empty Optional if none fits.
+        ATTRIBUTE_NODISCARD
+        Optional<std::pair<usize, Vector2i>> FindPosition(Vector2i size) const;
+
+        /// @brief Returns the height at which a rectangle of the given @p size would be placed if its left edge was on the node at @p index,
+        /// or an empty Optional if it would go out of bounds.
+        ATTRIBUTE_NODISCARD
+        Optional<s32> Fit(usize index, Vector2i size) const;
+
+        void AddLevel(usize index, Vector2i position, Vector2i size);
+
+        void Merge();
+    };
+}
@@ -0,0 +1,312 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <Mountain/Audio/AudioBus.hpp>
+#include <Mountain/Audio/AudioKernels.hpp>
+#include <Mountain/Audio/AudioMixer.hpp>
+#include <Mountain/Resource/AudioTrack.hpp>
+#include <Mountain/Utils/Simd.hpp>
+
+namespace
+{
+    constexpr u64 One = AudioKernels::FractionOne;
+
+    /// @brief Returns a 16-bit PCM Wavefront file with the given samples.
+    List<u8> MakeWavefront(const List<s16>& samples, const u16 channels, const s32 sampleRate)
+    {
+        const s32 dataSize = static_cast<s32>(samples.GetSize() * sizeof(s16));
+
+        List<u8> file;
+        const auto write = [&]<typename T>(const T value) { file.AddRange(reinterpret_cast<const u8*>(&value), sizeof(T)); };
+
+        file.AddRange(reinterpret_cast<const u8*>("RIFF"), 4);
+        write(36 + dataSize);
+        file.AddRange(reinterpret_cast<const u8*>("WAVEfmt "), 8);
+        write(16);
+        write(static_cast<u16>(1));
+        write(channels);
+        write(sampleRate);
+        write(sampleRate * channels * 2);
+        write(static_cast<u16>(channels * 2));
+        write(static_cast<u16>(16));
+        file.AddRange(reinterpret_cast<const u8*>("data"), 4);
+        write(dataSize);
+        file.AddRange(reinterpret_cast<const u8*>(samples.GetData()), static_cast<usize>(dataSize));
+
+        return file;
+    }
+
+    List<s16> RandomSamples(const usize count)
+    {
+        Random random{42};
+
+        List<s16> samples;
+        for (usize i = 0; i < count; i++)
+            samples.Add(random.Short());
+        return samples;
+    }
+
+    /// @brief Calls ResampleMix until the end of the samples, in small chunks to also test how each call continues the last one.
+    List<f32> ResampleAll(const List<s16>& samples, const u16 channels, const u64 step)
+    {
+        const u64 frameCount = samples.GetSize() / channels;
+
+        List<f32> output;
+        output.Resize(static_cast<usize>(frameCount * One / step + 64) * 2);
+
+        u64 position = 0;
+        u32 total = 0;
+        while (true)
+        {
+            constexpr u32 Chunk = 37;
+            const u32 mixed = AudioKernels::ResampleMix(samples.GetData(), frameCount, channels, position, step, 0.75f, 0.5f, output.GetData() + total * 2, Chunk);
+            total += mixed;
+            if (mixed < Chunk)
+                break;
+        }
+
+        output.Resize(static_cast<usize>(total) * 2);
+        return output;
+    }
+}
+
+TEST(Audio_AudioKernels, ResampleSameRate)
+{
+    const List<s16> samples = { 0, 16384, -16384, 32767 };
+
+    List<f32> output;
+    output.Resize(10, 1.f);
+
+    u64 position = 0;
+    EXPECT_EQ(AudioKernels::ResampleMix(samples.GetData(), 4, 1, position, One, 1.f, 0.5f, output.GetData(), 5), 4);
+    EXPECT_EQ(position, 4 * One);
+
+    EXPECT_FLOAT_EQ(output[0], 1.f);
+    EXPECT_FLOAT_EQ(output[1], 1.f);
+    EXPECT_FLOAT_EQ(output[2], 1.5f);
+    EXPECT_FLOAT_EQ(output[3], 1.25f);
+    EXPECT_FLOAT_EQ(output[4], 0.5f);
+    EXPECT_FLOAT_EQ(output[5], 0.75f);
+    EXPECT_FLOAT_EQ(output[6], 1.f + 32767.f / 32768.f);
+    EXPECT_FLOAT_EQ(output[7], 1.f + 32767.f / 32768.f * 0.5f);
+
+    // Nothing is added after the end of the samples
+    EXPECT_FLOAT_EQ(output[8], 1.f);
+    EXPECT_FLOAT_EQ(output[9], 1.f);
+}
+
+TEST(Audio_AudioKernels, ResampleInterpolates)
+{
+    const List<s16> samples = { 0, 16384, 0, -16384 };
+
+    List<f32> output;
+    output.Resize(16);
+
+    u64 position = 0;
+    EXPECT_EQ(AudioKernels::ResampleMix(samples.GetData(), 4, 1, position, One / 2, 1.f, 1.f, output.GetData(), 8), 8);
+
+    const Array expected = { 0.f, 0.25f, 0.5f, 0.25f, 0.f, -0.25f, -0.5f, -0.5f };
+    for (usize i = 0; i < expected.GetSize(); i++)
+    {
+        EXPECT_FLOAT_EQ(output[i * 2], expected[i]);
+        EXPECT_FLOAT_EQ(output[i * 2 + 1], expected[i]);
+    }
+}
+
+TEST(Audio_AudioKernels, ResampleStereo)
+{
+    const List<s16> samples = { 16384, -16384, 0, 0 };
+
+    List<f32> output;
+    output.Resize(4);
+
+    u64 position = 0;
+    EXPECT_EQ(AudioKernels::ResampleMix(samples.GetData(), 2, 2, position, One, 1.f, 1.f, output.GetData(), 2), 2);
+
+    EXPECT_FLOAT_EQ(output[0], 0.5f);
+    EXPECT_FLOAT_EQ(output[1], -0.5f);
+    EXPECT_FLOAT_EQ(output[2], 0.f);
+    EXPECT_FLOAT_EQ(output[3], 0.f);
+}
+
+TEST(Audio_AudioKernels, SimdMatchesScalar)
+{
+    const SimdLevel supported = Simd::GetSupportedLevel();
+
+    for (const u16 channels : { 1, 2 })
+    {
+        const List<s16> samples = RandomSamples(1001 * channels);
+
+        for (const f64 ratio : { 1.0, 0.5, 44100.0 / 48000.0, 1.7, 3.0 })
+        {
+            const u64 step = static_cast<u64>(ratio * static_cast<f64>(One));
+
+            Simd::SetLevel(SimdLevel::None);
+            const List<f32> expected = ResampleAll(samples, channels, step);
+
+            for (SimdLevel level = SimdLevel::Sse2; level <= supported; level = static_cast<SimdLevel>(static_cast<u8>(level) + 1))
+            {
+                Simd::SetLevel(level);
+                const List<f32> output = ResampleAll(samples, channels, step);
+
+                ASSERT_EQ(output.GetSize(), expected.GetSize());
+                for (usize i = 0; i < output.GetSize(); i++)
+                    ASSERT_FLOAT_EQ(output[i], expected[i]);
+            }
+        }
+    }
+
+    Simd::SetLevel(supported);
+}
+
+TEST(Audio_AudioKernels, Mix)
+{
+    List<f32> input, output;
+    for (usize i = 0; i < 19; i++)
+    {
+        input.Add(static_cast<f32>(i));
+        output.Add(1.f);
+    }
+
+    AudioKernels::Mix(input.GetData(), output.GetData(), input.GetSize(), 0.5f);
+
+    for (usize i = 0; i < output.GetSize(); i++)
+        EXPECT_FLOAT_EQ(output[i], 1.f + static_cast<f32>(i) * 0.5f);
+}
+
+TEST(Audio_AudioKernels, ConvertToS16)
+{
+    List<f32> input;
+    for (usize i = 0; i < 21; i++)
+        input.AddRange({ -2.f, -1.f, -0.5f, 0.f, 0.5f, 1.f, 2.f });
+
+    List<s16> output;
+    output.Resize(input.GetSize());
+    AudioKernels::ConvertToS16(input.GetData(), output.GetData(), input.GetSize());
+
+    const Array<s16, 7> expected = { -32767, -32767, -16384, 0, 16384, 32767, 32767 };
+    for (usize i = 0; i < output.GetSize(); i++)
+        EXPECT_EQ(output[i], expected[i % expected.GetSize()]);
+}
+
+TEST(Audio_AudioKernels, LowPass)
+{
+    List<f32> samples;
+    samples.Resize(2000, 1.f);
+
+    Array<f32, 2> state{};
+    AudioKernels::LowPass(samples.GetData(), 1000, AudioKernels::LowPassCoefficient(1000.f, 48000), state);
+
+    // The filter smoothly rises towards a constant input
+    EXPECT_GT(samples[0], 0.f);
+    EXPECT_LT(samples[0], 0.5f);
+    EXPECT_LT(samples[0], samples[200]);
+    EXPECT_NEAR(samples[1998], 1.f, 1e-4f);
+    EXPECT_NEAR(state[0], 1.f, 1e-4f);
+}
+
+TEST(Audio_AudioMixer, Buses)
+{
+    AudioMixer::Initialize();
+
+    List<s16> samples;
+    samples.Resize(AudioMixer::BufferFrameCount + 100, 16384);
+    const List<u8> file = MakeWavefront(samples, 1, AudioMixer::GetSampleRate());
+
+    AudioTrack track{"Buses"};
+    ASSERT_TRUE(track.SetSourceData(file.GetData(), static_cast<s64>(file.GetSize())));
+
+    List<f32> output;
+    output.Resize(static_cast<usize>(AudioMixer::BufferFrameCount) * 2);
+
+    {
+        AudioBus effects{"Effects"};
+        AudioBus child{"Child", &effects};
+        effects.SetVolume(0.5f);
+
+        EXPECT_TRUE(AudioMixer::Play(track, &child, 1.f, 1.f, -1.f));
+        AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+
+        EXPECT_EQ(AudioMixer::GetSoundCount(), 1);
+        EXPECT_FLOAT_EQ(output[0], 0.25f);
+        EXPECT_FLOAT_EQ(output[1], 0.f);
+        EXPECT_FLOAT_EQ(effects.GetPeak(), 0.25f);
+
+        // The sound ends during this block
+        effects.SetMuted(true);
+        AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+        EXPECT_FLOAT_EQ(output[0], 0.f);
+        EXPECT_EQ(AudioMixer::GetSoundCount(), 0);
+
+        EXPECT_TRUE(AudioMixer::Play(track, &child));
+    }
+
+    // Deleting a bus stops its sounds
+    AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+    EXPECT_EQ(AudioMixer::GetSoundCount(), 0);
+    EXPECT_FLOAT_EQ(output[0], 0.f);
+
+    AudioMixer::Shutdown();
+}
+
+TEST(Audio_AudioMixer, Ducking)
+{
+    AudioMixer::Initialize();
+
+    List<s16> samples;
+    samples.Resize(AudioMixer::BufferFrameCount * 20, 16384);
+    const List<u8> file = MakeWavefront(samples, 1, AudioMixer::GetSampleRate());
+
+    AudioTrack track{"Ducking"};
+    ASSERT_TRUE(track.SetSourceData(file.GetData(), static_cast<s64>(file.GetSize())));
+
+    List<f32> output;
+    output.Resize(static_cast<usize>(AudioMixer::BufferFrameCount) * 2);
+
+    {
+        AudioBus music{"Music"};
+        AudioBus voices{"Voices"};
+        music.SetDucking(&voices, 0.5f);
+
+        AudioMixer::Play(track, &music);
+        AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+        EXPECT_FLOAT_EQ(music.GetPeak(), 0.5f);
+
+        AudioMixer::Play(track, &voices);
+        for (usize i = 0; i < 10; i++)
+            AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+
+        EXPECT_NEAR(music.GetPeak(), 0.25f, 1e-3f);
+    }
+
+    AudioMixer::Shutdown();
+}
+
+TEST(Audio_AudioMixer, UnloadStopsSounds)
+{
+    AudioMixer::Initialize();
+
+    List<s16> samples;
+    samples.Resize(AudioMixer::BufferFrameCount * 4, 16384);
+    const List<u8> file = MakeWavefront(samples, 1, AudioMixer::GetSampleRate());
+
+    AudioTrack track{"UnloadStopsSounds"};
+    ASSERT_TRUE(track.SetSourceData(file.GetData(), static_cast<s64>(file.GetSize())));
+
+    List<f32> output;
+    output.Resize(static_cast<usize>(AudioMixer::BufferFrameCount) * 2);
+
+    EXPECT_TRUE(AudioMixer::Play(track));
+    AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+    EXPECT_EQ(AudioMixer::GetSoundCount(), 1);
+
+    // Both the playing and the pending sounds are stopped
+    EXPECT_TRUE(AudioMixer::Play(track));
+    track.Unload();
+    EXPECT_EQ(AudioMixer::GetSoundCount(), 0);
+
+    AudioMixer::Render(output.GetData(), AudioMixer::BufferFrameCount);
+    EXPECT_EQ(AudioMixer::GetSoundCount(), 0);
+    EXPECT_FLOAT_EQ(output[0], 0.f);
+
+    AudioMixer::Shutdown();
+}
@@ -0,0 +1,155 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <vector>
+
+#include <Mountain/Collision/Hitbox.hpp>
+#include <Mountain/Collision/SpatialHash.hpp>
+#include <Mountain/Ecs/Entity.hpp>
+
+namespace
+{
+    std::vector<Entity*> QueryRect(const SpatialHash& spatialHash, const Rectangle& rectangle)
+    {
+        std::vector<Entity*> result;
+        spatialHash.QueryRect(rectangle, [&](Entity* entity) { result.push_back(entity); });
+        return result;
+    }
+}
+
+TEST(Collision_SpatialHash, Insert)
+{
+    SpatialHash spatialHash;
+
+    Entity a{{ 10.f, 10.f }};
+    Hitbox aHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    a.SetCollider(&aHitbox);
+
+    Entity b{{ 200.f, 10.f }};
+    Hitbox bHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    b.SetCollider(&bHitbox);
+
+    spatialHash.Insert(a);
+    spatialHash.Insert(b);
+    // Inserting an entity twice doesn't add another proxy
+    spatialHash.Insert(a);
+
+    EXPECT_TRUE(spatialHash.Contains(a));
+    EXPECT_TRUE(spatialHash.Contains(b));
+    EXPECT_EQ(spatialHash.GetProxyCount(), 2);
+    EXPECT_EQ(spatialHash.GetCellCount(), 2);
+}
+
+TEST(Collision_SpatialHash, Query)
+{
+    SpatialHash spatialHash;
+
+    Entity a{{ 10.f, 10.f }};
+    Hitbox aHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    a.SetCollider(&aHitbox);
+
+    // Covers several cells but must only be reported once
+    Entity b{{ 50.f, 50.f }};
+    Hitbox bHitbox{ Vector2::Zero(), { 100.f, 100.f } };
+    b.SetCollider(&bHitbox);
+
+    spatialHash.Insert(a);
+    spatialHash.Insert(b);
+
+    EXPECT_EQ(QueryRect(spatialHash, { { 0.f, 0.f }, { 200.f, 200.f } }).size(), 2);
+    EXPECT_EQ(QueryRect(spatialHash, { { 100.f, 100.f }, { 10.f, 10.f } }), std::vector<Entity*>{ &b });
+    EXPECT_TRUE(QueryRect(spatialHash, { { 300.f, 300.f }, { 10.f, 10.f } }).empty());
+
+    std::vector<Entity*> points;
+    spatialHash.QueryPoint({ 15.f, 15.f }, [&](Entity* entity) { points.push_back(entity); });
+    EXPECT_EQ(points, std::vector<Entity*>{ &a });
+
+    std::vector<Entity*> circles;
+    spatialHash.QueryCircle({ 75.f, 75.f }, 5.f, [&](Entity* entity) { circles.push_back(entity); });
+    EXPECT_EQ(circles, std::vector<Entity*>{ &b });
+
+    std::vector<std::pair<Entity*, Entity*>> pairs;
+    spatialHash.QueryPairs([&](Entity* first, Entity* second) { pairs.emplace_back(first, second); });
+    EXPECT_TRUE(pairs.empty());
+
+    a.position = { 60.f, 60.f };
+    spatialHash.Update(a);
+    spatialHash.QueryPairs([&](Entity* first, Entity* second) { pairs.emplace_back(first, second); });
+    ASSERT_EQ(pairs.size(), 1);
+    EXPECT_TRUE((pairs[0] == std::pair{ &a, &b }) || (pairs[0] == std::pair{ &b, &a }));
+}
+
+TEST(Collision_SpatialHash, Move)
+{
+    SpatialHash spatialHash;
+
+    Entity entity{{ 10.f, 10.f }};
+    Hitbox hitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    entity.SetCollider(&hitbox);
+    spatialHash.Insert(entity);
+
+    entity.position = { 1000.f, 1000.f };
+    // The entity isn't found at its new position until it is updated
+    EXPECT_TRUE(QueryRect(spatialHash, { { 990.f, 990.f }, { 50.f, 50.f } }).empty());
+
+    spatialHash.Update(entity);
+    EXPECT_EQ(QueryRect(spatialHash, { { 990.f, 990.f }, { 50.f, 50.f } }), std::vector<Entity*>{ &entity });
+    EXPECT_TRUE(QueryRect(spatialHash, { { 0.f, 0.f }, { 50.f, 50.f } }).empty());
+
+    // The cell it left is erased
+    EXPECT_EQ(spatialHash.GetCellCount(), 1);
+}
+
+TEST(Collision_SpatialHash, Remove)
+{
+    SpatialHash spatialHash;
+
+    Entity small{{ 10.f, 10.f }};
+    Hitbox smallHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    small.SetCollider(&smallHitbox);
+
+    // Covers more than MaxProxyCells cells, so it is stored as a large proxy
+    Entity large{{ 0.f, 0.f }};
+    Hitbox largeHitbox{ Vector2::Zero(), { 1000.f, 1000.f } };
+    large.SetCollider(&largeHitbox);
+
+    spatialHash.Insert(small);
+    spatialHash.Insert(large);
+    EXPECT_EQ(QueryRect(spatialHash, { { 500.f, 500.f }, { 10.f, 10.f } }), std::vector<Entity*>{ &large });
+
+    spatialHash.Remove(small);
+    EXPECT_FALSE(spatialHash.Contains(small));
+    EXPECT_EQ(spatialHash.GetCellCount(), 0);
+    EXPECT_EQ(QueryRect(spatialHash, { { 0.f, 0.f }, { 50.f, 50.f } }), std::vector<Entity*>{ &large });
+
+    spatialHash.Remove(large);
+    EXPECT_FALSE(spatialHash.Contains(large));
+    EXPECT_EQ(spatialHash.GetProxyCount(), 0);
+    EXPECT_TRUE(QueryRect(spatialHash, { { 0.f, 0.f }, { 1000.f, 1000.f } }).empty());
+
+    // Removed proxies are reused
+    spatialHash.Insert(small);
+    EXPECT_EQ(spatialHash.GetProxyCount(), 1);
+    EXPECT_EQ(QueryRect(spatialHash, { { 0.f, 0.f }, { 50.f, 50.f } }), std::vector<Entity*>{ &small });
+}
+
+TEST(Collision_SpatialHash, Synchronize)
+{
+    SpatialHash spatialHash;
+
+    Entity a{{ 10.f, 10.f }};
+    Hitbox aHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    a.SetCollider(&aHitbox);
+
+    Entity b{{ 200.f, 10.f }};
+    Hitbox bHitbox{ Vector2::Zero(), { 20.f, 20.f } };
+    b.SetCollider(&bHitbox);
+
+    spatialHash.Synchronize(List<Entity*>{ &a, &b });
+    EXPECT_EQ(spatialHash.GetProxyCount(), 2);
+
+    a.position = { 500.f, 500.f };
+    spatialHash.Synchronize(List<Entity*>{ &a });
+    EXPECT_FALSE(spatialHash.Contains(b));
+    EXPECT_EQ(QueryRect(spatialHash, { { 490.f, 490.f }, { 50.f, 50.f } }), std::vector<Entity*>{ &a });
+    EXPECT_EQ(spatialHash.GetCellCount(), 1);
+}
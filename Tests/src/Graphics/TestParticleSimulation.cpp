@@ -0,0 +1,227 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <Mountain/Graphics/ParticleKernels.hpp>
+#include <Mountain/Graphics/ParticleSimulation.hpp>
+#include <Mountain/Utils/Simd.hpp>
+
+namespace
+{
+    /// @brief Simulates a few seconds of a system spawning particles every frame and returns its particles.
+    ParticleData Simulate(const ParticleSystemModules::ShapeType shapeType)
+    {
+        ParticleSystemModules::Shape shape;
+        shape.type = shapeType;
+        shape.rotation = 0.3f;
+        shape.scale = { 2.f, 3.f };
+        shape.offset = { 5.f, -4.f };
+        shape.circle.radiusThickness = 0.5f;
+        shape.circle.arcAngle = 4.f;
+        shape.rectangle.scaleThickness = { 0.25f, 0.5f };
+
+        ParticleSystemModules::VelocityOverLifetime velocityOverLifetime;
+        velocityOverLifetime.velocityMin = { -1.f, 2.f };
+        velocityOverLifetime.velocityMax = { 3.f, -4.f };
+
+        ParticleSystemModules::ForceOverLifetime forceOverLifetime;
+        forceOverLifetime.forceMin = { 0.f, 10.f };
+        forceOverLifetime.forceMax = { 5.f, 0.f };
+        forceOverLifetime.easingType = Easing::Type::QuadIn;
+
+        ParticleSystemModules::ColorOverLifetime colorOverLifetime;
+        colorOverLifetime.colorMax = Color::Red();
+
+        ParticleSystemModules::ColorBySpeed colorBySpeed;
+        colorBySpeed.colorMin = Color::Blue();
+        colorBySpeed.speedMin = 2.f;
+        colorBySpeed.speedMax = 8.f;
+
+        ParticleSimulationSettings settings;
+        settings.lifetime = 1.f;
+        settings.shape = &shape;
+        settings.velocityOverLifetime = &velocityOverLifetime;
+        settings.forceOverLifetime = &forceOverLifetime;
+        settings.colorOverLifetime = &colorOverLifetime;
+        settings.colorBySpeed = &colorBySpeed;
+
+        ParticleSimulation simulation{ 500, 1234 };
+        for (u32 i = 0; i < 150; i++)
+            simulation.Update(1.f / 60.f, settings, 7);
+
+        return simulation.GetParticles();
+    }
+
+    void ExpectSameParticles(const ParticleData& actual, const ParticleData& expected)
+    {
+        const auto compare = [](const List<f32>& actualComponent, const List<f32>& expectedComponent)
+        {
+            ASSERT_EQ(actualComponent.GetSize(), expectedComponent.GetSize());
+            for (usize i = 0; i < actualComponent.GetSize(); i++)
+                ASSERT_FLOAT_EQ(actualComponent[i], expectedComponent[i]);
+        };
+
+        compare(actual.lifetime, expected.lifetime);
+        compare(actual.size, expected.size);
+        compare(actual.startVelocityX, expected.startVelocityX);
+        compare(actual.startVelocityY, expected.startVelocityY);
+        compare(actual.offsetX, expected.offsetX);
+        compare(actual.offsetY, expected.offsetY);
+        compare(actual.accumulatedVelocityX, expected.accumulatedVelocityX);
+        compare(actual.accumulatedVelocityY, expected.accumulatedVelocityY);
+        compare(actual.colorR, expected.colorR);
+        compare(actual.colorG, expected.colorG);
+        compare(actual.colorB, expected.colorB);
+        compare(actual.colorA, expected.colorA);
+    }
+}
+
+TEST(Graphics_ParticleKernels, SimdMatchesScalar)
+{
+    const SimdLevel supported = Simd::GetSupportedLevel();
+
+    for (const ParticleSystemModules::ShapeType shapeType : { ParticleSystemModules::ShapeType::Circle, ParticleSystemModules::ShapeType::Rectangle })
+    {
+        Simd::SetLevel(SimdLevel::None);
+        const ParticleData expected = Simulate(shapeType);
+
+        for (SimdLevel level = SimdLevel::Sse2; level <= supported; level = static_cast<SimdLevel>(static_cast<u8>(level) + 1))
+        {
+            Simd::SetLevel(level);
+            ExpectSameParticles(Simulate(shapeType), expected);
+        }
+    }
+
+    Simd::SetLevel(supported);
+}
+
+TEST(Graphics_ParticleKernels, SpawnCircle)
+{
+    constexpr usize Count = 101;
+
+    List<f32> offsetX, offsetY, directionX, directionY;
+    offsetX.Resize(Count);
+    offsetY.Resize(Count);
+    directionX.Resize(Count);
+    directionY.Resize(Count);
+
+    ParticleKernels::SpawnCircle(
+        42,
+        2.f,
+        0.5f,
+        Calc::TwoPi,
+        0.f,
+        Vector2::One(),
+        Vector2::Zero(),
+        offsetX.GetData(),
+        offsetY.GetData(),
+        directionX.GetData(),
+        directionY.GetData(),
+        Count
+    );
+
+    for (usize i = 0; i < Count; i++)
+    {
+        const f32 distance = Vector2{ offsetX[i], offsetY[i] }.Length();
+        EXPECT_GE(distance, 1.f - 1e-4f);
+        EXPECT_LE(distance, 2.f + 1e-4f);
+        EXPECT_NEAR(Vector2(directionX[i], directionY[i]).Length(), 1.f, 1e-4f);
+    }
+}
+
+TEST(Graphics_ParticleKernels, LerpAdd)
+{
+    const List<f32> factors = { 0.f, 0.25f, 0.5f, 1.f, 0.f, 0.25f, 0.5f, 1.f, 0.75f };
+    List<f32> x, y;
+    x.Resize(factors.GetSize(), 1.f);
+    y.Resize(factors.GetSize(), 0.f);
+
+    ParticleKernels::LerpAdd(factors.GetData(), { 0.f, -2.f }, { 4.f, 2.f }, 0.5f, x.GetData(), y.GetData(), factors.GetSize());
+
+    for (usize i = 0; i < factors.GetSize(); i++)
+    {
+        EXPECT_FLOAT_EQ(x[i], 1.f + factors[i] * 2.f);
+        EXPECT_FLOAT_EQ(y[i], -1.f + factors[i] * 2.f);
+    }
+}
+
+TEST(Graphics_ParticleKernels, SpeedFactor)
+{
+    const List<f32> velocityX = { 0.f, 1.f, 3.f, 0.f, 10.f };
+    const List<f32> velocityY = { 0.f, 0.f, 0.f, -2.f, 10.f };
+    List<f32> factors;
+    factors.Resize(velocityX.GetSize());
+
+    ParticleKernels::SpeedFactor(velocityX.GetData(), velocityY.GetData(), 1.f, 3.f, factors.GetData(), factors.GetSize());
+
+    EXPECT_FLOAT_EQ(factors[0], 0.f);
+    EXPECT_FLOAT_EQ(factors[1], 0.f);
+    EXPECT_FLOAT_EQ(factors[2], 1.f);
+    // The squared speeds are interpolated, as in the compute shader
+    EXPECT_FLOAT_EQ(factors[3], 3.f / 8.f);
+    EXPECT_FLOAT_EQ(factors[4], 1.f);
+}
+
+TEST(Graphics_ParticleKernels, Integrate)
+{
+    const List<f32> velocityX = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f };
+    List<f32> accumulatedX, y, offsetX, offsetY;
+    accumulatedX.Resize(velocityX.GetSize(), 1.f);
+    y.Resize(velocityX.GetSize(), -1.f);
+    offsetX.Resize(velocityX.GetSize(), 0.f);
+    offsetY.Resize(velocityX.GetSize(), 2.f);
+
+    ParticleKernels::Integrate(
+        velocityX.GetData(),
+        y.GetData(),
+        accumulatedX.GetData(),
+        y.GetData(),
+        0.5f,
+        offsetX.GetData(),
+        offsetY.GetData(),
+        velocityX.GetSize()
+    );
+
+    for (usize i = 0; i < velocityX.GetSize(); i++)
+    {
+        EXPECT_FLOAT_EQ(offsetX[i], (velocityX[i] + 1.f) * 0.5f);
+        EXPECT_FLOAT_EQ(offsetY[i], 1.f);
+    }
+}
+
+TEST(Graphics_ParticleSimulation, MaxParticles)
+{
+    ParticleSimulation simulation{ 10 };
+
+    simulation.Update(0.1f, {}, 6);
+    EXPECT_EQ(simulation.GetParticleCount(), 6);
+
+    simulation.Update(0.1f, {}, 6);
+    EXPECT_EQ(simulation.GetParticleCount(), 10);
+
+    simulation.SetMaxParticles(20);
+    EXPECT_EQ(simulation.GetParticleCount(), 0);
+}
+
+TEST(Graphics_ParticleSimulation, RemovesDeadParticles)
+{
+    ParticleSimulationSettings settings;
+    settings.lifetime = 1.f;
+
+    ParticleSimulation simulation{ 100 };
+
+    simulation.Update(0.5f, settings, 10);
+    simulation.Update(0.5f, settings, 5);
+    EXPECT_EQ(simulation.GetParticleCount(), 15);
+
+    // The first particles reached the end of their life in the last update, so they are removed in this one
+    simulation.Update(0.25f, settings, 0);
+    EXPECT_EQ(simulation.GetParticleCount(), 5);
+
+    const ParticleData& particles = simulation.GetParticles();
+    for (u32 i = 0; i < simulation.GetParticleCount(); i++)
+    {
+        EXPECT_FLOAT_EQ(particles.lifetime[i], 0.25f);
+        // Without a shape, the particles go up at their speed
+        EXPECT_FLOAT_EQ(particles.offsetX[i], 0.f);
+        EXPECT_FLOAT_EQ(particles.offsetY[i], -settings.speed * 0.75f);
+    }
+}
@@ -0,0 +1,58 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <Mountain/Resource/Texture.hpp>
+#include <Mountain/Resource/TextureAtlas.hpp>
+
+namespace
+{
+    /// @brief Creates a Texture from an uncompressed 32-bit TGA image of the given size.
+    Pointer<Texture> MakeTexture(const std::string& name, const Vector2i size)
+    {
+        List<u8> file;
+        file.Resize(18);
+        file[2] = 2; // Uncompressed true-color
+        file[12] = static_cast<u8>(size.x);
+        file[13] = static_cast<u8>(size.x >> 8);
+        file[14] = static_cast<u8>(size.y);
+        file[15] = static_cast<u8>(size.y >> 8);
+        file[16] = 32;
+        file[17] = 8; // Alpha bits
+        file.Resize(file.GetSize() + static_cast<usize>(size.x) * size.y * 4, 0xFF);
+
+        Pointer<Texture> texture = Pointer<Texture>::New(name);
+        texture->SetSourceData(file.GetData(), static_cast<s64>(file.GetSize()));
+        return texture;
+    }
+}
+
+TEST(Graphics_TextureAtlas, OnlyAddsCompatibleTextures)
+{
+    TextureAtlas atlas{"Atlas"};
+
+    const Pointer<Texture> rgba = MakeTexture("RGBA", {4, 4});
+    ASSERT_NE(rgba->GetData(), nullptr);
+    EXPECT_TRUE(TextureAtlas::IsCompatible(*rgba));
+    EXPECT_TRUE(atlas.Add(rgba));
+    EXPECT_TRUE(atlas.Contains(*rgba));
+
+    const Pointer<Texture> red = MakeTexture("Red", {4, 4});
+    red->SetInternalFormat(Graphics::InternalFormat::Red8);
+    EXPECT_FALSE(TextureAtlas::IsCompatible(*red));
+    EXPECT_FALSE(atlas.Add(red));
+    EXPECT_EQ(red->GetAtlas(), nullptr);
+
+    const Pointer<Texture> srgb = MakeTexture("sRGB", {4, 4});
+    srgb->SetInternalFormat(Graphics::InternalFormat::SignedRedGreenBlueAlpha8);
+    EXPECT_FALSE(atlas.Add(srgb));
+
+    const Pointer<Texture> mipmapped = MakeTexture("Mipmapped", {4, 4});
+    mipmapped->SetGenerateMipmaps(true);
+    EXPECT_FALSE(TextureAtlas::IsCompatible(*mipmapped));
+    EXPECT_FALSE(atlas.Add(mipmapped));
+
+    // The compatible textures of a range are still packed together
+    EXPECT_FALSE(atlas.AddRange({ MakeTexture("Other", {4, 4}), red, mipmapped }));
+    EXPECT_EQ(atlas.GetPageCount(), 1);
+    EXPECT_EQ(red->GetAtlas(), nullptr);
+    EXPECT_EQ(mipmapped->GetAtlas(), nullptr);
+}
@@ -0,0 +1,66 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include <Mountain/FileSystem/FileManager.hpp>
+#include <Mountain/Resource/AudioTrack.hpp>
+#include <Mountain/Resource/ResourceManager.hpp>
+
+namespace
+{
+    /// @brief Writes a silent 16-bit mono Wavefront file and returns its path.
+    std::filesystem::path WriteWavefront(const std::string& filename, const s32 sampleCount)
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / filename;
+        std::ofstream file{path, std::ios::binary};
+
+        const auto write = [&]<typename T>(const T value) { file.write(reinterpret_cast<const c8*>(&value), sizeof(T)); };
+
+        const s32 dataSize = sampleCount * static_cast<s32>(sizeof(s16));
+        file.write("RIFF", 4);
+        write(36 + dataSize);
+        file.write("WAVEfmt ", 8);
+        write(16);
+        write(static_cast<u16>(1));
+        write(static_cast<u16>(1));
+        write(48000);
+        write(48000 * 2);
+        write(static_cast<u16>(2));
+        write(static_cast<u16>(16));
+        file.write("data", 4);
+        write(dataSize);
+        for (s32 i = 0; i < sampleCount; i++)
+            write(static_cast<s16>(0));
+
+        return path;
+    }
+}
+
+TEST(Resource_ResourceManager, UnloadDuringLoadAsync)
+{
+    const std::filesystem::path path = WriteWavefront("MountainUnloadDuringLoadAsync.wav", 48000);
+    const Pointer<File> file = FileManager::Add(path);
+    ASSERT_TRUE(file);
+
+    const std::string name = file->GetPathString();
+    const std::shared_future<Pointer<AudioTrack>> future = ResourceManager::LoadAsync<AudioTrack>(file);
+
+    // Whether or not a worker already started decoding it, the Resource must stay alive until the load finishes
+    ResourceManager::Unload(name);
+    EXPECT_FALSE(ResourceManager::Contains(name));
+
+    // The future is only fulfilled by UpdateAsyncLoads(), which must release the unloaded Resource instead of loading it
+    while (future.wait_for(std::chrono::milliseconds{1}) != std::future_status::ready)
+        ResourceManager::UpdateAsyncLoads();
+
+    EXPECT_FALSE(future.get());
+    EXPECT_FALSE(ResourceManager::Contains(name));
+    EXPECT_EQ(ResourceManager::GetPendingAsyncLoadCount(), 0);
+    EXPECT_EQ(ResourceManager::GetAsyncLoadProgress(), 1.f);
+
+    ResourceManager::StopAsyncLoads();
+    FileManager::Unload(path);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,100 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <Mountain/Utils/Compression.hpp>
+
+namespace
+{
+    List<u8> Compress(const List<u8>& data)
+    {
+        List<u8> result;
+        result.Resize(Compression::Lz4CompressBound(data.GetSize()));
+        const usize size = Compression::Lz4Compress(data.GetData(), data.GetSize(), result.GetData(), result.GetSize());
+        result.Resize(size);
+        return result;
+    }
+
+    void ExpectRoundTrip(const List<u8>& data)
+    {
+        const List<u8> compressed = Compress(data);
+        ASSERT_FALSE(compressed.IsEmpty());
+
+        List<u8> decompressed;
+        decompressed.Resize(data.GetSize());
+        EXPECT_TRUE(Compression::Lz4Decompress(compressed.GetData(), compressed.GetSize(), decompressed.GetData(), decompressed.GetSize()));
+
+        for (usize i = 0; i < data.GetSize(); i++)
+            ASSERT_EQ(decompressed[i], data[i]);
+    }
+}
+
+TEST(Utils_Compression, Empty)
+{
+    ExpectRoundTrip({});
+}
+
+TEST(Utils_Compression, Small)
+{
+    ExpectRoundTrip({ 1, 2, 3 });
+    ExpectRoundTrip({ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 });
+}
+
+TEST(Utils_Compression, Repetitive)
+{
+    List<u8> data;
+    data.Resize(100000, 7);
+
+    ExpectRoundTrip(data);
+    EXPECT_LT(Compress(data).GetSize(), data.GetSize() / 100);
+}
+
+TEST(Utils_Compression, Text)
+{
+    const std::string_view sentence = "The quick brown fox jumps over the lazy dog. ";
+
+    List<u8> data;
+    for (usize i = 0; i < 1000; i++)
+        data.AddRange(reinterpret_cast<const u8*>(sentence.data()), i % sentence.size() + 1);
+
+    ExpectRoundTrip(data);
+    EXPECT_LT(Compress(data).GetSize(), data.GetSize() / 2);
+}
+
+TEST(Utils_Compression, Incompressible)
+{
+    Random random{42};
+
+    List<u8> data;
+    data.Resize(10000);
+    for (u8& value : data)
+        value = random.Byte();
+
+    ExpectRoundTrip(data);
+    EXPECT_LE(Compress(data).GetSize(), Compression::Lz4CompressBound(data.GetSize()));
+}
+
+TEST(Utils_Compression, DestinationTooSmall)
+{
+    const List<u8> data{ 1, 2, 3, 4 };
+    List<u8> result;
+    result.Resize(Compression::Lz4CompressBound(data.GetSize()) - 1);
+
+    EXPECT_EQ(Compression::Lz4Compress(data.GetData(), data.GetSize(), result.GetData(), result.GetSize()), 0);
+}
+
+TEST(Utils_Compression, InvalidData)
+{
+    List<u8> data;
+    data.Resize(1000, 42);
+    const List<u8> compressed = Compress(data);
+
+    List<u8> decompressed;
+    decompressed.Resize(data.GetSize());
+
+    // Truncated input
+    EXPECT_FALSE(Compression::Lz4Decompress(compressed.GetData(), compressed.GetSize() - 1, decompressed.GetData(), decompressed.GetSize()));
+    // Wrong decompressed size
+    EXPECT_FALSE(Compression::Lz4Decompress(compressed.GetData(), compressed.GetSize(), decompressed.GetData(), decompressed.GetSize() - 1));
+    // Match offset before the start of the output
+    const List<u8> invalid{ 0x00, 0x10, 0x00 };
+    EXPECT_FALSE(Compression::Lz4Decompress(invalid.GetData(), invalid.GetSize(), decompressed.GetData(), decompressed.GetSize()));
+}
@@ -0,0 +1,147 @@
+#include "PrecompiledHeader.hpp"
+
+#include <atomic>
+
+#include <Mountain/Utils/JobSystem.hpp>
+
+using namespace Mountain;
+
+namespace
+{
+    struct JobSystemScope
+    {
+        explicit JobSystemScope(const u32 workerCount) { JobSystem::Initialize(workerCount); }
+        ~JobSystemScope() { JobSystem::Shutdown(); }
+
+        DELETE_COPY_MOVE_OPERATIONS(JobSystemScope)
+    };
+}
+
+TEST(Utils_JobSystem, Run)
+{
+    JobSystemScope scope{4};
+    EXPECT_EQ(JobSystem::GetWorkerCount(), 4u);
+    EXPECT_EQ(JobSystem::GetThreadIndex(), 0u);
+
+    std::atomic<u32> sum = 0;
+    JobCounter counter;
+    for (u32 i = 1; i <= 1000; i++)
+        JobSystem::Run([&sum, i] { sum += i; }, &counter);
+
+    JobSystem::Wait(counter);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(sum, 500500u);
+}
+
+TEST(Utils_JobSystem, RunAfter)
+{
+    JobSystemScope scope{4};
+
+    std::atomic<u32> value = 0;
+    JobCounter first;
+    JobCounter second;
+
+    for (u32 i = 0; i < 100; i++)
+        JobSystem::Run([&value] { ++value; }, &first);
+
+    // The dependent job must see all the increments of the first batch
+    u32 seen = 0;
+    JobSystem::RunAfter(first, [&value, &seen] { seen = value; }, &second);
+
+    JobSystem::Wait(second);
+    EXPECT_EQ(seen, 100u);
+
+    // An already finished dependency schedules the job immediately
+    JobCounter third;
+    JobSystem::RunAfter(first, [&value] { value = 0; }, &third);
+    JobSystem::Wait(third);
+    EXPECT_EQ(value, 0u);
+}
+
+TEST(Utils_JobSystem, NestedWait)
+{
+    JobSystemScope scope{2};
+
+    std::atomic<u32> count = 0;
+    JobCounter outer;
+    for (u32 i = 0; i < 8; i++)
+    {
+        JobSystem::Run(
+            [&count]
+            {
+                JobCounter inner;
+                for (u32 j = 0; j < 8; j++)
+                    JobSystem::Run([&count] { ++count; }, &inner);
+                JobSystem::Wait(inner);
+            },
+            &outer
+        );
+    }
+
+    JobSystem::Wait(outer);
+    EXPECT_EQ(count, 64u);
+}
+
+TEST(Utils_JobSystem, ThrowingJob)
+{
+    JobSystemScope scope{2};
+
+    // A job that throws still finishes, otherwise waiting for its counter would never end
+    std::atomic<u32> count = 0;
+    JobCounter counter;
+    for (u32 i = 0; i < 16; i++)
+    {
+        JobSystem::Run(
+            [&count, i]
+            {
+                if (i % 2 == 0)
+                    throw std::runtime_error{"Job failure"};
+                ++count;
+            },
+            &counter
+        );
+    }
+
+    JobSystem::Wait(counter);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(count, 8u);
+}
+
+TEST(Utils_JobSystem, ParallelFor)
+{
+    JobSystemScope scope{4};
+
+    List<u32> values;
+    values.Resize(1000);
+    JobSystem::ParallelFor(
+        0,
+        values.GetSize(),
+        64,
+        [&values](const usize begin, const usize end)
+        {
+            for (usize i = begin; i < end; i++)
+                values[i] = static_cast<u32>(i * 2);
+        }
+    );
+
+    for (usize i = 0; i < values.GetSize(); i++)
+        EXPECT_EQ(values[i], i * 2);
+
+    // Empty ranges must not call the function
+    bool called = false;
+    JobSystem::ParallelFor(10, 10, 1, [&called](usize, usize) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(Utils_JobSystem, WithoutWorkers)
+{
+    // Jobs run inline when the job system isn't initialized
+    u32 value = 0;
+    JobCounter counter;
+    JobSystem::Run([&value] { value = 42; }, &counter);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(value, 42u);
+
+    JobSystem::ParallelFor(0, 100, 10, [&value](const usize begin, const usize end) { value += static_cast<u32>(end - begin); });
+    EXPECT_EQ(value, 142u);
+}
@@ -83,3 +83,66 @@ TEST(Utils_Logger, LogDebugSuppression)
     Logger::minimumConsoleLevel = oldConsoleLevel;
     Logger::minimumFileLevel = oldFileLevel;
 }
+
+TEST(Utils_Logger, DeferredFormatting)
+{
+    Logger::Clear();
+
+    // A string literal with trivially copyable arguments is formatted on the logger thread
+    Logger::LogInfo("{} {:.1f} {} {}", 7, 2.5f, 'c', true);
+    // Other arguments are formatted on the calling thread
+    const std::string text = "text";
+    Logger::LogInfo("{} {}", text, 3);
+    // And so are runtime format strings
+    const std::string format = "Runtime {}";
+    Logger::LogInfo(format, 4);
+    Logger::Synchronize();
+
+    const auto& logs = Logger::GetLogList();
+    ASSERT_EQ(logs.size(), 3);
+    EXPECT_EQ(logs[0]->message, "7 2.5 c true");
+    EXPECT_EQ(logs[1]->message, "text 3");
+    EXPECT_EQ(logs[2]->message, "Runtime 4");
+}
+
+TEST(Utils_Logger, ViewArguments)
+{
+    Logger::Clear();
+
+    // Views must be formatted before their data is freed, even if they are trivially copyable
+    {
+        std::string temporary = "temporary";
+        Logger::LogInfo("{}", std::string_view{temporary});
+        temporary.assign(temporary.size(), 'x');
+    }
+    // Mutable character buffers can be used as runtime format strings
+    c8 format[32] = "Buffer {}";
+    Logger::LogInfo(format, 5);
+    Logger::Synchronize();
+
+    const auto& logs = Logger::GetLogList();
+    ASSERT_EQ(logs.size(), 2);
+    EXPECT_EQ(logs[0]->message, "temporary");
+    EXPECT_EQ(logs[1]->message, "Buffer 5");
+}
+
+TEST(Utils_Logger, HistoryCapacity)
+{
+    Logger::Clear();
+    const usize oldCapacity = Logger::historyCapacity;
+    Logger::historyCapacity = 3;
+
+    const u64 oldOverwrittenCount = Logger::GetOverwrittenCount();
+
+    for (s32 i = 0; i < 5; i++)
+        Logger::LogInfo("Log {}", i);
+    Logger::Synchronize();
+
+    const auto& logs = Logger::GetLogList();
+    ASSERT_EQ(logs.size(), 3);
+    EXPECT_EQ(logs.front()->message, "Log 2");
+    EXPECT_EQ(logs.back()->message, "Log 4");
+    EXPECT_EQ(Logger::GetOverwrittenCount() - oldOverwrittenCount, 2);
+
+    Logger::historyCapacity = oldCapacity;
+}
@@ -1,5 +1,8 @@
 ﻿#include "PrecompiledHeader.hpp"
 
+#include <thread>
+
+#include <Mountain/Containers/List.hpp>
 #include <Mountain/Utils/Pointer.hpp>
 
 TEST(Utils_Pointer, Basics)
@@ -48,6 +51,55 @@ TEST(Utils_Pointer, WeakReference)
     EXPECT_FALSE(weakRef.IsValid());
 }
 
+TEST(Utils_Pointer, ExpiredWeakReference)
+{
+    Pointer<int> weakRef;
+
+    {
+        const Pointer<int> ptr = Pointer<int>::New(5);
+        weakRef = ptr;
+    }
+
+    EXPECT_NE(weakRef.GetReferenceCounter(), nullptr);
+    EXPECT_EQ(weakRef.GetReferenceCounter()->GetStrong(), 0);
+    EXPECT_EQ(static_cast<int*>(weakRef), nullptr);
+
+    const Pointer<int> strongRef = weakRef.CreateStrongReference();
+    EXPECT_FALSE(strongRef.IsValid());
+    EXPECT_EQ(strongRef.GetReferenceCounter(), nullptr);
+
+    weakRef.ToStrongReference();
+    EXPECT_FALSE(weakRef.GetIsStrongReference());
+    EXPECT_EQ(weakRef.GetReferenceCounter(), nullptr);
+}
+
+TEST(Utils_Pointer, ThreadedCopies)
+{
+    const Pointer<int> ptr = Pointer<int>::New(3);
+
+    List<std::thread> threads;
+    for (u32 i = 0; i < 4; i++)
+    {
+        threads.Emplace(
+            [&]
+            {
+                for (u32 j = 0; j < 10000; j++)
+                {
+                    const Pointer<int> strong = ptr.CreateStrongReference();
+                    const Pointer<int> weak = strong;  // NOLINT(performance-unnecessary-copy-initialization)
+                    EXPECT_TRUE(weak.IsValid());
+                }
+            }
+        );
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(ptr.GetReferenceCounter()->GetStrong(), 1);
+    EXPECT_EQ(ptr.GetReferenceCounter()->GetWeak(), 0);
+}
+
 TEST(Utils_Pointer, StrongReference)
 {
     Pointer<int> strongRef;
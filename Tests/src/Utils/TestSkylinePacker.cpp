@@ -0,0 +1,93 @@
+﻿#include "PrecompiledHeader.hpp"
+
+#include <Mountain/Utils/SkylinePacker.hpp>
+
+namespace
+{
+    bool Overlaps(const Vector2i aPosition, const Vector2i aSize, const Vector2i bPosition, const Vector2i bSize)
+    {
+        return aPosition.x < bPosition.x + bSize.x && bPosition.x < aPosition.x + aSize.x
+            && aPosition.y < bPosition.y + bSize.y && bPosition.y < aPosition.y + aSize.y;
+    }
+}
+
+TEST(Utils_SkylinePacker, Empty)
+{
+    const SkylinePacker packer{{64, 32}};
+    EXPECT_EQ(packer.GetSize(), Vector2i(64, 32));
+    EXPECT_EQ(packer.GetUsedArea(), 0);
+    EXPECT_EQ(packer.GetOccupancy(), 0.f);
+    EXPECT_TRUE(packer.CanInsert({64, 32}));
+    EXPECT_FALSE(packer.CanInsert({65, 32}));
+    EXPECT_FALSE(packer.CanInsert({64, 33}));
+}
+
+TEST(Utils_SkylinePacker, InsertBottomLeft)
+{
+    SkylinePacker packer{{64, 64}};
+
+    Optional<Vector2i> position = packer.Insert({32, 16});
+    ASSERT_TRUE(position.HasValue());
+    EXPECT_EQ(position.Value(), Vector2i(0, 0));
+
+    position = packer.Insert({32, 16});
+    ASSERT_TRUE(position.HasValue());
+    EXPECT_EQ(position.Value(), Vector2i(32, 0));
+
+    position = packer.Insert({64, 16});
+    ASSERT_TRUE(position.HasValue());
+    EXPECT_EQ(position.Value(), Vector2i(0, 16));
+
+    EXPECT_EQ(packer.GetUsedArea(), 64 * 32);
+    EXPECT_FLOAT_EQ(packer.GetOccupancy(), 0.5f);
+}
+
+TEST(Utils_SkylinePacker, InsertFull)
+{
+    SkylinePacker packer{{16, 16}};
+
+    EXPECT_TRUE(packer.Insert({16, 16}).HasValue());
+    EXPECT_FALSE(packer.Insert({1, 1}).HasValue());
+    EXPECT_FLOAT_EQ(packer.GetOccupancy(), 1.f);
+
+    packer.Reset();
+    EXPECT_EQ(packer.GetUsedArea(), 0);
+    EXPECT_TRUE(packer.Insert({1, 1}).HasValue());
+}
+
+TEST(Utils_SkylinePacker, InsertInvalid)
+{
+    SkylinePacker packer{{16, 16}};
+
+    EXPECT_FALSE(packer.Insert({0, 4}).HasValue());
+    EXPECT_FALSE(packer.Insert({4, -1}).HasValue());
+    EXPECT_EQ(packer.GetUsedArea(), 0);
+}
+
+TEST(Utils_SkylinePacker, NoOverlap)
+{
+    SkylinePacker packer{{256, 256}};
+    List<std::pair<Vector2i, Vector2i>> placed;
+
+    for (s32 i = 0; i < 500; i++)
+    {
+        const Vector2i size{1 + i * 7 % 31, 1 + i * 13 % 29};
+        const Optional<Vector2i> position = packer.Insert(size);
+        if (!position.HasValue())
+            continue;
+
+        const Vector2i topLeft = position.Value();
+        EXPECT_GE(topLeft.x, 0);
+        EXPECT_GE(topLeft.y, 0);
+        EXPECT_LE(topLeft.x + size.x, 256);
+        EXPECT_LE(topLeft.y + size.y, 256);
+
+        for (const auto& [otherPosition, otherSize] : placed)
+            EXPECT_FALSE(Overlaps(topLeft, size, otherPosition, otherSize));
+
+        placed.Emplace(topLeft, size);
+    }
+
+    EXPECT_FALSE(placed.IsEmpty());
+    EXPECT_GT(packer.GetOccupancy(), 0.5f);
+}
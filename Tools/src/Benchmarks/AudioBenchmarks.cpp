@@ -0,0 +1,156 @@
+#include "Benchmark.hpp"
+
+#include "Mountain/Globals.hpp"
+#include "Mountain/Audio/Audio.hpp"
+#include "Mountain/Audio/AudioKernels.hpp"
+#include "Mountain/Audio/AudioMixer.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Resource/AudioTrack.hpp"
+#include "Mountain/Utils/Random.hpp"
+#include "Mountain/Utils/Simd.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    constexpr usize FrameCount = 10'000'000;
+    constexpr u32 BlockFrameCount = AudioMixer::BufferFrameCount;
+    /// @brief The number of sounds mixed at once, which is about what a busy frame of a game can play.
+    constexpr u32 SoundCount = 256;
+    constexpr s32 TrackSampleRate = 44100;
+
+    constexpr std::string_view LevelNames[] = { "scalar", "SSE2", "AVX2" };
+
+    /// @brief Returns a 16-bit mono PCM Wavefront file of a short noise.
+    List<u8> MakeWavefront(const usize frameCount)
+    {
+        Random random{42};
+
+        List<u8> file;
+        const auto write = [&](const auto value) { file.AddRange(reinterpret_cast<const u8*>(&value), sizeof(value)); };
+
+        const s32 dataSize = static_cast<s32>(frameCount * sizeof(s16));
+
+        file.AddRange(reinterpret_cast<const u8*>("RIFF"), 4);
+        write(36 + dataSize);
+        file.AddRange(reinterpret_cast<const u8*>("WAVEfmt "), 8);
+        write(16);
+        write(static_cast<u16>(1));
+        write(static_cast<u16>(1));
+        write(TrackSampleRate);
+        write(TrackSampleRate * 2);
+        write(static_cast<u16>(2));
+        write(static_cast<u16>(16));
+        file.AddRange(reinterpret_cast<const u8*>("data"), 4);
+        write(dataSize);
+        for (usize i = 0; i < frameCount; i++)
+            write(random.Short());
+
+        return file;
+    }
+
+    /// @brief Plays @c SoundCount sounds of @p track with different pitches and pans.
+    void PlaySounds(const AudioTrack& track)
+    {
+        Random random{7};
+        for (u32 i = 0; i < SoundCount; i++)
+            AudioMixer::Play(track, nullptr, 1.f / SoundCount, random.Float(0.5f, 2.f), random.Float(-1.f, 1.f));
+    }
+
+    void RunKernelBenchmarks(const List<s16>& samples)
+    {
+        List<f32> input;
+        input.Resize(static_cast<usize>(BlockFrameCount) * 2, 0.001f);
+        List<f32> output;
+        output.Resize(input.GetSize());
+        List<s16> converted;
+        converted.Resize(output.GetSize());
+
+        // Resampling from 44.1 kHz to 48 kHz
+        const u64 step = AudioKernels::FractionOne * TrackSampleRate / 48000;
+
+        for (u8 level = 0; level <= static_cast<u8>(Simd::GetSupportedLevel()); level++)
+        {
+            Simd::SetLevel(static_cast<SimdLevel>(level));
+            const std::string_view levelName = LevelNames[level];
+
+            Measure(std::format("Resample mono frame, {}", levelName), FrameCount, [&](const usize frames)
+            {
+                u64 position = 0;
+                for (usize i = 0; i < frames; i += BlockFrameCount)
+                {
+                    if (AudioKernels::ResampleMix(samples.GetData(), samples.GetSize(), 1, position, step, 0.5f, 0.5f, output.GetData(), BlockFrameCount) < BlockFrameCount)
+                        position = 0;
+                }
+                KeepAlive(output);
+            });
+
+            Measure(std::format("Mix stereo frame, {}", levelName), FrameCount, [&](const usize frames)
+            {
+                for (usize i = 0; i < frames; i += BlockFrameCount)
+                    AudioKernels::Mix(input.GetData(), output.GetData(), output.GetSize(), 0.5f);
+                KeepAlive(output);
+            });
+
+            Measure(std::format("Convert stereo frame, {}", levelName), FrameCount, [&](const usize frames)
+            {
+                for (usize i = 0; i < frames; i += BlockFrameCount)
+                    AudioKernels::ConvertToS16(output.GetData(), converted.GetData(), output.GetSize());
+                KeepAlive(converted);
+            });
+        }
+
+        Simd::SetLevel(Simd::GetSupportedLevel());
+    }
+}
+
+void Benchmark::RunAudioBenchmarks()
+{
+    // Long enough for the sounds not to end while measuring
+    constexpr usize TrackFrameCount = 500'000;
+    const List<u8> file = MakeWavefront(TrackFrameCount);
+
+    // The samples start right after the 44 bytes of the header
+    List<s16> samples;
+    samples.AddRange(reinterpret_cast<const s16*>(file.GetData() + 44), TrackFrameCount);
+
+    RunKernelBenchmarks(samples);
+
+    AudioTrack track{"Benchmark"};
+    track.SetSourceData(file.GetData(), static_cast<s64>(file.GetSize()));
+
+    List<f32> output;
+    output.Resize(static_cast<usize>(BlockFrameCount) * 2);
+
+    AudioMixer::Initialize();
+
+    Measure(std::format("Render {} sounds, per output frame", SoundCount), FrameCount / 100, [&](const usize frames)
+    {
+        AudioMixer::StopAll();
+        PlaySounds(track);
+        for (usize i = 0; i < frames; i += BlockFrameCount)
+            AudioMixer::Render(output.GetData(), BlockFrameCount);
+        KeepAlive(output);
+    });
+
+    AudioMixer::Shutdown();
+
+    // Render the mixer output through OpenAL as well, without needing any audio hardware
+    LoopbackAudio = true;
+    if (!Audio::Initialize())
+    {
+        std::println("    Loopback audio isn't supported, skipping the OpenAL benchmarks");
+        return;
+    }
+
+    Measure(std::format("Render {} sounds through OpenAL, per output frame", SoundCount), FrameCount / 100, [&](const usize frames)
+    {
+        AudioMixer::StopAll();
+        PlaySounds(track);
+        for (usize i = 0; i < frames; i += BlockFrameCount)
+            Audio::RenderLoopback(output.GetData(), BlockFrameCount);
+        KeepAlive(output);
+    });
+
+    Audio::Shutdown();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <print>
+#include <string_view>
+
+#include "Mountain/Core.hpp"
+#include "Mountain/Utils/Stopwatch.hpp"
+
+namespace Benchmark
+{
+    /// @brief Calls @p function once to warm up, then once more while timing it, and prints the average time per iteration.
+    /// @param name The name printed next to the result.
+    /// @param iterations The number of iterations @p function must run, which is given to it as its only argument.
+    /// @param function The function to time, looping @p iterations times itself to avoid measuring the cost of the call.
+    /// @return The average time per iteration in nanoseconds.
+    template <typename FunctionT>
+    Mountain::f64 Measure(std::string_view name, Mountain::usize iterations, FunctionT&& function);
+
+    /// @brief Prevents the compiler from optimizing away the computation of @p value.
+    template <typename T>
+    void KeepAlive(const T& value);
+
+    /// @brief Prints whether @p condition holds, and makes the benchmarks exit with a failure if it doesn't.
+    /// @details This checks that a benchmark measures working code, e.g. when running it on another driver.
+    /// @return @p condition
+    bool Check(bool condition, std::string_view description);
+
+    /// @brief Returns whether a @c Check() failed.
+    bool HasFailedChecks();
+
+    void RunAudioBenchmarks();
+
+    void RunParticleBenchmarks();
+
+    void RunPointerBenchmarks();
+}
+
+// Start of Benchmark.inl
+
+namespace Benchmark
+{
+    namespace Detail
+    {
+        inline const void* volatile keepAliveSink = nullptr;
+
+        inline bool checkFailed = false;
+    }
+
+    template <typename FunctionT>
+    Mountain::f64 Measure(const std::string_view name, const Mountain::usize iterations, FunctionT&& function)
+    {
+        function(iterations / 10 + 1);
+
+        const Mountain::Stopwatch stopwatch = Mountain::Stopwatch::StartNew();
+        function(iterations);
+        const Mountain::f64 nanoseconds = stopwatch.GetElapsed().GetTotalNanoseconds() / static_cast<Mountain::f64>(iterations);
+
+        std::println("    {:<48}{:>10.2f} ns/op", name, nanoseconds);
+
+        return nanoseconds;
+    }
+
+    template <typename T>
+    void KeepAlive(const T& value)
+    {
+        Detail::keepAliveSink = &value;
+    }
+
+    inline bool Check(const bool condition, const std::string_view description)
+    {
+        std::println("    {:<48}{:>10}", description, condition ? "ok" : "FAILED");
+
+        if (!condition)
+            Detail::checkFailed = true;
+
+        return condition;
+    }
+
+    inline bool HasFailedChecks() { return Detail::checkFailed; }
+}
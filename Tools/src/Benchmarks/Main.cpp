@@ -0,0 +1,57 @@
+#include <iostream>
+#include <print>
+#include <string_view>
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    struct Group
+    {
+        std::string_view name;
+        void (*run)();
+    };
+
+    constexpr Group Groups[] = {
+        { "Audio", Benchmark::RunAudioBenchmarks },
+        { "Particles", Benchmark::RunParticleBenchmarks },
+        { "Pointer", Benchmark::RunPointerBenchmarks }
+    };
+}
+
+int main(const int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        std::println(std::cerr, "Usage: MountainBenchmarks [group]");
+        std::println(std::cerr, "Runs all the benchmarks, or only the ones of the given group");
+        return EXIT_FAILURE;
+    }
+
+    const std::string_view filter = argc == 2 ? argv[1] : std::string_view{};
+
+    bool found = false;
+    for (const Group& group : Groups)
+    {
+        if (!filter.empty() && group.name != filter)
+            continue;
+
+        std::println("{}", group.name);
+        group.run();
+        found = true;
+    }
+
+    if (!found)
+    {
+        std::println(std::cerr, "No benchmark group named {}", filter);
+        return EXIT_FAILURE;
+    }
+
+    if (Benchmark::HasFailedChecks())
+    {
+        std::println(std::cerr, "Some checks failed");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
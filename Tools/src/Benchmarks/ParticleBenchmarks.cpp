@@ -0,0 +1,266 @@
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <memory>
+
+#include "Mountain/Game.hpp"
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Graphics/Graphics.hpp"
+#include "Mountain/Graphics/ParticleSimulation.hpp"
+#include "Mountain/Graphics/ParticleSystem.hpp"
+#include "Mountain/Resource/ComputeShader.hpp"
+#include "Mountain/Resource/ResourceManager.hpp"
+#include "Mountain/Resource/Shader.hpp"
+#include "Mountain/Utils/Simd.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    constexpr usize ParticleUpdateCount = 100'000'000;
+    constexpr f32 DeltaTime = 1.f / 60.f;
+    constexpr f32 Lifetime = 1.f;
+    /// @brief The maximum number of particles of each system, which spawn as fast as they die.
+    constexpr u32 SystemParticleCount = 50'000;
+    constexpr u32 SystemCount = 16;
+
+    constexpr std::string_view LevelNames[] = { "scalar", "SSE2", "AVX2" };
+
+    /// @brief Only used to create the OpenGL context and start the job system. Its window is never shown.
+    class BenchmarkGame : public Game
+    {
+    public:
+        BenchmarkGame() : Game{"Mountain Benchmarks"} {}
+
+        void LoadResources() override {}
+        void Initialize() override {}
+        void Shutdown() override {}
+        void Update() override {}
+        void Render() override {}
+    };
+
+    /// @brief Calls @p frame enough times to reach the steady number of particles, then measures it and prints the number
+    /// of particles it updates per millisecond.
+    /// @param name The name printed next to the result.
+    /// @param frame The function updating one frame of the particles.
+    /// @param getParticleCount The function returning the number of particles updated by @p frame.
+    template <typename FrameT, typename GetParticleCountT>
+    void MeasureParticles(const std::string_view name, FrameT&& frame, GetParticleCountT&& getParticleCount)
+    {
+        for (u32 i = 0; i < static_cast<u32>(Lifetime / DeltaTime) + 1; i++)
+            frame();
+
+        const usize particlesPerFrame = std::max<usize>(getParticleCount(), 1);
+
+        const f64 nanoseconds = Benchmark::Measure(name, ParticleUpdateCount, [&](const usize particles)
+        {
+            for (usize i = 0; i < particles; i += particlesPerFrame)
+                frame();
+        });
+
+        std::println("    {:<48}{:>10.0f} particles/ms", "", 1e6 / nanoseconds);
+    }
+
+    void RunSimulationBenchmarks()
+    {
+        ParticleSystemModules::Shape shape;
+        ParticleSystemModules::VelocityOverLifetime velocityOverLifetime;
+        velocityOverLifetime.velocityMax = { 0.f, -5.f };
+        ParticleSystemModules::ForceOverLifetime forceOverLifetime;
+        forceOverLifetime.forceMax = { 5.f, 10.f };
+        forceOverLifetime.easingType = Easing::Type::SineIn;
+        ParticleSystemModules::ColorOverLifetime colorOverLifetime;
+        colorOverLifetime.colorMax = Color::Transparent();
+        ParticleSystemModules::ColorBySpeed colorBySpeed;
+        colorBySpeed.colorMin = Color::Red();
+        colorBySpeed.speedMax = 10.f;
+
+        ParticleSimulationSettings settings;
+        settings.lifetime = Lifetime;
+        settings.shape = &shape;
+        settings.velocityOverLifetime = &velocityOverLifetime;
+        settings.forceOverLifetime = &forceOverLifetime;
+        settings.colorOverLifetime = &colorOverLifetime;
+        settings.colorBySpeed = &colorBySpeed;
+
+        constexpr u32 SpawnCount = static_cast<u32>(SystemParticleCount * DeltaTime / Lifetime);
+
+        List<u8> gpuData;
+        gpuData.Resize(static_cast<usize>(SystemParticleCount) * ParticleSimulation::GpuParticleSize);
+
+        for (u8 level = 0; level <= static_cast<u8>(Simd::GetSupportedLevel()); level++)
+        {
+            Simd::SetLevel(static_cast<SimdLevel>(level));
+
+            ParticleSimulation simulation{ SystemParticleCount, 42 };
+
+            MeasureParticles(
+                std::format("Simulate particle, {}", LevelNames[level]),
+                [&]
+                {
+                    simulation.Update(DeltaTime, settings, SpawnCount);
+                    simulation.WriteGpuData(gpuData.GetData());
+                    Benchmark::KeepAlive(gpuData);
+                },
+                [&] { return simulation.GetParticleCount(); }
+            );
+        }
+
+        Simd::SetLevel(Simd::GetSupportedLevel());
+    }
+
+    /// @brief Runs a GPU system for @p frameCount frames and checks that no particle is lost or duplicated between the alive
+    /// and dead lists.
+    /// @return The total number of particles spawned.
+    u32 UpdateGpuSystem(ParticleSystem& system, const u32 frameCount, const std::string_view description)
+    {
+        bool conserved = true;
+        u32 spawned = 0;
+
+        for (u32 i = 0; i < frameCount; i++)
+        {
+            system.Update(DeltaTime);
+
+            const ParticleSystemGpuCounters counters = system.ReadGpuCounters();
+            conserved &= counters.aliveCount + counters.deadCount == system.GetMaxParticles();
+            spawned += counters.spawnCount;
+        }
+
+        Benchmark::Check(conserved, description);
+        return spawned;
+    }
+
+    /// @brief Checks the particle lists of the GPU backend, which the benchmark alone can't tell are wrong.
+    /// @details This reads the counters back after each update, so it is slow but works on any driver, e.g. on Mesa
+    /// llvmpipe with @c LIBGL_ALWAYS_SOFTWARE=1.
+    /// @brief Checks that every internal shader was compiled and linked when the Game was created, which only logs errors.
+    void CheckInternalShaders()
+    {
+        for (const Pointer<Shader>& shader : ResourceManager::FindAll<Shader>())
+            Benchmark::Check(shader->IsLoaded() && shader->GetId() != 0, std::format("Shader {} linked", shader->GetName()));
+
+        for (const Pointer<ComputeShader>& shader : ResourceManager::FindAll<ComputeShader>())
+            Benchmark::Check(shader->IsLoaded() && shader->GetId() != 0, std::format("Compute shader {} linked", shader->GetName()));
+    }
+
+    void CheckGpuBackend()
+    {
+        constexpr u32 MaxParticles = 1000;
+        constexpr f32 Rate = 300.f;
+        constexpr u32 FramesPerSecond = static_cast<u32>(1.f / DeltaTime + 0.5f);
+
+        {
+            ParticleSystem system{MaxParticles, ParticleSystemBackend::Gpu};
+            system.particleLifetime = Lifetime;
+            system.emissionRateOverTime = Rate;
+            system.AddModules(ParticleSystemModules::Types::All);
+            system.enabledModules = ParticleSystemModules::Types::All;
+
+            // The spawn timer only advances once per frame, so the count can be off by up to one frame of emission
+            const u32 spawned = UpdateGpuSystem(system, FramesPerSecond, "GPU alive + dead == max, emitting");
+            Benchmark::Check(std::abs(static_cast<f32>(spawned) - Rate) <= Rate * DeltaTime, "GPU spawn count over time");
+
+            // A particle is drawn for one more frame after it dies
+            UpdateGpuSystem(system, FramesPerSecond * 2, "GPU alive + dead == max, steady");
+            const u32 alive = system.GetCurrentParticles();
+            Benchmark::Check(alive >= Rate * Lifetime && alive <= Rate * (Lifetime + DeltaTime * 2.f), "GPU steady particle count");
+        }
+
+        {
+            ParticleSystem system{MaxParticles, ParticleSystemBackend::Gpu};
+            system.emissionRateOverTime = 0.f;
+            system.emissionBursts.Add({ .time = 0.f, .count = 30 });
+
+            system.Update(DeltaTime);
+            const ParticleSystemGpuCounters counters = system.ReadGpuCounters();
+            Benchmark::Check(counters.spawnCount == 30 && counters.aliveCount == 30, "GPU burst spawn count");
+        }
+
+        {
+            // More particles are emitted than there are free ones
+            ParticleSystem system{MaxParticles / 4, ParticleSystemBackend::Gpu};
+            system.particleLifetime = Lifetime * 2.f;
+            system.emissionRateOverTime = Rate * 100.f;
+
+            UpdateGpuSystem(system, FramesPerSecond, "GPU alive + dead == max, saturated");
+            Benchmark::Check(system.GetCurrentParticles() == system.GetMaxParticles(), "GPU saturated particle count");
+        }
+
+        {
+            ParticleSystem system{MaxParticles * 2, ParticleSystemBackend::Gpu};
+            system.looping = false;
+            system.duration = 1.f;
+            system.startDelay = 0.25f;
+            // Neither the duration nor the lifetime need to be a multiple of the frame time
+            system.particleLifetime = Lifetime * 1.37f;
+            system.emissionRateOverTime = Rate * 2.f;
+
+            // The system stops updating once it estimates that all its particles are dead, so none of them must be left to draw
+            u32 frames = 0;
+            while (system.GetPlaying() && frames < FramesPerSecond * 10)
+            {
+                system.Update(DeltaTime);
+                frames++;
+            }
+
+            const ParticleSystemGpuCounters counters = system.ReadGpuCounters();
+            Benchmark::Check(system.IsComplete(), "GPU completion estimate ends");
+            Benchmark::Check(counters.aliveCount == 0 && counters.deadCount == system.GetMaxParticles(), "GPU completion estimate");
+        }
+    }
+
+    /// @brief Measures @c SystemCount systems using @p backend, all updated at once with @c ParticleSystem::UpdateAll().
+    void RunSystemBenchmark(const std::string_view name, const ParticleSystemBackend backend)
+    {
+        // The systems own OpenGL buffers, so they must not be moved when the list grows
+        List<std::unique_ptr<ParticleSystem>> systems;
+        List<ParticleSystem*> systemPointers;
+        for (u32 i = 0; i < SystemCount; i++)
+        {
+            ParticleSystem& system = *systems.Emplace(std::make_unique<ParticleSystem>(SystemParticleCount, backend));
+            system.particleLifetime = Lifetime;
+            system.emissionRateOverTime = SystemParticleCount / Lifetime;
+            system.AddModules(ParticleSystemModules::Types::All);
+            system.enabledModules = ParticleSystemModules::Types::All;
+            systemPointers.Add(&system);
+        }
+
+        MeasureParticles(
+            name,
+            [&]
+            {
+                ParticleSystem::UpdateAll(systemPointers, DeltaTime);
+                // Wait for the compute shaders and the uploads of the CPU backend to finish as well
+                Graphics::Finish();
+            },
+            [&]
+            {
+                usize particles = 0;
+                for (ParticleSystem* system : systemPointers)
+                    particles += system->GetCurrentParticles();
+                return particles;
+            }
+        );
+    }
+}
+
+void Benchmark::RunParticleBenchmarks()
+{
+    RunSimulationBenchmarks();
+
+    // The particle systems need an OpenGL context, even for the CPU backend which uploads its particles every frame
+    BenchmarkGame game;
+
+    CheckInternalShaders();
+    CheckGpuBackend();
+
+    for (u8 level = 0; level <= static_cast<u8>(Simd::GetSupportedLevel()); level++)
+    {
+        Simd::SetLevel(static_cast<SimdLevel>(level));
+        RunSystemBenchmark(std::format("Update {} CPU systems, {}", SystemCount, LevelNames[level]), ParticleSystemBackend::Cpu);
+    }
+
+    Simd::SetLevel(Simd::GetSupportedLevel());
+
+    RunSystemBenchmark(std::format("Update {} GPU systems", SystemCount), ParticleSystemBackend::Gpu);
+}
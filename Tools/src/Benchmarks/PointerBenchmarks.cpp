@@ -0,0 +1,150 @@
+#include "Benchmark.hpp"
+
+#include <memory>
+#include <thread>
+
+#include "Mountain/Containers/List.hpp"
+#include "Mountain/Utils/Pointer.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    constexpr usize Iterations = 10'000'000;
+    constexpr u32 ThreadCount = 4;
+
+    struct Payload
+    {
+        u64 value = 0;
+    };
+
+    /// @brief Runs @p function on @c ThreadCount threads at once, each doing a share of the iterations.
+    template <typename FunctionT>
+    void RunOnThreads(const usize iterations, const FunctionT& function)
+    {
+        List<std::thread> threads;
+        for (u32 i = 0; i < ThreadCount; i++)
+            threads.Emplace([&] { function(iterations / ThreadCount); });
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
+
+void Benchmark::RunPointerBenchmarks()
+{
+    const Pointer<Payload> strong = Pointer<Payload>::New();
+    const Pointer<Payload> weak = strong;
+    const std::shared_ptr<Payload> shared = std::make_shared<Payload>();
+    const std::weak_ptr<Payload> sharedWeak = shared;
+
+    Measure("New and destroy", Iterations, [](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const Pointer<Payload> pointer = Pointer<Payload>::New();
+            KeepAlive(pointer);
+        }
+    });
+
+    Measure("Copy and destroy strong", Iterations, [&](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const Pointer<Payload> copy = strong.CreateStrongReference();
+            KeepAlive(copy);
+        }
+    });
+
+    Measure("Copy and destroy weak", Iterations, [&](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const Pointer<Payload> copy = weak;  // NOLINT(performance-unnecessary-copy-initialization)
+            KeepAlive(copy);
+        }
+    });
+
+    Measure("Move strong", Iterations, [&](const usize iterations)
+    {
+        Pointer<Payload> a = strong.CreateStrongReference();
+        Pointer<Payload> b;
+        for (usize i = 0; i < iterations; i++)
+        {
+            b = std::move(a);
+            a = std::move(b);
+            KeepAlive(a);
+        }
+    });
+
+    Measure("Move weak", Iterations, [&](const usize iterations)
+    {
+        Pointer<Payload> a = weak;
+        Pointer<Payload> b;
+        for (usize i = 0; i < iterations; i++)
+        {
+            b = std::move(a);
+            a = std::move(b);
+            KeepAlive(a);
+        }
+    });
+
+    Measure("Validate weak", Iterations, [&](const usize iterations)
+    {
+        bool valid = true;
+        for (usize i = 0; i < iterations; i++)
+            valid &= weak.IsValid();
+        KeepAlive(valid);
+    });
+
+    Measure("Copy and destroy strong, 4 threads", Iterations, [&](const usize iterations)
+    {
+        RunOnThreads(iterations, [&](const usize threadIterations)
+        {
+            for (usize i = 0; i < threadIterations; i++)
+            {
+                const Pointer<Payload> copy = strong.CreateStrongReference();
+                KeepAlive(copy);
+            }
+        });
+    });
+
+    Measure("Copy and destroy weak, 4 threads", Iterations, [&](const usize iterations)
+    {
+        RunOnThreads(iterations, [&](const usize threadIterations)
+        {
+            for (usize i = 0; i < threadIterations; i++)
+            {
+                const Pointer<Payload> copy = weak;  // NOLINT(performance-unnecessary-copy-initialization)
+                KeepAlive(copy);
+            }
+        });
+    });
+
+    Measure("std::make_shared and destroy", Iterations, [](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const std::shared_ptr<Payload> pointer = std::make_shared<Payload>();
+            KeepAlive(pointer);
+        }
+    });
+
+    Measure("Copy and destroy std::shared_ptr", Iterations, [&](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const std::shared_ptr<Payload> copy = shared;  // NOLINT(performance-unnecessary-copy-initialization)
+            KeepAlive(copy);
+        }
+    });
+
+    Measure("Copy and destroy std::weak_ptr", Iterations, [&](const usize iterations)
+    {
+        for (usize i = 0; i < iterations; i++)
+        {
+            const std::weak_ptr<Payload> copy = sharedWeak;  // NOLINT(performance-unnecessary-copy-initialization)
+            KeepAlive(copy);
+        }
+    });
+}
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <print>
+
+#include "Mountain/FileSystem/Archive.hpp"
+#include "Mountain/Utils/Logger.hpp"
+
+using namespace Mountain;
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::println(std::cerr, "Usage: MountainPacker <input directory> <output archive> [--no-compression]");
+        std::println(std::cerr, "Packs all the files of the input directory in a single archive that can be mounted with FileManager::MountArchive()");
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    if (argc < 3 || argc > 4)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path inputDirectory = argv[1];
+    const std::filesystem::path outputPath = argv[2];
+    bool compress = true;
+
+    if (argc == 4)
+    {
+        if (std::string_view{argv[3]} != "--no-compression")
+        {
+            PrintUsage();
+            return EXIT_FAILURE;
+        }
+
+        compress = false;
+    }
+
+    if (!is_directory(inputDirectory))
+    {
+        std::println(std::cerr, "{} isn't a directory", inputDirectory.string());
+        return EXIT_FAILURE;
+    }
+
+    List<Archive::SourceEntry> entries;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(inputDirectory))
+    {
+        if (!entry.is_regular_file())
+            continue;
+
+        // Entry paths are stored relative to the input directory, with forward slashes on all platforms
+        entries.Add(
+            {
+                .path = entry.path().lexically_relative(inputDirectory).generic_string(),
+                .sourcePath = entry.path()
+            }
+        );
+    }
+
+    // Sort the entries to make the output deterministic, since the directory iteration order is unspecified
+    entries.Sort([](const Archive::SourceEntry& lhs, const Archive::SourceEntry& rhs) { return lhs.path < rhs.path; });
+
+    Logger::Start();
+
+    const bool success = Archive::Write(outputPath, entries, compress);
+
+    Logger::Stop();
+
+    if (!success)
+        return EXIT_FAILURE;
+
+    std::println(std::cout, "Packed {} files in {} ({} bytes)", entries.GetSize(), outputPath.string(), file_size(outputPath));
+
+    return EXIT_SUCCESS;
+}